@@ -15,6 +15,8 @@ namespace LibFlatArray {}
 #pragma warning( disable : 4514 4710 )
 #endif
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <list>
 #include <sstream>
@@ -2461,6 +2463,144 @@ public:
     }
 };
 
+class ReactionKernel : public cpu_benchmark
+{
+public:
+    std::string family()
+    {
+        return "ReactionKernel";
+    }
+
+    std::string unit()
+    {
+        return "GLUPS";
+    }
+
+protected:
+    // Arrhenius-type rate law plus a constant source term, clamped
+    // to valid concentrations. Exercises exp(), fma(), min()/max()
+    // and hsum(), which is also what LBM collision kernels need.
+    static double prefactor()
+    {
+        return 1.0e3;
+    }
+
+    static double activation()
+    {
+        return 2.0e3;
+    }
+
+    static double source()
+    {
+        return 0.05;
+    }
+
+    static void init(std::size_t n, double *temperature, double *concentration)
+    {
+        for (std::size_t i = 0; i < n; ++i) {
+            temperature[i] = 300.0 + double(i % 97);
+            concentration[i] = 0.5 + 0.001 * double(i % 13);
+        }
+    }
+
+    static double glups(std::size_t n, int repeats, double seconds)
+    {
+        return 1.0e-9 * double(n) * repeats / seconds;
+    }
+};
+
+class ReactionKernelVanilla : public ReactionKernel
+{
+public:
+    std::string species()
+    {
+        return "vanilla";
+    }
+
+    double performance(std::vector<int> dim)
+    {
+        std::size_t n = std::size_t(dim[0]);
+        int repeats = dim[1];
+
+        std::vector<double> temperature(n);
+        std::vector<double> concentration(n);
+        init(n, &temperature[0], &concentration[0]);
+        double total = 0;
+
+        double tStart = time();
+
+        for (int t = 0; t < repeats; ++t) {
+            for (std::size_t i = 0; i < n; ++i) {
+                double rate = prefactor() * std::exp(-activation() / temperature[i]);
+                double c = concentration[i] * (1.0 - DELTA_T * rate) + DELTA_T * source();
+                c = (std::min)((std::max)(c, 0.0), 1.0);
+                concentration[i] = c;
+                total += c;
+            }
+        }
+
+        double tEnd = time();
+
+        if (total == 4711) {
+            std::cout << "this is really only here to prevent the compiler from optimizing away any code: " << total << "\n";
+        }
+
+        return glups(n, repeats, tEnd - tStart);
+    }
+};
+
+class ReactionKernelGold : public ReactionKernel
+{
+public:
+    std::string species()
+    {
+        return "gold";
+    }
+
+    double performance(std::vector<int> dim)
+    {
+        typedef short_vec<double, 8> Double;
+
+        std::size_t n = std::size_t(dim[0]);
+        int repeats = dim[1];
+
+        std::vector<double, aligned_allocator<double, 64> > temperature(n);
+        std::vector<double, aligned_allocator<double, 64> > concentration(n);
+        init(n, &temperature[0], &concentration[0]);
+        double total = 0;
+
+        Double one = 1.0;
+        Double zero = 0.0;
+        Double deltaT = DELTA_T;
+        Double minusActivation = -activation();
+        Double scaledSource = DELTA_T * source();
+
+        double tStart = time();
+
+        for (int t = 0; t < repeats; ++t) {
+            Double sum = 0.0;
+
+            for (std::size_t i = 0; i < n; i += Double::ARITY) {
+                Double rate = prefactor() * exp(minusActivation / Double(&temperature[i]));
+                Double c = fma(Double(&concentration[i]), one - deltaT * rate, scaledSource);
+                c = min(max(c, zero), one);
+                &concentration[i] << c;
+                sum += c;
+            }
+
+            total += hsum(sum);
+        }
+
+        double tEnd = time();
+
+        if (total == 4711) {
+            std::cout << "this is really only here to prevent the compiler from optimizing away any code: " << total << "\n";
+        }
+
+        return glups(n, repeats, tEnd - tStart);
+    }
+};
+
 int main(int argc, char **argv)
 {
     if ((argc < 3) || (argc > 4)) {
@@ -2629,6 +2769,28 @@ int main(int argc, char **argv)
         eval(ConditionalAnyGold(), *i);
     }
 
+    sizes.clear();
+    for (int n = 1 << 12; n <= (1 << 22); n *= 4) {
+        if (quickMode && (n != (1 << 20))) {
+            continue;
+        }
+
+        std::vector<int> dim(3);
+        dim[0] = n;
+        dim[1] = (1 << 26) / n;
+        dim[2] = 0;
+
+        sizes.push_back(dim);
+    }
+
+    for (std::vector<std::vector<int> >::iterator i = sizes.begin(); i != sizes.end(); ++i) {
+        eval(ReactionKernelVanilla(), *i);
+    }
+
+    for (std::vector<std::vector<int> >::iterator i = sizes.begin(); i != sizes.end(); ++i) {
+        eval(ReactionKernelGold(), *i);
+    }
+
     return 0;
 }
 
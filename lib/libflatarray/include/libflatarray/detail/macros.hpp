@@ -56,6 +56,15 @@
                 1,                                                      \
                 LIBFLATARRAY_ARRAY_ARITY(MEMBER));                      \
                                                                         \
+        /* element size and arity of the member ending at OFFSET */     \
+        static const std::size_t ELEMENT_SIZE =                         \
+            sizeof(LIBFLATARRAY_ELEM(0, MEMBER));                       \
+        static const std::size_t ARITY =                                \
+            LIBFLATARRAY_ARRAY_CONDITIONAL(                             \
+                MEMBER,                                                 \
+                1,                                                      \
+                LIBFLATARRAY_ARRAY_ARITY(MEMBER));                      \
+                                                                        \
         template<typename MEMBER_TYPE>                                  \
         inline                                                          \
         int operator()(MEMBER_TYPE CELL_TYPE:: *member_ptr)             \
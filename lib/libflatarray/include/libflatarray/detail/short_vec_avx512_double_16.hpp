@@ -30,6 +30,7 @@
 
 #include <libflatarray/detail/sqrt_reference.hpp>
 #include <libflatarray/detail/short_vec_helpers.hpp>
+#include <libflatarray/detail/short_vec_math.hpp>
 #include <libflatarray/config.h>
 #include <libflatarray/short_vec_base.hpp>
 
@@ -233,6 +234,67 @@ public:
             _mm512_sqrt_pd(val[ 1]));
     }
 
+    inline
+    short_vec<double, 16> min(const short_vec<double, 16>& other) const
+    {
+        return short_vec<double, 16>(
+            _mm512_min_pd(val[ 0], other.val[ 0]),
+            _mm512_min_pd(val[ 1], other.val[ 1]));
+    }
+
+    inline
+    short_vec<double, 16> max(const short_vec<double, 16>& other) const
+    {
+        return short_vec<double, 16>(
+            _mm512_max_pd(val[ 0], other.val[ 0]),
+            _mm512_max_pd(val[ 1], other.val[ 1]));
+    }
+
+    inline
+    short_vec<double, 16> fma(const short_vec<double, 16>& factor, const short_vec<double, 16>& summand) const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 8> ops;
+        return short_vec<double, 16>(
+            ops::fma(val[ 0], factor.val[ 0], summand.val[ 0]),
+            ops::fma(val[ 1], factor.val[ 1], summand.val[ 1]));
+    }
+
+    inline
+    short_vec<double, 16> exp() const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 8> ops;
+        return short_vec<double, 16>(
+            ShortVecHelpers::exp<ops>(val[ 0]),
+            ShortVecHelpers::exp<ops>(val[ 1]));
+    }
+
+    inline
+    short_vec<double, 16> log() const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 8> ops;
+        return short_vec<double, 16>(
+            ShortVecHelpers::log<ops>(val[ 0]),
+            ShortVecHelpers::log<ops>(val[ 1]));
+    }
+
+    inline
+    double hsum() const
+    {
+        return ShortVecHelpers::hsum<ShortVecHelpers::simd_ops<double, 8> >(val);
+    }
+
+    inline
+    double hmin() const
+    {
+        return ShortVecHelpers::hmin<ShortVecHelpers::simd_ops<double, 8> >(val);
+    }
+
+    inline
+    double hmax() const
+    {
+        return ShortVecHelpers::hmax<ShortVecHelpers::simd_ops<double, 8> >(val);
+    }
+
     inline
     void load(const double *data)
     {
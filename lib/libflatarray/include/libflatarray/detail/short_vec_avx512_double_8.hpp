@@ -13,6 +13,7 @@
 
 #include <libflatarray/detail/sqrt_reference.hpp>
 #include <libflatarray/detail/short_vec_helpers.hpp>
+#include <libflatarray/detail/short_vec_math.hpp>
 #include <libflatarray/config.h>
 #include <libflatarray/short_vec_base.hpp>
 
@@ -211,6 +212,62 @@ public:
             _mm512_sqrt_pd(val));
     }
 
+    inline
+    short_vec<double, 8> min(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm512_min_pd(val, other.val));
+    }
+
+    inline
+    short_vec<double, 8> max(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm512_max_pd(val, other.val));
+    }
+
+    inline
+    short_vec<double, 8> fma(const short_vec<double, 8>& factor, const short_vec<double, 8>& summand) const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 8> ops;
+        return short_vec<double, 8>(
+            ops::fma(val, factor.val, summand.val));
+    }
+
+    inline
+    short_vec<double, 8> exp() const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 8> ops;
+        return short_vec<double, 8>(
+            ShortVecHelpers::exp<ops>(val));
+    }
+
+    inline
+    short_vec<double, 8> log() const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 8> ops;
+        return short_vec<double, 8>(
+            ShortVecHelpers::log<ops>(val));
+    }
+
+    inline
+    double hsum() const
+    {
+        return ShortVecHelpers::simd_ops<double, 8>::hsum(val);
+    }
+
+    inline
+    double hmin() const
+    {
+        return ShortVecHelpers::simd_ops<double, 8>::hmin(val);
+    }
+
+    inline
+    double hmax() const
+    {
+        return ShortVecHelpers::simd_ops<double, 8>::hmax(val);
+    }
+
     inline
     void load(const double *data)
     {
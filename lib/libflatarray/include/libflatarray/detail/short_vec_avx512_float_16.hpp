@@ -13,6 +13,7 @@
 
 #include <libflatarray/detail/sqrt_reference.hpp>
 #include <libflatarray/detail/short_vec_helpers.hpp>
+#include <libflatarray/detail/short_vec_math.hpp>
 #include <libflatarray/short_vec_base.hpp>
 #include <libflatarray/config.h>
 
@@ -228,6 +229,62 @@ public:
             _mm512_sqrt_ps(val));
     }
 
+    inline
+    short_vec<float, 16> min(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            _mm512_min_ps(val, other.val));
+    }
+
+    inline
+    short_vec<float, 16> max(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            _mm512_max_ps(val, other.val));
+    }
+
+    inline
+    short_vec<float, 16> fma(const short_vec<float, 16>& factor, const short_vec<float, 16>& summand) const
+    {
+        typedef ShortVecHelpers::simd_ops<float, 16> ops;
+        return short_vec<float, 16>(
+            ops::fma(val, factor.val, summand.val));
+    }
+
+    inline
+    short_vec<float, 16> exp() const
+    {
+        typedef ShortVecHelpers::simd_ops<float, 16> ops;
+        return short_vec<float, 16>(
+            ShortVecHelpers::exp<ops>(val));
+    }
+
+    inline
+    short_vec<float, 16> log() const
+    {
+        typedef ShortVecHelpers::simd_ops<float, 16> ops;
+        return short_vec<float, 16>(
+            ShortVecHelpers::log<ops>(val));
+    }
+
+    inline
+    float hsum() const
+    {
+        return ShortVecHelpers::simd_ops<float, 16>::hsum(val);
+    }
+
+    inline
+    float hmin() const
+    {
+        return ShortVecHelpers::simd_ops<float, 16>::hmin(val);
+    }
+
+    inline
+    float hmax() const
+    {
+        return ShortVecHelpers::simd_ops<float, 16>::hmax(val);
+    }
+
     inline
     void load(const float *data)
     {
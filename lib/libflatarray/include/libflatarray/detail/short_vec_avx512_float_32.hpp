@@ -14,6 +14,7 @@
 
 #include <libflatarray/detail/sqrt_reference.hpp>
 #include <libflatarray/detail/short_vec_helpers.hpp>
+#include <libflatarray/detail/short_vec_math.hpp>
 #include <libflatarray/short_vec_base.hpp>
 #include <libflatarray/config.h>
 
@@ -249,6 +250,67 @@ public:
             _mm512_sqrt_ps(val[ 1]));
     }
 
+    inline
+    short_vec<float, 32> min(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            _mm512_min_ps(val[ 0], other.val[ 0]),
+            _mm512_min_ps(val[ 1], other.val[ 1]));
+    }
+
+    inline
+    short_vec<float, 32> max(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            _mm512_max_ps(val[ 0], other.val[ 0]),
+            _mm512_max_ps(val[ 1], other.val[ 1]));
+    }
+
+    inline
+    short_vec<float, 32> fma(const short_vec<float, 32>& factor, const short_vec<float, 32>& summand) const
+    {
+        typedef ShortVecHelpers::simd_ops<float, 16> ops;
+        return short_vec<float, 32>(
+            ops::fma(val[ 0], factor.val[ 0], summand.val[ 0]),
+            ops::fma(val[ 1], factor.val[ 1], summand.val[ 1]));
+    }
+
+    inline
+    short_vec<float, 32> exp() const
+    {
+        typedef ShortVecHelpers::simd_ops<float, 16> ops;
+        return short_vec<float, 32>(
+            ShortVecHelpers::exp<ops>(val[ 0]),
+            ShortVecHelpers::exp<ops>(val[ 1]));
+    }
+
+    inline
+    short_vec<float, 32> log() const
+    {
+        typedef ShortVecHelpers::simd_ops<float, 16> ops;
+        return short_vec<float, 32>(
+            ShortVecHelpers::log<ops>(val[ 0]),
+            ShortVecHelpers::log<ops>(val[ 1]));
+    }
+
+    inline
+    float hsum() const
+    {
+        return ShortVecHelpers::hsum<ShortVecHelpers::simd_ops<float, 16> >(val);
+    }
+
+    inline
+    float hmin() const
+    {
+        return ShortVecHelpers::hmin<ShortVecHelpers::simd_ops<float, 16> >(val);
+    }
+
+    inline
+    float hmax() const
+    {
+        return ShortVecHelpers::hmax<ShortVecHelpers::simd_ops<float, 16> >(val);
+    }
+
     inline
     void load(const float *data)
     {
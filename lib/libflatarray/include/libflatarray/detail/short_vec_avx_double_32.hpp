@@ -29,6 +29,7 @@
 
 #include <libflatarray/detail/sqrt_reference.hpp>
 #include <libflatarray/detail/short_vec_helpers.hpp>
+#include <libflatarray/detail/short_vec_math.hpp>
 #include <libflatarray/config.h>
 #include <libflatarray/short_vec_base.hpp>
 
@@ -333,6 +334,97 @@ public:
             _mm256_sqrt_pd(val[ 7]));
     }
 
+    inline
+    short_vec<double, 32> min(const short_vec<double, 32>& other) const
+    {
+        return short_vec<double, 32>(
+            _mm256_min_pd(val[ 0], other.val[ 0]),
+            _mm256_min_pd(val[ 1], other.val[ 1]),
+            _mm256_min_pd(val[ 2], other.val[ 2]),
+            _mm256_min_pd(val[ 3], other.val[ 3]),
+            _mm256_min_pd(val[ 4], other.val[ 4]),
+            _mm256_min_pd(val[ 5], other.val[ 5]),
+            _mm256_min_pd(val[ 6], other.val[ 6]),
+            _mm256_min_pd(val[ 7], other.val[ 7]));
+    }
+
+    inline
+    short_vec<double, 32> max(const short_vec<double, 32>& other) const
+    {
+        return short_vec<double, 32>(
+            _mm256_max_pd(val[ 0], other.val[ 0]),
+            _mm256_max_pd(val[ 1], other.val[ 1]),
+            _mm256_max_pd(val[ 2], other.val[ 2]),
+            _mm256_max_pd(val[ 3], other.val[ 3]),
+            _mm256_max_pd(val[ 4], other.val[ 4]),
+            _mm256_max_pd(val[ 5], other.val[ 5]),
+            _mm256_max_pd(val[ 6], other.val[ 6]),
+            _mm256_max_pd(val[ 7], other.val[ 7]));
+    }
+
+    inline
+    short_vec<double, 32> fma(const short_vec<double, 32>& factor, const short_vec<double, 32>& summand) const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 4> ops;
+        return short_vec<double, 32>(
+            ops::fma(val[ 0], factor.val[ 0], summand.val[ 0]),
+            ops::fma(val[ 1], factor.val[ 1], summand.val[ 1]),
+            ops::fma(val[ 2], factor.val[ 2], summand.val[ 2]),
+            ops::fma(val[ 3], factor.val[ 3], summand.val[ 3]),
+            ops::fma(val[ 4], factor.val[ 4], summand.val[ 4]),
+            ops::fma(val[ 5], factor.val[ 5], summand.val[ 5]),
+            ops::fma(val[ 6], factor.val[ 6], summand.val[ 6]),
+            ops::fma(val[ 7], factor.val[ 7], summand.val[ 7]));
+    }
+
+    inline
+    short_vec<double, 32> exp() const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 4> ops;
+        return short_vec<double, 32>(
+            ShortVecHelpers::exp<ops>(val[ 0]),
+            ShortVecHelpers::exp<ops>(val[ 1]),
+            ShortVecHelpers::exp<ops>(val[ 2]),
+            ShortVecHelpers::exp<ops>(val[ 3]),
+            ShortVecHelpers::exp<ops>(val[ 4]),
+            ShortVecHelpers::exp<ops>(val[ 5]),
+            ShortVecHelpers::exp<ops>(val[ 6]),
+            ShortVecHelpers::exp<ops>(val[ 7]));
+    }
+
+    inline
+    short_vec<double, 32> log() const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 4> ops;
+        return short_vec<double, 32>(
+            ShortVecHelpers::log<ops>(val[ 0]),
+            ShortVecHelpers::log<ops>(val[ 1]),
+            ShortVecHelpers::log<ops>(val[ 2]),
+            ShortVecHelpers::log<ops>(val[ 3]),
+            ShortVecHelpers::log<ops>(val[ 4]),
+            ShortVecHelpers::log<ops>(val[ 5]),
+            ShortVecHelpers::log<ops>(val[ 6]),
+            ShortVecHelpers::log<ops>(val[ 7]));
+    }
+
+    inline
+    double hsum() const
+    {
+        return ShortVecHelpers::hsum<ShortVecHelpers::simd_ops<double, 4> >(val);
+    }
+
+    inline
+    double hmin() const
+    {
+        return ShortVecHelpers::hmin<ShortVecHelpers::simd_ops<double, 4> >(val);
+    }
+
+    inline
+    double hmax() const
+    {
+        return ShortVecHelpers::hmax<ShortVecHelpers::simd_ops<double, 4> >(val);
+    }
+
     inline
     void load(const double *data)
     {
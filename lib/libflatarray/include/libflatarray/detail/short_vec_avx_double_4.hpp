@@ -15,6 +15,7 @@
 
 #include <libflatarray/detail/sqrt_reference.hpp>
 #include <libflatarray/detail/short_vec_helpers.hpp>
+#include <libflatarray/detail/short_vec_math.hpp>
 #include <libflatarray/config.h>
 #include <libflatarray/short_vec_base.hpp>
 
@@ -204,6 +205,62 @@ public:
             _mm256_sqrt_pd(val));
     }
 
+    inline
+    short_vec<double, 4> min(const short_vec<double, 4>& other) const
+    {
+        return short_vec<double, 4>(
+            _mm256_min_pd(val, other.val));
+    }
+
+    inline
+    short_vec<double, 4> max(const short_vec<double, 4>& other) const
+    {
+        return short_vec<double, 4>(
+            _mm256_max_pd(val, other.val));
+    }
+
+    inline
+    short_vec<double, 4> fma(const short_vec<double, 4>& factor, const short_vec<double, 4>& summand) const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 4> ops;
+        return short_vec<double, 4>(
+            ops::fma(val, factor.val, summand.val));
+    }
+
+    inline
+    short_vec<double, 4> exp() const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 4> ops;
+        return short_vec<double, 4>(
+            ShortVecHelpers::exp<ops>(val));
+    }
+
+    inline
+    short_vec<double, 4> log() const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 4> ops;
+        return short_vec<double, 4>(
+            ShortVecHelpers::log<ops>(val));
+    }
+
+    inline
+    double hsum() const
+    {
+        return ShortVecHelpers::simd_ops<double, 4>::hsum(val);
+    }
+
+    inline
+    double hmin() const
+    {
+        return ShortVecHelpers::simd_ops<double, 4>::hmin(val);
+    }
+
+    inline
+    double hmax() const
+    {
+        return ShortVecHelpers::simd_ops<double, 4>::hmax(val);
+    }
+
     inline
     void load(const double *data)
     {
@@ -13,6 +13,7 @@
 
 #include <libflatarray/detail/sqrt_reference.hpp>
 #include <libflatarray/detail/short_vec_helpers.hpp>
+#include <libflatarray/detail/short_vec_math.hpp>
 #include <libflatarray/config.h>
 #include <libflatarray/short_vec_base.hpp>
 
@@ -225,6 +226,67 @@ public:
             _mm256_sqrt_pd(val[ 1]));
     }
 
+    inline
+    short_vec<double, 8> min(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm256_min_pd(val[ 0], other.val[ 0]),
+            _mm256_min_pd(val[ 1], other.val[ 1]));
+    }
+
+    inline
+    short_vec<double, 8> max(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            _mm256_max_pd(val[ 0], other.val[ 0]),
+            _mm256_max_pd(val[ 1], other.val[ 1]));
+    }
+
+    inline
+    short_vec<double, 8> fma(const short_vec<double, 8>& factor, const short_vec<double, 8>& summand) const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 4> ops;
+        return short_vec<double, 8>(
+            ops::fma(val[ 0], factor.val[ 0], summand.val[ 0]),
+            ops::fma(val[ 1], factor.val[ 1], summand.val[ 1]));
+    }
+
+    inline
+    short_vec<double, 8> exp() const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 4> ops;
+        return short_vec<double, 8>(
+            ShortVecHelpers::exp<ops>(val[ 0]),
+            ShortVecHelpers::exp<ops>(val[ 1]));
+    }
+
+    inline
+    short_vec<double, 8> log() const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 4> ops;
+        return short_vec<double, 8>(
+            ShortVecHelpers::log<ops>(val[ 0]),
+            ShortVecHelpers::log<ops>(val[ 1]));
+    }
+
+    inline
+    double hsum() const
+    {
+        return ShortVecHelpers::hsum<ShortVecHelpers::simd_ops<double, 4> >(val);
+    }
+
+    inline
+    double hmin() const
+    {
+        return ShortVecHelpers::hmin<ShortVecHelpers::simd_ops<double, 4> >(val);
+    }
+
+    inline
+    double hmax() const
+    {
+        return ShortVecHelpers::hmax<ShortVecHelpers::simd_ops<double, 4> >(val);
+    }
+
     inline
     void load(const double *data)
     {
@@ -15,6 +15,7 @@
 
 #include <libflatarray/detail/sqrt_reference.hpp>
 #include <libflatarray/detail/short_vec_helpers.hpp>
+#include <libflatarray/detail/short_vec_math.hpp>
 #include <libflatarray/config.h>
 #include <libflatarray/short_vec_base.hpp>
 
@@ -217,6 +218,62 @@ public:
         return _mm256_sqrt_ps(val);
     }
 
+    inline
+    short_vec<float, 8> min(const short_vec<float, 8>& other) const
+    {
+        return short_vec<float, 8>(
+            _mm256_min_ps(val, other.val));
+    }
+
+    inline
+    short_vec<float, 8> max(const short_vec<float, 8>& other) const
+    {
+        return short_vec<float, 8>(
+            _mm256_max_ps(val, other.val));
+    }
+
+    inline
+    short_vec<float, 8> fma(const short_vec<float, 8>& factor, const short_vec<float, 8>& summand) const
+    {
+        typedef ShortVecHelpers::simd_ops<float, 8> ops;
+        return short_vec<float, 8>(
+            ops::fma(val, factor.val, summand.val));
+    }
+
+    inline
+    short_vec<float, 8> exp() const
+    {
+        typedef ShortVecHelpers::simd_ops<float, 8> ops;
+        return short_vec<float, 8>(
+            ShortVecHelpers::exp<ops>(val));
+    }
+
+    inline
+    short_vec<float, 8> log() const
+    {
+        typedef ShortVecHelpers::simd_ops<float, 8> ops;
+        return short_vec<float, 8>(
+            ShortVecHelpers::log<ops>(val));
+    }
+
+    inline
+    float hsum() const
+    {
+        return ShortVecHelpers::simd_ops<float, 8>::hsum(val);
+    }
+
+    inline
+    float hmin() const
+    {
+        return ShortVecHelpers::simd_ops<float, 8>::hmin(val);
+    }
+
+    inline
+    float hmax() const
+    {
+        return ShortVecHelpers::simd_ops<float, 8>::hmax(val);
+    }
+
     inline
     void load(const float *data)
     {
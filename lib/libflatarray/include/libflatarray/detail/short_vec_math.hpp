@@ -0,0 +1,1185 @@
+/**
+ * Copyright 2018 Google
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef FLAT_ARRAY_DETAIL_SHORT_VEC_MATH_HPP
+#define FLAT_ARRAY_DETAIL_SHORT_VEC_MATH_HPP
+
+#include <libflatarray/config.h>
+
+// disable certain warnings from system headers when compiling with
+// Microsoft Visual Studio:
+#ifdef _MSC_BUILD
+#pragma warning( push )
+#pragma warning( disable : 4514 )
+#endif
+
+#if (LIBFLATARRAY_WIDEST_VECTOR_ISA == LIBFLATARRAY_SSE) ||             \
+    (LIBFLATARRAY_WIDEST_VECTOR_ISA == LIBFLATARRAY_SSE2) ||            \
+    (LIBFLATARRAY_WIDEST_VECTOR_ISA == LIBFLATARRAY_SSE4_1)
+#include <emmintrin.h>
+#ifdef __SSE4_1__
+#include <smmintrin.h>
+#endif
+#endif
+
+#if (LIBFLATARRAY_WIDEST_VECTOR_ISA == LIBFLATARRAY_AVX) ||             \
+    (LIBFLATARRAY_WIDEST_VECTOR_ISA == LIBFLATARRAY_AVX2) ||            \
+    (LIBFLATARRAY_WIDEST_VECTOR_ISA == LIBFLATARRAY_AVX512F)
+#include <immintrin.h>
+#endif
+
+#ifdef _MSC_BUILD
+#pragma warning( pop )
+#endif
+
+namespace LibFlatArray {
+
+namespace ShortVecHelpers {
+
+/**
+ * Wraps the primitive operations on a single SIMD register which
+ * are required by the vectorized math functions below (exp(),
+ * log(), horizontal reductions). Specialized for all x86 register
+ * types. We key these by CARGO and WIDTH as GCC would drop the
+ * attributes of the intrinsic types if used as template arguments.
+ *
+ * Comparisons are hidden in select_*() as AVX-512 yields bit masks
+ * instead of registers. min() and max() return their second
+ * argument if either is NaN, just like the underlying instructions.
+ */
+template<typename CARGO, int WIDTH>
+class simd_ops;
+
+/**
+ * Constants for exp() and log(), see below.
+ */
+template<typename CARGO>
+class math_constants;
+
+template<>
+class math_constants<double>
+{
+public:
+    typedef unsigned long long bits_type;
+
+    static const int MANTISSA_BITS = 52;
+    static const int EXPONENT_BIAS = 1023;
+    static const int EXP_DEGREE = 13;
+    static const int LOG_DEGREE = 11;
+
+    static inline double mantissa_mask()
+    {
+        return from_bits(0x000FFFFFFFFFFFFFULL);
+    }
+
+    // 2^52: adding and subtracting it rounds to an integer, and an
+    // integer k < 2^52 can be read from or written into the lower bits
+    // of 2^52 + k.
+    static inline double two_to_mantissa_bits()
+    {
+        return 4503599627370496.0;
+    }
+
+    static inline double exp_lower_limit()
+    {
+        return -745.2;
+    }
+
+    static inline double exp_upper_limit()
+    {
+        return 709.8;
+    }
+
+    static inline double min_normal()
+    {
+        return 2.2250738585072014e-308;
+    }
+
+    // scales denormals into the normal range:
+    static inline double denormal_scale()
+    {
+        return 18014398509481984.0;
+    }
+
+    static inline double denormal_scale_exponent()
+    {
+        return 54.0;
+    }
+
+    static inline double log2e()
+    {
+        return 1.4426950408889634074;
+    }
+
+    // ln(2) split in a part with trailing zeros so that n * ln2_hi is
+    // exact for all exponents n in question (Cody & Waite):
+    static inline double ln2_hi()
+    {
+        return 6.93147180369123816490e-01;
+    }
+
+    static inline double ln2_lo()
+    {
+        return 1.90821492927058770002e-10;
+    }
+
+    static inline double sqrt2()
+    {
+        return 1.4142135623730950488;
+    }
+
+    static inline double infinity()
+    {
+        return from_bits(0x7FF0000000000000ULL);
+    }
+
+    static inline double nan()
+    {
+        return from_bits(0x7FF8000000000000ULL);
+    }
+
+    /**
+     * Taylor coefficients 1/k! of e^r.
+     */
+    static inline double exp_coefficient(int k)
+    {
+        static const double coefficients[EXP_DEGREE + 1] = {
+            1.0,
+            1.0,
+            1.0 / 2,
+            1.0 / 6,
+            1.0 / 24,
+            1.0 / 120,
+            1.0 / 720,
+            1.0 / 5040,
+            1.0 / 40320,
+            1.0 / 362880,
+            1.0 / 3628800,
+            1.0 / 39916800,
+            1.0 / 479001600,
+            1.0 / 6227020800.0
+        };
+
+        return coefficients[k];
+    }
+
+    static inline double from_bits(bits_type bits)
+    {
+        union {
+            bits_type i;
+            double f;
+        } buf;
+        buf.i = bits;
+        return buf.f;
+    }
+};
+
+template<>
+class math_constants<float>
+{
+public:
+    typedef unsigned bits_type;
+
+    static const int MANTISSA_BITS = 23;
+    static const int EXPONENT_BIAS = 127;
+    static const int EXP_DEGREE = 7;
+    static const int LOG_DEGREE = 5;
+
+    static inline float mantissa_mask()
+    {
+        return from_bits(0x007FFFFFU);
+    }
+
+    static inline float two_to_mantissa_bits()
+    {
+        return 8388608.0f;
+    }
+
+    static inline float exp_lower_limit()
+    {
+        return -104.0f;
+    }
+
+    static inline float exp_upper_limit()
+    {
+        return 88.8f;
+    }
+
+    static inline float min_normal()
+    {
+        return 1.17549435e-38f;
+    }
+
+    static inline float denormal_scale()
+    {
+        return 33554432.0f;
+    }
+
+    static inline float denormal_scale_exponent()
+    {
+        return 25.0f;
+    }
+
+    static inline float log2e()
+    {
+        return 1.44269504f;
+    }
+
+    static inline float ln2_hi()
+    {
+        return 0.693359375f;
+    }
+
+    static inline float ln2_lo()
+    {
+        return -2.12194440e-4f;
+    }
+
+    static inline float sqrt2()
+    {
+        return 1.41421356f;
+    }
+
+    static inline float infinity()
+    {
+        return from_bits(0x7F800000U);
+    }
+
+    static inline float nan()
+    {
+        return from_bits(0x7FC00000U);
+    }
+
+    static inline float exp_coefficient(int k)
+    {
+        static const float coefficients[EXP_DEGREE + 1] = {
+            1.0f,
+            1.0f,
+            1.0f / 2,
+            1.0f / 6,
+            1.0f / 24,
+            1.0f / 120,
+            1.0f / 720,
+            1.0f / 5040
+        };
+
+        return coefficients[k];
+    }
+
+    static inline float from_bits(bits_type bits)
+    {
+        union {
+            bits_type i;
+            float f;
+        } buf;
+        buf.i = bits;
+        return buf.f;
+    }
+};
+
+#if (LIBFLATARRAY_WIDEST_VECTOR_ISA == LIBFLATARRAY_SSE) ||             \
+    (LIBFLATARRAY_WIDEST_VECTOR_ISA == LIBFLATARRAY_SSE2) ||            \
+    (LIBFLATARRAY_WIDEST_VECTOR_ISA == LIBFLATARRAY_SSE4_1) ||          \
+    (LIBFLATARRAY_WIDEST_VECTOR_ISA == LIBFLATARRAY_AVX) ||             \
+    (LIBFLATARRAY_WIDEST_VECTOR_ISA == LIBFLATARRAY_AVX2) ||            \
+    (LIBFLATARRAY_WIDEST_VECTOR_ISA == LIBFLATARRAY_AVX512F)
+
+template<>
+class simd_ops<double, 2>
+{
+public:
+    typedef double cargo_type;
+    typedef __m128d register_type;
+
+    static inline __m128d set1(double a)
+    {
+        return _mm_set1_pd(a);
+    }
+
+    static inline __m128d add(__m128d a, __m128d b)
+    {
+        return _mm_add_pd(a, b);
+    }
+
+    static inline __m128d sub(__m128d a, __m128d b)
+    {
+        return _mm_sub_pd(a, b);
+    }
+
+    static inline __m128d mul(__m128d a, __m128d b)
+    {
+        return _mm_mul_pd(a, b);
+    }
+
+    static inline __m128d div(__m128d a, __m128d b)
+    {
+        return _mm_div_pd(a, b);
+    }
+
+    static inline __m128d min(__m128d a, __m128d b)
+    {
+        return _mm_min_pd(a, b);
+    }
+
+    static inline __m128d max(__m128d a, __m128d b)
+    {
+        return _mm_max_pd(a, b);
+    }
+
+    static inline __m128d fma(__m128d a, __m128d b, __m128d c)
+    {
+#ifdef __FMA__
+        return _mm_fmadd_pd(a, b, c);
+#else
+        return _mm_add_pd(_mm_mul_pd(a, b), c);
+#endif
+    }
+
+    static inline __m128d bit_and(__m128d a, __m128d b)
+    {
+        return _mm_and_pd(a, b);
+    }
+
+    static inline __m128d bit_or(__m128d a, __m128d b)
+    {
+        return _mm_or_pd(a, b);
+    }
+
+    static inline __m128d shift_left_exponent(__m128d a)
+    {
+        return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(a), 52));
+    }
+
+    static inline __m128d shift_right_exponent(__m128d a)
+    {
+        return _mm_castsi128_pd(_mm_srli_epi64(_mm_castpd_si128(a), 52));
+    }
+
+    // (a < b) ? x : y
+    static inline __m128d select_lt(__m128d a, __m128d b, __m128d x, __m128d y)
+    {
+        return blend(y, x, _mm_cmplt_pd(a, b));
+    }
+
+    // (a == b) ? x : y
+    static inline __m128d select_eq(__m128d a, __m128d b, __m128d x, __m128d y)
+    {
+        return blend(y, x, _mm_cmpeq_pd(a, b));
+    }
+
+    // !(a >= b) ? x : y, true for NaNs
+    static inline __m128d select_nge(__m128d a, __m128d b, __m128d x, __m128d y)
+    {
+        return blend(y, x, _mm_cmpnge_pd(a, b));
+    }
+
+    static inline double hsum(__m128d a)
+    {
+        return _mm_cvtsd_f64(_mm_add_sd(a, _mm_unpackhi_pd(a, a)));
+    }
+
+    static inline double hmin(__m128d a)
+    {
+        return _mm_cvtsd_f64(_mm_min_sd(a, _mm_unpackhi_pd(a, a)));
+    }
+
+    static inline double hmax(__m128d a)
+    {
+        return _mm_cvtsd_f64(_mm_max_sd(a, _mm_unpackhi_pd(a, a)));
+    }
+
+private:
+    static inline __m128d blend(__m128d a, __m128d b, __m128d mask)
+    {
+#ifdef __SSE4_1__
+        return _mm_blendv_pd(a, b, mask);
+#else
+        return _mm_or_pd(
+            _mm_and_pd(mask, b),
+            _mm_andnot_pd(mask, a));
+#endif
+    }
+};
+
+template<>
+class simd_ops<float, 4>
+{
+public:
+    typedef float cargo_type;
+    typedef __m128 register_type;
+
+    static inline __m128 set1(float a)
+    {
+        return _mm_set1_ps(a);
+    }
+
+    static inline __m128 add(__m128 a, __m128 b)
+    {
+        return _mm_add_ps(a, b);
+    }
+
+    static inline __m128 sub(__m128 a, __m128 b)
+    {
+        return _mm_sub_ps(a, b);
+    }
+
+    static inline __m128 mul(__m128 a, __m128 b)
+    {
+        return _mm_mul_ps(a, b);
+    }
+
+    static inline __m128 div(__m128 a, __m128 b)
+    {
+        return _mm_div_ps(a, b);
+    }
+
+    static inline __m128 min(__m128 a, __m128 b)
+    {
+        return _mm_min_ps(a, b);
+    }
+
+    static inline __m128 max(__m128 a, __m128 b)
+    {
+        return _mm_max_ps(a, b);
+    }
+
+    static inline __m128 fma(__m128 a, __m128 b, __m128 c)
+    {
+#ifdef __FMA__
+        return _mm_fmadd_ps(a, b, c);
+#else
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+    }
+
+    static inline __m128 bit_and(__m128 a, __m128 b)
+    {
+        return _mm_and_ps(a, b);
+    }
+
+    static inline __m128 bit_or(__m128 a, __m128 b)
+    {
+        return _mm_or_ps(a, b);
+    }
+
+    static inline __m128 shift_left_exponent(__m128 a)
+    {
+        return _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(a), 23));
+    }
+
+    static inline __m128 shift_right_exponent(__m128 a)
+    {
+        return _mm_castsi128_ps(_mm_srli_epi32(_mm_castps_si128(a), 23));
+    }
+
+    static inline __m128 select_lt(__m128 a, __m128 b, __m128 x, __m128 y)
+    {
+        return blend(y, x, _mm_cmplt_ps(a, b));
+    }
+
+    static inline __m128 select_eq(__m128 a, __m128 b, __m128 x, __m128 y)
+    {
+        return blend(y, x, _mm_cmpeq_ps(a, b));
+    }
+
+    static inline __m128 select_nge(__m128 a, __m128 b, __m128 x, __m128 y)
+    {
+        return blend(y, x, _mm_cmpnge_ps(a, b));
+    }
+
+    static inline float hsum(__m128 a)
+    {
+        __m128 buf = _mm_add_ps(a, _mm_movehl_ps(a, a));
+        return _mm_cvtss_f32(_mm_add_ss(buf, _mm_shuffle_ps(buf, buf, 1)));
+    }
+
+    static inline float hmin(__m128 a)
+    {
+        __m128 buf = _mm_min_ps(a, _mm_movehl_ps(a, a));
+        return _mm_cvtss_f32(_mm_min_ss(buf, _mm_shuffle_ps(buf, buf, 1)));
+    }
+
+    static inline float hmax(__m128 a)
+    {
+        __m128 buf = _mm_max_ps(a, _mm_movehl_ps(a, a));
+        return _mm_cvtss_f32(_mm_max_ss(buf, _mm_shuffle_ps(buf, buf, 1)));
+    }
+
+private:
+    static inline __m128 blend(__m128 a, __m128 b, __m128 mask)
+    {
+#ifdef __SSE4_1__
+        return _mm_blendv_ps(a, b, mask);
+#else
+        return _mm_or_ps(
+            _mm_and_ps(mask, b),
+            _mm_andnot_ps(mask, a));
+#endif
+    }
+};
+
+#endif
+
+#if (LIBFLATARRAY_WIDEST_VECTOR_ISA == LIBFLATARRAY_AVX) ||             \
+    (LIBFLATARRAY_WIDEST_VECTOR_ISA == LIBFLATARRAY_AVX2) ||            \
+    (LIBFLATARRAY_WIDEST_VECTOR_ISA == LIBFLATARRAY_AVX512F)
+
+template<>
+class simd_ops<double, 4>
+{
+public:
+    typedef double cargo_type;
+    typedef __m256d register_type;
+
+    static inline __m256d set1(double a)
+    {
+        return _mm256_set1_pd(a);
+    }
+
+    static inline __m256d add(__m256d a, __m256d b)
+    {
+        return _mm256_add_pd(a, b);
+    }
+
+    static inline __m256d sub(__m256d a, __m256d b)
+    {
+        return _mm256_sub_pd(a, b);
+    }
+
+    static inline __m256d mul(__m256d a, __m256d b)
+    {
+        return _mm256_mul_pd(a, b);
+    }
+
+    static inline __m256d div(__m256d a, __m256d b)
+    {
+        return _mm256_div_pd(a, b);
+    }
+
+    static inline __m256d min(__m256d a, __m256d b)
+    {
+        return _mm256_min_pd(a, b);
+    }
+
+    static inline __m256d max(__m256d a, __m256d b)
+    {
+        return _mm256_max_pd(a, b);
+    }
+
+    static inline __m256d fma(__m256d a, __m256d b, __m256d c)
+    {
+#ifdef __FMA__
+        return _mm256_fmadd_pd(a, b, c);
+#else
+        return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#endif
+    }
+
+    static inline __m256d bit_and(__m256d a, __m256d b)
+    {
+        return _mm256_and_pd(a, b);
+    }
+
+    static inline __m256d bit_or(__m256d a, __m256d b)
+    {
+        return _mm256_or_pd(a, b);
+    }
+
+    static inline __m256d shift_left_exponent(__m256d a)
+    {
+#ifdef __AVX2__
+        return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(a), 52));
+#else
+        // AVX lacks 256-bit integer instructions, so we shift both halves:
+        return combine(
+            simd_ops<double, 2>::shift_left_exponent(_mm256_castpd256_pd128(a)),
+            simd_ops<double, 2>::shift_left_exponent(_mm256_extractf128_pd(a, 1)));
+#endif
+    }
+
+    static inline __m256d shift_right_exponent(__m256d a)
+    {
+#ifdef __AVX2__
+        return _mm256_castsi256_pd(_mm256_srli_epi64(_mm256_castpd_si256(a), 52));
+#else
+        return combine(
+            simd_ops<double, 2>::shift_right_exponent(_mm256_castpd256_pd128(a)),
+            simd_ops<double, 2>::shift_right_exponent(_mm256_extractf128_pd(a, 1)));
+#endif
+    }
+
+    static inline __m256d select_lt(__m256d a, __m256d b, __m256d x, __m256d y)
+    {
+        return _mm256_blendv_pd(y, x, _mm256_cmp_pd(a, b, _CMP_LT_OQ));
+    }
+
+    static inline __m256d select_eq(__m256d a, __m256d b, __m256d x, __m256d y)
+    {
+        return _mm256_blendv_pd(y, x, _mm256_cmp_pd(a, b, _CMP_EQ_OQ));
+    }
+
+    static inline __m256d select_nge(__m256d a, __m256d b, __m256d x, __m256d y)
+    {
+        return _mm256_blendv_pd(y, x, _mm256_cmp_pd(a, b, _CMP_NGE_UQ));
+    }
+
+    static inline double hsum(__m256d a)
+    {
+        return simd_ops<double, 2>::hsum(
+            _mm_add_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1)));
+    }
+
+    static inline double hmin(__m256d a)
+    {
+        return simd_ops<double, 2>::hmin(
+            _mm_min_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1)));
+    }
+
+    static inline double hmax(__m256d a)
+    {
+        return simd_ops<double, 2>::hmax(
+            _mm_max_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1)));
+    }
+
+private:
+    static inline __m256d combine(__m128d lo, __m128d hi)
+    {
+        return _mm256_insertf128_pd(_mm256_castpd128_pd256(lo), hi, 1);
+    }
+};
+
+template<>
+class simd_ops<float, 8>
+{
+public:
+    typedef float cargo_type;
+    typedef __m256 register_type;
+
+    static inline __m256 set1(float a)
+    {
+        return _mm256_set1_ps(a);
+    }
+
+    static inline __m256 add(__m256 a, __m256 b)
+    {
+        return _mm256_add_ps(a, b);
+    }
+
+    static inline __m256 sub(__m256 a, __m256 b)
+    {
+        return _mm256_sub_ps(a, b);
+    }
+
+    static inline __m256 mul(__m256 a, __m256 b)
+    {
+        return _mm256_mul_ps(a, b);
+    }
+
+    static inline __m256 div(__m256 a, __m256 b)
+    {
+        return _mm256_div_ps(a, b);
+    }
+
+    static inline __m256 min(__m256 a, __m256 b)
+    {
+        return _mm256_min_ps(a, b);
+    }
+
+    static inline __m256 max(__m256 a, __m256 b)
+    {
+        return _mm256_max_ps(a, b);
+    }
+
+    static inline __m256 fma(__m256 a, __m256 b, __m256 c)
+    {
+#ifdef __FMA__
+        return _mm256_fmadd_ps(a, b, c);
+#else
+        return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+    }
+
+    static inline __m256 bit_and(__m256 a, __m256 b)
+    {
+        return _mm256_and_ps(a, b);
+    }
+
+    static inline __m256 bit_or(__m256 a, __m256 b)
+    {
+        return _mm256_or_ps(a, b);
+    }
+
+    static inline __m256 shift_left_exponent(__m256 a)
+    {
+#ifdef __AVX2__
+        return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(a), 23));
+#else
+        return combine(
+            simd_ops<float, 4>::shift_left_exponent(_mm256_castps256_ps128(a)),
+            simd_ops<float, 4>::shift_left_exponent(_mm256_extractf128_ps(a, 1)));
+#endif
+    }
+
+    static inline __m256 shift_right_exponent(__m256 a)
+    {
+#ifdef __AVX2__
+        return _mm256_castsi256_ps(_mm256_srli_epi32(_mm256_castps_si256(a), 23));
+#else
+        return combine(
+            simd_ops<float, 4>::shift_right_exponent(_mm256_castps256_ps128(a)),
+            simd_ops<float, 4>::shift_right_exponent(_mm256_extractf128_ps(a, 1)));
+#endif
+    }
+
+    static inline __m256 select_lt(__m256 a, __m256 b, __m256 x, __m256 y)
+    {
+        return _mm256_blendv_ps(y, x, _mm256_cmp_ps(a, b, _CMP_LT_OQ));
+    }
+
+    static inline __m256 select_eq(__m256 a, __m256 b, __m256 x, __m256 y)
+    {
+        return _mm256_blendv_ps(y, x, _mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+    }
+
+    static inline __m256 select_nge(__m256 a, __m256 b, __m256 x, __m256 y)
+    {
+        return _mm256_blendv_ps(y, x, _mm256_cmp_ps(a, b, _CMP_NGE_UQ));
+    }
+
+    static inline float hsum(__m256 a)
+    {
+        return simd_ops<float, 4>::hsum(
+            _mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1)));
+    }
+
+    static inline float hmin(__m256 a)
+    {
+        return simd_ops<float, 4>::hmin(
+            _mm_min_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1)));
+    }
+
+    static inline float hmax(__m256 a)
+    {
+        return simd_ops<float, 4>::hmax(
+            _mm_max_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1)));
+    }
+
+private:
+    static inline __m256 combine(__m128 lo, __m128 hi)
+    {
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+    }
+};
+
+#endif
+
+#if LIBFLATARRAY_WIDEST_VECTOR_ISA == LIBFLATARRAY_AVX512F
+
+template<>
+class simd_ops<double, 8>
+{
+public:
+    typedef double cargo_type;
+    typedef __m512d register_type;
+
+    static inline __m512d set1(double a)
+    {
+        return _mm512_set1_pd(a);
+    }
+
+    static inline __m512d add(__m512d a, __m512d b)
+    {
+        return _mm512_add_pd(a, b);
+    }
+
+    static inline __m512d sub(__m512d a, __m512d b)
+    {
+        return _mm512_sub_pd(a, b);
+    }
+
+    static inline __m512d mul(__m512d a, __m512d b)
+    {
+        return _mm512_mul_pd(a, b);
+    }
+
+    static inline __m512d div(__m512d a, __m512d b)
+    {
+        return _mm512_div_pd(a, b);
+    }
+
+    static inline __m512d min(__m512d a, __m512d b)
+    {
+        return _mm512_min_pd(a, b);
+    }
+
+    static inline __m512d max(__m512d a, __m512d b)
+    {
+        return _mm512_max_pd(a, b);
+    }
+
+    static inline __m512d fma(__m512d a, __m512d b, __m512d c)
+    {
+        return _mm512_fmadd_pd(a, b, c);
+    }
+
+    // bitwise floating point operations require AVX512DQ, hence the
+    // detour via integers:
+    static inline __m512d bit_and(__m512d a, __m512d b)
+    {
+        return _mm512_castsi512_pd(
+            _mm512_and_si512(_mm512_castpd_si512(a), _mm512_castpd_si512(b)));
+    }
+
+    static inline __m512d bit_or(__m512d a, __m512d b)
+    {
+        return _mm512_castsi512_pd(
+            _mm512_or_si512(_mm512_castpd_si512(a), _mm512_castpd_si512(b)));
+    }
+
+    static inline __m512d shift_left_exponent(__m512d a)
+    {
+        return _mm512_castsi512_pd(_mm512_slli_epi64(_mm512_castpd_si512(a), 52));
+    }
+
+    static inline __m512d shift_right_exponent(__m512d a)
+    {
+        return _mm512_castsi512_pd(_mm512_srli_epi64(_mm512_castpd_si512(a), 52));
+    }
+
+    static inline __m512d select_lt(__m512d a, __m512d b, __m512d x, __m512d y)
+    {
+        return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(a, b, _CMP_LT_OQ), y, x);
+    }
+
+    static inline __m512d select_eq(__m512d a, __m512d b, __m512d x, __m512d y)
+    {
+        return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ), y, x);
+    }
+
+    static inline __m512d select_nge(__m512d a, __m512d b, __m512d x, __m512d y)
+    {
+        return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(a, b, _CMP_NGE_UQ), y, x);
+    }
+
+    static inline double hsum(__m512d a)
+    {
+        return _mm512_reduce_add_pd(a);
+    }
+
+    static inline double hmin(__m512d a)
+    {
+        return _mm512_reduce_min_pd(a);
+    }
+
+    static inline double hmax(__m512d a)
+    {
+        return _mm512_reduce_max_pd(a);
+    }
+};
+
+template<>
+class simd_ops<float, 16>
+{
+public:
+    typedef float cargo_type;
+    typedef __m512 register_type;
+
+    static inline __m512 set1(float a)
+    {
+        return _mm512_set1_ps(a);
+    }
+
+    static inline __m512 add(__m512 a, __m512 b)
+    {
+        return _mm512_add_ps(a, b);
+    }
+
+    static inline __m512 sub(__m512 a, __m512 b)
+    {
+        return _mm512_sub_ps(a, b);
+    }
+
+    static inline __m512 mul(__m512 a, __m512 b)
+    {
+        return _mm512_mul_ps(a, b);
+    }
+
+    static inline __m512 div(__m512 a, __m512 b)
+    {
+        return _mm512_div_ps(a, b);
+    }
+
+    static inline __m512 min(__m512 a, __m512 b)
+    {
+        return _mm512_min_ps(a, b);
+    }
+
+    static inline __m512 max(__m512 a, __m512 b)
+    {
+        return _mm512_max_ps(a, b);
+    }
+
+    static inline __m512 fma(__m512 a, __m512 b, __m512 c)
+    {
+        return _mm512_fmadd_ps(a, b, c);
+    }
+
+    static inline __m512 bit_and(__m512 a, __m512 b)
+    {
+        return _mm512_castsi512_ps(
+            _mm512_and_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)));
+    }
+
+    static inline __m512 bit_or(__m512 a, __m512 b)
+    {
+        return _mm512_castsi512_ps(
+            _mm512_or_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)));
+    }
+
+    static inline __m512 shift_left_exponent(__m512 a)
+    {
+        return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(a), 23));
+    }
+
+    static inline __m512 shift_right_exponent(__m512 a)
+    {
+        return _mm512_castsi512_ps(_mm512_srli_epi32(_mm512_castps_si512(a), 23));
+    }
+
+    static inline __m512 select_lt(__m512 a, __m512 b, __m512 x, __m512 y)
+    {
+        return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(a, b, _CMP_LT_OQ), y, x);
+    }
+
+    static inline __m512 select_eq(__m512 a, __m512 b, __m512 x, __m512 y)
+    {
+        return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ), y, x);
+    }
+
+    static inline __m512 select_nge(__m512 a, __m512 b, __m512 x, __m512 y)
+    {
+        return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(a, b, _CMP_NGE_UQ), y, x);
+    }
+
+    static inline float hsum(__m512 a)
+    {
+        return _mm512_reduce_add_ps(a);
+    }
+
+    static inline float hmin(__m512 a)
+    {
+        return _mm512_reduce_min_ps(a);
+    }
+
+    static inline float hmax(__m512 a)
+    {
+        return _mm512_reduce_max_ps(a);
+    }
+};
+
+#endif
+
+/**
+ * Horizontal reductions of the register arrays which back the wider
+ * short_vec types. Registers are combined as a tree to keep the
+ * dependency chain short.
+ */
+template<typename OPS, int N>
+inline typename OPS::cargo_type hsum(const typename OPS::register_type (&val)[N])
+{
+    typename OPS::register_type buf[N];
+    for (int i = 0; i < N; ++i) {
+        buf[i] = val[i];
+    }
+    for (int width = N / 2; width > 0; width /= 2) {
+        for (int i = 0; i < width; ++i) {
+            buf[i] = OPS::add(buf[i], buf[i + width]);
+        }
+    }
+
+    return OPS::hsum(buf[0]);
+}
+
+template<typename OPS, int N>
+inline typename OPS::cargo_type hmin(const typename OPS::register_type (&val)[N])
+{
+    typename OPS::register_type buf[N];
+    for (int i = 0; i < N; ++i) {
+        buf[i] = val[i];
+    }
+    for (int width = N / 2; width > 0; width /= 2) {
+        for (int i = 0; i < width; ++i) {
+            buf[i] = OPS::min(buf[i], buf[i + width]);
+        }
+    }
+
+    return OPS::hmin(buf[0]);
+}
+
+template<typename OPS, int N>
+inline typename OPS::cargo_type hmax(const typename OPS::register_type (&val)[N])
+{
+    typename OPS::register_type buf[N];
+    for (int i = 0; i < N; ++i) {
+        buf[i] = val[i];
+    }
+    for (int width = N / 2; width > 0; width /= 2) {
+        for (int i = 0; i < width; ++i) {
+            buf[i] = OPS::max(buf[i], buf[i + width]);
+        }
+    }
+
+    return OPS::hmax(buf[0]);
+}
+
+/**
+ * Computes 2^n for integral n, which need to be within the range of
+ * normalized exponents.
+ */
+template<typename OPS>
+inline typename OPS::register_type pow2(const typename OPS::register_type& n)
+{
+    typedef typename OPS::register_type REGISTER;
+    typedef math_constants<typename OPS::cargo_type> constants;
+
+    // the lower bits of 2^MANTISSA_BITS + n + BIAS hold the biased
+    // exponent, which merely needs to be shifted into place:
+    REGISTER biased = OPS::add(
+        n,
+        OPS::set1(constants::two_to_mantissa_bits() + constants::EXPONENT_BIAS));
+    return OPS::shift_left_exponent(biased);
+}
+
+/**
+ * Rounds to the nearest integer, ties to even. Only valid for
+ * |x| < 2^(MANTISSA_BITS - 1).
+ */
+template<typename OPS>
+inline typename OPS::register_type round(const typename OPS::register_type& x)
+{
+    typedef typename OPS::register_type REGISTER;
+    typedef math_constants<typename OPS::cargo_type> constants;
+
+    REGISTER magic = OPS::set1(constants::two_to_mantissa_bits() * 1.5f);
+    return OPS::sub(OPS::add(x, magic), magic);
+}
+
+/**
+ * Vectorized e^x. The argument is split into x = n * ln(2) + r with
+ * |r| <= ln(2)/2 so that e^x = 2^n * e^r, and e^r is approximated by
+ * its Taylor polynomial. 2^n is applied in two steps so that
+ * results in the denormal range come out right, too. Accurate to a
+ * few ulp; returns 0 and inf for large negative/positive x, and
+ * NaN for NaN.
+ */
+template<typename OPS>
+inline typename OPS::register_type exp(const typename OPS::register_type& x)
+{
+    typedef typename OPS::register_type REGISTER;
+    typedef math_constants<typename OPS::cargo_type> constants;
+
+    // clamping first keeps n in range. Order of arguments matters:
+    // min() and max() pass on NaNs in their second argument.
+    REGISTER clamped = OPS::max(
+        OPS::set1(constants::exp_lower_limit()),
+        OPS::min(OPS::set1(constants::exp_upper_limit()), x));
+
+    REGISTER n = round<OPS>(OPS::mul(clamped, OPS::set1(constants::log2e())));
+    REGISTER r = OPS::sub(clamped, OPS::mul(n, OPS::set1(constants::ln2_hi())));
+    r = OPS::sub(r, OPS::mul(n, OPS::set1(constants::ln2_lo())));
+
+    REGISTER p = OPS::set1(constants::exp_coefficient(constants::EXP_DEGREE));
+    for (int k = constants::EXP_DEGREE - 1; k >= 0; --k) {
+        p = OPS::fma(p, r, OPS::set1(constants::exp_coefficient(k)));
+    }
+
+    REGISTER n1 = round<OPS>(OPS::mul(n, OPS::set1(0.5f)));
+    REGISTER n2 = OPS::sub(n, n1);
+
+    return OPS::mul(OPS::mul(p, pow2<OPS>(n1)), pow2<OPS>(n2));
+}
+
+/**
+ * Vectorized natural logarithm. x is split into 2^e * m with m in
+ * [sqrt(1/2), sqrt(2)), and log(m) = log(1 + f) is evaluated via the
+ * series of 2 * atanh(s) with s = f / (2 + f), arranged as in fdlibm.
+ * Accurate to about 1 ulp.
+ * Handles denormals and returns -inf for 0, inf for inf and NaN for
+ * negative arguments.
+ */
+template<typename OPS>
+inline typename OPS::register_type log(const typename OPS::register_type& x)
+{
+    typedef typename OPS::register_type REGISTER;
+    typedef typename OPS::cargo_type cargo_type;
+    typedef math_constants<cargo_type> constants;
+
+    REGISTER zero = OPS::set1(0);
+    REGISTER one = OPS::set1(1);
+
+    // scale denormals so that their exponent can be read directly:
+    REGISTER denormal_correction = OPS::select_lt(
+        x, OPS::set1(constants::min_normal()),
+        OPS::set1(constants::denormal_scale_exponent()), zero);
+    REGISTER normalized = OPS::mul(
+        x,
+        OPS::select_lt(
+            x, OPS::set1(constants::min_normal()),
+            OPS::set1(constants::denormal_scale()), one));
+
+    // the biased exponent ends up in the lower bits of
+    // 2^MANTISSA_BITS + exponent:
+    REGISTER e = OPS::bit_or(
+        OPS::shift_right_exponent(normalized),
+        OPS::set1(constants::two_to_mantissa_bits()));
+    e = OPS::sub(
+        e,
+        OPS::set1(constants::two_to_mantissa_bits() + constants::EXPONENT_BIAS));
+    e = OPS::sub(e, denormal_correction);
+
+    // mantissa in [1, 2):
+    REGISTER m = OPS::bit_or(
+        OPS::bit_and(normalized, OPS::set1(constants::mantissa_mask())),
+        one);
+    REGISTER sqrt2 = OPS::set1(constants::sqrt2());
+    e = OPS::add(e, OPS::select_lt(sqrt2, m, one, zero));
+    m = OPS::select_lt(sqrt2, m, OPS::mul(m, OPS::set1(0.5f)), m);
+
+    // m - 1 is exact for m in [sqrt(1/2), sqrt(2)). Adding the
+    // correction terms to f (instead of scaling the series by 2 * s)
+    // keeps the rounding error of the division out of the leading
+    // term:
+    REGISTER f = OPS::sub(m, one);
+    REGISTER s = OPS::div(f, OPS::add(f, OPS::set1(2)));
+    REGISTER z = OPS::mul(s, s);
+    REGISTER hfsq = OPS::mul(OPS::mul(f, f), OPS::set1(0.5f));
+
+    // R = 2 * z / 3 + 2 * z^2 / 5 + ...
+    REGISTER r = OPS::set1(cargo_type(2) / (2 * constants::LOG_DEGREE + 1));
+    for (int k = constants::LOG_DEGREE - 1; k >= 1; --k) {
+        r = OPS::fma(r, z, OPS::set1(cargo_type(2) / (2 * k + 1)));
+    }
+    r = OPS::mul(r, z);
+
+    // log(m) = f - (hfsq - s * (hfsq + R))
+    REGISTER ret = OPS::fma(s, OPS::add(hfsq, r), OPS::mul(e, OPS::set1(constants::ln2_lo())));
+    ret = OPS::sub(OPS::sub(hfsq, ret), f);
+    ret = OPS::fma(e, OPS::set1(constants::ln2_hi()), OPS::sub(zero, ret));
+
+    REGISTER infinity = OPS::set1(constants::infinity());
+    ret = OPS::select_eq(x, infinity, infinity, ret);
+    ret = OPS::select_eq(x, zero, OPS::sub(zero, infinity), ret);
+    ret = OPS::select_nge(x, zero, OPS::set1(constants::nan()), ret);
+
+    return ret;
+}
+
+}
+
+}
+
+#endif
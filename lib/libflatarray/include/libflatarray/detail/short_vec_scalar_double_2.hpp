@@ -24,6 +24,8 @@
 #pragma warning( disable : 4514 )
 #endif
 
+#include <algorithm>
+#include <cmath>
 #ifdef LIBFLATARRAY_WITH_CPP14
 #include <initializer_list>
 #endif
@@ -216,6 +218,79 @@ public:
             std::sqrt(val[ 1]));
     }
 
+    inline
+    short_vec<double, 2> min(const short_vec<double, 2>& other) const
+    {
+        return short_vec<double, 2>(
+            std::min(val[ 0], other.val[ 0]),
+            std::min(val[ 1], other.val[ 1]));
+    }
+
+    inline
+    short_vec<double, 2> max(const short_vec<double, 2>& other) const
+    {
+        return short_vec<double, 2>(
+            std::max(val[ 0], other.val[ 0]),
+            std::max(val[ 1], other.val[ 1]));
+    }
+
+    inline
+    short_vec<double, 2> fma(const short_vec<double, 2>& factor, const short_vec<double, 2>& summand) const
+    {
+        return short_vec<double, 2>(
+            val[ 0] * factor.val[ 0] + summand.val[ 0],
+            val[ 1] * factor.val[ 1] + summand.val[ 1]);
+    }
+
+    inline
+    short_vec<double, 2> exp() const
+    {
+        return short_vec<double, 2>(
+            std::exp(val[ 0]),
+            std::exp(val[ 1]));
+    }
+
+    inline
+    short_vec<double, 2> log() const
+    {
+        return short_vec<double, 2>(
+            std::log(val[ 0]),
+            std::log(val[ 1]));
+    }
+
+    inline
+    double hsum() const
+    {
+        double ret = val[0];
+        for (int i = 1; i < 2; ++i) {
+            ret += val[i];
+        }
+
+        return ret;
+    }
+
+    inline
+    double hmin() const
+    {
+        double ret = val[0];
+        for (int i = 1; i < 2; ++i) {
+            ret = std::min(ret, val[i]);
+        }
+
+        return ret;
+    }
+
+    inline
+    double hmax() const
+    {
+        double ret = val[0];
+        for (int i = 1; i < 2; ++i) {
+            ret = std::max(ret, val[i]);
+        }
+
+        return ret;
+    }
+
     inline
     void load(const double *data)
     {
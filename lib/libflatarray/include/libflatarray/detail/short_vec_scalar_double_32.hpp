@@ -23,6 +23,8 @@
 #pragma warning( disable : 4514 )
 #endif
 
+#include <algorithm>
+#include <cmath>
 #ifdef LIBFLATARRAY_WITH_CPP14
 #include <initializer_list>
 #endif
@@ -759,6 +761,229 @@ public:
             std::sqrt(val[30]),
             std::sqrt(val[31]));
     }
+
+    inline
+    short_vec<double, 32> min(const short_vec<double, 32>& other) const
+    {
+        return short_vec<double, 32>(
+            std::min(val[ 0], other.val[ 0]),
+            std::min(val[ 1], other.val[ 1]),
+            std::min(val[ 2], other.val[ 2]),
+            std::min(val[ 3], other.val[ 3]),
+            std::min(val[ 4], other.val[ 4]),
+            std::min(val[ 5], other.val[ 5]),
+            std::min(val[ 6], other.val[ 6]),
+            std::min(val[ 7], other.val[ 7]),
+            std::min(val[ 8], other.val[ 8]),
+            std::min(val[ 9], other.val[ 9]),
+            std::min(val[10], other.val[10]),
+            std::min(val[11], other.val[11]),
+            std::min(val[12], other.val[12]),
+            std::min(val[13], other.val[13]),
+            std::min(val[14], other.val[14]),
+            std::min(val[15], other.val[15]),
+            std::min(val[16], other.val[16]),
+            std::min(val[17], other.val[17]),
+            std::min(val[18], other.val[18]),
+            std::min(val[19], other.val[19]),
+            std::min(val[20], other.val[20]),
+            std::min(val[21], other.val[21]),
+            std::min(val[22], other.val[22]),
+            std::min(val[23], other.val[23]),
+            std::min(val[24], other.val[24]),
+            std::min(val[25], other.val[25]),
+            std::min(val[26], other.val[26]),
+            std::min(val[27], other.val[27]),
+            std::min(val[28], other.val[28]),
+            std::min(val[29], other.val[29]),
+            std::min(val[30], other.val[30]),
+            std::min(val[31], other.val[31]));
+    }
+
+    inline
+    short_vec<double, 32> max(const short_vec<double, 32>& other) const
+    {
+        return short_vec<double, 32>(
+            std::max(val[ 0], other.val[ 0]),
+            std::max(val[ 1], other.val[ 1]),
+            std::max(val[ 2], other.val[ 2]),
+            std::max(val[ 3], other.val[ 3]),
+            std::max(val[ 4], other.val[ 4]),
+            std::max(val[ 5], other.val[ 5]),
+            std::max(val[ 6], other.val[ 6]),
+            std::max(val[ 7], other.val[ 7]),
+            std::max(val[ 8], other.val[ 8]),
+            std::max(val[ 9], other.val[ 9]),
+            std::max(val[10], other.val[10]),
+            std::max(val[11], other.val[11]),
+            std::max(val[12], other.val[12]),
+            std::max(val[13], other.val[13]),
+            std::max(val[14], other.val[14]),
+            std::max(val[15], other.val[15]),
+            std::max(val[16], other.val[16]),
+            std::max(val[17], other.val[17]),
+            std::max(val[18], other.val[18]),
+            std::max(val[19], other.val[19]),
+            std::max(val[20], other.val[20]),
+            std::max(val[21], other.val[21]),
+            std::max(val[22], other.val[22]),
+            std::max(val[23], other.val[23]),
+            std::max(val[24], other.val[24]),
+            std::max(val[25], other.val[25]),
+            std::max(val[26], other.val[26]),
+            std::max(val[27], other.val[27]),
+            std::max(val[28], other.val[28]),
+            std::max(val[29], other.val[29]),
+            std::max(val[30], other.val[30]),
+            std::max(val[31], other.val[31]));
+    }
+
+    inline
+    short_vec<double, 32> fma(const short_vec<double, 32>& factor, const short_vec<double, 32>& summand) const
+    {
+        return short_vec<double, 32>(
+            val[ 0] * factor.val[ 0] + summand.val[ 0],
+            val[ 1] * factor.val[ 1] + summand.val[ 1],
+            val[ 2] * factor.val[ 2] + summand.val[ 2],
+            val[ 3] * factor.val[ 3] + summand.val[ 3],
+            val[ 4] * factor.val[ 4] + summand.val[ 4],
+            val[ 5] * factor.val[ 5] + summand.val[ 5],
+            val[ 6] * factor.val[ 6] + summand.val[ 6],
+            val[ 7] * factor.val[ 7] + summand.val[ 7],
+            val[ 8] * factor.val[ 8] + summand.val[ 8],
+            val[ 9] * factor.val[ 9] + summand.val[ 9],
+            val[10] * factor.val[10] + summand.val[10],
+            val[11] * factor.val[11] + summand.val[11],
+            val[12] * factor.val[12] + summand.val[12],
+            val[13] * factor.val[13] + summand.val[13],
+            val[14] * factor.val[14] + summand.val[14],
+            val[15] * factor.val[15] + summand.val[15],
+            val[16] * factor.val[16] + summand.val[16],
+            val[17] * factor.val[17] + summand.val[17],
+            val[18] * factor.val[18] + summand.val[18],
+            val[19] * factor.val[19] + summand.val[19],
+            val[20] * factor.val[20] + summand.val[20],
+            val[21] * factor.val[21] + summand.val[21],
+            val[22] * factor.val[22] + summand.val[22],
+            val[23] * factor.val[23] + summand.val[23],
+            val[24] * factor.val[24] + summand.val[24],
+            val[25] * factor.val[25] + summand.val[25],
+            val[26] * factor.val[26] + summand.val[26],
+            val[27] * factor.val[27] + summand.val[27],
+            val[28] * factor.val[28] + summand.val[28],
+            val[29] * factor.val[29] + summand.val[29],
+            val[30] * factor.val[30] + summand.val[30],
+            val[31] * factor.val[31] + summand.val[31]);
+    }
+
+    inline
+    short_vec<double, 32> exp() const
+    {
+        return short_vec<double, 32>(
+            std::exp(val[ 0]),
+            std::exp(val[ 1]),
+            std::exp(val[ 2]),
+            std::exp(val[ 3]),
+            std::exp(val[ 4]),
+            std::exp(val[ 5]),
+            std::exp(val[ 6]),
+            std::exp(val[ 7]),
+            std::exp(val[ 8]),
+            std::exp(val[ 9]),
+            std::exp(val[10]),
+            std::exp(val[11]),
+            std::exp(val[12]),
+            std::exp(val[13]),
+            std::exp(val[14]),
+            std::exp(val[15]),
+            std::exp(val[16]),
+            std::exp(val[17]),
+            std::exp(val[18]),
+            std::exp(val[19]),
+            std::exp(val[20]),
+            std::exp(val[21]),
+            std::exp(val[22]),
+            std::exp(val[23]),
+            std::exp(val[24]),
+            std::exp(val[25]),
+            std::exp(val[26]),
+            std::exp(val[27]),
+            std::exp(val[28]),
+            std::exp(val[29]),
+            std::exp(val[30]),
+            std::exp(val[31]));
+    }
+
+    inline
+    short_vec<double, 32> log() const
+    {
+        return short_vec<double, 32>(
+            std::log(val[ 0]),
+            std::log(val[ 1]),
+            std::log(val[ 2]),
+            std::log(val[ 3]),
+            std::log(val[ 4]),
+            std::log(val[ 5]),
+            std::log(val[ 6]),
+            std::log(val[ 7]),
+            std::log(val[ 8]),
+            std::log(val[ 9]),
+            std::log(val[10]),
+            std::log(val[11]),
+            std::log(val[12]),
+            std::log(val[13]),
+            std::log(val[14]),
+            std::log(val[15]),
+            std::log(val[16]),
+            std::log(val[17]),
+            std::log(val[18]),
+            std::log(val[19]),
+            std::log(val[20]),
+            std::log(val[21]),
+            std::log(val[22]),
+            std::log(val[23]),
+            std::log(val[24]),
+            std::log(val[25]),
+            std::log(val[26]),
+            std::log(val[27]),
+            std::log(val[28]),
+            std::log(val[29]),
+            std::log(val[30]),
+            std::log(val[31]));
+    }
+
+    inline
+    double hsum() const
+    {
+        double ret = val[0];
+        for (int i = 1; i < 32; ++i) {
+            ret += val[i];
+        }
+
+        return ret;
+    }
+
+    inline
+    double hmin() const
+    {
+        double ret = val[0];
+        for (int i = 1; i < 32; ++i) {
+            ret = std::min(ret, val[i]);
+        }
+
+        return ret;
+    }
+
+    inline
+    double hmax() const
+    {
+        double ret = val[0];
+        for (int i = 1; i < 32; ++i) {
+            ret = std::max(ret, val[i]);
+        }
+
+        return ret;
+    }
 #ifdef _MSC_BUILD
 #pragma warning( pop )
 #endif
@@ -22,6 +22,8 @@
 #pragma warning( disable : 4514 )
 #endif
 
+#include <algorithm>
+#include <cmath>
 #ifdef LIBFLATARRAY_WITH_CPP14
 #include <initializer_list>
 #endif
@@ -322,6 +324,109 @@ public:
             std::sqrt(val[ 7]));
     }
 
+    inline
+    short_vec<double, 8> min(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            std::min(val[ 0], other.val[ 0]),
+            std::min(val[ 1], other.val[ 1]),
+            std::min(val[ 2], other.val[ 2]),
+            std::min(val[ 3], other.val[ 3]),
+            std::min(val[ 4], other.val[ 4]),
+            std::min(val[ 5], other.val[ 5]),
+            std::min(val[ 6], other.val[ 6]),
+            std::min(val[ 7], other.val[ 7]));
+    }
+
+    inline
+    short_vec<double, 8> max(const short_vec<double, 8>& other) const
+    {
+        return short_vec<double, 8>(
+            std::max(val[ 0], other.val[ 0]),
+            std::max(val[ 1], other.val[ 1]),
+            std::max(val[ 2], other.val[ 2]),
+            std::max(val[ 3], other.val[ 3]),
+            std::max(val[ 4], other.val[ 4]),
+            std::max(val[ 5], other.val[ 5]),
+            std::max(val[ 6], other.val[ 6]),
+            std::max(val[ 7], other.val[ 7]));
+    }
+
+    inline
+    short_vec<double, 8> fma(const short_vec<double, 8>& factor, const short_vec<double, 8>& summand) const
+    {
+        return short_vec<double, 8>(
+            val[ 0] * factor.val[ 0] + summand.val[ 0],
+            val[ 1] * factor.val[ 1] + summand.val[ 1],
+            val[ 2] * factor.val[ 2] + summand.val[ 2],
+            val[ 3] * factor.val[ 3] + summand.val[ 3],
+            val[ 4] * factor.val[ 4] + summand.val[ 4],
+            val[ 5] * factor.val[ 5] + summand.val[ 5],
+            val[ 6] * factor.val[ 6] + summand.val[ 6],
+            val[ 7] * factor.val[ 7] + summand.val[ 7]);
+    }
+
+    inline
+    short_vec<double, 8> exp() const
+    {
+        return short_vec<double, 8>(
+            std::exp(val[ 0]),
+            std::exp(val[ 1]),
+            std::exp(val[ 2]),
+            std::exp(val[ 3]),
+            std::exp(val[ 4]),
+            std::exp(val[ 5]),
+            std::exp(val[ 6]),
+            std::exp(val[ 7]));
+    }
+
+    inline
+    short_vec<double, 8> log() const
+    {
+        return short_vec<double, 8>(
+            std::log(val[ 0]),
+            std::log(val[ 1]),
+            std::log(val[ 2]),
+            std::log(val[ 3]),
+            std::log(val[ 4]),
+            std::log(val[ 5]),
+            std::log(val[ 6]),
+            std::log(val[ 7]));
+    }
+
+    inline
+    double hsum() const
+    {
+        double ret = val[0];
+        for (int i = 1; i < 8; ++i) {
+            ret += val[i];
+        }
+
+        return ret;
+    }
+
+    inline
+    double hmin() const
+    {
+        double ret = val[0];
+        for (int i = 1; i < 8; ++i) {
+            ret = std::min(ret, val[i]);
+        }
+
+        return ret;
+    }
+
+    inline
+    double hmax() const
+    {
+        double ret = val[0];
+        for (int i = 1; i < 8; ++i) {
+            ret = std::max(ret, val[i]);
+        }
+
+        return ret;
+    }
+
     inline
     void load(const double *data)
     {
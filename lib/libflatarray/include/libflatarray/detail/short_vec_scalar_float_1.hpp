@@ -16,6 +16,7 @@
 #pragma warning( disable : 4514 )
 #endif
 
+#include <algorithm>
 #include <cmath>
 
 #ifdef _MSC_BUILD
@@ -182,6 +183,59 @@ public:
         return short_vec<float, 1>(std::sqrt(val));
     }
 
+    inline
+    short_vec<float, 1> min(const short_vec<float, 1>& other) const
+    {
+        return short_vec<float, 1>(
+            std::min(val, other.val));
+    }
+
+    inline
+    short_vec<float, 1> max(const short_vec<float, 1>& other) const
+    {
+        return short_vec<float, 1>(
+            std::max(val, other.val));
+    }
+
+    inline
+    short_vec<float, 1> fma(const short_vec<float, 1>& factor, const short_vec<float, 1>& summand) const
+    {
+        return short_vec<float, 1>(
+            val * factor.val + summand.val);
+    }
+
+    inline
+    short_vec<float, 1> exp() const
+    {
+        return short_vec<float, 1>(
+            std::exp(val));
+    }
+
+    inline
+    short_vec<float, 1> log() const
+    {
+        return short_vec<float, 1>(
+            std::log(val));
+    }
+
+    inline
+    float hsum() const
+    {
+        return val;
+    }
+
+    inline
+    float hmin() const
+    {
+        return val;
+    }
+
+    inline
+    float hmax() const
+    {
+        return val;
+    }
+
     inline
     void load(const float *data)
     {
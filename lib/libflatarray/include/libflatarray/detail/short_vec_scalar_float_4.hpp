@@ -23,6 +23,8 @@
 #pragma warning( disable : 4514 )
 #endif
 
+#include <algorithm>
+#include <cmath>
 #ifdef LIBFLATARRAY_WITH_CPP14
 #include <initializer_list>
 #endif
@@ -251,6 +253,89 @@ public:
             std::sqrt(val[ 3]));
     }
 
+    inline
+    short_vec<float, 4> min(const short_vec<float, 4>& other) const
+    {
+        return short_vec<float, 4>(
+            std::min(val[ 0], other.val[ 0]),
+            std::min(val[ 1], other.val[ 1]),
+            std::min(val[ 2], other.val[ 2]),
+            std::min(val[ 3], other.val[ 3]));
+    }
+
+    inline
+    short_vec<float, 4> max(const short_vec<float, 4>& other) const
+    {
+        return short_vec<float, 4>(
+            std::max(val[ 0], other.val[ 0]),
+            std::max(val[ 1], other.val[ 1]),
+            std::max(val[ 2], other.val[ 2]),
+            std::max(val[ 3], other.val[ 3]));
+    }
+
+    inline
+    short_vec<float, 4> fma(const short_vec<float, 4>& factor, const short_vec<float, 4>& summand) const
+    {
+        return short_vec<float, 4>(
+            val[ 0] * factor.val[ 0] + summand.val[ 0],
+            val[ 1] * factor.val[ 1] + summand.val[ 1],
+            val[ 2] * factor.val[ 2] + summand.val[ 2],
+            val[ 3] * factor.val[ 3] + summand.val[ 3]);
+    }
+
+    inline
+    short_vec<float, 4> exp() const
+    {
+        return short_vec<float, 4>(
+            std::exp(val[ 0]),
+            std::exp(val[ 1]),
+            std::exp(val[ 2]),
+            std::exp(val[ 3]));
+    }
+
+    inline
+    short_vec<float, 4> log() const
+    {
+        return short_vec<float, 4>(
+            std::log(val[ 0]),
+            std::log(val[ 1]),
+            std::log(val[ 2]),
+            std::log(val[ 3]));
+    }
+
+    inline
+    float hsum() const
+    {
+        float ret = val[0];
+        for (int i = 1; i < 4; ++i) {
+            ret += val[i];
+        }
+
+        return ret;
+    }
+
+    inline
+    float hmin() const
+    {
+        float ret = val[0];
+        for (int i = 1; i < 4; ++i) {
+            ret = std::min(ret, val[i]);
+        }
+
+        return ret;
+    }
+
+    inline
+    float hmax() const
+    {
+        float ret = val[0];
+        for (int i = 1; i < 4; ++i) {
+            ret = std::max(ret, val[i]);
+        }
+
+        return ret;
+    }
+
     inline
     void load(const float *data)
     {
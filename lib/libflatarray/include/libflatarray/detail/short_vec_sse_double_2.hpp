@@ -17,6 +17,7 @@
     (LIBFLATARRAY_WIDEST_VECTOR_ISA == LIBFLATARRAY_AVX512F)
 
 #include <libflatarray/detail/short_vec_helpers.hpp>
+#include <libflatarray/detail/short_vec_math.hpp>
 #include <libflatarray/config.h>
 #include <libflatarray/short_vec_base.hpp>
 
@@ -203,6 +204,62 @@ public:
             _mm_sqrt_pd(val));
     }
 
+    inline
+    short_vec<double, 2> min(const short_vec<double, 2>& other) const
+    {
+        return short_vec<double, 2>(
+            _mm_min_pd(val, other.val));
+    }
+
+    inline
+    short_vec<double, 2> max(const short_vec<double, 2>& other) const
+    {
+        return short_vec<double, 2>(
+            _mm_max_pd(val, other.val));
+    }
+
+    inline
+    short_vec<double, 2> fma(const short_vec<double, 2>& factor, const short_vec<double, 2>& summand) const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 2> ops;
+        return short_vec<double, 2>(
+            ops::fma(val, factor.val, summand.val));
+    }
+
+    inline
+    short_vec<double, 2> exp() const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 2> ops;
+        return short_vec<double, 2>(
+            ShortVecHelpers::exp<ops>(val));
+    }
+
+    inline
+    short_vec<double, 2> log() const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 2> ops;
+        return short_vec<double, 2>(
+            ShortVecHelpers::log<ops>(val));
+    }
+
+    inline
+    double hsum() const
+    {
+        return ShortVecHelpers::simd_ops<double, 2>::hsum(val);
+    }
+
+    inline
+    double hmin() const
+    {
+        return ShortVecHelpers::simd_ops<double, 2>::hmin(val);
+    }
+
+    inline
+    double hmax() const
+    {
+        return ShortVecHelpers::simd_ops<double, 2>::hmax(val);
+    }
+
     inline
     void load(const double *data)
     {
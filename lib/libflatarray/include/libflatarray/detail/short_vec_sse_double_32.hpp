@@ -31,6 +31,7 @@
 #endif
 
 #include <libflatarray/detail/short_vec_helpers.hpp>
+#include <libflatarray/detail/short_vec_math.hpp>
 #include <libflatarray/config.h>
 #include <libflatarray/short_vec_base.hpp>
 
@@ -479,6 +480,137 @@ public:
             _mm_sqrt_pd(val[15]));
     }
 
+    inline
+    short_vec<double, 32> min(const short_vec<double, 32>& other) const
+    {
+        return short_vec<double, 32>(
+            _mm_min_pd(val[ 0], other.val[ 0]),
+            _mm_min_pd(val[ 1], other.val[ 1]),
+            _mm_min_pd(val[ 2], other.val[ 2]),
+            _mm_min_pd(val[ 3], other.val[ 3]),
+            _mm_min_pd(val[ 4], other.val[ 4]),
+            _mm_min_pd(val[ 5], other.val[ 5]),
+            _mm_min_pd(val[ 6], other.val[ 6]),
+            _mm_min_pd(val[ 7], other.val[ 7]),
+            _mm_min_pd(val[ 8], other.val[ 8]),
+            _mm_min_pd(val[ 9], other.val[ 9]),
+            _mm_min_pd(val[10], other.val[10]),
+            _mm_min_pd(val[11], other.val[11]),
+            _mm_min_pd(val[12], other.val[12]),
+            _mm_min_pd(val[13], other.val[13]),
+            _mm_min_pd(val[14], other.val[14]),
+            _mm_min_pd(val[15], other.val[15]));
+    }
+
+    inline
+    short_vec<double, 32> max(const short_vec<double, 32>& other) const
+    {
+        return short_vec<double, 32>(
+            _mm_max_pd(val[ 0], other.val[ 0]),
+            _mm_max_pd(val[ 1], other.val[ 1]),
+            _mm_max_pd(val[ 2], other.val[ 2]),
+            _mm_max_pd(val[ 3], other.val[ 3]),
+            _mm_max_pd(val[ 4], other.val[ 4]),
+            _mm_max_pd(val[ 5], other.val[ 5]),
+            _mm_max_pd(val[ 6], other.val[ 6]),
+            _mm_max_pd(val[ 7], other.val[ 7]),
+            _mm_max_pd(val[ 8], other.val[ 8]),
+            _mm_max_pd(val[ 9], other.val[ 9]),
+            _mm_max_pd(val[10], other.val[10]),
+            _mm_max_pd(val[11], other.val[11]),
+            _mm_max_pd(val[12], other.val[12]),
+            _mm_max_pd(val[13], other.val[13]),
+            _mm_max_pd(val[14], other.val[14]),
+            _mm_max_pd(val[15], other.val[15]));
+    }
+
+    inline
+    short_vec<double, 32> fma(const short_vec<double, 32>& factor, const short_vec<double, 32>& summand) const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 2> ops;
+        return short_vec<double, 32>(
+            ops::fma(val[ 0], factor.val[ 0], summand.val[ 0]),
+            ops::fma(val[ 1], factor.val[ 1], summand.val[ 1]),
+            ops::fma(val[ 2], factor.val[ 2], summand.val[ 2]),
+            ops::fma(val[ 3], factor.val[ 3], summand.val[ 3]),
+            ops::fma(val[ 4], factor.val[ 4], summand.val[ 4]),
+            ops::fma(val[ 5], factor.val[ 5], summand.val[ 5]),
+            ops::fma(val[ 6], factor.val[ 6], summand.val[ 6]),
+            ops::fma(val[ 7], factor.val[ 7], summand.val[ 7]),
+            ops::fma(val[ 8], factor.val[ 8], summand.val[ 8]),
+            ops::fma(val[ 9], factor.val[ 9], summand.val[ 9]),
+            ops::fma(val[10], factor.val[10], summand.val[10]),
+            ops::fma(val[11], factor.val[11], summand.val[11]),
+            ops::fma(val[12], factor.val[12], summand.val[12]),
+            ops::fma(val[13], factor.val[13], summand.val[13]),
+            ops::fma(val[14], factor.val[14], summand.val[14]),
+            ops::fma(val[15], factor.val[15], summand.val[15]));
+    }
+
+    inline
+    short_vec<double, 32> exp() const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 2> ops;
+        return short_vec<double, 32>(
+            ShortVecHelpers::exp<ops>(val[ 0]),
+            ShortVecHelpers::exp<ops>(val[ 1]),
+            ShortVecHelpers::exp<ops>(val[ 2]),
+            ShortVecHelpers::exp<ops>(val[ 3]),
+            ShortVecHelpers::exp<ops>(val[ 4]),
+            ShortVecHelpers::exp<ops>(val[ 5]),
+            ShortVecHelpers::exp<ops>(val[ 6]),
+            ShortVecHelpers::exp<ops>(val[ 7]),
+            ShortVecHelpers::exp<ops>(val[ 8]),
+            ShortVecHelpers::exp<ops>(val[ 9]),
+            ShortVecHelpers::exp<ops>(val[10]),
+            ShortVecHelpers::exp<ops>(val[11]),
+            ShortVecHelpers::exp<ops>(val[12]),
+            ShortVecHelpers::exp<ops>(val[13]),
+            ShortVecHelpers::exp<ops>(val[14]),
+            ShortVecHelpers::exp<ops>(val[15]));
+    }
+
+    inline
+    short_vec<double, 32> log() const
+    {
+        typedef ShortVecHelpers::simd_ops<double, 2> ops;
+        return short_vec<double, 32>(
+            ShortVecHelpers::log<ops>(val[ 0]),
+            ShortVecHelpers::log<ops>(val[ 1]),
+            ShortVecHelpers::log<ops>(val[ 2]),
+            ShortVecHelpers::log<ops>(val[ 3]),
+            ShortVecHelpers::log<ops>(val[ 4]),
+            ShortVecHelpers::log<ops>(val[ 5]),
+            ShortVecHelpers::log<ops>(val[ 6]),
+            ShortVecHelpers::log<ops>(val[ 7]),
+            ShortVecHelpers::log<ops>(val[ 8]),
+            ShortVecHelpers::log<ops>(val[ 9]),
+            ShortVecHelpers::log<ops>(val[10]),
+            ShortVecHelpers::log<ops>(val[11]),
+            ShortVecHelpers::log<ops>(val[12]),
+            ShortVecHelpers::log<ops>(val[13]),
+            ShortVecHelpers::log<ops>(val[14]),
+            ShortVecHelpers::log<ops>(val[15]));
+    }
+
+    inline
+    double hsum() const
+    {
+        return ShortVecHelpers::hsum<ShortVecHelpers::simd_ops<double, 2> >(val);
+    }
+
+    inline
+    double hmin() const
+    {
+        return ShortVecHelpers::hmin<ShortVecHelpers::simd_ops<double, 2> >(val);
+    }
+
+    inline
+    double hmax() const
+    {
+        return ShortVecHelpers::hmax<ShortVecHelpers::simd_ops<double, 2> >(val);
+    }
+
     inline
     void load(const double *data)
     {
@@ -35,6 +35,7 @@
 
 #include <libflatarray/detail/sqrt_reference.hpp>
 #include <libflatarray/detail/short_vec_helpers.hpp>
+#include <libflatarray/detail/short_vec_math.hpp>
 #include <libflatarray/config.h>
 #include <libflatarray/short_vec_base.hpp>
 
@@ -283,6 +284,77 @@ public:
             _mm_sqrt_ps(val[ 3]));
     }
 
+    inline
+    short_vec<float, 16> min(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            _mm_min_ps(val[ 0], other.val[ 0]),
+            _mm_min_ps(val[ 1], other.val[ 1]),
+            _mm_min_ps(val[ 2], other.val[ 2]),
+            _mm_min_ps(val[ 3], other.val[ 3]));
+    }
+
+    inline
+    short_vec<float, 16> max(const short_vec<float, 16>& other) const
+    {
+        return short_vec<float, 16>(
+            _mm_max_ps(val[ 0], other.val[ 0]),
+            _mm_max_ps(val[ 1], other.val[ 1]),
+            _mm_max_ps(val[ 2], other.val[ 2]),
+            _mm_max_ps(val[ 3], other.val[ 3]));
+    }
+
+    inline
+    short_vec<float, 16> fma(const short_vec<float, 16>& factor, const short_vec<float, 16>& summand) const
+    {
+        typedef ShortVecHelpers::simd_ops<float, 4> ops;
+        return short_vec<float, 16>(
+            ops::fma(val[ 0], factor.val[ 0], summand.val[ 0]),
+            ops::fma(val[ 1], factor.val[ 1], summand.val[ 1]),
+            ops::fma(val[ 2], factor.val[ 2], summand.val[ 2]),
+            ops::fma(val[ 3], factor.val[ 3], summand.val[ 3]));
+    }
+
+    inline
+    short_vec<float, 16> exp() const
+    {
+        typedef ShortVecHelpers::simd_ops<float, 4> ops;
+        return short_vec<float, 16>(
+            ShortVecHelpers::exp<ops>(val[ 0]),
+            ShortVecHelpers::exp<ops>(val[ 1]),
+            ShortVecHelpers::exp<ops>(val[ 2]),
+            ShortVecHelpers::exp<ops>(val[ 3]));
+    }
+
+    inline
+    short_vec<float, 16> log() const
+    {
+        typedef ShortVecHelpers::simd_ops<float, 4> ops;
+        return short_vec<float, 16>(
+            ShortVecHelpers::log<ops>(val[ 0]),
+            ShortVecHelpers::log<ops>(val[ 1]),
+            ShortVecHelpers::log<ops>(val[ 2]),
+            ShortVecHelpers::log<ops>(val[ 3]));
+    }
+
+    inline
+    float hsum() const
+    {
+        return ShortVecHelpers::hsum<ShortVecHelpers::simd_ops<float, 4> >(val);
+    }
+
+    inline
+    float hmin() const
+    {
+        return ShortVecHelpers::hmin<ShortVecHelpers::simd_ops<float, 4> >(val);
+    }
+
+    inline
+    float hmax() const
+    {
+        return ShortVecHelpers::hmax<ShortVecHelpers::simd_ops<float, 4> >(val);
+    }
+
     inline
     void load(const float *data)
     {
@@ -15,6 +15,7 @@
 
 #include <libflatarray/detail/sqrt_reference.hpp>
 #include <libflatarray/detail/short_vec_helpers.hpp>
+#include <libflatarray/detail/short_vec_math.hpp>
 #include <libflatarray/config.h>
 #include <libflatarray/short_vec_base.hpp>
 
@@ -353,6 +354,97 @@ public:
             _mm_sqrt_ps(val[ 7]));
     }
 
+    inline
+    short_vec<float, 32> min(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            _mm_min_ps(val[ 0], other.val[ 0]),
+            _mm_min_ps(val[ 1], other.val[ 1]),
+            _mm_min_ps(val[ 2], other.val[ 2]),
+            _mm_min_ps(val[ 3], other.val[ 3]),
+            _mm_min_ps(val[ 4], other.val[ 4]),
+            _mm_min_ps(val[ 5], other.val[ 5]),
+            _mm_min_ps(val[ 6], other.val[ 6]),
+            _mm_min_ps(val[ 7], other.val[ 7]));
+    }
+
+    inline
+    short_vec<float, 32> max(const short_vec<float, 32>& other) const
+    {
+        return short_vec<float, 32>(
+            _mm_max_ps(val[ 0], other.val[ 0]),
+            _mm_max_ps(val[ 1], other.val[ 1]),
+            _mm_max_ps(val[ 2], other.val[ 2]),
+            _mm_max_ps(val[ 3], other.val[ 3]),
+            _mm_max_ps(val[ 4], other.val[ 4]),
+            _mm_max_ps(val[ 5], other.val[ 5]),
+            _mm_max_ps(val[ 6], other.val[ 6]),
+            _mm_max_ps(val[ 7], other.val[ 7]));
+    }
+
+    inline
+    short_vec<float, 32> fma(const short_vec<float, 32>& factor, const short_vec<float, 32>& summand) const
+    {
+        typedef ShortVecHelpers::simd_ops<float, 4> ops;
+        return short_vec<float, 32>(
+            ops::fma(val[ 0], factor.val[ 0], summand.val[ 0]),
+            ops::fma(val[ 1], factor.val[ 1], summand.val[ 1]),
+            ops::fma(val[ 2], factor.val[ 2], summand.val[ 2]),
+            ops::fma(val[ 3], factor.val[ 3], summand.val[ 3]),
+            ops::fma(val[ 4], factor.val[ 4], summand.val[ 4]),
+            ops::fma(val[ 5], factor.val[ 5], summand.val[ 5]),
+            ops::fma(val[ 6], factor.val[ 6], summand.val[ 6]),
+            ops::fma(val[ 7], factor.val[ 7], summand.val[ 7]));
+    }
+
+    inline
+    short_vec<float, 32> exp() const
+    {
+        typedef ShortVecHelpers::simd_ops<float, 4> ops;
+        return short_vec<float, 32>(
+            ShortVecHelpers::exp<ops>(val[ 0]),
+            ShortVecHelpers::exp<ops>(val[ 1]),
+            ShortVecHelpers::exp<ops>(val[ 2]),
+            ShortVecHelpers::exp<ops>(val[ 3]),
+            ShortVecHelpers::exp<ops>(val[ 4]),
+            ShortVecHelpers::exp<ops>(val[ 5]),
+            ShortVecHelpers::exp<ops>(val[ 6]),
+            ShortVecHelpers::exp<ops>(val[ 7]));
+    }
+
+    inline
+    short_vec<float, 32> log() const
+    {
+        typedef ShortVecHelpers::simd_ops<float, 4> ops;
+        return short_vec<float, 32>(
+            ShortVecHelpers::log<ops>(val[ 0]),
+            ShortVecHelpers::log<ops>(val[ 1]),
+            ShortVecHelpers::log<ops>(val[ 2]),
+            ShortVecHelpers::log<ops>(val[ 3]),
+            ShortVecHelpers::log<ops>(val[ 4]),
+            ShortVecHelpers::log<ops>(val[ 5]),
+            ShortVecHelpers::log<ops>(val[ 6]),
+            ShortVecHelpers::log<ops>(val[ 7]));
+    }
+
+    inline
+    float hsum() const
+    {
+        return ShortVecHelpers::hsum<ShortVecHelpers::simd_ops<float, 4> >(val);
+    }
+
+    inline
+    float hmin() const
+    {
+        return ShortVecHelpers::hmin<ShortVecHelpers::simd_ops<float, 4> >(val);
+    }
+
+    inline
+    float hmax() const
+    {
+        return ShortVecHelpers::hmax<ShortVecHelpers::simd_ops<float, 4> >(val);
+    }
+
     inline
     void load(const float *data)
     {
@@ -18,6 +18,7 @@
 
 #include <libflatarray/detail/sqrt_reference.hpp>
 #include <libflatarray/detail/short_vec_helpers.hpp>
+#include <libflatarray/detail/short_vec_math.hpp>
 #include <libflatarray/config.h>
 #include <libflatarray/short_vec_base.hpp>
 
@@ -227,6 +228,62 @@ public:
             _mm_sqrt_ps(val));
     }
 
+    inline
+    short_vec<float, 4> min(const short_vec<float, 4>& other) const
+    {
+        return short_vec<float, 4>(
+            _mm_min_ps(val, other.val));
+    }
+
+    inline
+    short_vec<float, 4> max(const short_vec<float, 4>& other) const
+    {
+        return short_vec<float, 4>(
+            _mm_max_ps(val, other.val));
+    }
+
+    inline
+    short_vec<float, 4> fma(const short_vec<float, 4>& factor, const short_vec<float, 4>& summand) const
+    {
+        typedef ShortVecHelpers::simd_ops<float, 4> ops;
+        return short_vec<float, 4>(
+            ops::fma(val, factor.val, summand.val));
+    }
+
+    inline
+    short_vec<float, 4> exp() const
+    {
+        typedef ShortVecHelpers::simd_ops<float, 4> ops;
+        return short_vec<float, 4>(
+            ShortVecHelpers::exp<ops>(val));
+    }
+
+    inline
+    short_vec<float, 4> log() const
+    {
+        typedef ShortVecHelpers::simd_ops<float, 4> ops;
+        return short_vec<float, 4>(
+            ShortVecHelpers::log<ops>(val));
+    }
+
+    inline
+    float hsum() const
+    {
+        return ShortVecHelpers::simd_ops<float, 4>::hsum(val);
+    }
+
+    inline
+    float hmin() const
+    {
+        return ShortVecHelpers::simd_ops<float, 4>::hmin(val);
+    }
+
+    inline
+    float hmax() const
+    {
+        return ShortVecHelpers::simd_ops<float, 4>::hmax(val);
+    }
+
     inline
     void load(const float *data)
     {
@@ -120,6 +120,83 @@ SHORT_VEC1 blend(const SHORT_VEC1& v1, const SHORT_VEC2& v2, const typename SHOR
     return ret;
 }
 
+/**
+ * Element-wise minimum and maximum. Results for NaNs depend on the
+ * backend.
+ */
+template<typename CARGO, std::size_t ARITY>
+inline
+short_vec<CARGO, ARITY> min(const short_vec<CARGO, ARITY>& a, const short_vec<CARGO, ARITY>& b)
+{
+    return a.min(b);
+}
+
+template<typename CARGO, std::size_t ARITY>
+inline
+short_vec<CARGO, ARITY> max(const short_vec<CARGO, ARITY>& a, const short_vec<CARGO, ARITY>& b)
+{
+    return a.max(b);
+}
+
+/**
+ * Returns a * b + c. This maps to fused multiply-add instructions
+ * (with a single rounding) if the target supports them, i.e. with
+ * AVX-512 or when compiling with FMA enabled (e.g. -mfma).
+ */
+template<typename CARGO, std::size_t ARITY>
+inline
+short_vec<CARGO, ARITY> fma(
+    const short_vec<CARGO, ARITY>& a,
+    const short_vec<CARGO, ARITY>& b,
+    const short_vec<CARGO, ARITY>& c)
+{
+    return a.fma(b, c);
+}
+
+/**
+ * Element-wise e^x and natural logarithm. The SSE/AVX/AVX-512
+ * backends use polynomial approximations which are accurate to 2 ulp
+ * (see detail/short_vec_math.hpp), the scalar backends defer to
+ * std::exp() and std::log().
+ */
+template<typename CARGO, std::size_t ARITY>
+inline
+short_vec<CARGO, ARITY> exp(const short_vec<CARGO, ARITY>& vec)
+{
+    return vec.exp();
+}
+
+template<typename CARGO, std::size_t ARITY>
+inline
+short_vec<CARGO, ARITY> log(const short_vec<CARGO, ARITY>& vec)
+{
+    return vec.log();
+}
+
+/**
+ * Horizontal reductions: sum, minimum and maximum of all elements.
+ */
+template<typename CARGO, std::size_t ARITY>
+inline
+CARGO hsum(const short_vec<CARGO, ARITY>& vec)
+{
+    return vec.hsum();
+}
+
+template<typename CARGO, std::size_t ARITY>
+inline
+CARGO hmin(const short_vec<CARGO, ARITY>& vec)
+{
+    return vec.hmin();
+}
+
+template<typename CARGO, std::size_t ARITY>
+inline
+CARGO hmax(const short_vec<CARGO, ARITY>& vec)
+{
+    return vec.hmax();
+}
+
 #ifdef _MSC_BUILD
 #pragma warning( pop )
 #endif
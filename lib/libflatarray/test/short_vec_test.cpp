@@ -28,9 +28,11 @@
 #pragma warning( disable : 4514 )
 #endif
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 #include <vector>
@@ -45,6 +47,18 @@ namespace LibFlatArray {
 
 #define SHORT_VEC_TEMPLATE short_vec
 
+/**
+ * Distance of actual to the exact result in units in the last place
+ * of CARGO. expected should be computed at a higher precision.
+ */
+template<typename CARGO>
+double ulp_distance(CARGO actual, long double expected)
+{
+    CARGO rounded = std::abs(CARGO(expected));
+    CARGO ulp = std::nextafter(rounded, std::numeric_limits<CARGO>::infinity()) - rounded;
+    return double(std::abs(actual - expected) / ulp);
+}
+
 template<typename CARGO, std::size_t ARITY>
 void testImplementationReal()
 {
@@ -629,6 +643,118 @@ void testImplementationReal()
         }
     }
 
+    // test min/max
+    {
+        std::vector<CARGO, aligned_allocator<CARGO, 64> > array1(ARITY);
+        std::vector<CARGO, aligned_allocator<CARGO, 64> > array2(ARITY);
+        for (std::size_t i = 0; i < ARITY; ++i) {
+            array1[i] = i + 0.5;
+            array2[i] = (ARITY - i) * 0.75;
+        }
+
+        ShortVec v1(&array1[0]);
+        ShortVec v2(&array2[0]);
+        ShortVec lower = min(v1, v2);
+        ShortVec upper = max(v1, v2);
+
+        for (std::size_t i = 0; i < ARITY; ++i) {
+            BOOST_TEST_EQ((std::min)(array1[i], array2[i]), get(lower, i));
+            BOOST_TEST_EQ((std::max)(array1[i], array2[i]), get(upper, i));
+        }
+    }
+
+    // test fma
+    for (std::size_t i = 0; i < numElements; ++i) {
+        vec1[i] = i + 0.1;
+        vec2[i] = i + 0.2;
+    }
+    for (std::size_t i = 0; i < (numElements - ShortVec::ARITY + 1); i += ShortVec::ARITY) {
+        ShortVec v = &vec1[i];
+        ShortVec w = &vec2[i];
+        &vec2[i] << fma(v, w, ShortVec(CARGO(0.25)));
+    }
+    for (std::size_t i = 0; i < numElements; ++i) {
+        TEST_REAL((i + 0.1) * (i + 0.2) + 0.25, vec2[i]);
+    }
+
+    // test horizontal reductions
+    {
+        std::vector<CARGO, aligned_allocator<CARGO, 64> > array(ARITY);
+        for (std::size_t i = 0; i < ARITY; ++i) {
+            // mixed signs, extrema somewhere in the middle:
+            array[i] = (i % 3 == 1) ? -CARGO(i) : CARGO(i) * CARGO(0.5);
+        }
+        if (ARITY > 2) {
+            array[ARITY / 2] = 100;
+        }
+
+        ShortVec v(&array[0]);
+        CARGO expectedSum = 0;
+        for (std::size_t i = 0; i < ARITY; ++i) {
+            expectedSum += array[i];
+        }
+
+        TEST_REAL(expectedSum, hsum(v));
+        BOOST_TEST_EQ(*std::min_element(array.begin(), array.end()), hmin(v));
+        BOOST_TEST_EQ(*std::max_element(array.begin(), array.end()), hmax(v));
+    }
+
+    // test exp/log
+    {
+        std::vector<CARGO, aligned_allocator<CARGO, 64> > array(ARITY * 16);
+        std::vector<CARGO, aligned_allocator<CARGO, 64> > actual1(ARITY * 16);
+        std::vector<CARGO, aligned_allocator<CARGO, 64> > actual2(ARITY * 16);
+        for (std::size_t i = 0; i < (ARITY * 16); ++i) {
+            array[i] = (CARGO(i) - ARITY * 8) * CARGO(70.0 / ARITY / 8) + CARGO(0.1);
+        }
+
+        for (std::size_t i = 0; i < (ARITY * 16); i += ARITY) {
+            ShortVec v(&array[i]);
+            &actual1[i] << exp(v);
+            &actual2[i] << log(exp(v));
+        }
+
+        for (std::size_t i = 0; i < (ARITY * 16); ++i) {
+            TEST_REAL(std::exp(array[i]), actual1[i]);
+            TEST_REAL_ACCURACY(array[i], actual2[i], 0.00001);
+        }
+
+        // log() and exp() need to stay within 2 ulp of the exact
+        // result. Mantissas close to sqrt(2) and 1 are the critical
+        // cases for log():
+        std::vector<CARGO, aligned_allocator<CARGO, 64> > logArgs(ARITY * 64);
+        std::vector<CARGO, aligned_allocator<CARGO, 64> > expArgs(ARITY * 64);
+        for (std::size_t i = 0; i < (ARITY * 64); ++i) {
+            CARGO mantissa = CARGO(0.7) + CARGO(0.75) * CARGO(i) / CARGO(ARITY * 64);
+            logArgs[i] = std::ldexp(mantissa, int(i % 41) - 20);
+            expArgs[i] = (CARGO(i) / (ARITY * 32) - 1) * CARGO(80);
+        }
+        logArgs[0] = CARGO(1.274136);
+        logArgs[1] = CARGO(1.02872145);
+
+        for (std::size_t i = 0; i < (ARITY * 64); i += ARITY) {
+            ShortVec logs = log(ShortVec(&logArgs[i]));
+            ShortVec exps = exp(ShortVec(&expArgs[i]));
+
+            for (std::size_t j = 0; j < ARITY; ++j) {
+                long double expectedLog = std::log((long double)logArgs[i + j]);
+                long double expectedExp = std::exp((long double)expArgs[i + j]);
+                BOOST_TEST(ulp_distance(get(logs, j), expectedLog) <= 2.0);
+                BOOST_TEST(ulp_distance(get(exps, j), expectedExp) <= 2.0);
+            }
+        }
+
+        // special values: exp(-inf) = 0, exp(inf) = log(inf) = inf,
+        // log(0) = -inf, log(-1) = NaN
+        CARGO inf = std::numeric_limits<CARGO>::infinity();
+        BOOST_TEST_EQ(CARGO(0), get(exp(ShortVec(-inf)), 0));
+        BOOST_TEST_EQ(inf, get(exp(ShortVec(inf)), 0));
+        BOOST_TEST_EQ(inf, get(log(ShortVec(inf)), 0));
+        BOOST_TEST_EQ(-inf, get(log(ShortVec(CARGO(0))), 0));
+        CARGO nan = get(log(ShortVec(CARGO(-1))), 0);
+        BOOST_TEST(nan != nan);
+    }
+
     // fixme: add all tests for int, too
 }
 
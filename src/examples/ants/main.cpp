@@ -1,4 +1,5 @@
 #include <libgeodecomp/parallelization/serialsimulator.h>
+#include <libgeodecomp/misc/counterbasedrandom.h>
 #include <libgeodecomp/io/ppmwriter.h>
 #include <libgeodecomp/io/simpleinitializer.h>
 #include <libgeodecomp/io/simplecellplotter.h>
@@ -26,15 +27,18 @@ public:
 
     enum State {EMPTY, FOOD, IDLE_ANT, BUSY_ANT, BARRIER};
     static const double PI;
+    static const unsigned SEED = 1234;
 
-    explicit Cell(State state=EMPTY) :
+    explicit Cell(State state=EMPTY, const Coord<2>& coord = Coord<2>(), unsigned step = 0) :
         state(state),
+        coord(coord),
+        step(step),
         posX(0),
         posY(0),
         dropFood(false)
     {
         if (isAnt())
-            randomTurn();
+            randomTurn(0);
     }
 
     template<typename COORD_MAP>
@@ -63,7 +67,7 @@ public:
                         if (targetCell.state == FOOD && state == BUSY_ANT) {
                             dropFood = true;
                         }
-                        randomTurn();
+                        randomTurn(nanoStep);
                     }
                 }
             }
@@ -85,6 +89,7 @@ public:
                     Coord<2> neigh = NEIGHBORS[i];
                     if (neigh == -neighborhood[neigh].target) {
                         *this = neighborhood[neigh];
+                        coord = neighborhood[Coord<2>(0, 0)].coord;
                         posX += neigh.x();
                         posY += neigh.y();
                         if (dropFood) {
@@ -95,20 +100,21 @@ public:
                         if (neighborhood[Coord<2>(0, 0)].state == FOOD) {
                             state = BUSY_ANT;
                             dropFood = false;
-                            randomTurn();
+                            randomTurn(nanoStep);
                         }
                     }
                 }
             } else {
                 if (isAnt() && target != Coord<2>(0, 0)) {
                     if (neighborhood[target].incoming == 1) {
-                        *this = Cell(dropFood? FOOD :EMPTY);
+                        *this = Cell(dropFood? FOOD :EMPTY, coord, step);
                     } else {
-                        randomTurn();
+                        randomTurn(nanoStep);
                     }
                 }
             }
 
+            ++step;
         }
     }
 
@@ -124,6 +130,10 @@ public:
 
 private:
     State state;
+    // global coordinate and time step, used for keying the random
+    // number generator independently of the domain decomposition:
+    Coord<2> coord;
+    unsigned step;
     double dir;
     double posX;
     double posY;
@@ -131,9 +141,9 @@ private:
     Coord<2> target;
     bool dropFood;
 
-    void randomTurn()
+    void randomTurn(unsigned nanoStep)
     {
-        dir = rand() % 360;
+        dir = CounterBasedRandom(SEED, coord, step, nanoStep).genUnsigned(360);
         posX = 0;
         posY = 0;
         target = Coord<2>(0, 0);
@@ -177,23 +187,40 @@ public:
     virtual void grid(GridBase<Cell, 2> *ret)
     {
         ret->setEdge(Cell(Cell::BARRIER));
+        CoordBox<2> box = ret->boundingBox();
         int numAnts =  100;
         int numFood = 500;
 
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            ret->set(*i, Cell(Cell::EMPTY, *i));
+        }
+
         for (int i = 0; i < numFood; ++i) {
-            ret->set(randCoord(), Cell(Cell::FOOD));
+            Coord<2> c = randCoord(i);
+            if (box.inBounds(c)) {
+                ret->set(c, Cell(Cell::FOOD, c));
+            }
         }
 
         for (int i = 0; i < numAnts; ++i) {
-            ret->set(randCoord(), Cell(Cell::IDLE_ANT));
+            Coord<2> c = randCoord(numFood + i);
+            if (box.inBounds(c)) {
+                ret->set(c, Cell(Cell::IDLE_ANT, c));
+            }
         }
     }
 
 private:
-    Coord<2> randCoord() const
+    /**
+     * Each rank only initializes its own part of the grid, so
+     * positions are derived from the item's index rather than from a
+     * shared random sequence.
+     */
+    Coord<2> randCoord(int index) const
     {
-        int x = rand() % gridDimensions().x();
-        int y = rand() % gridDimensions().y();
+        CounterBasedRandom rng(Cell::SEED, index);
+        int x = rng.genUnsigned(gridDimensions().x());
+        int y = rng.genUnsigned(gridDimensions().y());
         return Coord<2>(x, y);
     }
 };
@@ -238,7 +265,6 @@ public:
 
 void runSimulation()
 {
-    srand(1234);
     int outputFrequency = 1;
     CellInitializer *init = new CellInitializer();
     SerialSimulator<Cell> sim(init);
@@ -54,12 +54,10 @@ public:
             ShortVec tmp;
             tmp.load_aligned(&hoodNew->sum());
 
-            for (const auto& j: hoodOld.weights(0)) {
-                ShortVec weights;
-                ShortVec values;
-                weights.load_aligned(j.second());
-                values.gather(&hoodOld->value(), j.first());
-                tmp += values * weights;
+            // each iteration yields C gathered neighbor values and
+            // the corresponding C weights:
+            for (const auto& j: hoodOld.weights(0).gather(&hoodOld->value())) {
+                tmp += j.values() * j.weights();
             }
 
             tmp.store_aligned(&hoodNew->sum());
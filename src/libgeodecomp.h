@@ -34,6 +34,9 @@
 #include <libgeodecomp/geometry/floatcoord.h>
 #include <libgeodecomp/geometry/stencils.h>
 #include <libgeodecomp/geometry/voronoimesher.h>
+#include <libgeodecomp/io/asyncparallelwriter.h>
+#include <libgeodecomp/io/asyncwriter.h>
+#include <libgeodecomp/io/metricswriter.h>
 #include <libgeodecomp/io/ppmwriter.h>
 #include <libgeodecomp/io/remotesteerer.h>
 #include <libgeodecomp/io/serialbovwriter.h>
@@ -46,8 +49,12 @@
 #include <libgeodecomp/loadbalancer/tracingbalancer.h>
 #include <libgeodecomp/misc/apitraits.h>
 #include <libgeodecomp/misc/color.h>
+#include <libgeodecomp/misc/counterbasedrandom.h>
+#include <libgeodecomp/misc/eventtrace.h>
 #include <libgeodecomp/misc/limits.h>
+#include <libgeodecomp/misc/metrics.h>
 #include <libgeodecomp/misc/random.h>
+#include <libgeodecomp/parallelization/dataflowsimulator.h>
 #include <libgeodecomp/parallelization/serialsimulator.h>
 #include <libgeodecomp/parallelization/stripingsimulator.h>
 #include <libgeodecomp/storage/boxcell.h>
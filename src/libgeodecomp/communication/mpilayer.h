@@ -39,7 +39,8 @@ public:
         // links between any two nodes.
         PATCH_LINK = 100,
         PARALLEL_MEMORY_WRITER = 200,
-        COLLECTING_WRITER = 300
+        COLLECTING_WRITER = 300,
+        HIPAR_SIMULATOR = 400
     };
 
     typedef std::map<int, std::vector<MPI_Request> > RequestsMap;
@@ -7,9 +7,11 @@
 #include <deque>
 #include <libgeodecomp/communication/mpilayer.h>
 #include <libgeodecomp/misc/limits.h>
+#include <libgeodecomp/misc/metrics.h>
 #include <libgeodecomp/storage/patchaccepter.h>
 #include <libgeodecomp/storage/patchprovider.h>
 #include <libgeodecomp/storage/serializationbuffer.h>
+#include <libgeodecomp/storage/soagrid.h>
 
 namespace LibGeoDecomp {
 
@@ -18,6 +20,12 @@ namespace LibGeoDecomp {
  * remote processes. PatchLink::Accepter takes the patches from a
  * Stepper hands them on to MPI, while PatchLink::Provider will receive
  * the patches from the net and provide then to a Stepper.
+ *
+ * In zero-copy mode both ends skip the SerializationBuffer if the
+ * grid permits it: they derive an MPI datatype from the Region which
+ * selects its cells (or, for SoA grids, their members) directly in
+ * grid memory. As this yields the same byte stream as the buffered
+ * transfers, both ends may pick their mode independently.
  */
 template<class GRID_TYPE>
 class PatchLink
@@ -49,12 +57,17 @@ public:
             mpiLayer(communicator),
             region(region),
             buffer(SerializationBuffer<CellType>::create(region)),
-            tag(tag)
+            tag(tag),
+            regionMPIDatatype(MPI_DATATYPE_NULL),
+            regionByteSize(0)
         {}
 
         virtual ~Link()
         {
             wait();
+            if (regionMPIDatatype != MPI_DATATYPE_NULL) {
+                MPI_Type_free(&regionMPIDatatype);
+            }
         }
 
         /**
@@ -76,18 +89,166 @@ public:
             mpiLayer.wait(tag);
         }
 
+        /**
+         * Polls (but doesn't block on) this Link's pending requests,
+         * which lets MPI implementations without an asynchronous
+         * progress thread push our transfers forward.
+         */
+        inline void test()
+        {
+            mpiLayer.test(tag);
+        }
+
         inline void cancel()
         {
             mpiLayer.cancelAll();
         }
 
     protected:
+        /**
+         * Size of one element of the payload in bytes, required for
+         * accounting the traffic in our Metrics.
+         */
+        static std::size_t elementSize(const MPI_Datatype& datatype)
+        {
+            int size;
+            MPI_Type_size(datatype, &size);
+            return size;
+        }
+
         std::size_t lastNanoStep;
         long stride;
         MPILayer mpiLayer;
         Region<DIM> region;
         BufferType buffer;
         int tag;
+        MPI_Datatype regionMPIDatatype;
+        CoordBox<DIM> regionMPIDatatypeBox;
+        std::size_t regionByteSize;
+
+        /**
+         * Returns the address relative to which regionMPIDatatype
+         * selects the Region's cells within the grid, or NULL if the
+         * grid doesn't permit this (e.g. if it doesn't store its
+         * cells in plain arrays). The layout of our grids depends
+         * solely on their bounding box, so we only need to rebuild
+         * the datatype if that changes, but not when a Stepper
+         * alternates between its grids.
+         */
+        const char *regionAddress(const GRID_TYPE& grid, const MPI_Datatype& cellMPIDatatype)
+        {
+            if (region.empty()) {
+                return 0;
+            }
+
+            const char *base = chunkBase(grid, region);
+            if (base == 0) {
+                return 0;
+            }
+
+            if ((regionMPIDatatype != MPI_DATATYPE_NULL) &&
+                (regionMPIDatatypeBox == grid.boundingBox())) {
+                return base;
+            }
+
+            std::vector<int> lengths;
+            std::vector<MPI_Aint> displacements;
+            MPI_Aint lowerBound;
+            MPI_Aint extent;
+            MPI_Type_get_extent(cellMPIDatatype, &lowerBound, &extent);
+
+            // the datatype needs to describe exactly one element of
+            // the memory layout or it won't fit the displacements:
+            if ((lowerBound != 0) ||
+                (std::size_t(extent) != chunkElementSize(grid)) ||
+                !listChunks(grid, region, base, &lengths, &displacements)) {
+                return 0;
+            }
+
+            if (regionMPIDatatype != MPI_DATATYPE_NULL) {
+                MPI_Type_free(&regionMPIDatatype);
+            }
+            MPI_Type_create_hindexed(
+                lengths.size(),
+                &lengths[0],
+                &displacements[0],
+                cellMPIDatatype,
+                &regionMPIDatatype);
+            MPI_Type_commit(&regionMPIDatatype);
+            regionMPIDatatypeBox = grid.boundingBox();
+
+            int size;
+            MPI_Type_size(regionMPIDatatype, &size);
+            regionByteSize = size;
+
+            return base;
+        }
+
+    private:
+        template<typename GRID>
+        static const char *chunkBase(const GRID& grid, const Region<DIM>& region)
+        {
+            return reinterpret_cast<const char*>(grid.streakAddress(*region.beginStreak()));
+        }
+
+        template<typename CELL, typename TOPOLOGY, bool TOPOLOGICALLY_CORRECT>
+        static const char *chunkBase(
+            const SoAGrid<CELL, TOPOLOGY, TOPOLOGICALLY_CORRECT>& grid,
+            const Region<DIM>& /* region */)
+        {
+            return grid.data();
+        }
+
+        template<typename GRID>
+        static std::size_t chunkElementSize(const GRID& /* grid */)
+        {
+            return sizeof(CellType);
+        }
+
+        template<typename CELL, typename TOPOLOGY, bool TOPOLOGICALLY_CORRECT>
+        static std::size_t chunkElementSize(const SoAGrid<CELL, TOPOLOGY, TOPOLOGICALLY_CORRECT>& /* grid */)
+        {
+            // SoA grids are serialized byte-wise
+            return 1;
+        }
+
+        template<typename GRID>
+        static bool listChunks(
+            const GRID& grid,
+            const Region<DIM>& region,
+            const char *base,
+            std::vector<int> *lengths,
+            std::vector<MPI_Aint> *displacements)
+        {
+            for (typename Region<DIM>::StreakIterator i = region.beginStreak();
+                 i != region.endStreak();
+                 ++i) {
+                const char *address = reinterpret_cast<const char*>(grid.streakAddress(*i));
+                if (address == 0) {
+                    return false;
+                }
+
+                *lengths << i->length();
+                *displacements << MPI_Aint(address - base);
+            }
+
+            return true;
+        }
+
+        template<typename CELL, typename TOPOLOGY, bool TOPOLOGICALLY_CORRECT>
+        static bool listChunks(
+            const SoAGrid<CELL, TOPOLOGY, TOPOLOGICALLY_CORRECT>& grid,
+            const Region<DIM>& region,
+            const char * /* base */,
+            std::vector<int> *lengths,
+            std::vector<MPI_Aint> *displacements)
+        {
+            std::vector<std::ptrdiff_t> offsets;
+            grid.regionChunks(region, &offsets, lengths);
+            displacements->assign(offsets.begin(), offsets.end());
+
+            return true;
+        }
     };
 
     class Accepter :
@@ -99,6 +260,8 @@ public:
         using Link::lastNanoStep;
         using Link::mpiLayer;
         using Link::region;
+        using Link::regionByteSize;
+        using Link::regionMPIDatatype;
         using Link::stride;
         using Link::tag;
         using Link::wait;
@@ -107,15 +270,30 @@ public:
         using PatchAccepter<GRID_TYPE>::pushRequest;
         using PatchAccepter<GRID_TYPE>::requestedNanoSteps;
 
+        /**
+         * If zeroCopy is set, the Accepter will send its patches
+         * straight from grid memory. As the send may still be in
+         * progress once put() has returned, this requires the Stepper
+         * to call flush() before it modifies the patch. Hence we
+         * stick to buffered sends until we've seen the first flush().
+         * Grids which don't support this (see GridBase::streakAddress())
+         * and cells of variable size always fall back to buffered
+         * sends.
+         */
         inline Accepter(
             const Region<DIM>& region,
             const int dest,
             const int tag,
             const MPI_Datatype& cellMPIDatatype,
-            MPI_Comm communicator = MPI_COMM_WORLD) :
+            MPI_Comm communicator = MPI_COMM_WORLD,
+            bool zeroCopy = false) :
             Link(region, tag, communicator),
             dest(dest),
-            cellMPIDatatype(cellMPIDatatype)
+            cellMPIDatatype(cellMPIDatatype),
+            cellSize(Link::elementSize(cellMPIDatatype)),
+            zeroCopy(zeroCopy),
+            flushed(false),
+            sendingFromGrid(false)
         {}
 
         virtual void charge(std::size_t next, std::size_t last, std::size_t newStride)
@@ -135,11 +313,19 @@ public:
                 return;
             }
 
-            wait();
-            SerializationBuffer<CellType>::resize(&buffer, region.size());
-            grid.saveRegion(&buffer, region);
-            sendHeader(FixedSize());
-            mpiLayer.send(&buffer[0], dest, buffer.size(), tag, cellMPIDatatype);
+            {
+                Metrics::ScopedLatency latency(Metrics::PATCH_LINK_WAIT);
+                wait();
+            }
+            sendingFromGrid = false;
+
+            if (!sendDirectly(grid, FixedSize())) {
+                SerializationBuffer<CellType>::resize(&buffer, region.size());
+                grid.saveRegion(&buffer, region);
+                sendHeader(FixedSize());
+                mpiLayer.send(&buffer[0], dest, buffer.size(), tag, cellMPIDatatype);
+                Metrics::add(Metrics::GHOST_BYTES_SENT, buffer.size() * cellSize);
+            }
 
             std::size_t nextNanoStep = (min)(requestedNanoSteps) + stride;
             if ((lastNanoStep == infinity()) ||
@@ -150,10 +336,58 @@ public:
             erase_min(requestedNanoSteps);
         }
 
+        virtual void progress()
+        {
+            Link::test();
+        }
+
+        /**
+         * Only zero-copy sends need to be waited for here: buffered
+         * ones don't access the grid anymore. Waiting for those might
+         * even deadlock, as the receiver of a variable size payload
+         * won't post its receive before its next get().
+         */
+        virtual void flush()
+        {
+            flushed = true;
+            if (sendingFromGrid) {
+                Metrics::ScopedLatency latency(Metrics::PATCH_LINK_WAIT);
+                wait();
+                sendingFromGrid = false;
+            }
+        }
+
     private:
         int dest;
         int dataSize;
         MPI_Datatype cellMPIDatatype;
+        std::size_t cellSize;
+        bool zeroCopy;
+        bool flushed;
+        bool sendingFromGrid;
+
+        bool sendDirectly(const GRID_TYPE& grid, APITraits::TrueType)
+        {
+            if (!zeroCopy || !flushed) {
+                return false;
+            }
+
+            const char *base = Link::regionAddress(grid, cellMPIDatatype);
+            if (base == 0) {
+                return false;
+            }
+
+            mpiLayer.send(base, dest, 1, tag, regionMPIDatatype);
+            Metrics::add(Metrics::GHOST_BYTES_SENT, regionByteSize);
+            sendingFromGrid = true;
+            return true;
+        }
+
+        bool sendDirectly(const GRID_TYPE& /* grid */, APITraits::FalseType)
+        {
+            // a variable size payload needs to be serialized anyway
+            return false;
+        }
 
         void sendHeader(APITraits::TrueType)
         {
@@ -180,6 +414,8 @@ public:
         using Link::lastNanoStep;
         using Link::mpiLayer;
         using Link::region;
+        using Link::regionByteSize;
+        using Link::regionMPIDatatype;
         using Link::stride;
         using Link::tag;
         using Link::wait;
@@ -188,18 +424,31 @@ public:
         using PatchProvider<GRID_TYPE>::storedNanoSteps;
         using PatchProvider<GRID_TYPE>::get;
 
+        /**
+         * If zeroCopy is set, the Provider will receive its patches
+         * straight into the grid which the Stepper announces via
+         * prepare(). Until a Stepper does so, receives are posted
+         * into our buffer as soon as possible. Afterwards they are
+         * deferred until prepare() is called. If get() then targets
+         * a different grid, the patch is copied over.
+         */
         inline
         Provider(
             const Region<DIM>& region,
             int source,
             int tag,
             const MPI_Datatype& cellMPIDatatype,
-            MPI_Comm communicator = MPI_COMM_WORLD) :
+            MPI_Comm communicator = MPI_COMM_WORLD,
+            bool zeroCopy = false) :
             Link(region, tag, communicator),
             source(source),
             dataSize(0),
             cellMPIDatatype(cellMPIDatatype),
-            transmissionInFlight(false)
+            cellSize(Link::elementSize(cellMPIDatatype)),
+            transmissionInFlight(false),
+            zeroCopy(zeroCopy),
+            prepared(false),
+            target(0)
         {}
 
         virtual void cleanup()
@@ -207,6 +456,12 @@ public:
             if (transmissionInFlight) {
                 recvSecondPart(FixedSize());
             }
+
+            // the grid may not outlive us:
+            if (target != 0) {
+                wait();
+                target = 0;
+            }
         }
 
         virtual void charge(const std::size_t next, const std::size_t last, const std::size_t newStride)
@@ -228,11 +483,29 @@ public:
             }
 
             checkNanoStepGet(nanoStep);
-            wait();
-            recvSecondPart(FixedSize());
+            {
+                Metrics::ScopedLatency latency(Metrics::PATCH_LINK_WAIT);
+                if (!transmissionInFlight) {
+                    // prepare() wasn't called for this patch
+                    recvFirstPart(FixedSize());
+                }
+                wait();
+                recvSecondPart(FixedSize());
+            }
             transmissionInFlight = false;
 
-            grid->loadRegion(buffer, region);
+            if (target == 0) {
+                Metrics::add(Metrics::GHOST_BYTES_RECEIVED, buffer.size() * cellSize);
+                grid->loadRegion(buffer, region);
+            } else {
+                Metrics::add(Metrics::GHOST_BYTES_RECEIVED, regionByteSize);
+                if (target != grid) {
+                    SerializationBuffer<CellType>::resize(&buffer, region.size());
+                    target->saveRegion(&buffer, region);
+                    grid->loadRegion(buffer, region);
+                }
+                target = 0;
+            }
 
             std::size_t nextNanoStep = (min)(storedNanoSteps) + stride;
             if ((lastNanoStep == infinity()) ||
@@ -243,18 +516,69 @@ public:
             erase_min(storedNanoSteps);
         }
 
+        virtual void progress()
+        {
+            Link::test();
+        }
+
+        virtual void prepare(GRID_TYPE *grid)
+        {
+            prepared = zeroCopy;
+            if (!prepared || transmissionInFlight || storedNanoSteps.empty()) {
+                return;
+            }
+
+            recvDirectly(grid, FixedSize());
+        }
+
         void recv(const std::size_t nanoStep)
         {
             storedNanoSteps << nanoStep;
-            recvFirstPart(FixedSize());
-            transmissionInFlight = true;
+            if (!deferReceive(FixedSize())) {
+                recvFirstPart(FixedSize());
+                transmissionInFlight = true;
+            }
         }
 
     private:
         int source;
         int dataSize;
         MPI_Datatype cellMPIDatatype;
+        std::size_t cellSize;
         bool transmissionInFlight;
+        bool zeroCopy;
+        bool prepared;
+        GRID_TYPE *target;
+
+        bool deferReceive(APITraits::TrueType)
+        {
+            return prepared;
+        }
+
+        bool deferReceive(APITraits::FalseType)
+        {
+            return false;
+        }
+
+        void recvDirectly(GRID_TYPE *grid, APITraits::TrueType)
+        {
+            // the Stepper hands us a mutable grid, so it's fine to
+            // receive into the memory which it lets us look at:
+            char *base = const_cast<char*>(Link::regionAddress(*grid, cellMPIDatatype));
+            if (base == 0) {
+                recvFirstPart(APITraits::TrueType());
+            } else {
+                mpiLayer.recv(base, source, 1, tag, regionMPIDatatype);
+                target = grid;
+            }
+
+            transmissionInFlight = true;
+        }
+
+        void recvDirectly(GRID_TYPE * /* grid */, APITraits::FalseType)
+        {
+            // receives of variable size payloads are never deferred
+        }
 
         void recvFirstPart(APITraits::TrueType)
         {
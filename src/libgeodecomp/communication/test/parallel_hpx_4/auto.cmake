@@ -0,0 +1,6 @@
+set(SOURCES ${SOURCES}
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}hpxpatchlinktest.h
+  ${RELATIVE_PATH}hpxreceivertest.h
+)
@@ -0,0 +1,62 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_MPILayerTest_init = false;
+#include "/root/repo/src/libgeodecomp/communication/test/parallel_mpi_1/mpilayertest.h"
+
+static MPILayerTest suite_MPILayerTest;
+
+static CxxTest::List Tests_MPILayerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MPILayerTest( "/root/repo/src/libgeodecomp/communication/test/parallel_mpi_1/mpilayertest.h", 11, "MPILayerTest", suite_MPILayerTest, Tests_MPILayerTest );
+
+static class TestDescription_suite_MPILayerTest_testRequestHandlingCell : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MPILayerTest_testRequestHandlingCell() : CxxTest::RealTestDescription( Tests_MPILayerTest, suiteDescription_MPILayerTest, 22, "testRequestHandlingCell" ) {}
+ void runTest() { suite_MPILayerTest.testRequestHandlingCell(); }
+} testDescription_suite_MPILayerTest_testRequestHandlingCell;
+
+static class TestDescription_suite_MPILayerTest_testSendRecvCell : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MPILayerTest_testSendRecvCell() : CxxTest::RealTestDescription( Tests_MPILayerTest, suiteDescription_MPILayerTest, 36, "testSendRecvCell" ) {}
+ void runTest() { suite_MPILayerTest.testSendRecvCell(); }
+} testDescription_suite_MPILayerTest_testSendRecvCell;
+
+static class TestDescription_suite_MPILayerTest_testSize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MPILayerTest_testSize() : CxxTest::RealTestDescription( Tests_MPILayerTest, suiteDescription_MPILayerTest, 47, "testSize" ) {}
+ void runTest() { suite_MPILayerTest.testSize(); }
+} testDescription_suite_MPILayerTest_testSize;
+
+static class TestDescription_suite_MPILayerTest_testRank : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MPILayerTest_testRank() : CxxTest::RealTestDescription( Tests_MPILayerTest, suiteDescription_MPILayerTest, 53, "testRank" ) {}
+ void runTest() { suite_MPILayerTest.testRank(); }
+} testDescription_suite_MPILayerTest_testRank;
+
+static class TestDescription_suite_MPILayerTest_testSendRecvVec : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MPILayerTest_testSendRecvVec() : CxxTest::RealTestDescription( Tests_MPILayerTest, suiteDescription_MPILayerTest, 59, "testSendRecvVec" ) {}
+ void runTest() { suite_MPILayerTest.testSendRecvVec(); }
+} testDescription_suite_MPILayerTest_testSendRecvVec;
+
@@ -239,6 +239,96 @@ public:
         }
     }
 
+    void testZeroCopy()
+    {
+        std::vector<SharedPtr<PatchAccepterType>::Type> accepters;
+        std::vector<SharedPtr<PatchProviderType>::Type> providers;
+        int stride = 3;
+        std::size_t maxNanoSteps = 20;
+        // testMultiple2() may still have receives pending on genTag()'s tags:
+        int tagOffset = 100;
+
+        for (int i = 0; i < mpiLayer->size(); ++i) {
+            if (i != mpiLayer->rank()) {
+                accepters << SharedPtr<PatchAccepterType>::Type(
+                    new PatchAccepterType(
+                        region2,
+                        i,
+                        genTag(mpiLayer->rank(), i) + tagOffset,
+                        MPI_INT,
+                        MPI_COMM_WORLD,
+                        true));
+
+                providers << SharedPtr<PatchProviderType>::Type(
+                    new PatchProviderType(
+                        region2,
+                        i,
+                        genTag(i, mpiLayer->rank()) + tagOffset,
+                        MPI_INT,
+                        MPI_COMM_WORLD,
+                        true));
+            }
+        }
+
+        for (int i = 0; i < mpiLayer->size() - 1; ++i) {
+            accepters[i]->charge(0, maxNanoSteps, stride);
+            providers[i]->charge(0, maxNanoSteps, stride);
+        }
+
+        // the grids differ in their layout every other time step to
+        // ensure the links rebuild their datatypes:
+        CoordBox<2> largeBox(Coord<2>(-2, -1), Coord<2>(12, 9));
+        GridType smallSendGrid;
+        GridType largeSendGrid(largeBox, -1);
+        std::vector<GridType> landingGrids(mpiLayer->size() - 1);
+
+        for (std::size_t nanoStep = 0; nanoStep < maxNanoSteps; nanoStep += stride) {
+            bool odd = (nanoStep / stride) % 2;
+            smallSendGrid = markGrid(region2, mpiLayer->rank() * 10000 + nanoStep * 100);
+            for (CoordBox<2>::Iterator i = boundingBox.begin(); i != boundingBox.end(); ++i) {
+                largeSendGrid[*i] = smallSendGrid[*i];
+            }
+            GridType& mySendGrid = odd ? largeSendGrid : smallSendGrid;
+
+            for (int i = 0; i < mpiLayer->size() - 1; ++i) {
+                accepters[i]->put(mySendGrid, boundingRegion, boundingBox.dimensions, nanoStep, mpiLayer->rank());
+            }
+
+            // receives need to be posted before we wait for the sends:
+            for (int i = 0; i < mpiLayer->size() - 1; ++i) {
+                landingGrids[i] = odd ? GridType(largeBox, 0) : zeroGrid;
+                providers[i]->prepare(&landingGrids[i]);
+            }
+
+            for (int i = 0; i < mpiLayer->size() - 1; ++i) {
+                accepters[i]->flush();
+            }
+
+            // zero-copy sends need to be complete once flush() returns:
+            for (Region<2>::Iterator i = region2.begin(); i != region2.end(); ++i) {
+                mySendGrid[*i] = -1;
+            }
+
+            for (int i = 0; i < mpiLayer->size() - 1; ++i) {
+                std::size_t senderRank = i >= mpiLayer->rank() ? i + 1 : i;
+                GridType expected = markGrid(region2, senderRank * 10000 + nanoStep * 100);
+                GridType actual = zeroGrid;
+                providers[i]->get(&actual, boundingRegion, boundingBox.dimensions, nanoStep, senderRank);
+
+                TS_ASSERT_EQUALS(actual, expected);
+
+                // the initial receive is posted by charge(), before
+                // prepare() tells the Provider where to store the
+                // patch, so only later patches arrive in-place:
+                if (nanoStep > 0) {
+                    for (Region<2>::Iterator j = region2.begin(); j != region2.end(); ++j) {
+                        TS_ASSERT_EQUALS(expected[*j], landingGrids[i][*j]);
+                    }
+                }
+            }
+        }
+    }
+
     void testSoA()
     {
         Coord<3> dim(30, 20, 10);
@@ -309,6 +399,95 @@ public:
         accepter.wait();
     }
 
+    void testSoAZeroCopy()
+    {
+        Coord<3> dim(30, 20, 10);
+        CoordBox<3> box(Coord<3>(), dim);
+        Region<3> boxRegion;
+        boxRegion << box;
+
+        GridType2 sendGrid(box);
+        GridType2 recvGrid(box);
+
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            Coord<3> offset(0, 0, mpiLayer->rank() * 100);
+            sendGrid.set(*i, TestCellSoA(*i + offset, dim, 0, mpiLayer->rank()));
+        }
+
+        // each rank sends a ragged patch to the last rank. The
+        // patches may not overlap as they're received in-place
+        // concurrently:
+        std::vector<Region<3> > regions(mpiLayer->size());
+        for (int i = 0; i < mpiLayer->size(); ++i) {
+            regions[i] << CoordBox<3>(Coord<3>(0, 0, i), Coord<3>(dim.x(), dim.y(), 1));
+            regions[i] << Streak<3>(Coord<3>(i * 7, 5, 5), i * 8 + 3);
+        }
+
+        PatchLink<GridType2>::Accepter accepter(
+            regions[mpiLayer->rank()],
+            mpiLayer->size() - 1,
+            2702,
+            MPI_CHAR,
+            MPI_COMM_WORLD,
+            true);
+        // zero-copy sends are only used once the caller has shown
+        // that it flushes the Accepter:
+        accepter.flush();
+        accepter.charge(4, 4, 1);
+        accepter.put(sendGrid, boxRegion, dim, 4, mpiLayer->rank());
+
+        std::vector<SharedPtr<PatchLink<GridType2>::Provider>::Type> providers;
+        if (mpiLayer->rank() == (mpiLayer->size() - 1)) {
+            for (int i = 0; i < mpiLayer->size(); ++i) {
+                providers.push_back(
+                    SharedPtr<PatchLink<GridType2>::Provider>::Type(
+                        new PatchLink<GridType2>::Provider(
+                            regions[i],
+                            i,
+                            2702,
+                            MPI_CHAR,
+                            MPI_COMM_WORLD,
+                            true)));
+
+                // defer the receive until we know its target grid:
+                providers[i]->prepare(&recvGrid);
+                providers[i]->charge(4, 4, 1);
+                providers[i]->prepare(&recvGrid);
+            }
+        }
+
+        accepter.flush();
+        for (Region<3>::Iterator i = regions[mpiLayer->rank()].begin();
+             i != regions[mpiLayer->rank()].end();
+             ++i) {
+            sendGrid.set(*i, TestCellSoA());
+        }
+
+        if (mpiLayer->rank() == (mpiLayer->size() - 1)) {
+            for (int i = 0; i < mpiLayer->size(); ++i) {
+                providers[i]->get(&recvGrid, boxRegion, dim, 4, i);
+            }
+
+            for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+                TestCellSoA cell = recvGrid.get(*i);
+
+                int sender = mpiLayer->size() - 1;
+                while ((sender >= 0) && !regions[sender].count(*i)) {
+                    --sender;
+                }
+
+                if (sender < 0) {
+                    TS_ASSERT_EQUALS(666, cell.testValue);
+                    continue;
+                }
+
+                Coord<3> expectedPosition = *i + Coord<3>(0, 0, sender * 100);
+                TS_ASSERT_EQUALS(double(sender), cell.testValue);
+                TS_ASSERT_EQUALS(expectedPosition, cell.pos);
+            }
+        }
+    }
+
     void testBoostSerialization1()
     {
 #ifdef LIBGEODECOMP_WITH_BOOST_SERIALIZATION
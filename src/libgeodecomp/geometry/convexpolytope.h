@@ -4,9 +4,10 @@
 #include <libgeodecomp/geometry/coordbox.h>
 #include <libgeodecomp/geometry/floatcoord.h>
 #include <libgeodecomp/geometry/plane.h>
-#include <libgeodecomp/misc/random.h>
 #include <libgeodecomp/misc/stdcontaineroverloads.h>
 
+#include <cmath>
+
 namespace LibGeoDecomp {
 
 /**
@@ -17,7 +18,6 @@ template<typename COORD, typename ID = int>
 class ConvexPolytope
 {
 public:
-    const static std::size_t SAMPLES = 1000;
     const static int DIM = COORD::DIM;
 
     typedef Plane<COORD, ID> EquationType;
@@ -180,15 +180,21 @@ public:
             return;
         }
 
-        int hits = 0;
-        for (std::size_t i = 0; i < SAMPLES; ++i) {
-            COORD p = COORD(Random::genDouble(delta[0]),
-                            Random::genDouble(delta[1])) + minCoord;
-            if (includes(p)) {
-                ++hits;
+        // Shoelace formula, evaluated relative to the center: each
+        // edge spans a triangle with the center and as the polytope
+        // is convex and contains its center, these triangles
+        // partition it. This avoids sorting the cut points.
+        area = 0;
+        for (std::size_t i = 0; i < limits.size(); ++i) {
+            if ((cutPoints[2 * i + 0] == farAway<2>()) ||
+                (cutPoints[2 * i + 1] == farAway<2>())) {
+                continue;
             }
+
+            COORD a = cutPoints[2 * i + 0] - center;
+            COORD b = cutPoints[2 * i + 1] - center;
+            area += 0.5 * std::fabs(1.0 * a[0] * b[1] - 1.0 * a[1] * b[0]);
         }
-        area = 1.0 * hits / SAMPLES * delta.prod();
 
         double newDiameter = delta.maxElement();
         if (newDiameter > diameter) {
@@ -205,9 +211,8 @@ public:
     }
 
     /**
-     * The ConvexPolytope's volume is determined via random sampling
-     * integration. Few samples are used, so this method is highly
-     * inaccurate.
+     * The ConvexPolytope's volume is computed exactly from its cut
+     * points by updateGeometryData().
      */
     double getVolume() const
     {
@@ -229,6 +234,22 @@ public:
         return diameter;
     }
 
+    /**
+     * Squared distance of the cut point which is farthest away from
+     * the center. Points which are farther away from the center than
+     * twice this distance can't alter the ConvexPolytope.
+     */
+    double getRadiusSquared() const
+    {
+        double ret = 0;
+        for (std::size_t i = 0; i < cutPoints.size(); ++i) {
+            COORD delta = cutPoints[i] - center;
+            ret = (std::max)(ret, 1.0 * delta[0] * delta[0] + 1.0 * delta[1] * delta[1]);
+        }
+
+        return ret;
+    }
+
 private:
     COORD center;
     COORD simSpaceDim;
@@ -77,6 +77,7 @@ public:
         myRank = newRank;
         ghostZoneWidth = newGhostZoneWidth;
         regions.clear();
+        neighborhoodBoxes.clear();
         outerGhostZoneFragments.clear();
         innerGhostZoneFragments.clear();
         fillOwnRegion();
@@ -92,17 +93,9 @@ public:
 
         boundingBoxes = newBoundingBoxes;
         expandedBoundingBoxes = newExpandedBoundingBoxes;
-        CoordBox<DIM> ownBoundingBox = ownRegion().boundingBox();
-        CoordBox<DIM> ownExpandedBoundingBox = ownExpandedRegion().boundingBox();
 
         for (unsigned i = 0; i < boundingBoxes.size(); ++i) {
-            if ((i != myRank) &&
-                (boundingBoxes[i].intersects(ownExpandedBoundingBox) ||
-                 expandedBoundingBoxes[i].intersects(ownBoundingBox)) &&
-                (!(getRegion(myRank, ghostZoneWidth) &
-                   getRegion(i,      0)).empty() ||
-                 !(getRegion(i,      ghostZoneWidth) &
-                   getRegion(myRank, 0)).empty())) {
+            if ((i != myRank) && isNeighbor(i, Topology())) {
                 intersect(i);
             }
         }
@@ -151,12 +144,17 @@ public:
         return outerGhostZoneFragments[OUTGROUP].back();
     }
 
+    /**
+     * Returns the given node's Region, expanded by expansionWidth.
+     * Expansions are computed lazily as neighbor discovery only
+     * needs the unexpanded Regions of most nodes.
+     */
     inline const Region<DIM>& getRegion(
         int node,
         unsigned expansionWidth)
     {
-        if (regions.count(node) == 0) {
-            fillRegion(node);
+        if (regions[node].size() <= expansionWidth) {
+            fillRegion(node, expansionWidth);
         }
         return regions[node][expansionWidth];
     }
@@ -253,6 +251,7 @@ private:
     unsigned ghostZoneWidth;
     std::vector<CoordBox<DIM> > boundingBoxes;
     std::vector<CoordBox<DIM> > expandedBoundingBoxes;
+    std::vector<CoordBox<DIM> > neighborhoodBoxes;
 
     const SharedPtr<Adjacency>::Type adjacency(const Region<DIM>& region) const
     {
@@ -264,26 +263,119 @@ private:
         return adjacencyManufacturer->getReverseAdjacency(region);
     }
 
-    inline void fillRegion(unsigned node)
+    inline void fillRegion(unsigned node, std::size_t expansionWidth)
     {
         std::vector<Region<DIM> >& regionExpansion = regions[node];
-        regionExpansion.resize(getGhostZoneWidth() + 1);
-        regionExpansion[0] = partition->getRegion(node);
-        for (std::size_t i = 1; i <= getGhostZoneWidth(); ++i) {
-            Region<DIM> expanded;
-            const Region<DIM>& reg = regionExpansion[i - 1];
-            expanded = reg.expandWithTopology(
+        if (regionExpansion.empty()) {
+            regionExpansion.push_back(partition->getRegion(node));
+        }
+
+        while (regionExpansion.size() <= expansionWidth) {
+            const Region<DIM>& reg = regionExpansion.back();
+            Region<DIM> expanded = reg.expandWithTopology(
                 1,
                 simulationArea.dimensions,
                 Topology(),
                 *adjacency(reg));
-            regionExpansion[i] = expanded;
+            regionExpansion.push_back(expanded);
+        }
+    }
+
+    /**
+     * Unstructured grids may have asymmetric adjacencies, hence we
+     * need to check both directions and can't tell neighbors by
+     * geometry alone.
+     */
+    inline bool isNeighbor(unsigned node, const Topologies::Unstructured::Topology& /* unused */)
+    {
+        return
+            (boundingBoxes[node].intersects(ownExpandedRegion().boundingBox()) ||
+             expandedBoundingBoxes[node].intersects(ownRegion().boundingBox())) &&
+            (!(getRegion(myRank, ghostZoneWidth) & getRegion(node, 0)).empty() ||
+             !(getRegion(node, ghostZoneWidth) & getRegion(myRank, 0)).empty());
+    }
+
+    /**
+     * On structured grids each expansion step adds all cells within a
+     * distance of 1 (maximum norm), which is symmetric: node is
+     * within our outer ghost zone iff we're within its outer ghost
+     * zone. That's why the unexpanded Region of node is sufficient
+     * here. Candidates are rejected cheaply unless their bounding box
+     * overlaps with one of the wrapped pieces of our expanded
+     * bounding box. Unlike the bounding box of our expanded Region,
+     * these pieces don't degenerate to whole axes at periodic
+     * boundaries, so distant nodes never cause Region operations.
+     */
+    template<typename STRUCTURED_TOPOLOGY>
+    inline bool isNeighbor(unsigned node, const STRUCTURED_TOPOLOGY& /* unused */)
+    {
+        if (neighborhoodBoxes.empty()) {
+            initNeighborhoodBoxes();
+        }
+
+        bool candidate = false;
+        for (typename std::vector<CoordBox<DIM> >::const_iterator i = neighborhoodBoxes.begin();
+             i != neighborhoodBoxes.end();
+             ++i) {
+            if (boundingBoxes[node].intersects(*i)) {
+                candidate = true;
+                break;
+            }
+        }
+
+        return candidate && !(ownExpandedRegion() & getRegion(node, 0)).empty();
+    }
+
+    /**
+     * Grows our bounding box by the ghost zone width and cuts the
+     * result into pieces which are wrapped into the simulation area
+     * along periodic axes.
+     */
+    inline void initNeighborhoodBoxes()
+    {
+        CoordBox<DIM> box = ownRegion().boundingBox();
+        box.origin -= Coord<DIM>::diagonal(ghostZoneWidth);
+        box.dimensions += Coord<DIM>::diagonal(2 * ghostZoneWidth);
+        neighborhoodBoxes.push_back(box);
+
+        for (int d = 0; d < DIM; ++d) {
+            if (!Topology::wrapsAxis(d)) {
+                continue;
+            }
+
+            int width = simulationArea.dimensions[d];
+            std::vector<CoordBox<DIM> > wrappedBoxes;
+            for (typename std::vector<CoordBox<DIM> >::iterator i = neighborhoodBoxes.begin();
+                 i != neighborhoodBoxes.end();
+                 ++i) {
+                if (i->dimensions[d] >= width) {
+                    i->origin[d] = 0;
+                    i->dimensions[d] = width;
+                    wrappedBoxes.push_back(*i);
+                    continue;
+                }
+
+                for (int shift = -width; shift <= width; shift += width) {
+                    CoordBox<DIM> piece = *i;
+                    piece.origin[d] += shift;
+                    int begin = (std::max)(piece.origin[d], 0);
+                    int end = (std::min)(piece.origin[d] + piece.dimensions[d], width);
+                    if (begin < end) {
+                        piece.origin[d] = begin;
+                        piece.dimensions[d] = end - begin;
+                        wrappedBoxes.push_back(piece);
+                    }
+                }
+            }
+
+            using std::swap;
+            swap(neighborhoodBoxes, wrappedBoxes);
         }
     }
 
     inline void fillOwnRegion()
     {
-        fillRegion(myRank);
+        fillRegion(myRank, getGhostZoneWidth());
         Region<DIM> surface(
             ownRegion().expandWithTopology(
                 1,
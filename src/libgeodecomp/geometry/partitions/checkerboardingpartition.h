@@ -17,12 +17,15 @@ class CheckerboardingPartition : public Partition<DIM>
 public:
     using Partition<DIM>::startOffsets;
     using Partition<DIM>::weights;
+    typedef typename Partition<DIM>::AdjacencyPtr AdjacencyPtr;
+    typedef void SupportsCostFunction;
 
     inline explicit CheckerboardingPartition(
         const Coord<DIM>& origin = Coord<DIM>(),
         const Coord<DIM>& dimensions = Coord<DIM>(),
         const long& offset = 0,
-        const std::vector<std::size_t>& weights = std::vector<std::size_t>(2)) :
+        const std::vector<std::size_t>& weights = std::vector<std::size_t>(2),
+        const AdjacencyPtr& /* unused: adjacency */ = AdjacencyPtr()) :
         Partition<DIM>(offset, weights),
         origin(origin),
         dimensions(dimensions)
@@ -30,6 +33,49 @@ public:
         nodeGridDim = getNodeGridDim(weights.size());
     }
 
+    /**
+     * Places the cuts along each axis so that all slabs between two
+     * neighboring cuts carry roughly the same cost. As the cuts span
+     * the whole grid, this can only balance costs which are
+     * (approximately) separable, e.g. a hotspot in one corner. Just
+     * like with the default constructor the weights are ignored.
+     */
+    inline CheckerboardingPartition(
+        const Coord<DIM>& origin,
+        const Coord<DIM>& dimensions,
+        const long& offset,
+        const std::vector<std::size_t>& weights,
+        const CostFunction<DIM>& cost,
+        const AdjacencyPtr& /* unused: adjacency */ = AdjacencyPtr()) :
+        Partition<DIM>(offset, weights),
+        origin(origin),
+        dimensions(dimensions)
+    {
+        nodeGridDim = getNodeGridDim(weights.size());
+
+        std::vector<std::vector<double> > sliceCosts(DIM);
+        for (int d = 0; d < DIM; ++d) {
+            sliceCosts[d].resize(dimensions[d] + 1, 0);
+        }
+
+        CoordBox<DIM> box(origin, dimensions);
+        for (typename CoordBox<DIM>::Iterator i = box.begin(); i != box.end(); ++i) {
+            double c = cost(*i);
+            if (c < 0) {
+                throw std::invalid_argument("cell cost may not be negative");
+            }
+
+            for (int d = 0; d < DIM; ++d) {
+                sliceCosts[d][(*i)[d] - origin[d] + 1] += c;
+            }
+        }
+
+        cuts.resize(DIM);
+        for (int d = 0; d < DIM; ++d) {
+            cuts[d] = costCuts(&sliceCosts[d], nodeGridDim[d]);
+        }
+    }
+
     Region<DIM> getRegion(const std::size_t node) const
     {
         Coord<DIM> logicalCoord(node % nodeGridDim.x(),
@@ -41,8 +87,13 @@ public:
         Coord<DIM> realStart;
         Coord<DIM> realEnd;
         for(int i = 0; i < DIM; ++i){
-            realStart[i] = logicalCoord[i] * dimensions[i] / nodeGridDim[i];
-            realEnd[i] = (logicalCoord[i]+1) * dimensions[i] / nodeGridDim[i];
+            if (cuts.empty()) {
+                realStart[i] = logicalCoord[i] * dimensions[i] / nodeGridDim[i];
+                realEnd[i] = (logicalCoord[i]+1) * dimensions[i] / nodeGridDim[i];
+            } else {
+                realStart[i] = cuts[i][logicalCoord[i] + 0];
+                realEnd[i]   = cuts[i][logicalCoord[i] + 1];
+            }
         }
         Region<DIM> r;
         r << CoordBox<DIM>(origin + realStart, realEnd - realStart);
@@ -53,6 +104,47 @@ private:
     Coord<DIM> origin;
     Coord<DIM> dimensions;
     Coord<DIM> nodeGridDim;
+    // per axis offsets of the nodeGridDim[d] + 1 cut planes, empty unless a CostFunction was given
+    std::vector<std::vector<int> > cuts;
+
+    /**
+     * Converts the slice costs to prefix sums and returns the offsets
+     * at which these have to be cut to yield numSlabs slabs of
+     * similar cost.
+     */
+    inline std::vector<int> costCuts(std::vector<double> *sliceCosts, const int numSlabs) const
+    {
+        std::vector<double>& prefix = *sliceCosts;
+        for (std::size_t i = 1; i < prefix.size(); ++i) {
+            prefix[i] += prefix[i - 1];
+        }
+
+        int length = prefix.size() - 1;
+        double totalCost = prefix.back();
+        std::vector<int> ret(numSlabs + 1, 0);
+        ret[numSlabs] = length;
+
+        for (int k = 1; k < numSlabs; ++k) {
+            if (totalCost <= 0) {
+                ret[k] = k * length / numSlabs;
+                continue;
+            }
+
+            double target = totalCost * k / numSlabs;
+            std::vector<double>::iterator cut = std::lower_bound(
+                prefix.begin(), prefix.end(), target);
+            if (cut == prefix.end()) {
+                --cut;
+            }
+            if ((cut != prefix.begin()) && ((target - *(cut - 1)) < (*cut - target))) {
+                --cut;
+            }
+
+            ret[k] = (std::max)(int(cut - prefix.begin()), ret[k - 1]);
+        }
+
+        return ret;
+    }
 
     Coord<DIM> getNodeGridDim(const std::size_t totalNodes) const
     {
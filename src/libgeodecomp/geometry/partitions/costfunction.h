@@ -0,0 +1,59 @@
+#ifndef LIBGEODECOMP_GEOMETRY_PARTITIONS_COSTFUNCTION_H
+#define LIBGEODECOMP_GEOMETRY_PARTITIONS_COSTFUNCTION_H
+
+#include <libgeodecomp/geometry/coord.h>
+#include <libgeodecomp/storage/gridbase.h>
+
+namespace LibGeoDecomp {
+
+/**
+ * A CostFunction yields the estimated computational cost of updating
+ * a single cell. Partitions which are given a CostFunction will
+ * distribute the total cost of the simulation space instead of the
+ * number of cells among the nodes. This pays off for models where
+ * some regions (e.g. densely populated areas) are much more
+ * expensive than others.
+ *
+ * Initializers which know the load profile of their model may
+ * implement this interface directly.
+ */
+template<int DIM>
+class CostFunction
+{
+public:
+    virtual ~CostFunction()
+    {}
+
+    /**
+     * Returns the (non-negative) cost of the cell at the given
+     * coordinate. Only relative values matter.
+     */
+    virtual double operator()(const Coord<DIM>& coord) const = 0;
+};
+
+/**
+ * Reads the cost of each cell from a grid, e.g. a cost map which was
+ * measured in a previous run. The grid is only referenced, so it has
+ * to outlive the GridCostFunction (but not the Partitions which were
+ * set up with it).
+ */
+template<int DIM>
+class GridCostFunction : public CostFunction<DIM>
+{
+public:
+    explicit GridCostFunction(const GridBase<double, DIM>& costs) :
+        costs(costs)
+    {}
+
+    double operator()(const Coord<DIM>& coord) const
+    {
+        return costs.get(coord);
+    }
+
+private:
+    const GridBase<double, DIM>& costs;
+};
+
+}
+
+#endif
@@ -26,6 +26,7 @@ public:
     typedef Grid<std::vector<Coord<2> >, Topologies::Cube<3>::Topology> CacheType;
 
     using Partition<2>::AdjacencyPtr;
+    typedef void SupportsCostFunction;
 
     static SharedPtr<CacheType>::Type squareCoordsCache;
     static Form squareFormTransitions[4][4];
@@ -314,6 +315,24 @@ public:
         dimensions(dimensions)
     {}
 
+    /**
+     * Cuts the curve at equal (weighted) prefix sums of the cells'
+     * costs instead of equal cell counts.
+     */
+    inline HilbertPartition(
+        const Coord<2>& origin,
+        const Coord<2>& dimensions,
+        const long& offset,
+        const std::vector<std::size_t>& weights,
+        const CostFunction<2>& cost,
+        const AdjacencyPtr& /* unused: adjacency */ = AdjacencyPtr()) :
+        SpaceFillingCurve<2>(offset, weights),
+        origin(origin),
+        dimensions(dimensions)
+    {
+        balanceCost((*this)[startOffsets[0]], end(), cost);
+    }
+
     inline Iterator operator[](unsigned i) const
     {
         return Iterator(origin, dimensions, i);
@@ -68,6 +68,8 @@ class HIndexingPartition : public SpaceFillingCurve<2>
     friend class HIndexingPartitionTest;
 
 public:
+    using Partition<2>::AdjacencyPtr;
+    typedef void SupportsCostFunction;
     typedef std::vector<Coord<2> > CoordVector;
 
     class Triangle
@@ -525,12 +527,31 @@ public:
         const Coord<2>& origin=Coord<2>(0, 0),
         const Coord<2>& dimensions=Coord<2>(0, 0),
         const long& offset=0,
-        const std::vector<std::size_t>& weights=std::vector<std::size_t>(2)) :
+        const std::vector<std::size_t>& weights=std::vector<std::size_t>(2),
+        const AdjacencyPtr& /* unused: adjacency */ = AdjacencyPtr()) :
         SpaceFillingCurve<2>(offset, weights),
         origin(origin),
         dimensions(dimensions)
     {}
 
+    /**
+     * Cuts the curve at equal (weighted) prefix sums of the cells'
+     * costs instead of equal cell counts.
+     */
+    inline HIndexingPartition(
+        const Coord<2>& origin,
+        const Coord<2>& dimensions,
+        const long& offset,
+        const std::vector<std::size_t>& weights,
+        const CostFunction<2>& cost,
+        const AdjacencyPtr& /* unused: adjacency */ = AdjacencyPtr()) :
+        SpaceFillingCurve<2>(offset, weights),
+        origin(origin),
+        dimensions(dimensions)
+    {
+        balanceCost((*this)[startOffsets[0]], end(), cost);
+    }
+
     inline Iterator begin() const
     {
         return Iterator(origin, dimensions);
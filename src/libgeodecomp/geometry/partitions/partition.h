@@ -3,9 +3,13 @@
 
 #include <libgeodecomp/geometry/adjacency.h>
 #include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/geometry/partitions/costfunction.h>
 #include <libgeodecomp/misc/sharedptr.h>
 #include <libgeodecomp/misc/stdcontaineroverloads.h>
 
+#include <algorithm>
+#include <stdexcept>
+
 namespace LibGeoDecomp {
 
 /**
@@ -29,6 +33,10 @@ public:
      * means that each simulation cell corresponds to a weight of 1.
      * Each entry in the weight vector will usually correspond to an
      * MPI process, identified by its rank.
+     *
+     * Some Partitions also accept a CostFunction, in which case the
+     * weights denote each node's share of the total cost and are
+     * replaced by the resulting number of cells per node.
      */
     inline Partition(
         const long offset,
@@ -55,6 +63,111 @@ public:
 protected:
     std::vector<std::size_t> weights;
     std::vector<std::size_t> startOffsets;
+
+    /**
+     * Moves the cuts between the nodes so that each node receives a
+     * share of the total cost (as opposed to the number of cells)
+     * which is proportional to its weight. The range of cells covered
+     * by all nodes stays the same. begin has to point to the first
+     * cell (i.e. the one at startOffsets[0]), and the iterator has to
+     * traverse the cells in the same order in which they're assigned
+     * to nodes. Afterwards weights will hold the number of cells per
+     * node.
+     */
+    template<typename ITERATOR>
+    void balanceCost(ITERATOR begin, const ITERATOR& end, const CostFunction<DIM>& cost)
+    {
+        std::size_t numCells = startOffsets.back() - startOffsets.front();
+        std::vector<double> prefixSums;
+        prefixSums.reserve(numCells + 1);
+        prefixSums.push_back(0);
+
+        for (; (begin != end) && (prefixSums.size() <= numCells); ++begin) {
+            double c = cost(*begin);
+            if (c < 0) {
+                throw std::invalid_argument("cell cost may not be negative");
+            }
+            prefixSums.push_back(prefixSums.back() + c);
+        }
+
+        double totalCost = prefixSums.back();
+        double totalWeight = startOffsets.back() - startOffsets.front();
+        if ((totalCost <= 0) || (totalWeight <= 0)) {
+            throw std::invalid_argument("total cost and weight need to be positive");
+        }
+
+        std::size_t offset = startOffsets.front();
+        std::size_t accumulatedWeight = 0;
+        for (std::size_t i = 1; i < weights.size(); ++i) {
+            accumulatedWeight += weights[i - 1];
+            double target = totalCost * accumulatedWeight / totalWeight;
+
+            std::vector<double>::iterator cut = std::lower_bound(
+                prefixSums.begin(), prefixSums.end(), target);
+            if (cut == prefixSums.end()) {
+                --cut;
+            }
+            if ((cut != prefixSums.begin()) && ((target - *(cut - 1)) < (*cut - target))) {
+                --cut;
+            }
+
+            startOffsets[i] = offset + (cut - prefixSums.begin());
+        }
+        startOffsets.back() = offset + prefixSums.size() - 1;
+
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            weights[i] = startOffsets[i + 1] - startOffsets[i];
+        }
+    }
+};
+
+/**
+ * Creates Partitions for the simulators. PARTITIONs which advertise
+ * a constructor accepting a CostFunction (via the typedef
+ * SupportsCostFunction) will receive the given CostFunction, for all
+ * others it is ignored. This lets simulators pass on the costs
+ * provided by an Initializer without knowing which Partition they've
+ * been instantiated with.
+ */
+template<typename PARTITION, typename SUPPORTS_COST_FUNCTION = void>
+class PartitionFactory
+{
+public:
+    template<int DIM>
+    static PARTITION *create(
+        const Coord<DIM>& origin,
+        const Coord<DIM>& dimensions,
+        const long offset,
+        const std::vector<std::size_t>& weights,
+        const typename Partition<DIM>::AdjacencyPtr& adjacency,
+        const CostFunction<DIM> * /* unused: cost */ = 0)
+    {
+        return new PARTITION(origin, dimensions, offset, weights, adjacency);
+    }
+};
+
+/**
+ * see above
+ */
+template<typename PARTITION>
+class PartitionFactory<PARTITION, typename PARTITION::SupportsCostFunction>
+{
+public:
+    template<int DIM>
+    static PARTITION *create(
+        const Coord<DIM>& origin,
+        const Coord<DIM>& dimensions,
+        const long offset,
+        const std::vector<std::size_t>& weights,
+        const typename Partition<DIM>::AdjacencyPtr& adjacency,
+        const CostFunction<DIM> *cost = 0)
+    {
+        if (cost) {
+            return new PARTITION(origin, dimensions, offset, weights, *cost, adjacency);
+        }
+
+        return new PARTITION(origin, dimensions, offset, weights, adjacency);
+    }
 };
 
 }
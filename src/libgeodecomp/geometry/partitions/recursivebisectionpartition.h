@@ -20,6 +20,7 @@ public:
     friend class RecursiveBisectionPartitionTest;
     typedef std::vector<std::size_t> SizeTVec;
     typedef typename Partition<DIM>::AdjacencyPtr AdjacencyPtr;
+    typedef void SupportsCostFunction;
 
     inline explicit RecursiveBisectionPartition(
         const Coord<DIM>& origin = Coord<DIM>(),
@@ -38,6 +39,39 @@ public:
         }
     }
 
+    /**
+     * Places the bisection planes so that the cost (instead of the
+     * number of cells) of both halves matches the ratio of their
+     * weights. The cells' costs are sampled once during construction.
+     */
+    inline RecursiveBisectionPartition(
+        const Coord<DIM>& origin,
+        const Coord<DIM>& dimensions,
+        const long& offset,
+        const SizeTVec weights,
+        const CostFunction<DIM>& cost,
+        const AdjacencyPtr& adjacency = AdjacencyPtr(),
+        const Coord<DIM>& dimWeights = Coord<DIM>::diagonal(1)) :
+        Partition<DIM>(0, weights),
+        origin(origin),
+        dimensions(dimensions),
+        dimWeights(dimWeights)
+    {
+        if (dimensions.prod() == 0) {
+            throw std::invalid_argument("size of simulation space may not be zero");
+        }
+
+        CoordBox<DIM> box(origin, dimensions);
+        cellCosts.reserve(dimensions.prod());
+        for (typename CoordBox<DIM>::Iterator i = box.begin(); i != box.end(); ++i) {
+            double c = cost(*i);
+            if (c < 0) {
+                throw std::invalid_argument("cell cost may not be negative");
+            }
+            cellCosts << c;
+        }
+    }
+
     inline Region<DIM> getRegion(const std::size_t i) const
     {
         CoordBox<DIM> cuboid = searchNodeCuboid(
@@ -57,6 +91,8 @@ private:
     Coord<DIM> origin;
     Coord<DIM> dimensions;
     Coord<DIM> dimWeights;
+    // empty unless a CostFunction was given, indexed in the order of CoordBox<DIM>::Iterator
+    std::vector<double> cellCosts;
 
     /**
      * returns the CoordBox which belongs to the node whose weight is
@@ -116,12 +152,50 @@ private:
             }
         }
 
-        int offset = round(ratio * dim[longestDim]);
+        int offset = cellCosts.empty() ?
+            round(ratio * dim[longestDim]) :
+            costSplit(oldBox, longestDim, ratio);
         int remainder = dim[longestDim] - offset;
         newBoxes[0].dimensions[longestDim] = offset;
         newBoxes[1].dimensions[longestDim] = remainder;
         newBoxes[1].origin[longestDim] += offset;
     }
+
+    /**
+     * Returns the offset of the plane orthogonal to splitDim which
+     * splits the cost of box in the given ratio.
+     */
+    inline int costSplit(
+        const CoordBox<DIM>& box,
+        const int splitDim,
+        const double ratio) const
+    {
+        std::vector<double> sliceCosts(box.dimensions[splitDim] + 1, 0);
+        for (typename CoordBox<DIM>::Iterator i = box.begin(); i != box.end(); ++i) {
+            std::size_t index = (*i - origin).toIndex(dimensions);
+            sliceCosts[(*i)[splitDim] - box.origin[splitDim] + 1] += cellCosts[index];
+        }
+        for (std::size_t i = 1; i < sliceCosts.size(); ++i) {
+            sliceCosts[i] += sliceCosts[i - 1];
+        }
+
+        double totalCost = sliceCosts.back();
+        if (totalCost <= 0) {
+            return round(ratio * box.dimensions[splitDim]);
+        }
+
+        double target = ratio * totalCost;
+        std::vector<double>::iterator cut = std::lower_bound(
+            sliceCosts.begin(), sliceCosts.end(), target);
+        if (cut == sliceCosts.end()) {
+            --cut;
+        }
+        if ((cut != sliceCosts.begin()) && ((target - *(cut - 1)) < (*cut - target))) {
+            --cut;
+        }
+
+        return cut - sliceCosts.begin();
+    }
 };
 
 template<typename _CharT, typename _Traits, int _Dim>
@@ -22,12 +22,21 @@ class ScotchPartition : public Partition<DIM>
 public:
     using Partition<DIM>::startOffsets;
     using Partition<DIM>::weights;
+    typedef typename Partition<DIM>::AdjacencyPtr AdjacencyPtr;
+    typedef void SupportsCostFunction;
+
+    /**
+     * Resolution of the integer vertex loads handed to Scotch: the
+     * most expensive cell gets a load of 1 + RESOLUTION.
+     */
+    static const int RESOLUTION = 100;
 
     inline explicit ScotchPartition(
         const Coord<DIM>& origin = Coord<DIM>(),
         const Coord<DIM>& dimensions = Coord<DIM>(),
         const long& offset = 0,
-        const std::vector<std::size_t>& weights = std::vector<std::size_t>(2)) :
+        const std::vector<std::size_t>& weights = std::vector<std::size_t>(2),
+        const AdjacencyPtr& /* unused: adjacency */ = AdjacencyPtr()) :
         Partition<DIM>(offset, weights),
         origin(origin),
         dimensions(dimensions),
@@ -39,6 +48,54 @@ public:
         createRegions(&indices[0]);
     }
 
+    /**
+     * Passes the cells' costs as vertex loads to Scotch, which will
+     * then balance the sum of the loads (instead of the number of
+     * cells) per node according to the weights. Costs are scaled to
+     * integers in the range [1, 1 + RESOLUTION].
+     */
+    inline ScotchPartition(
+        const Coord<DIM>& origin,
+        const Coord<DIM>& dimensions,
+        const long& offset,
+        const std::vector<std::size_t>& weights,
+        const CostFunction<DIM>& cost,
+        const AdjacencyPtr& /* unused: adjacency */ = AdjacencyPtr()) :
+        Partition<DIM>(offset, weights),
+        origin(origin),
+        dimensions(dimensions),
+        cellNbr(dimensions.prod())
+    {
+        std::vector<double> costs;
+        costs.reserve(cellNbr);
+        double maxCost = 0;
+
+        // x-fastest, just like the vertex numbering in initIndices():
+        CoordBox<DIM> box(origin, dimensions);
+        for (typename CoordBox<DIM>::Iterator i = box.begin(); i != box.end(); ++i) {
+            double c = cost(*i);
+            if (c < 0) {
+                throw std::invalid_argument("cell cost may not be negative");
+            }
+            costs.push_back(c);
+            maxCost = (std::max)(maxCost, c);
+        }
+
+        cellLoads.reserve(cellNbr);
+        for (std::vector<double>::iterator i = costs.begin(); i != costs.end(); ++i) {
+            SCOTCH_Num load = 1;
+            if (maxCost > 0) {
+                load += SCOTCH_Num(RESOLUTION * *i / maxCost);
+            }
+            cellLoads.push_back(load);
+        }
+
+        std::vector<SCOTCH_Num> indices(cellNbr);
+        initIndices(&indices[0]);
+        regions.resize(weights.size());
+        createRegions(&indices[0]);
+    }
+
     Region<DIM> getRegion(const std::size_t node) const
     {
         return regions[node];
@@ -49,6 +106,8 @@ private:
     Coord<DIM> dimensions;
     SCOTCH_Num cellNbr;
     std::vector<Region<DIM> > regions;
+    // empty unless a CostFunction was given
+    std::vector<SCOTCH_Num> cellLoads;
 
     void initIndices(SCOTCH_Num *indices)
     {
@@ -121,7 +180,7 @@ private:
             cellNbr,
             verttabGra,
             verttabGra +1,
-            NULL,
+            cellLoads.empty() ? NULL : &cellLoads[0],
             NULL,
             edgenbrGra,
             edgetabGra,
@@ -23,6 +23,7 @@ public:
     const static int DIM = DIMENSIONS;
     typedef typename CoordBox<DIM>::Iterator Iterator;
     typedef typename Partition<DIM>::AdjacencyPtr AdjacencyPtr;
+    typedef void SupportsCostFunction;
 
     explicit StripingPartition(
         const Coord<DIM>& origin = Coord<DIM>(),
@@ -42,6 +43,24 @@ public:
         }
     }
 
+    /**
+     * Places the cuts between the stripes so that each node's share
+     * of the total cost is proportional to its weight.
+     */
+    StripingPartition(
+        const Coord<DIM>& origin,
+        const Coord<DIM>& dimensions,
+        const long& offset,
+        const std::vector<std::size_t>& weights,
+        const CostFunction<DIM>& cost,
+        const AdjacencyPtr& /* unused: adjacency */ = AdjacencyPtr()) :
+        SpaceFillingCurve<DIM>(offset, weights),
+        origin(origin),
+        dimensions(dimensions)
+    {
+        this->balanceCost((*this)[startOffsets[0]], end(), cost);
+    }
+
     Iterator begin() const
     {
         return Iterator(origin, origin, dimensions);
@@ -0,0 +1,62 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_PTScotchPartitionTest_init = false;
+#include "/root/repo/src/libgeodecomp/geometry/partitions/test/parallel_mpi_4/ptscotchpartitiontest.h"
+
+static PTScotchPartitionTest suite_PTScotchPartitionTest;
+
+static CxxTest::List Tests_PTScotchPartitionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PTScotchPartitionTest( "/root/repo/src/libgeodecomp/geometry/partitions/test/parallel_mpi_4/ptscotchpartitiontest.h", 11, "PTScotchPartitionTest", suite_PTScotchPartitionTest, Tests_PTScotchPartitionTest );
+
+static class TestDescription_suite_PTScotchPartitionTest_testComplete3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PTScotchPartitionTest_testComplete3D() : CxxTest::RealTestDescription( Tests_PTScotchPartitionTest, suiteDescription_PTScotchPartitionTest, 14, "testComplete3D" ) {}
+ void runTest() { suite_PTScotchPartitionTest.testComplete3D(); }
+} testDescription_suite_PTScotchPartitionTest_testComplete3D;
+
+static class TestDescription_suite_PTScotchPartitionTest_testOverlapse3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PTScotchPartitionTest_testOverlapse3D() : CxxTest::RealTestDescription( Tests_PTScotchPartitionTest, suiteDescription_PTScotchPartitionTest, 35, "testOverlapse3D" ) {}
+ void runTest() { suite_PTScotchPartitionTest.testOverlapse3D(); }
+} testDescription_suite_PTScotchPartitionTest_testOverlapse3D;
+
+static class TestDescription_suite_PTScotchPartitionTest_testEqual2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PTScotchPartitionTest_testEqual2D() : CxxTest::RealTestDescription( Tests_PTScotchPartitionTest, suiteDescription_PTScotchPartitionTest, 58, "testEqual2D" ) {}
+ void runTest() { suite_PTScotchPartitionTest.testEqual2D(); }
+} testDescription_suite_PTScotchPartitionTest_testEqual2D;
+
+static class TestDescription_suite_PTScotchPartitionTest_testComplete2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PTScotchPartitionTest_testComplete2D() : CxxTest::RealTestDescription( Tests_PTScotchPartitionTest, suiteDescription_PTScotchPartitionTest, 79, "testComplete2D" ) {}
+ void runTest() { suite_PTScotchPartitionTest.testComplete2D(); }
+} testDescription_suite_PTScotchPartitionTest_testComplete2D;
+
+static class TestDescription_suite_PTScotchPartitionTest_testOverlapse2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PTScotchPartitionTest_testOverlapse2D() : CxxTest::RealTestDescription( Tests_PTScotchPartitionTest, suiteDescription_PTScotchPartitionTest, 100, "testOverlapse2D" ) {}
+ void runTest() { suite_PTScotchPartitionTest.testOverlapse2D(); }
+} testDescription_suite_PTScotchPartitionTest_testOverlapse2D;
+
@@ -0,0 +1,23 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}checkerboardingpartitiontest.cpp
+  ${RELATIVE_PATH}hilbertpartitiontest.cpp
+  ${RELATIVE_PATH}hindexingpartitiontest.cpp
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}recursivebisectionpartitiontest.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+  ${RELATIVE_PATH}scotchpartitiontest.cpp
+  ${RELATIVE_PATH}stripingpartitiontest.cpp
+  ${RELATIVE_PATH}unstructuredstripingpartitiontest.cpp
+  ${RELATIVE_PATH}zcurvepartitiontest.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}checkerboardingpartitiontest.h
+  ${RELATIVE_PATH}hilbertpartitiontest.h
+  ${RELATIVE_PATH}hindexingpartitiontest.h
+  ${RELATIVE_PATH}partitiontestfunctions.h
+  ${RELATIVE_PATH}recursivebisectionpartitiontest.h
+  ${RELATIVE_PATH}scotchpartitiontest.h
+  ${RELATIVE_PATH}stripingpartitiontest.h
+  ${RELATIVE_PATH}unstructuredstripingpartitiontest.h
+  ${RELATIVE_PATH}zcurvepartitiontest.h
+)
@@ -0,0 +1,62 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CheckerboardingPartitionTest_init = false;
+#include "/root/repo/src/libgeodecomp/geometry/partitions/test/unit/checkerboardingpartitiontest.h"
+
+static CheckerboardingPartitionTest suite_CheckerboardingPartitionTest;
+
+static CxxTest::List Tests_CheckerboardingPartitionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CheckerboardingPartitionTest( "/root/repo/src/libgeodecomp/geometry/partitions/test/unit/checkerboardingpartitiontest.h", 11, "CheckerboardingPartitionTest", suite_CheckerboardingPartitionTest, Tests_CheckerboardingPartitionTest );
+
+static class TestDescription_suite_CheckerboardingPartitionTest_test3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CheckerboardingPartitionTest_test3D() : CxxTest::RealTestDescription( Tests_CheckerboardingPartitionTest, suiteDescription_CheckerboardingPartitionTest, 14, "test3D" ) {}
+ void runTest() { suite_CheckerboardingPartitionTest.test3D(); }
+} testDescription_suite_CheckerboardingPartitionTest_test3D;
+
+static class TestDescription_suite_CheckerboardingPartitionTest_test2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CheckerboardingPartitionTest_test2D() : CxxTest::RealTestDescription( Tests_CheckerboardingPartitionTest, suiteDescription_CheckerboardingPartitionTest, 52, "test2D" ) {}
+ void runTest() { suite_CheckerboardingPartitionTest.test2D(); }
+} testDescription_suite_CheckerboardingPartitionTest_test2D;
+
+static class TestDescription_suite_CheckerboardingPartitionTest_test2DwithMoreNodesAndOffset : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CheckerboardingPartitionTest_test2DwithMoreNodesAndOffset() : CxxTest::RealTestDescription( Tests_CheckerboardingPartitionTest, suiteDescription_CheckerboardingPartitionTest, 78, "test2DwithMoreNodesAndOffset" ) {}
+ void runTest() { suite_CheckerboardingPartitionTest.test2DwithMoreNodesAndOffset(); }
+} testDescription_suite_CheckerboardingPartitionTest_test2DwithMoreNodesAndOffset;
+
+static class TestDescription_suite_CheckerboardingPartitionTest_test3DwithNonEvenDivisions : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CheckerboardingPartitionTest_test3DwithNonEvenDivisions() : CxxTest::RealTestDescription( Tests_CheckerboardingPartitionTest, suiteDescription_CheckerboardingPartitionTest, 99, "test3DwithNonEvenDivisions" ) {}
+ void runTest() { suite_CheckerboardingPartitionTest.test3DwithNonEvenDivisions(); }
+} testDescription_suite_CheckerboardingPartitionTest_test3DwithNonEvenDivisions;
+
+static class TestDescription_suite_CheckerboardingPartitionTest_testCostFunction : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CheckerboardingPartitionTest_testCostFunction() : CxxTest::RealTestDescription( Tests_CheckerboardingPartitionTest, suiteDescription_CheckerboardingPartitionTest, 133, "testCostFunction" ) {}
+ void runTest() { suite_CheckerboardingPartitionTest.testCostFunction(); }
+} testDescription_suite_CheckerboardingPartitionTest_testCostFunction;
+
@@ -1,5 +1,6 @@
 #include <libgeodecomp/geometry/coordbox.h>
 #include <libgeodecomp/geometry/partitions/checkerboardingpartition.h>
+#include <libgeodecomp/geometry/partitions/test/unit/partitiontestfunctions.h>
 
 #include <cxxtest/TestSuite.h>
 
@@ -128,6 +129,37 @@ public:
             }
         }
     }
+
+    void testCostFunction()
+    {
+        // the 4 leftmost columns are 7x as expensive as the rest:
+        class TestCost : public CostFunction<2>
+        {
+        public:
+            double operator()(const Coord<2>& coord) const
+            {
+                return (coord.x() < 14) ? 7 : 1;
+            }
+        };
+
+        CoordBox<2> box(Coord<2>(10, 20), Coord<2>(16, 16));
+        TestCost cost;
+        std::vector<std::size_t> weights(4, 1);
+        CheckerboardingPartition<2> p(box.origin, box.dimensions, 0, weights, cost);
+
+        // columns cost 112 (expensive) and 16 (cheap), total is 640.
+        // Cutting after 3 columns yields 336 vs. 304:
+        Region<2> expected[4];
+        expected[0] << CoordBox<2>(Coord<2>(10, 20), Coord<2>( 3, 8));
+        expected[1] << CoordBox<2>(Coord<2>(13, 20), Coord<2>(13, 8));
+        expected[2] << CoordBox<2>(Coord<2>(10, 28), Coord<2>( 3, 8));
+        expected[3] << CoordBox<2>(Coord<2>(13, 28), Coord<2>(13, 8));
+        for (int i = 0; i < 4; ++i) {
+            TS_ASSERT_EQUALS(expected[i], p.getRegion(i));
+        }
+
+        PartitionTestFunctions::checkCostBalance(p, cost, box, 4, 160, 8, false);
+    }
 };
 
 }
@@ -1,5 +1,7 @@
 #include <libgeodecomp/geometry/partitions/hilbertpartition.h>
 
+#include <libgeodecomp/geometry/partitions/test/unit/partitiontestfunctions.h>
+
 #include <cxxtest/TestSuite.h>
 
 using namespace LibGeoDecomp;
@@ -145,6 +147,18 @@ public:
         TS_ASSERT_EQUALS(expectedSorted, actual);
     }
 
+    void testCostFunction()
+    {
+        CoordBox<2> box(Coord<2>(10, 20), Coord<2>(16, 16));
+        std::vector<std::size_t> weights;
+        weights << 64 << 64 << 64 << 64;
+        PartitionTestFunctions::HotspotCost costFunction;
+        HilbertPartition p(box.origin, box.dimensions, 0, weights, costFunction);
+
+        // total cost: 8 * 8 * 10 + 192 * 1 = 832, hence 208 per node:
+        PartitionTestFunctions::checkCostBalance(p, costFunction, box, 4, 208, 10);
+    }
+
 private:
     HilbertPartition partition;
     CoordVector expected, actual;
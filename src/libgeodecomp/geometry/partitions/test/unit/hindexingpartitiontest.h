@@ -1,5 +1,6 @@
 #include <libgeodecomp/geometry/partitions/hindexingpartition.h>
 #include <libgeodecomp/geometry/partitions/stripingpartition.h>
+#include <libgeodecomp/geometry/partitions/test/unit/partitiontestfunctions.h>
 
 #include <cxxtest/TestSuite.h>
 
@@ -203,6 +204,18 @@ public:
 
         TS_ASSERT_EQUALS(expected, actual);
     }
+
+    void testCostFunction()
+    {
+        CoordBox<2> box(Coord<2>(10, 20), Coord<2>(16, 16));
+        std::vector<std::size_t> weights;
+        weights << 64 << 64 << 64 << 64;
+        PartitionTestFunctions::HotspotCost costFunction;
+        HIndexingPartition p(box.origin, box.dimensions, 0, weights, costFunction);
+
+        // total cost: 8 * 8 * 10 + 192 * 1 = 832, hence 208 per node:
+        PartitionTestFunctions::checkCostBalance(p, costFunction, box, 4, 208, 10);
+    }
 };
 
 }
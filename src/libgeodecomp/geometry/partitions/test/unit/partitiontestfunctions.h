@@ -0,0 +1,76 @@
+#ifndef LIBGEODECOMP_GEOMETRY_PARTITIONS_TEST_UNIT_PARTITIONTESTFUNCTIONS_H
+#define LIBGEODECOMP_GEOMETRY_PARTITIONS_TEST_UNIT_PARTITIONTESTFUNCTIONS_H
+
+#include <libgeodecomp/geometry/partitions/partition.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+/**
+ * Shared fixtures to exercise the CostFunction-based constructors of
+ * all Partitions.
+ */
+class PartitionTestFunctions
+{
+public:
+    /**
+     * Models a dense hotspot in the lower left corner which is 10x as
+     * expensive as the background.
+     */
+    class HotspotCost : public CostFunction<2>
+    {
+    public:
+        double operator()(const Coord<2>& coord) const
+        {
+            return ((coord.x() < 18) && (coord.y() < 28)) ? 10 : 1;
+        }
+    };
+
+    /**
+     * Checks that the regions of all numNodes nodes are disjoint,
+     * cover box exactly, and that the cost of each lies within
+     * expectedCost +/- tolerance. If checkWeights is set, the
+     * partition's weights need to reflect the cell counts.
+     */
+    template<typename PARTITION, int DIM>
+    static void checkCostBalance(
+        const PARTITION& partition,
+        const CostFunction<DIM>& cost,
+        const CoordBox<DIM>& box,
+        const std::size_t numNodes,
+        const double expectedCost,
+        const double tolerance,
+        const bool checkWeights = true)
+    {
+        Region<DIM> all;
+        std::size_t cellCount = 0;
+        for (std::size_t i = 0; i < numNodes; ++i) {
+            Region<DIM> r = partition.getRegion(i);
+            TS_ASSERT((all & r).empty());
+            all += r;
+            cellCount += r.size();
+            if (checkWeights) {
+                TS_ASSERT_EQUALS(r.size(), partition.getWeights()[i]);
+            }
+
+            double sum = 0;
+            for (typename Region<DIM>::Iterator j = r.begin(); j != r.end(); ++j) {
+                sum += cost(*j);
+            }
+            TS_ASSERT_LESS_THAN_EQUALS(expectedCost - tolerance, sum);
+            TS_ASSERT_LESS_THAN_EQUALS(sum, expectedCost + tolerance);
+        }
+
+        Region<DIM> expected;
+        expected << box;
+        TS_ASSERT_EQUALS(expected, all);
+        TS_ASSERT_EQUALS(std::size_t(box.dimensions.prod()), cellCount);
+    }
+};
+
+}
+
+#endif
@@ -1,4 +1,5 @@
 #include <libgeodecomp/geometry/partitions/recursivebisectionpartition.h>
+#include <libgeodecomp/storage/grid.h>
 
 #include <cxxtest/TestSuite.h>
 
@@ -92,6 +93,32 @@ public:
         checkCuboid(weights, 3, Coord<2>(48, 16), Coord<2>(48, 16), dim, dimWeights);
     }
 
+    void testCostFunction()
+    {
+        std::vector<std::size_t> weights;
+        weights << 100 << 100;
+        Coord<2> dim(20, 10);
+
+        // the first 5 columns are 10x as expensive as the rest:
+        Grid<double> costs(dim, 1.0);
+        for (int y = 0; y < 10; ++y) {
+            for (int x = 0; x < 5; ++x) {
+                costs.set(Coord<2>(x, y), 10.0);
+            }
+        }
+
+        RecursiveBisectionPartition<2> p(
+            Coord<2>(),
+            dim,
+            0,
+            weights,
+            GridCostFunction<2>(costs));
+
+        // total cost is 650, the first 3 columns amount to 300:
+        TS_ASSERT_EQUALS(genRegion(0, 0,  3, 10), p.getRegion(0));
+        TS_ASSERT_EQUALS(genRegion(3, 0, 17, 10), p.getRegion(1));
+    }
+
     void testDegradedDimensions()
     {
         std::vector<std::size_t> weights;
@@ -143,7 +170,13 @@ public:
         return r;
     }
 
+    Region<2> genRegion(int o1, int o2, int d1, int d2)
+    {
+        Region<2> r;
+        r << CoordBox<2>(Coord<2>(o1, o2), Coord<2>(d1, d2));
 
+        return r;
+    }
 };
 
 }
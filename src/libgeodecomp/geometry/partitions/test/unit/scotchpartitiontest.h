@@ -2,6 +2,7 @@
 
 #include <libgeodecomp/geometry/coordbox.h>
 #include <libgeodecomp/geometry/partitions/scotchpartition.h>
+#include <libgeodecomp/geometry/partitions/test/unit/partitiontestfunctions.h>
 
 using namespace LibGeoDecomp;
 
@@ -112,6 +113,20 @@ public:
 #endif
      }
 
+    void testCostFunction()
+    {
+#ifdef LIBGEODECOMP_WITH_SCOTCH
+        CoordBox<2> box(Coord<2>(10, 20), Coord<2>(16, 16));
+        std::vector<std::size_t> weights;
+        weights << 64 << 64 << 64 << 64;
+        PartitionTestFunctions::HotspotCost costFunction;
+        ScotchPartition<2> p(box.origin, box.dimensions, 0, weights, costFunction);
+
+        // total cost: 8 * 8 * 10 + 192 * 1 = 832, hence 208 per
+        // node. Scotch tolerates some imbalance, hence the slack:
+        PartitionTestFunctions::checkCostBalance(p, costFunction, box, 4, 208, 30, false);
+#endif
+    }
 };
 
 }
@@ -0,0 +1,86 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_StripingPartitionTest_init = false;
+#include "/root/repo/src/libgeodecomp/geometry/partitions/test/unit/stripingpartitiontest.h"
+
+static StripingPartitionTest suite_StripingPartitionTest;
+
+static CxxTest::List Tests_StripingPartitionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_StripingPartitionTest( "/root/repo/src/libgeodecomp/geometry/partitions/test/unit/stripingpartitiontest.h", 11, "StripingPartitionTest", suite_StripingPartitionTest, Tests_StripingPartitionTest );
+
+static class TestDescription_suite_StripingPartitionTest_testSimple : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingPartitionTest_testSimple() : CxxTest::RealTestDescription( Tests_StripingPartitionTest, suiteDescription_StripingPartitionTest, 33, "testSimple" ) {}
+ void runTest() { suite_StripingPartitionTest.testSimple(); }
+} testDescription_suite_StripingPartitionTest_testSimple;
+
+static class TestDescription_suite_StripingPartitionTest_testVertical : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingPartitionTest_testVertical() : CxxTest::RealTestDescription( Tests_StripingPartitionTest, suiteDescription_StripingPartitionTest, 39, "testVertical" ) {}
+ void runTest() { suite_StripingPartitionTest.testVertical(); }
+} testDescription_suite_StripingPartitionTest_testVertical;
+
+static class TestDescription_suite_StripingPartitionTest_testHorizontal : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingPartitionTest_testHorizontal() : CxxTest::RealTestDescription( Tests_StripingPartitionTest, suiteDescription_StripingPartitionTest, 45, "testHorizontal" ) {}
+ void runTest() { suite_StripingPartitionTest.testHorizontal(); }
+} testDescription_suite_StripingPartitionTest_testHorizontal;
+
+static class TestDescription_suite_StripingPartitionTest_testNormal : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingPartitionTest_testNormal() : CxxTest::RealTestDescription( Tests_StripingPartitionTest, suiteDescription_StripingPartitionTest, 51, "testNormal" ) {}
+ void runTest() { suite_StripingPartitionTest.testNormal(); }
+} testDescription_suite_StripingPartitionTest_testNormal;
+
+static class TestDescription_suite_StripingPartitionTest_testOffset : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingPartitionTest_testOffset() : CxxTest::RealTestDescription( Tests_StripingPartitionTest, suiteDescription_StripingPartitionTest, 60, "testOffset" ) {}
+ void runTest() { suite_StripingPartitionTest.testOffset(); }
+} testDescription_suite_StripingPartitionTest_testOffset;
+
+static class TestDescription_suite_StripingPartitionTest_testSquareBracketsOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingPartitionTest_testSquareBracketsOperator() : CxxTest::RealTestDescription( Tests_StripingPartitionTest, suiteDescription_StripingPartitionTest, 70, "testSquareBracketsOperator" ) {}
+ void runTest() { suite_StripingPartitionTest.testSquareBracketsOperator(); }
+} testDescription_suite_StripingPartitionTest_testSquareBracketsOperator;
+
+static class TestDescription_suite_StripingPartitionTest_test3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingPartitionTest_test3D() : CxxTest::RealTestDescription( Tests_StripingPartitionTest, suiteDescription_StripingPartitionTest, 84, "test3D" ) {}
+ void runTest() { suite_StripingPartitionTest.test3D(); }
+} testDescription_suite_StripingPartitionTest_test3D;
+
+static class TestDescription_suite_StripingPartitionTest_testCostFunction : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingPartitionTest_testCostFunction() : CxxTest::RealTestDescription( Tests_StripingPartitionTest, suiteDescription_StripingPartitionTest, 106, "testCostFunction" ) {}
+ void runTest() { suite_StripingPartitionTest.testCostFunction(); }
+} testDescription_suite_StripingPartitionTest_testCostFunction;
+
+static class TestDescription_suite_StripingPartitionTest_testPartitionFactory : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingPartitionTest_testPartitionFactory() : CxxTest::RealTestDescription( Tests_StripingPartitionTest, suiteDescription_StripingPartitionTest, 137, "testPartitionFactory" ) {}
+ void runTest() { suite_StripingPartitionTest.testPartitionFactory(); }
+} testDescription_suite_StripingPartitionTest_testPartitionFactory;
+
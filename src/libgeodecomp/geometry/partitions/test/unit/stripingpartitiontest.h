@@ -1,5 +1,6 @@
 #include <libgeodecomp/geometry/coordbox.h>
 #include <libgeodecomp/geometry/partitions/stripingpartition.h>
+#include <libgeodecomp/storage/grid.h>
 
 #include <cxxtest/TestSuite.h>
 
@@ -102,6 +103,62 @@ public:
         TS_ASSERT_EQUALS(expected, actual);
     }
 
+    void testCostFunction()
+    {
+        // the upper half is 10x as expensive as the lower half:
+        Grid<double> costs(Coord<2>(10, 10), 1.0);
+        for (int y = 5; y < 10; ++y) {
+            for (int x = 0; x < 10; ++x) {
+                costs.set(Coord<2>(x, y), 10.0);
+            }
+        }
+
+        std::vector<std::size_t> weights;
+        weights << 50 << 50;
+        StripingPartition<2> p(Coord<2>(), Coord<2>(10, 10), 0, weights, GridCostFunction<2>(costs));
+
+        // 50 cheap cells plus 23 expensive ones yield 280, the
+        // remaining 27 expensive cells amount to 270:
+        std::vector<std::size_t> expectedWeights;
+        expectedWeights << 73 << 27;
+        TS_ASSERT_EQUALS(expectedWeights, p.getWeights());
+
+        Region<2> expected0;
+        expected0 << CoordBox<2>(Coord<2>(0, 0), Coord<2>(10, 7))
+                  << CoordBox<2>(Coord<2>(0, 7), Coord<2>( 3, 1));
+        TS_ASSERT_EQUALS(expected0, p.getRegion(0));
+
+        Region<2> expected1;
+        expected1 << CoordBox<2>(Coord<2>(0, 0), Coord<2>(10, 10));
+        expected1 -= expected0;
+        TS_ASSERT_EQUALS(expected1, p.getRegion(1));
+    }
+
+    void testPartitionFactory()
+    {
+        Grid<double> costs(Coord<2>(10, 10), 1.0);
+        for (int y = 5; y < 10; ++y) {
+            for (int x = 0; x < 10; ++x) {
+                costs.set(Coord<2>(x, y), 10.0);
+            }
+        }
+        GridCostFunction<2> costFunction(costs);
+
+        std::vector<std::size_t> weights;
+        weights << 50 << 50;
+        typedef PartitionFactory<StripingPartition<2> > Factory;
+
+        SharedPtr<StripingPartition<2> >::Type plain(
+            Factory::create(Coord<2>(), Coord<2>(10, 10), 0, weights, Partition<2>::AdjacencyPtr()));
+        TS_ASSERT_EQUALS(weights, plain->getWeights());
+
+        SharedPtr<StripingPartition<2> >::Type balanced(
+            Factory::create(Coord<2>(), Coord<2>(10, 10), 0, weights, Partition<2>::AdjacencyPtr(), &costFunction));
+        std::vector<std::size_t> expectedWeights;
+        expectedWeights << 73 << 27;
+        TS_ASSERT_EQUALS(expectedWeights, balanced->getWeights());
+    }
+
 private:
     CoordVector  expected;
 };
@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_UnstructuredStripingPartitionTest_init = false;
+#include "/root/repo/src/libgeodecomp/geometry/partitions/test/unit/unstructuredstripingpartitiontest.h"
+
+static UnstructuredStripingPartitionTest suite_UnstructuredStripingPartitionTest;
+
+static CxxTest::List Tests_UnstructuredStripingPartitionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_UnstructuredStripingPartitionTest( "/root/repo/src/libgeodecomp/geometry/partitions/test/unit/unstructuredstripingpartitiontest.h", 10, "UnstructuredStripingPartitionTest", suite_UnstructuredStripingPartitionTest, Tests_UnstructuredStripingPartitionTest );
+
+static class TestDescription_suite_UnstructuredStripingPartitionTest_testSingleDomain : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredStripingPartitionTest_testSingleDomain() : CxxTest::RealTestDescription( Tests_UnstructuredStripingPartitionTest, suiteDescription_UnstructuredStripingPartitionTest, 13, "testSingleDomain" ) {}
+ void runTest() { suite_UnstructuredStripingPartitionTest.testSingleDomain(); }
+} testDescription_suite_UnstructuredStripingPartitionTest_testSingleDomain;
+
+static class TestDescription_suite_UnstructuredStripingPartitionTest_testMultipleDomains : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredStripingPartitionTest_testMultipleDomains() : CxxTest::RealTestDescription( Tests_UnstructuredStripingPartitionTest, suiteDescription_UnstructuredStripingPartitionTest, 33, "testMultipleDomains" ) {}
+ void runTest() { suite_UnstructuredStripingPartitionTest.testMultipleDomains(); }
+} testDescription_suite_UnstructuredStripingPartitionTest_testMultipleDomains;
+
+static class TestDescription_suite_UnstructuredStripingPartitionTest_testCostFunction : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredStripingPartitionTest_testCostFunction() : CxxTest::RealTestDescription( Tests_UnstructuredStripingPartitionTest, suiteDescription_UnstructuredStripingPartitionTest, 52, "testCostFunction" ) {}
+ void runTest() { suite_UnstructuredStripingPartitionTest.testCostFunction(); }
+} testDescription_suite_UnstructuredStripingPartitionTest_testCostFunction;
+
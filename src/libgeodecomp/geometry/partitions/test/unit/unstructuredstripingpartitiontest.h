@@ -1,4 +1,5 @@
 #include <libgeodecomp/geometry/partitions/unstructuredstripingpartition.h>
+#include <libgeodecomp/geometry/partitions/test/unit/partitiontestfunctions.h>
 
 #include <cxxtest/TestSuite.h>
 
@@ -47,6 +48,36 @@ public:
         TS_ASSERT_EQUALS(partition.getRegion(1), expected1);
         TS_ASSERT_EQUALS(partition.getRegion(2), expected2);
     }
+
+    void testCostFunction()
+    {
+        // IDs 100-119 are 4x as expensive as the rest:
+        class TestCost : public CostFunction<1>
+        {
+        public:
+            double operator()(const Coord<1>& coord) const
+            {
+                return (coord.x() < 120) ? 4 : 1;
+            }
+        };
+
+        std::vector<std::size_t> weights(4, 25);
+        TestCost cost;
+        UnstructuredStripingPartition partition(Coord<1>(100), Coord<1>(100), 0, weights, cost);
+
+        // total cost is 80 + 80 = 160, hence 40 per node:
+        Region<1> expected[4];
+        expected[0] << Streak<1>(Coord<1>(100), 110);
+        expected[1] << Streak<1>(Coord<1>(110), 120);
+        expected[2] << Streak<1>(Coord<1>(120), 160);
+        expected[3] << Streak<1>(Coord<1>(160), 200);
+        for (int i = 0; i < 4; ++i) {
+            TS_ASSERT_EQUALS(partition.getRegion(i), expected[i]);
+        }
+
+        PartitionTestFunctions::checkCostBalance(
+            partition, cost, CoordBox<1>(Coord<1>(100), Coord<1>(100)), 4, 40, 0);
+    }
 };
 
 }
@@ -1,5 +1,7 @@
 #include <libgeodecomp/geometry/partitions/zcurvepartition.h>
 
+#include <libgeodecomp/geometry/partitions/test/unit/partitiontestfunctions.h>
+
 #include <cxxtest/TestSuite.h>
 
 using namespace LibGeoDecomp;
@@ -187,6 +189,18 @@ public:
     }
 
 
+    void testCostFunction()
+    {
+        CoordBox<2> box(Coord<2>(10, 20), Coord<2>(16, 16));
+        std::vector<std::size_t> weights;
+        weights << 64 << 64 << 64 << 64;
+        PartitionTestFunctions::HotspotCost costFunction;
+        ZCurvePartition<2> p(box.origin, box.dimensions, 0, weights, costFunction);
+
+        // total cost: 8 * 8 * 10 + 192 * 1 = 832, hence 208 per node:
+        PartitionTestFunctions::checkCostBalance(p, costFunction, box, 4, 208, 10);
+    }
+
 private:
     ZCurvePartition<2> partition;
     CoordVector expected, actual;
@@ -20,7 +20,7 @@ public:
     using Partition<1>::startOffsets;
     using Partition<1>::weights;
     using Partition<1>::AdjacencyPtr;
-
+    typedef void SupportsCostFunction;
 
     UnstructuredStripingPartition(
         const Coord<1> origin,
@@ -31,6 +31,24 @@ public:
         Partition<1>(origin.x() + offset, weights)
     {}
 
+    /**
+     * Cuts the ID range at equal (weighted) prefix sums of the
+     * cells' costs instead of equal cell counts.
+     */
+    UnstructuredStripingPartition(
+        const Coord<1> origin,
+        const Coord<1> /* unused: dimensions */,
+        const long offset,
+        const std::vector<std::size_t>& weights,
+        const CostFunction<1>& cost,
+        const AdjacencyPtr& /* unused: adjacency */ = AdjacencyPtr()) :
+        Partition<1>(origin.x() + offset, weights)
+    {
+        Region<1> region;
+        region << Streak<1>(Coord<1>(startOffsets.front()), startOffsets.back());
+        balanceCost(region.begin(), region.end(), cost);
+    }
+
     Region<1> getRegion(const std::size_t node) const
 #ifdef LIBGEODECOMP_WITH_CPP14
         override
@@ -32,6 +32,7 @@ public:
     typedef typename SharedPtr<CacheType>::Type Cache;
     typedef typename Topologies::Cube<DIM>::Topology Topology;
     typedef typename Partition<DIM>::AdjacencyPtr AdjacencyPtr;
+    typedef void SupportsCostFunction;
 
     class Square
     {
@@ -287,6 +288,24 @@ public:
         dimensions(dimensions)
     {}
 
+    /**
+     * Cuts the curve at equal (weighted) prefix sums of the cells'
+     * costs instead of equal cell counts.
+     */
+    inline ZCurvePartition(
+        const Coord<DIM>& origin,
+        const Coord<DIM>& dimensions,
+        const long& offset,
+        const std::vector<std::size_t>& weights,
+        const CostFunction<DIM>& cost,
+        const AdjacencyPtr& /* unused: adjacency */ = AdjacencyPtr()) :
+        SpaceFillingCurve<DIM>(offset, weights),
+        origin(origin),
+        dimensions(dimensions)
+    {
+        this->balanceCost((*this)[startOffsets[0]], end(), cost);
+    }
+
     inline Iterator operator[](unsigned i) const
     {
         return Iterator(origin, dimensions, i);
@@ -1,15 +1,21 @@
 #ifndef LIBGEODECOMP_GEOMETRY_REGION_H
 #define LIBGEODECOMP_GEOMETRY_REGION_H
 
+#include <libgeodecomp/config.h>
 #include <libgeodecomp/geometry/coordbox.h>
 #include <libgeodecomp/geometry/regionstreakiterator.h>
 #include <libgeodecomp/geometry/streak.h>
 #include <libgeodecomp/geometry/topologies.h>
 #include <libgeodecomp/misc/stdcontaineroverloads.h>
 #include <libgeodecomp/storage/selector.h>
+#include <algorithm>
 #include <cstddef>
 #include <vector>
 
+#ifdef LIBGEODECOMP_WITH_THREADS
+#include <omp.h>
+#endif
+
 namespace LibGeoDecomp {
 
 template<typename CELL_TYPE, int DIM>
@@ -762,11 +768,9 @@ public:
         Coord<DIM> xOffset;
         xOffset[0] = -radii[0];
 
-        StreakIterator end = endStreak(xOffset, radii[0] * 2);
         // expansion in X dimension is a simple 1-pass operation:
-        for (StreakIterator i = beginStreak(xOffset, radii[0] * 2); i != end; ++i) {
-            accumulator << *i;
-        }
+        std::vector<Operand> operands(1, Operand(this, xOffset, radii[0] * 2));
+        applyPlanewise(accumulator, MergeOperation(), operands);
 
         // expand into other dimensions, one after another
         for (int d = 1; d < DIM; ++d) {
@@ -794,12 +798,10 @@ public:
         Region current;
 
         for (StreakIterator i = stencil.beginStreak(); i != stencil.endStreak(); ++i) {
-            merge2way(
-                accumulator,
-                current.beginStreak(),
-                current.endStreak(),
-                beginStreak(i->origin, i->length() - 1),
-                endStreak(  i->origin, i->length() - 1));
+            std::vector<Operand> operands;
+            operands.push_back(Operand(&current));
+            operands.push_back(Operand(this, i->origin, i->length() - 1));
+            applyPlanewise(accumulator, MergeOperation(), operands);
 
             current.clear();
             using std::swap;
@@ -870,11 +872,12 @@ public:
         Region<1> ret = *this;
         Region<1> newCoords = *this;
 
-        // neighbors vector is defined outside of the loop to avoid reallocations
+        // vectors are defined outside of the loop to avoid reallocations
         std::vector<int> neighbors;
+        std::vector<int> allNeighbors;
 
         for (unsigned pass = 0; pass < width; ++pass) {
-            Region add;
+            allNeighbors.clear();
 
             // walk over all indices and remember adjacent neighbors
             // this is done in a separate pass to ensure that
@@ -885,16 +888,20 @@ public:
                 for (int x = streak->origin.x(); x < streak->endX; ++x) {
                     neighbors.clear();
                     adjacency.getNeighbors(x, &neighbors);
-
-                    for (std::vector<int>::const_iterator i = neighbors.begin(); i != neighbors.end(); ++i) {
-                        Coord<DIM> c(*i);
-                        if (ret.count(c) == 0) {
-                            add << c;
-                        }
-                    }
+                    allNeighbors.insert(allNeighbors.end(), neighbors.begin(), neighbors.end());
                 }
             }
 
+            // sorting the neighbors lets us append them to the Region
+            // instead of inserting them at random positions, and a
+            // single subtraction replaces one lookup per neighbor:
+            std::sort(allNeighbors.begin(), allNeighbors.end());
+            Region add;
+            for (std::vector<int>::const_iterator i = allNeighbors.begin(); i != allNeighbors.end(); ++i) {
+                add << Coord<DIM>(*i);
+            }
+            add -= ret;
+
             ret += add;
             using std::swap;
             swap(add, newCoords);
@@ -1040,11 +1047,7 @@ public:
      */
     inline Region operator-(const Region& other) const
     {
-        using std::max;
-        using std::min;
         Region ret;
-        // these conditionals are less a shortcut but more a guarantee
-        // that the derefernce below will succeed:
         if (this->empty()) {
             return ret;
         }
@@ -1052,48 +1055,10 @@ public:
             return *this;
         }
 
-        StreakIterator myIter = beginStreak();
-        StreakIterator otherIter = other.beginStreak();
-
-        StreakIterator myEnd = endStreak();
-        StreakIterator otherEnd = other.endStreak();
-
-        Streak<DIM> cursor = *myIter;
-
-        for (;;) {
-            if (RegionHelpers::RegionIntersectHelper<DIM - 1>::intersects(cursor, *otherIter)) {
-                int intersectionOriginX = (max)(cursor.origin.x(), otherIter->origin.x());
-                int intersectionEndX = (min)(cursor.endX, otherIter->endX);
-
-                ret << Streak<DIM>(cursor.origin, intersectionOriginX);
-                cursor.origin.x() = intersectionEndX;
-            }
-
-            if (RegionHelpers::RegionIntersectHelper<DIM - 1>::lessThan(cursor, *otherIter)) {
-                ret << cursor;
-                ++myIter;
-
-                if (myIter == myEnd) {
-                    break;
-                } else {
-                    cursor = *myIter;
-                }
-            } else {
-                ++otherIter;
-                if (otherIter == otherEnd) {
-                    break;
-                }
-            }
-        }
-
-        // don't loose the remainder
-        ret << cursor;
-        if (myIter != myEnd) {
-            ++myIter;
-            for (; myIter != myEnd; ++myIter) {
-                ret << *myIter;
-            }
-        }
+        std::vector<Operand> operands;
+        operands.push_back(Operand(this));
+        operands.push_back(Operand(&other));
+        applyPlanewise(ret, SubtractOperation(), operands);
 
         return ret;
     }
@@ -1109,35 +1074,16 @@ public:
      */
     inline Region operator&(const Region& other) const
     {
-        using std::max;
-        using std::min;
         Region ret;
-        StreakIterator myIter = beginStreak();
-        StreakIterator otherIter = other.beginStreak();
-
-        StreakIterator myEnd = endStreak();
-        StreakIterator otherEnd = other.endStreak();
-
-        for (;;) {
-            if ((myIter == myEnd) ||
-                (otherIter == otherEnd)) {
-                break;
-            }
-
-            if (RegionHelpers::RegionIntersectHelper<DIM - 1>::intersects(*myIter, *otherIter)) {
-                Streak<DIM> intersection = *myIter;
-                intersection.origin.x() = (max)(myIter->origin.x(), otherIter->origin.x());
-                intersection.endX = (min)(myIter->endX, otherIter->endX);
-                ret << intersection;
-            }
-
-            if (RegionHelpers::RegionIntersectHelper<DIM - 1>::lessThan(*myIter, *otherIter)) {
-                ++myIter;
-            } else {
-                ++otherIter;
-            }
+        if (this->empty() || other.empty()) {
+            return ret;
         }
 
+        std::vector<Operand> operands;
+        operands.push_back(Operand(this));
+        operands.push_back(Operand(&other));
+        applyPlanewise(ret, IntersectOperation(), operands);
+
         return ret;
     }
 
@@ -1208,10 +1154,10 @@ public:
         // else: normal merge
         Region ret;
 
-        merge2way(
-            ret,
-            this->beginStreak(), this->endStreak(),
-            other.beginStreak(), other.endStreak());
+        std::vector<Operand> operands;
+        operands.push_back(Operand(this));
+        operands.push_back(Operand(&other));
+        applyPlanewise(ret, MergeOperation(), operands);
 
         return ret;
     }
@@ -1502,6 +1448,18 @@ private:
         Streak<DIM> lastInsert;
 
         for (;;) {
+            // fast path for runs of identical Streaks (e.g. when
+            // merging overlapping Regions): insert once, skip both
+            if (*iterA == *iterB) {
+                LIBGEODECOMP_REGION_ADVANCE_ITERATOR(iterA, endA);
+                ++iterB;
+                if (iterB == endB) {
+                    break;
+                }
+
+                continue;
+            }
+
             if (RegionHelpers::RegionIntersectHelper<DIM - 1>::lessThan(*iterA, *iterB)) {
                 LIBGEODECOMP_REGION_ADVANCE_ITERATOR(iterA, endA);
             } else {
@@ -1596,6 +1554,366 @@ private:
 
 #undef LIBGEODECOMP_REGION_ADVANCE_ITERATOR
 
+    /**
+     * Computes the set difference of the Streaks in [beginA, endA)
+     * and [beginB, endB) and adds it to ret.
+     */
+    inline static void subtract(
+        Region& ret,
+        const StreakIterator& beginA, const StreakIterator& endA,
+        const StreakIterator& beginB, const StreakIterator& endB)
+    {
+        using std::max;
+        using std::min;
+
+        if (beginA == endA) {
+            return;
+        }
+        if (beginB == endB) {
+            for (StreakIterator i = beginA; i != endA; ++i) {
+                ret << *i;
+            }
+            return;
+        }
+
+        StreakIterator myIter = beginA;
+        StreakIterator otherIter = beginB;
+        Streak<DIM> cursor = *myIter;
+
+        for (;;) {
+            // fast path for runs of identical Streaks, which simply
+            // cancel each other out:
+            if (cursor == *otherIter) {
+                ++myIter;
+                ++otherIter;
+                if (myIter == endA) {
+                    return;
+                }
+
+                cursor = *myIter;
+                if (otherIter == endB) {
+                    break;
+                }
+
+                continue;
+            }
+
+            if (RegionHelpers::RegionIntersectHelper<DIM - 1>::intersects(cursor, *otherIter)) {
+                int intersectionOriginX = (max)(cursor.origin.x(), otherIter->origin.x());
+                int intersectionEndX = (min)(cursor.endX, otherIter->endX);
+
+                ret << Streak<DIM>(cursor.origin, intersectionOriginX);
+                cursor.origin.x() = intersectionEndX;
+            }
+
+            if (RegionHelpers::RegionIntersectHelper<DIM - 1>::lessThan(cursor, *otherIter)) {
+                ret << cursor;
+                ++myIter;
+
+                if (myIter == endA) {
+                    return;
+                } else {
+                    cursor = *myIter;
+                }
+            } else {
+                ++otherIter;
+                if (otherIter == endB) {
+                    break;
+                }
+            }
+        }
+
+        // don't loose the remainder
+        ret << cursor;
+        for (++myIter; myIter != endA; ++myIter) {
+            ret << *myIter;
+        }
+    }
+
+    /**
+     * Adds the intersection of the Streaks in [beginA, endA) and
+     * [beginB, endB) to ret.
+     */
+    inline static void intersect(
+        Region& ret,
+        const StreakIterator& beginA, const StreakIterator& endA,
+        const StreakIterator& beginB, const StreakIterator& endB)
+    {
+        using std::max;
+        using std::min;
+
+        StreakIterator myIter = beginA;
+        StreakIterator otherIter = beginB;
+
+        for (;;) {
+            if ((myIter == endA) ||
+                (otherIter == endB)) {
+                break;
+            }
+
+            // fast path for runs of identical Streaks (e.g. when
+            // intersecting a Region with a superset):
+            if (*myIter == *otherIter) {
+                ret << *myIter;
+                ++myIter;
+                ++otherIter;
+                continue;
+            }
+
+            if (RegionHelpers::RegionIntersectHelper<DIM - 1>::intersects(*myIter, *otherIter)) {
+                Streak<DIM> intersection = *myIter;
+                intersection.origin.x() = (max)(myIter->origin.x(), otherIter->origin.x());
+                intersection.endX = (min)(myIter->endX, otherIter->endX);
+                ret << intersection;
+            }
+
+            if (RegionHelpers::RegionIntersectHelper<DIM - 1>::lessThan(*myIter, *otherIter)) {
+                ++myIter;
+            } else {
+                ++otherIter;
+            }
+        }
+    }
+
+    /**
+     * An argument to applyPlanewise(): a Region whose Streaks may be
+     * shifted and elongated, just like with beginStreak() and
+     * endStreak().
+     */
+    class Operand
+    {
+    public:
+        inline explicit Operand(
+            const Region *region,
+            const Coord<DIM>& offset = Coord<DIM>(),
+            int additionalLength = 0) :
+            region(region),
+            offset(offset),
+            additionalLength(additionalLength)
+        {}
+
+        inline StreakIterator begin() const
+        {
+            return region->beginStreak(offset, additionalLength);
+        }
+
+        inline StreakIterator end() const
+        {
+            return region->endStreak(offset, additionalLength);
+        }
+
+        /**
+         * Yields an iterator to the first Streak whose (shifted)
+         * plane coordinate is not less than z.
+         */
+        inline StreakIterator planeOnOrAfter(int z) const
+        {
+            const IndexVectorType& planes = region->indices[DIM - 1];
+            IndexVectorType::const_iterator i = RegionHelpers::lowerBound(
+                planes.begin(),
+                planes.end(),
+                IntPair(z - offset[DIM - 1], 0),
+                RegionHelpers::RegionCommonHelper::pairCompareFirst);
+
+            if (i == planes.end()) {
+                return end();
+            }
+
+            return StreakIterator(
+                region,
+                RegionHelpers::StreakIteratorInitPlaneOffset<DIM - 1>(std::size_t(i - planes.begin())),
+                offset,
+                additionalLength);
+        }
+
+        const Region *region;
+        Coord<DIM> offset;
+        int additionalLength;
+    };
+
+    /**
+     * Merges one (i.e. copies), two, or three ranges of Streaks.
+     */
+    class MergeOperation
+    {
+    public:
+        inline void operator()(
+            Region& ret,
+            const std::vector<StreakIterator>& begins,
+            const std::vector<StreakIterator>& ends) const
+        {
+            if (begins.size() == 1) {
+                for (StreakIterator i = begins[0]; i != ends[0]; ++i) {
+                    ret << *i;
+                }
+                return;
+            }
+
+            if (begins.size() == 2) {
+                merge2way(ret, begins[0], ends[0], begins[1], ends[1]);
+                return;
+            }
+
+            merge3way(ret, begins[0], ends[0], begins[1], ends[1], begins[2], ends[2]);
+        }
+    };
+
+    /**
+     * Subtracts the second range of Streaks from the first one.
+     */
+    class SubtractOperation
+    {
+    public:
+        inline void operator()(
+            Region& ret,
+            const std::vector<StreakIterator>& begins,
+            const std::vector<StreakIterator>& ends) const
+        {
+            subtract(ret, begins[0], ends[0], begins[1], ends[1]);
+        }
+    };
+
+    /**
+     * Intersects two ranges of Streaks.
+     */
+    class IntersectOperation
+    {
+    public:
+        inline void operator()(
+            Region& ret,
+            const std::vector<StreakIterator>& begins,
+            const std::vector<StreakIterator>& ends) const
+        {
+            intersect(ret, begins[0], ends[0], begins[1], ends[1]);
+        }
+    };
+
+    /**
+     * Applies the set operation to the operands and stores the
+     * result in ret, which is expected to be empty. None of the
+     * operations lets Streaks travel from one plane to another, so
+     * for large operands we cut all of them along the same plane
+     * coordinates into chunks, process these concurrently and
+     * concatenate the partial results.
+     */
+    template<typename OPERATION>
+    static inline void applyPlanewise(
+        Region& ret,
+        const OPERATION& operation,
+        const std::vector<Operand>& operands)
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        std::vector<int> splits = planewiseSplits(operands);
+        if (!splits.empty() && ret.empty()) {
+            int numChunks = int(splits.size()) + 1;
+            std::vector<Region> chunks(numChunks);
+
+#pragma omp parallel for schedule(dynamic)
+            for (int c = 0; c < numChunks; ++c) {
+                std::vector<StreakIterator> begins;
+                std::vector<StreakIterator> ends;
+
+                for (typename std::vector<Operand>::const_iterator i = operands.begin();
+                     i != operands.end();
+                     ++i) {
+                    begins.push_back((c == 0)             ? i->begin() : i->planeOnOrAfter(splits[c - 1]));
+                    ends.push_back(  (c == numChunks - 1) ? i->end()   : i->planeOnOrAfter(splits[c]));
+                }
+
+                operation(chunks[c], begins, ends);
+            }
+
+            for (int c = 0; c < numChunks; ++c) {
+                ret.appendPlanes(chunks[c]);
+            }
+
+            return;
+        }
+#endif
+
+        std::vector<StreakIterator> begins;
+        std::vector<StreakIterator> ends;
+        for (typename std::vector<Operand>::const_iterator i = operands.begin(); i != operands.end(); ++i) {
+            begins.push_back(i->begin());
+            ends.push_back(i->end());
+        }
+
+        operation(ret, begins, ends);
+    }
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+    /**
+     * Operands with less Streaks than this are merged sequentially as
+     * the threading overhead would dominate.
+     */
+    static const std::size_t PLANEWISE_PARALLELIZATION_THRESHOLD = 1 << 14;
+
+    /**
+     * Yields the plane coordinates at which applyPlanewise() should
+     * cut the operands, or an empty vector if the operation should
+     * rather run sequentially (e.g. if we're already inside a
+     * parallel region). Cuts are spread evenly across the planes of
+     * the largest operand.
+     */
+    static inline std::vector<int> planewiseSplits(const std::vector<Operand>& operands)
+    {
+        std::vector<int> splits;
+        if ((DIM < 2) || operands.empty() || omp_in_parallel() || (omp_get_max_threads() < 2)) {
+            return splits;
+        }
+
+        std::size_t numStreaks = 0;
+        const Operand *largest = &operands[0];
+        for (typename std::vector<Operand>::const_iterator i = operands.begin(); i != operands.end(); ++i) {
+            numStreaks += i->region->numStreaks();
+            if (i->region->numPlanes() > largest->region->numPlanes()) {
+                largest = &*i;
+            }
+        }
+        if (numStreaks < PLANEWISE_PARALLELIZATION_THRESHOLD) {
+            return splits;
+        }
+
+        // a couple of chunks per thread help to balance the load:
+        std::size_t numPlanes = largest->region->numPlanes();
+        std::size_t numChunks = (std::min)(numPlanes, std::size_t(omp_get_max_threads()) * 4);
+        const IndexVectorType& planes = largest->region->indices[DIM - 1];
+
+        for (std::size_t i = 1; i < numChunks; ++i) {
+            splits.push_back(planes[i * numPlanes / numChunks].first + largest->offset[DIM - 1]);
+        }
+
+        return splits;
+    }
+#endif
+
+    /**
+     * Appends all Streaks of other to this Region. All planes of
+     * other need to succeed the ones of this Region. Runs in O(n)
+     * with n being the size of other's indices.
+     */
+    inline void appendPlanes(const Region& other)
+    {
+        if (other.empty()) {
+            return;
+        }
+
+        std::size_t oldSizes[DIM];
+        for (int d = 0; d < DIM; ++d) {
+            oldSizes[d] = indices[d].size();
+        }
+
+        indices[0].insert(indices[0].end(), other.indices[0].begin(), other.indices[0].end());
+        for (int d = 1; d < DIM; ++d) {
+            indices[d].reserve(oldSizes[d] + other.indices[d].size());
+            for (IndexVectorType::const_iterator i = other.indices[d].begin(); i != other.indices[d].end(); ++i) {
+                indices[d].push_back(IntPair(i->first, i->second + int(oldSizes[d - 1])));
+            }
+        }
+
+        geometryCacheTainted = true;
+    }
+
     inline void determineGeometry() const
     {
         if (empty()) {
@@ -1715,14 +2033,11 @@ private:
             offset[dim] = width;
             buffer.clear();
 
-            merge3way(
-                buffer,
-                accumulator.beginStreak(-offset),
-                accumulator.endStreak(-offset),
-                accumulator.beginStreak(),
-                accumulator.endStreak(),
-                accumulator.beginStreak(offset),
-                accumulator.endStreak(offset));
+            std::vector<Operand> operands;
+            operands.push_back(Operand(&accumulator, -offset));
+            operands.push_back(Operand(&accumulator));
+            operands.push_back(Operand(&accumulator, offset));
+            applyPlanewise(buffer, MergeOperation(), operands);
             swap(accumulator, buffer);
         }
 
@@ -1731,23 +2046,13 @@ private:
             finalOffset[dim] = radius - width / 2;
             buffer.clear();
 
+            std::vector<Operand> operands;
+            operands.push_back(Operand(&accumulator, -finalOffset));
             if ((width * 2) < targetWidth) {
-                merge3way(
-                    buffer,
-                    accumulator.beginStreak(-finalOffset),
-                    accumulator.endStreak(-finalOffset),
-                    accumulator.beginStreak(),
-                    accumulator.endStreak(),
-                    accumulator.beginStreak(finalOffset),
-                    accumulator.endStreak(finalOffset));
-            } else {
-                merge2way(
-                    buffer,
-                    accumulator.beginStreak(-finalOffset),
-                    accumulator.endStreak(-finalOffset),
-                    accumulator.beginStreak(finalOffset),
-                    accumulator.endStreak(finalOffset));
+                operands.push_back(Operand(&accumulator));
             }
+            operands.push_back(Operand(&accumulator, finalOffset));
+            applyPlanewise(buffer, MergeOperation(), operands);
             swap(buffer, accumulator);
         }
     }
@@ -0,0 +1,9 @@
+set(SOURCES ${SOURCES}
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}coordboxtest.h
+  ${RELATIVE_PATH}coordtest.h
+  ${RELATIVE_PATH}floatcoordtest.h
+  ${RELATIVE_PATH}regiontest.h
+  ${RELATIVE_PATH}streaktest.h
+)
@@ -0,0 +1,38 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_PartitionManagerTest_init = false;
+#include "/root/repo/src/libgeodecomp/geometry/test/parallel_mpi_4/partitionmanagertest.h"
+
+static PartitionManagerTest suite_PartitionManagerTest;
+
+static CxxTest::List Tests_PartitionManagerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PartitionManagerTest( "/root/repo/src/libgeodecomp/geometry/test/parallel_mpi_4/partitionmanagertest.h", 11, "PartitionManagerTest", suite_PartitionManagerTest, Tests_PartitionManagerTest );
+
+static class TestDescription_suite_PartitionManagerTest_testUnstructured : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PartitionManagerTest_testUnstructured() : CxxTest::RealTestDescription( Tests_PartitionManagerTest, suiteDescription_PartitionManagerTest, 24, "testUnstructured" ) {}
+ void runTest() { suite_PartitionManagerTest.testUnstructured(); }
+} testDescription_suite_PartitionManagerTest_testUnstructured;
+
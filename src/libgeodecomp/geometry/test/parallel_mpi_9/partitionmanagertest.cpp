@@ -0,0 +1,74 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_PartitionManagerTest_init = false;
+#include "/root/repo/src/libgeodecomp/geometry/test/parallel_mpi_9/partitionmanagertest.h"
+
+static PartitionManagerTest suite_PartitionManagerTest;
+
+static CxxTest::List Tests_PartitionManagerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PartitionManagerTest( "/root/repo/src/libgeodecomp/geometry/test/parallel_mpi_9/partitionmanagertest.h", 9, "PartitionManagerTest", suite_PartitionManagerTest, Tests_PartitionManagerTest );
+
+static class TestDescription_suite_PartitionManagerTest_testOuterAndInnerGhostZoneFragments : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PartitionManagerTest_testOuterAndInnerGhostZoneFragments() : CxxTest::RealTestDescription( Tests_PartitionManagerTest, suiteDescription_PartitionManagerTest, 52, "testOuterAndInnerGhostZoneFragments" ) {}
+ void runTest() { suite_PartitionManagerTest.testOuterAndInnerGhostZoneFragments(); }
+} testDescription_suite_PartitionManagerTest_testOuterAndInnerGhostZoneFragments;
+
+static class TestDescription_suite_PartitionManagerTest_testOwnAndExpandedRegion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PartitionManagerTest_testOwnAndExpandedRegion() : CxxTest::RealTestDescription( Tests_PartitionManagerTest, suiteDescription_PartitionManagerTest, 91, "testOwnAndExpandedRegion" ) {}
+ void runTest() { suite_PartitionManagerTest.testOwnAndExpandedRegion(); }
+} testDescription_suite_PartitionManagerTest_testOwnAndExpandedRegion;
+
+static class TestDescription_suite_PartitionManagerTest_testRims : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PartitionManagerTest_testRims() : CxxTest::RealTestDescription( Tests_PartitionManagerTest, suiteDescription_PartitionManagerTest, 106, "testRims" ) {}
+ void runTest() { suite_PartitionManagerTest.testRims(); }
+} testDescription_suite_PartitionManagerTest_testRims;
+
+static class TestDescription_suite_PartitionManagerTest_testInnerSets : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PartitionManagerTest_testInnerSets() : CxxTest::RealTestDescription( Tests_PartitionManagerTest, suiteDescription_PartitionManagerTest, 124, "testInnerSets" ) {}
+ void runTest() { suite_PartitionManagerTest.testInnerSets(); }
+} testDescription_suite_PartitionManagerTest_testInnerSets;
+
+static class TestDescription_suite_PartitionManagerTest_testOutgroupGhostZones : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PartitionManagerTest_testOutgroupGhostZones() : CxxTest::RealTestDescription( Tests_PartitionManagerTest, suiteDescription_PartitionManagerTest, 137, "testOutgroupGhostZones" ) {}
+ void runTest() { suite_PartitionManagerTest.testOutgroupGhostZones(); }
+} testDescription_suite_PartitionManagerTest_testOutgroupGhostZones;
+
+static class TestDescription_suite_PartitionManagerTest_testVolatileKernel : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PartitionManagerTest_testVolatileKernel() : CxxTest::RealTestDescription( Tests_PartitionManagerTest, suiteDescription_PartitionManagerTest, 152, "testVolatileKernel" ) {}
+ void runTest() { suite_PartitionManagerTest.testVolatileKernel(); }
+} testDescription_suite_PartitionManagerTest_testVolatileKernel;
+
+static class TestDescription_suite_PartitionManagerTest_testInnerRim : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PartitionManagerTest_testInnerRim() : CxxTest::RealTestDescription( Tests_PartitionManagerTest, suiteDescription_PartitionManagerTest, 172, "testInnerRim" ) {}
+ void runTest() { suite_PartitionManagerTest.testInnerRim(); }
+} testDescription_suite_PartitionManagerTest_testInnerRim;
+
@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ConvexPolytopeTest_init = false;
+#include "/root/repo/src/libgeodecomp/geometry/test/unit/convexpolytopetest.h"
+
+static ConvexPolytopeTest suite_ConvexPolytopeTest;
+
+static CxxTest::List Tests_ConvexPolytopeTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ConvexPolytopeTest( "/root/repo/src/libgeodecomp/geometry/test/unit/convexpolytopetest.h", 7, "ConvexPolytopeTest", suite_ConvexPolytopeTest, Tests_ConvexPolytopeTest );
+
+static class TestDescription_suite_ConvexPolytopeTest_testSquare2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ConvexPolytopeTest_testSquare2D() : CxxTest::RealTestDescription( Tests_ConvexPolytopeTest, suiteDescription_ConvexPolytopeTest, 10, "testSquare2D" ) {}
+ void runTest() { suite_ConvexPolytopeTest.testSquare2D(); }
+} testDescription_suite_ConvexPolytopeTest_testSquare2D;
+
+static class TestDescription_suite_ConvexPolytopeTest_testTriangle2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ConvexPolytopeTest_testTriangle2D() : CxxTest::RealTestDescription( Tests_ConvexPolytopeTest, suiteDescription_ConvexPolytopeTest, 50, "testTriangle2D" ) {}
+ void runTest() { suite_ConvexPolytopeTest.testTriangle2D(); }
+} testDescription_suite_ConvexPolytopeTest_testTriangle2D;
+
+static class TestDescription_suite_ConvexPolytopeTest_testEdgeElimination : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ConvexPolytopeTest_testEdgeElimination() : CxxTest::RealTestDescription( Tests_ConvexPolytopeTest, suiteDescription_ConvexPolytopeTest, 63, "testEdgeElimination" ) {}
+ void runTest() { suite_ConvexPolytopeTest.testEdgeElimination(); }
+} testDescription_suite_ConvexPolytopeTest_testEdgeElimination;
+
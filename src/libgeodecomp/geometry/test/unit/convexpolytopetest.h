@@ -21,8 +21,7 @@ public:
         double expectedVolume = 100 * 100;
 
         TS_ASSERT_EQUALS(Coord<2>(200, 100), poly.getCenter());
-        TS_ASSERT_LESS_THAN(0.9 * expectedVolume, poly.getVolume());
-        TS_ASSERT_LESS_THAN(poly.getVolume(), 1.1 * expectedVolume);
+        TS_ASSERT_DELTA(expectedVolume, poly.getVolume(), 1e-9);
 
         TS_ASSERT_EQUALS(100, poly.getDiameter());
 
@@ -57,8 +56,7 @@ public:
         triangle.updateGeometryData();
 
         double expectedVolume = 0.5 * 100 * 100;
-        TS_ASSERT_LESS_THAN(0.9 * expectedVolume, triangle.getVolume());
-        TS_ASSERT_LESS_THAN(triangle.getVolume(), 1.1 * expectedVolume);
+        TS_ASSERT_DELTA(expectedVolume, triangle.getVolume(), 1e-9);
         TS_ASSERT_EQUALS(CoordBox<2>(Coord<2>(100, 0), Coord<2>(100, 100)), triangle.boundingBox());
     }
 
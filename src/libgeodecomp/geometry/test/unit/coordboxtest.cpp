@@ -0,0 +1,116 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CoordBoxTest_init = false;
+#include "/root/repo/src/libgeodecomp/geometry/test/unit/coordboxtest.h"
+
+static CoordBoxTest suite_CoordBoxTest;
+
+static CxxTest::List Tests_CoordBoxTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CoordBoxTest( "/root/repo/src/libgeodecomp/geometry/test/unit/coordboxtest.h", 10, "CoordBoxTest", suite_CoordBoxTest, Tests_CoordBoxTest );
+
+static class TestDescription_suite_CoordBoxTest_testConstructor1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testConstructor1() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 21, "testConstructor1" ) {}
+ void runTest() { suite_CoordBoxTest.testConstructor1(); }
+} testDescription_suite_CoordBoxTest_testConstructor1;
+
+static class TestDescription_suite_CoordBoxTest_testConstructor2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testConstructor2() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 28, "testConstructor2" ) {}
+ void runTest() { suite_CoordBoxTest.testConstructor2(); }
+} testDescription_suite_CoordBoxTest_testConstructor2;
+
+static class TestDescription_suite_CoordBoxTest_testInBoundsCoord : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testInBoundsCoord() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 36, "testInBoundsCoord" ) {}
+ void runTest() { suite_CoordBoxTest.testInBoundsCoord(); }
+} testDescription_suite_CoordBoxTest_testInBoundsCoord;
+
+static class TestDescription_suite_CoordBoxTest_testInBoundsStreak : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testInBoundsStreak() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 65, "testInBoundsStreak" ) {}
+ void runTest() { suite_CoordBoxTest.testInBoundsStreak(); }
+} testDescription_suite_CoordBoxTest_testInBoundsStreak;
+
+static class TestDescription_suite_CoordBoxTest_testSize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testSize() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 99, "testSize" ) {}
+ void runTest() { suite_CoordBoxTest.testSize(); }
+} testDescription_suite_CoordBoxTest_testSize;
+
+static class TestDescription_suite_CoordBoxTest_testIntersects : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testIntersects() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 108, "testIntersects" ) {}
+ void runTest() { suite_CoordBoxTest.testIntersects(); }
+} testDescription_suite_CoordBoxTest_testIntersects;
+
+static class TestDescription_suite_CoordBoxTest_testIterator1D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testIterator1D() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 135, "testIterator1D" ) {}
+ void runTest() { suite_CoordBoxTest.testIterator1D(); }
+} testDescription_suite_CoordBoxTest_testIterator1D;
+
+static class TestDescription_suite_CoordBoxTest_testIterator2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testIterator2D() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 155, "testIterator2D" ) {}
+ void runTest() { suite_CoordBoxTest.testIterator2D(); }
+} testDescription_suite_CoordBoxTest_testIterator2D;
+
+static class TestDescription_suite_CoordBoxTest_testIterator3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testIterator3D() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 175, "testIterator3D" ) {}
+ void runTest() { suite_CoordBoxTest.testIterator3D(); }
+} testDescription_suite_CoordBoxTest_testIterator3D;
+
+static class TestDescription_suite_CoordBoxTest_testStreakIterator1D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testStreakIterator1D() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 197, "testStreakIterator1D" ) {}
+ void runTest() { suite_CoordBoxTest.testStreakIterator1D(); }
+} testDescription_suite_CoordBoxTest_testStreakIterator1D;
+
+static class TestDescription_suite_CoordBoxTest_testStreakIterator2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testStreakIterator2D() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 213, "testStreakIterator2D" ) {}
+ void runTest() { suite_CoordBoxTest.testStreakIterator2D(); }
+} testDescription_suite_CoordBoxTest_testStreakIterator2D;
+
+static class TestDescription_suite_CoordBoxTest_testStreakIterator3DFirst : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testStreakIterator3DFirst() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 231, "testStreakIterator3DFirst" ) {}
+ void runTest() { suite_CoordBoxTest.testStreakIterator3DFirst(); }
+} testDescription_suite_CoordBoxTest_testStreakIterator3DFirst;
+
+static class TestDescription_suite_CoordBoxTest_testStreakIterator3DSecond : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testStreakIterator3DSecond() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 251, "testStreakIterator3DSecond" ) {}
+ void runTest() { suite_CoordBoxTest.testStreakIterator3DSecond(); }
+} testDescription_suite_CoordBoxTest_testStreakIterator3DSecond;
+
+static class TestDescription_suite_CoordBoxTest_testEmptyIteration : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testEmptyIteration() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 273, "testEmptyIteration" ) {}
+ void runTest() { suite_CoordBoxTest.testEmptyIteration(); }
+} testDescription_suite_CoordBoxTest_testEmptyIteration;
+
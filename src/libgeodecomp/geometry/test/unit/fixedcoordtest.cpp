@@ -0,0 +1,37 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_FixedCoordTest_init = false;
+#include "/root/repo/src/libgeodecomp/geometry/test/unit/fixedcoordtest.h"
+
+static FixedCoordTest suite_FixedCoordTest;
+
+static CxxTest::List Tests_FixedCoordTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_FixedCoordTest( "/root/repo/src/libgeodecomp/geometry/test/unit/fixedcoordtest.h", 8, "FixedCoordTest", suite_FixedCoordTest, Tests_FixedCoordTest );
+
+static class TestDescription_suite_FixedCoordTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedCoordTest_testBasic() : CxxTest::RealTestDescription( Tests_FixedCoordTest, suiteDescription_FixedCoordTest, 12, "testBasic" ) {}
+ void runTest() { suite_FixedCoordTest.testBasic(); }
+} testDescription_suite_FixedCoordTest_testBasic;
+
@@ -275,6 +275,49 @@ public:
 
     }
 
+    void testNeighborDiscoveryOnTorus()
+    {
+        CoordBox<2> box(Coord<2>(), Coord<2>(40, 64));
+        std::vector<std::size_t> weights(16, 160);
+        SharedPtr<Partition<2> >::Type partition(
+            new StripingPartition<2>(Coord<2>(), box.dimensions, 0, weights));
+        SharedPtr<AdjacencyManufacturer<2> >::Type dummyAdjacencyManufacturer(new DummyAdjacencyManufacturer<2>);
+
+        PartitionManager<Topologies::Torus<2>::Topology> manager;
+        manager.resetRegions(dummyAdjacencyManufacturer, box, partition, 0, 2);
+
+        std::vector<CoordBox<2> > boundingBoxes;
+        std::vector<CoordBox<2> > expandedBoundingBoxes;
+        for (int i = 0; i < 16; ++i) {
+            Region<2> region = partition->getRegion(i);
+            boundingBoxes << region.boundingBox();
+            expandedBoundingBoxes << region.expandWithTopology(
+                2, box.dimensions, Topologies::Torus<2>::Topology()).boundingBox();
+        }
+        manager.resetGhostZones(boundingBoxes, expandedBoundingBoxes);
+
+        // only the stripes directly above (wrapped around) and below
+        // us are neighbors:
+        typedef PartitionManager<Topologies::Torus<2>::Topology>::RegionVecMap RegionVecMap;
+        RegionVecMap& fragments = manager.getOuterGhostZoneFragments();
+        TS_ASSERT_EQUALS(std::size_t(3), fragments.size());
+        TS_ASSERT_EQUALS(std::size_t(1), fragments.count(1));
+        TS_ASSERT_EQUALS(std::size_t(1), fragments.count(15));
+
+        Region<2> expected;
+        expected << CoordBox<2>(Coord<2>(0, 62), Coord<2>(40, 2));
+        TS_ASSERT_EQUALS(expected, fragments[15].back());
+
+        expected.clear();
+        expected << CoordBox<2>(Coord<2>(0, 4), Coord<2>(40, 2));
+        TS_ASSERT_EQUALS(expected, fragments[1].back());
+
+        // distant nodes must not even have had their Regions computed:
+        for (int i = 2; i < 15; ++i) {
+            TS_ASSERT_EQUALS(std::size_t(0), manager.regions.count(i));
+        }
+    }
+
 private:
     Coord<2> dimensions;
     unsigned offset;
@@ -0,0 +1,512 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_RegionTest_init = false;
+#include "/root/repo/src/libgeodecomp/geometry/test/unit/regiontest.h"
+
+static RegionTest suite_RegionTest;
+
+static CxxTest::List Tests_RegionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RegionTest( "/root/repo/src/libgeodecomp/geometry/test/unit/regiontest.h", 15, "RegionTest", suite_RegionTest, Tests_RegionTest );
+
+static class TestDescription_suite_RegionTest_testExpandWithAdjacency : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpandWithAdjacency() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 69, "testExpandWithAdjacency" ) {}
+ void runTest() { suite_RegionTest.testExpandWithAdjacency(); }
+} testDescription_suite_RegionTest_testExpandWithAdjacency;
+
+static class TestDescription_suite_RegionTest_testMoveAssignment : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testMoveAssignment() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 133, "testMoveAssignment" ) {}
+ void runTest() { suite_RegionTest.testMoveAssignment(); }
+} testDescription_suite_RegionTest_testMoveAssignment;
+
+static class TestDescription_suite_RegionTest_testMoveConstructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testMoveConstructor() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 155, "testMoveConstructor" ) {}
+ void runTest() { suite_RegionTest.testMoveConstructor(); }
+} testDescription_suite_RegionTest_testMoveConstructor;
+
+static class TestDescription_suite_RegionTest_testIntersectOrTouch : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testIntersectOrTouch() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 176, "testIntersectOrTouch" ) {}
+ void runTest() { suite_RegionTest.testIntersectOrTouch(); }
+} testDescription_suite_RegionTest_testIntersectOrTouch;
+
+static class TestDescription_suite_RegionTest_testIntersect : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testIntersect() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 212, "testIntersect" ) {}
+ void runTest() { suite_RegionTest.testIntersect(); }
+} testDescription_suite_RegionTest_testIntersect;
+
+static class TestDescription_suite_RegionTest_testFuse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testFuse() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 250, "testFuse" ) {}
+ void runTest() { suite_RegionTest.testFuse(); }
+} testDescription_suite_RegionTest_testFuse;
+
+static class TestDescription_suite_RegionTest_testSubstract : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testSubstract() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 268, "testSubstract" ) {}
+ void runTest() { suite_RegionTest.testSubstract(); }
+} testDescription_suite_RegionTest_testSubstract;
+
+static class TestDescription_suite_RegionTest_testCoordBoxConstructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testCoordBoxConstructor() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 296, "testCoordBoxConstructor" ) {}
+ void runTest() { suite_RegionTest.testCoordBoxConstructor(); }
+} testDescription_suite_RegionTest_testCoordBoxConstructor;
+
+static class TestDescription_suite_RegionTest_testInsert1a : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsert1a() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 306, "testInsert1a" ) {}
+ void runTest() { suite_RegionTest.testInsert1a(); }
+} testDescription_suite_RegionTest_testInsert1a;
+
+static class TestDescription_suite_RegionTest_testInsert1b : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsert1b() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 317, "testInsert1b" ) {}
+ void runTest() { suite_RegionTest.testInsert1b(); }
+} testDescription_suite_RegionTest_testInsert1b;
+
+static class TestDescription_suite_RegionTest_testInsert1c : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsert1c() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 328, "testInsert1c" ) {}
+ void runTest() { suite_RegionTest.testInsert1c(); }
+} testDescription_suite_RegionTest_testInsert1c;
+
+static class TestDescription_suite_RegionTest_testInsert2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsert2() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 336, "testInsert2" ) {}
+ void runTest() { suite_RegionTest.testInsert2(); }
+} testDescription_suite_RegionTest_testInsert2;
+
+static class TestDescription_suite_RegionTest_testInsert3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsert3() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 367, "testInsert3" ) {}
+ void runTest() { suite_RegionTest.testInsert3(); }
+} testDescription_suite_RegionTest_testInsert3;
+
+static class TestDescription_suite_RegionTest_testInsertCoordBox1D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsertCoordBox1D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 388, "testInsertCoordBox1D" ) {}
+ void runTest() { suite_RegionTest.testInsertCoordBox1D(); }
+} testDescription_suite_RegionTest_testInsertCoordBox1D;
+
+static class TestDescription_suite_RegionTest_testInsertCoordBox2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsertCoordBox2D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 400, "testInsertCoordBox2D" ) {}
+ void runTest() { suite_RegionTest.testInsertCoordBox2D(); }
+} testDescription_suite_RegionTest_testInsertCoordBox2D;
+
+static class TestDescription_suite_RegionTest_testInsertCoordBox3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsertCoordBox3D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 414, "testInsertCoordBox3D" ) {}
+ void runTest() { suite_RegionTest.testInsertCoordBox3D(); }
+} testDescription_suite_RegionTest_testInsertCoordBox3D;
+
+static class TestDescription_suite_RegionTest_testInsert3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsert3D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 431, "testInsert3D" ) {}
+ void runTest() { suite_RegionTest.testInsert3D(); }
+} testDescription_suite_RegionTest_testInsert3D;
+
+static class TestDescription_suite_RegionTest_testInsertVsOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testInsertVsOperator() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 474, "testInsertVsOperator" ) {}
+ void runTest() { suite_RegionTest.testInsertVsOperator(); }
+} testDescription_suite_RegionTest_testInsertVsOperator;
+
+static class TestDescription_suite_RegionTest_testCount : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testCount() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 487, "testCount" ) {}
+ void runTest() { suite_RegionTest.testCount(); }
+} testDescription_suite_RegionTest_testCount;
+
+static class TestDescription_suite_RegionTest_testCountCoord : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testCountCoord() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 535, "testCountCoord" ) {}
+ void runTest() { suite_RegionTest.testCountCoord(); }
+} testDescription_suite_RegionTest_testCountCoord;
+
+static class TestDescription_suite_RegionTest_testCountStreak : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testCountStreak() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 565, "testCountStreak" ) {}
+ void runTest() { suite_RegionTest.testCountStreak(); }
+} testDescription_suite_RegionTest_testCountStreak;
+
+static class TestDescription_suite_RegionTest_testStreakIteration : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testStreakIteration() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 584, "testStreakIteration" ) {}
+ void runTest() { suite_RegionTest.testStreakIteration(); }
+} testDescription_suite_RegionTest_testStreakIteration;
+
+static class TestDescription_suite_RegionTest_testEmptyStreakIteration : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testEmptyStreakIteration() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 613, "testEmptyStreakIteration" ) {}
+ void runTest() { suite_RegionTest.testEmptyStreakIteration(); }
+} testDescription_suite_RegionTest_testEmptyStreakIteration;
+
+static class TestDescription_suite_RegionTest_testUnorderedInsert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testUnorderedInsert() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 630, "testUnorderedInsert" ) {}
+ void runTest() { suite_RegionTest.testUnorderedInsert(); }
+} testDescription_suite_RegionTest_testUnorderedInsert;
+
+static class TestDescription_suite_RegionTest_testBigInsert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testBigInsert() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 658, "testBigInsert" ) {}
+ void runTest() { suite_RegionTest.testBigInsert(); }
+} testDescription_suite_RegionTest_testBigInsert;
+
+static class TestDescription_suite_RegionTest_testSubstractionOfCoordBox : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testSubstractionOfCoordBox() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 698, "testSubstractionOfCoordBox" ) {}
+ void runTest() { suite_RegionTest.testSubstractionOfCoordBox(); }
+} testDescription_suite_RegionTest_testSubstractionOfCoordBox;
+
+static class TestDescription_suite_RegionTest_testEmpty : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testEmpty() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 718, "testEmpty" ) {}
+ void runTest() { suite_RegionTest.testEmpty(); }
+} testDescription_suite_RegionTest_testEmpty;
+
+static class TestDescription_suite_RegionTest_testBoundingBox : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testBoundingBox() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 726, "testBoundingBox" ) {}
+ void runTest() { suite_RegionTest.testBoundingBox(); }
+} testDescription_suite_RegionTest_testBoundingBox;
+
+static class TestDescription_suite_RegionTest_testSize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testSize() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 778, "testSize" ) {}
+ void runTest() { suite_RegionTest.testSize(); }
+} testDescription_suite_RegionTest_testSize;
+
+static class TestDescription_suite_RegionTest_testDimension : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testDimension() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 793, "testDimension" ) {}
+ void runTest() { suite_RegionTest.testDimension(); }
+} testDescription_suite_RegionTest_testDimension;
+
+static class TestDescription_suite_RegionTest_testExpand1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpand1() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 805, "testExpand1" ) {}
+ void runTest() { suite_RegionTest.testExpand1(); }
+} testDescription_suite_RegionTest_testExpand1;
+
+static class TestDescription_suite_RegionTest_testExpand2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpand2() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 852, "testExpand2" ) {}
+ void runTest() { suite_RegionTest.testExpand2(); }
+} testDescription_suite_RegionTest_testExpand2;
+
+static class TestDescription_suite_RegionTest_testExpand3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpand3() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 872, "testExpand3" ) {}
+ void runTest() { suite_RegionTest.testExpand3(); }
+} testDescription_suite_RegionTest_testExpand3;
+
+static class TestDescription_suite_RegionTest_testExpandWithStencilAndVonNeumannStencil : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpandWithStencilAndVonNeumannStencil() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 894, "testExpandWithStencilAndVonNeumannStencil" ) {}
+ void runTest() { suite_RegionTest.testExpandWithStencilAndVonNeumannStencil(); }
+} testDescription_suite_RegionTest_testExpandWithStencilAndVonNeumannStencil;
+
+static class TestDescription_suite_RegionTest_testExpandWithStencilAndMooreStencil : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpandWithStencilAndMooreStencil() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 917, "testExpandWithStencilAndMooreStencil" ) {}
+ void runTest() { suite_RegionTest.testExpandWithStencilAndMooreStencil(); }
+} testDescription_suite_RegionTest_testExpandWithStencilAndMooreStencil;
+
+static class TestDescription_suite_RegionTest_testExpandWithStencil2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpandWithStencil2D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 932, "testExpandWithStencil2D" ) {}
+ void runTest() { suite_RegionTest.testExpandWithStencil2D(); }
+} testDescription_suite_RegionTest_testExpandWithStencil2D;
+
+static class TestDescription_suite_RegionTest_testDelete : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testDelete() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 947, "testDelete" ) {}
+ void runTest() { suite_RegionTest.testDelete(); }
+} testDescription_suite_RegionTest_testDelete;
+
+static class TestDescription_suite_RegionTest_testAndNot1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testAndNot1() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 978, "testAndNot1" ) {}
+ void runTest() { suite_RegionTest.testAndNot1(); }
+} testDescription_suite_RegionTest_testAndNot1;
+
+static class TestDescription_suite_RegionTest_testAndNot2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testAndNot2() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1010, "testAndNot2" ) {}
+ void runTest() { suite_RegionTest.testAndNot2(); }
+} testDescription_suite_RegionTest_testAndNot2;
+
+static class TestDescription_suite_RegionTest_testAndAssignmentOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testAndAssignmentOperator() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1032, "testAndAssignmentOperator" ) {}
+ void runTest() { suite_RegionTest.testAndAssignmentOperator(); }
+} testDescription_suite_RegionTest_testAndAssignmentOperator;
+
+static class TestDescription_suite_RegionTest_testAndOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testAndOperator() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1060, "testAndOperator" ) {}
+ void runTest() { suite_RegionTest.testAndOperator(); }
+} testDescription_suite_RegionTest_testAndOperator;
+
+static class TestDescription_suite_RegionTest_testAddAssignmentOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testAddAssignmentOperator() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1084, "testAddAssignmentOperator" ) {}
+ void runTest() { suite_RegionTest.testAddAssignmentOperator(); }
+} testDescription_suite_RegionTest_testAddAssignmentOperator;
+
+static class TestDescription_suite_RegionTest_testAddOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testAddOperator() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1112, "testAddOperator" ) {}
+ void runTest() { suite_RegionTest.testAddOperator(); }
+} testDescription_suite_RegionTest_testAddOperator;
+
+static class TestDescription_suite_RegionTest_testAddOperator2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testAddOperator2() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1139, "testAddOperator2" ) {}
+ void runTest() { suite_RegionTest.testAddOperator2(); }
+} testDescription_suite_RegionTest_testAddOperator2;
+
+static class TestDescription_suite_RegionTest_testEqualsOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testEqualsOperator() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1152, "testEqualsOperator" ) {}
+ void runTest() { suite_RegionTest.testEqualsOperator(); }
+} testDescription_suite_RegionTest_testEqualsOperator;
+
+static class TestDescription_suite_RegionTest_testNumStreaks : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testNumStreaks() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1174, "testNumStreaks" ) {}
+ void runTest() { suite_RegionTest.testNumStreaks(); }
+} testDescription_suite_RegionTest_testNumStreaks;
+
+static class TestDescription_suite_RegionTest_testToVector : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testToVector() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1192, "testToVector" ) {}
+ void runTest() { suite_RegionTest.testToVector(); }
+} testDescription_suite_RegionTest_testToVector;
+
+static class TestDescription_suite_RegionTest_testIteratorInsertConstructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testIteratorInsertConstructor() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1214, "testIteratorInsertConstructor" ) {}
+ void runTest() { suite_RegionTest.testIteratorInsertConstructor(); }
+} testDescription_suite_RegionTest_testIteratorInsertConstructor;
+
+static class TestDescription_suite_RegionTest_testClear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testClear() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1228, "testClear" ) {}
+ void runTest() { suite_RegionTest.testClear(); }
+} testDescription_suite_RegionTest_testClear;
+
+static class TestDescription_suite_RegionTest_test3DSimple1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_test3DSimple1() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1240, "test3DSimple1" ) {}
+ void runTest() { suite_RegionTest.test3DSimple1(); }
+} testDescription_suite_RegionTest_test3DSimple1;
+
+static class TestDescription_suite_RegionTest_test3DSimple2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_test3DSimple2() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1264, "test3DSimple2" ) {}
+ void runTest() { suite_RegionTest.test3DSimple2(); }
+} testDescription_suite_RegionTest_test3DSimple2;
+
+static class TestDescription_suite_RegionTest_test3DSimple3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_test3DSimple3() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1284, "test3DSimple3" ) {}
+ void runTest() { suite_RegionTest.test3DSimple3(); }
+} testDescription_suite_RegionTest_test3DSimple3;
+
+static class TestDescription_suite_RegionTest_test3DSimple4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_test3DSimple4() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1300, "test3DSimple4" ) {}
+ void runTest() { suite_RegionTest.test3DSimple4(); }
+} testDescription_suite_RegionTest_test3DSimple4;
+
+static class TestDescription_suite_RegionTest_testExpand3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpand3D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1324, "testExpand3D" ) {}
+ void runTest() { suite_RegionTest.testExpand3D(); }
+} testDescription_suite_RegionTest_testExpand3D;
+
+static class TestDescription_suite_RegionTest_testExpandWithTopology1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpandWithTopology1() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1349, "testExpandWithTopology1" ) {}
+ void runTest() { suite_RegionTest.testExpandWithTopology1(); }
+} testDescription_suite_RegionTest_testExpandWithTopology1;
+
+static class TestDescription_suite_RegionTest_testExpandWithTopology2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpandWithTopology2() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1380, "testExpandWithTopology2" ) {}
+ void runTest() { suite_RegionTest.testExpandWithTopology2(); }
+} testDescription_suite_RegionTest_testExpandWithTopology2;
+
+static class TestDescription_suite_RegionTest_testExpandWithRadius1D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpandWithRadius1D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1402, "testExpandWithRadius1D" ) {}
+ void runTest() { suite_RegionTest.testExpandWithRadius1D(); }
+} testDescription_suite_RegionTest_testExpandWithRadius1D;
+
+static class TestDescription_suite_RegionTest_testExpandWithRadius2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpandWithRadius2D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1418, "testExpandWithRadius2D" ) {}
+ void runTest() { suite_RegionTest.testExpandWithRadius2D(); }
+} testDescription_suite_RegionTest_testExpandWithRadius2D;
+
+static class TestDescription_suite_RegionTest_testExpandWithRadius3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testExpandWithRadius3D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1431, "testExpandWithRadius3D" ) {}
+ void runTest() { suite_RegionTest.testExpandWithRadius3D(); }
+} testDescription_suite_RegionTest_testExpandWithRadius3D;
+
+static class TestDescription_suite_RegionTest_testBoolean3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testBoolean3D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1446, "testBoolean3D" ) {}
+ void runTest() { suite_RegionTest.testBoolean3D(); }
+} testDescription_suite_RegionTest_testBoolean3D;
+
+static class TestDescription_suite_RegionTest_testLargeBoolean3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testLargeBoolean3D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1476, "testLargeBoolean3D" ) {}
+ void runTest() { suite_RegionTest.testLargeBoolean3D(); }
+} testDescription_suite_RegionTest_testLargeBoolean3D;
+
+static class TestDescription_suite_RegionTest_testSwap : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testSwap() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1531, "testSwap" ) {}
+ void runTest() { suite_RegionTest.testSwap(); }
+} testDescription_suite_RegionTest_testSwap;
+
+static class TestDescription_suite_RegionTest_testRemove1D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testRemove1D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1557, "testRemove1D" ) {}
+ void runTest() { suite_RegionTest.testRemove1D(); }
+} testDescription_suite_RegionTest_testRemove1D;
+
+static class TestDescription_suite_RegionTest_testRemove3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testRemove3D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1571, "testRemove3D" ) {}
+ void runTest() { suite_RegionTest.testRemove3D(); }
+} testDescription_suite_RegionTest_testRemove3D;
+
+static class TestDescription_suite_RegionTest_testMerge2way : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testMerge2way() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1626, "testMerge2way" ) {}
+ void runTest() { suite_RegionTest.testMerge2way(); }
+} testDescription_suite_RegionTest_testMerge2way;
+
+static class TestDescription_suite_RegionTest_testMerge3way : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testMerge3way() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1646, "testMerge3way" ) {}
+ void runTest() { suite_RegionTest.testMerge3way(); }
+} testDescription_suite_RegionTest_testMerge3way;
+
+static class TestDescription_suite_RegionTest_testStreakIterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testStreakIterator() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1756, "testStreakIterator" ) {}
+ void runTest() { suite_RegionTest.testStreakIterator(); }
+} testDescription_suite_RegionTest_testStreakIterator;
+
+static class TestDescription_suite_RegionTest_testNormalIterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testNormalIterator() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1809, "testNormalIterator" ) {}
+ void runTest() { suite_RegionTest.testNormalIterator(); }
+} testDescription_suite_RegionTest_testNormalIterator;
+
+static class TestDescription_suite_RegionTest_testOffsetBasedStreakIteratorAccess : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testOffsetBasedStreakIteratorAccess() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1831, "testOffsetBasedStreakIteratorAccess" ) {}
+ void runTest() { suite_RegionTest.testOffsetBasedStreakIteratorAccess(); }
+} testDescription_suite_RegionTest_testOffsetBasedStreakIteratorAccess;
+
+static class TestDescription_suite_RegionTest_testRandomAccessIteratorAccess : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testRandomAccessIteratorAccess() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1868, "testRandomAccessIteratorAccess" ) {}
+ void runTest() { suite_RegionTest.testRandomAccessIteratorAccess(); }
+} testDescription_suite_RegionTest_testRandomAccessIteratorAccess;
+
+static class TestDescription_suite_RegionTest_testToString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testToString() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1892, "testToString" ) {}
+ void runTest() { suite_RegionTest.testToString(); }
+} testDescription_suite_RegionTest_testToString;
+
+static class TestDescription_suite_RegionTest_testPrettyPrint : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testPrettyPrint() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1920, "testPrettyPrint" ) {}
+ void runTest() { suite_RegionTest.testPrettyPrint(); }
+} testDescription_suite_RegionTest_testPrettyPrint;
+
+static class TestDescription_suite_RegionTest_testPlaneStreakIterator3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testPlaneStreakIterator3D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1948, "testPlaneStreakIterator3D" ) {}
+ void runTest() { suite_RegionTest.testPlaneStreakIterator3D(); }
+} testDescription_suite_RegionTest_testPlaneStreakIterator3D;
+
+static class TestDescription_suite_RegionTest_testPlaneStreakIterator2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testPlaneStreakIterator2D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 1988, "testPlaneStreakIterator2D" ) {}
+ void runTest() { suite_RegionTest.testPlaneStreakIterator2D(); }
+} testDescription_suite_RegionTest_testPlaneStreakIterator2D;
+
+static class TestDescription_suite_RegionTest_testStreakIteratorOnOrAfter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testStreakIteratorOnOrAfter() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 2006, "testStreakIteratorOnOrAfter" ) {}
+ void runTest() { suite_RegionTest.testStreakIteratorOnOrAfter(); }
+} testDescription_suite_RegionTest_testStreakIteratorOnOrAfter;
+
+static class TestDescription_suite_RegionTest_testPrettyPrint2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testPrettyPrint2D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 2140, "testPrettyPrint2D" ) {}
+ void runTest() { suite_RegionTest.testPrettyPrint2D(); }
+} testDescription_suite_RegionTest_testPrettyPrint2D;
+
+static class TestDescription_suite_RegionTest_testPrintToBOV3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testPrintToBOV3D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 2151, "testPrintToBOV3D" ) {}
+ void runTest() { suite_RegionTest.testPrintToBOV3D(); }
+} testDescription_suite_RegionTest_testPrintToBOV3D;
+
+static class TestDescription_suite_RegionTest_testIsAppendable1D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testIsAppendable1D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 2200, "testIsAppendable1D" ) {}
+ void runTest() { suite_RegionTest.testIsAppendable1D(); }
+} testDescription_suite_RegionTest_testIsAppendable1D;
+
+static class TestDescription_suite_RegionTest_testIsAppendable2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testIsAppendable2D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 2227, "testIsAppendable2D" ) {}
+ void runTest() { suite_RegionTest.testIsAppendable2D(); }
+} testDescription_suite_RegionTest_testIsAppendable2D;
+
+static class TestDescription_suite_RegionTest_testIsAppendable3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionTest_testIsAppendable3D() : CxxTest::RealTestDescription( Tests_RegionTest, suiteDescription_RegionTest, 2265, "testIsAppendable3D" ) {}
+ void runTest() { suite_RegionTest.testIsAppendable3D(); }
+} testDescription_suite_RegionTest_testIsAppendable3D;
+
@@ -1473,6 +1473,61 @@ public:
         TS_ASSERT_EQUALS(mergerFL - leftCube,  frontCube);
     }
 
+    void testLargeBoolean3D()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        // ensure the planewise parallel code path is exercised:
+        int oldNumThreads = omp_get_max_threads();
+        omp_set_num_threads(4);
+#endif
+
+        Region<3> a;
+        Region<3> b;
+        for (int z = 0; z < 300; ++z) {
+            for (int y = 0; y < 64; ++y) {
+                a << Streak<3>(Coord<3>(0, y, z), 40 + (y + z) % 7);
+                if ((y + z) % 3) {
+                    b << Streak<3>(Coord<3>((y * z) % 11, y + 2, z + 1), 40);
+                }
+                b << Streak<3>(Coord<3>(44, y, z), 50);
+            }
+        }
+
+        Region<3> expectedUnion;
+        Region<3> expectedIntersection;
+        Region<3> expectedDifference;
+        Region<3>::merge2way(
+            expectedUnion, a.beginStreak(), a.endStreak(), b.beginStreak(), b.endStreak());
+        Region<3>::intersect(
+            expectedIntersection, a.beginStreak(), a.endStreak(), b.beginStreak(), b.endStreak());
+        Region<3>::subtract(
+            expectedDifference, a.beginStreak(), a.endStreak(), b.beginStreak(), b.endStreak());
+
+        TS_ASSERT_EQUALS(expectedUnion,        a + b);
+        TS_ASSERT_EQUALS(expectedIntersection, a & b);
+        TS_ASSERT_EQUALS(expectedDifference,   a - b);
+
+        TS_ASSERT_EQUALS((a - b) + (a & b), a);
+        TS_ASSERT(((a - b) & b).empty());
+        TS_ASSERT_EQUALS((a + b).size(), a.size() + b.size() - (a & b).size());
+        TS_ASSERT_EQUALS(a & a, a);
+        TS_ASSERT((a - a).empty());
+
+        Region<3> boxes;
+        Region<3> expectedExpansion;
+        for (int i = 0; i < 200; ++i) {
+            Coord<3> origin((i * 37) % 500, (i * 17) % 300, i * 5);
+            Coord<3> dim(10 + i % 13, 20 + i % 7, 3 + i % 5);
+            boxes << CoordBox<3>(origin, dim);
+            expectedExpansion << CoordBox<3>(origin - Coord<3>(2, 3, 4), dim + Coord<3>(4, 6, 8));
+        }
+        TS_ASSERT_EQUALS(expectedExpansion, boxes.expand(Coord<3>(2, 3, 4)));
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+        omp_set_num_threads(oldNumThreads);
+#endif
+    }
+
     void testSwap()
     {
         using std::swap;
@@ -0,0 +1,79 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_StencilsTest_init = false;
+#include "/root/repo/src/libgeodecomp/geometry/test/unit/stencilstest.h"
+
+static StencilsTest suite_StencilsTest;
+
+static CxxTest::List Tests_StencilsTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_StencilsTest( "/root/repo/src/libgeodecomp/geometry/test/unit/stencilstest.h", 8, "StencilsTest", suite_StencilsTest, Tests_StencilsTest );
+
+static class TestDescription_suite_StencilsTest_testPower : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StencilsTest_testPower() : CxxTest::RealTestDescription( Tests_StencilsTest, suiteDescription_StencilsTest, 11, "testPower" ) {}
+ void runTest() { suite_StencilsTest.testPower(); }
+} testDescription_suite_StencilsTest_testPower;
+
+static class TestDescription_suite_StencilsTest_testSum1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StencilsTest_testSum1() : CxxTest::RealTestDescription( Tests_StencilsTest, suiteDescription_StencilsTest, 18, "testSum1" ) {}
+ void runTest() { suite_StencilsTest.testSum1(); }
+} testDescription_suite_StencilsTest_testSum1;
+
+static class TestDescription_suite_StencilsTest_testSum2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StencilsTest_testSum2() : CxxTest::RealTestDescription( Tests_StencilsTest, suiteDescription_StencilsTest, 25, "testSum2" ) {}
+ void runTest() { suite_StencilsTest.testSum2(); }
+} testDescription_suite_StencilsTest_testSum2;
+
+static class TestDescription_suite_StencilsTest_testOffsetHelper : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StencilsTest_testOffsetHelper() : CxxTest::RealTestDescription( Tests_StencilsTest, suiteDescription_StencilsTest, 32, "testOffsetHelper" ) {}
+ void runTest() { suite_StencilsTest.testOffsetHelper(); }
+} testDescription_suite_StencilsTest_testOffsetHelper;
+
+static class TestDescription_suite_StencilsTest_testVonNeumannDimDelta : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StencilsTest_testVonNeumannDimDelta() : CxxTest::RealTestDescription( Tests_StencilsTest, suiteDescription_StencilsTest, 79, "testVonNeumannDimDelta" ) {}
+ void runTest() { suite_StencilsTest.testVonNeumannDimDelta(); }
+} testDescription_suite_StencilsTest_testVonNeumannDimDelta;
+
+static class TestDescription_suite_StencilsTest_testRadius : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StencilsTest_testRadius() : CxxTest::RealTestDescription( Tests_StencilsTest, suiteDescription_StencilsTest, 124, "testRadius" ) {}
+ void runTest() { suite_StencilsTest.testRadius(); }
+} testDescription_suite_StencilsTest_testRadius;
+
+static class TestDescription_suite_StencilsTest_testVolume : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StencilsTest_testVolume() : CxxTest::RealTestDescription( Tests_StencilsTest, suiteDescription_StencilsTest, 143, "testVolume" ) {}
+ void runTest() { suite_StencilsTest.testVolume(); }
+} testDescription_suite_StencilsTest_testVolume;
+
+static class TestDescription_suite_StencilsTest_testCoords : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StencilsTest_testCoords() : CxxTest::RealTestDescription( Tests_StencilsTest, suiteDescription_StencilsTest, 188, "testCoords" ) {}
+ void runTest() { suite_StencilsTest.testCoords(); }
+} testDescription_suite_StencilsTest_testCoords;
+
@@ -0,0 +1,49 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_StreakTest_init = false;
+#include "/root/repo/src/libgeodecomp/geometry/test/unit/streaktest.h"
+
+static StreakTest suite_StreakTest;
+
+static CxxTest::List Tests_StreakTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_StreakTest( "/root/repo/src/libgeodecomp/geometry/test/unit/streaktest.h", 10, "StreakTest", suite_StreakTest, Tests_StreakTest );
+
+static class TestDescription_suite_StreakTest_testAddSub1D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StreakTest_testAddSub1D() : CxxTest::RealTestDescription( Tests_StreakTest, suiteDescription_StreakTest, 14, "testAddSub1D" ) {}
+ void runTest() { suite_StreakTest.testAddSub1D(); }
+} testDescription_suite_StreakTest_testAddSub1D;
+
+static class TestDescription_suite_StreakTest_testAddSub2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StreakTest_testAddSub2D() : CxxTest::RealTestDescription( Tests_StreakTest, suiteDescription_StreakTest, 31, "testAddSub2D" ) {}
+ void runTest() { suite_StreakTest.testAddSub2D(); }
+} testDescription_suite_StreakTest_testAddSub2D;
+
+static class TestDescription_suite_StreakTest_testAddSub3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StreakTest_testAddSub3D() : CxxTest::RealTestDescription( Tests_StreakTest, suiteDescription_StreakTest, 48, "testAddSub3D" ) {}
+ void runTest() { suite_StreakTest.testAddSub3D(); }
+} testDescription_suite_StreakTest_testAddSub3D;
+
@@ -0,0 +1,56 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_VoronoiMesherTest_init = false;
+#include "/root/repo/src/libgeodecomp/geometry/test/unit/voronoimeshertest.h"
+
+static VoronoiMesherTest suite_VoronoiMesherTest;
+
+static CxxTest::List Tests_VoronoiMesherTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_VoronoiMesherTest( "/root/repo/src/libgeodecomp/geometry/test/unit/voronoimeshertest.h", 75, "VoronoiMesherTest", suite_VoronoiMesherTest, Tests_VoronoiMesherTest );
+
+static class TestDescription_suite_VoronoiMesherTest_testElementDoesntRemoveLimitsAfterDuplicateInsertion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_VoronoiMesherTest_testElementDoesntRemoveLimitsAfterDuplicateInsertion() : CxxTest::RealTestDescription( Tests_VoronoiMesherTest, suiteDescription_VoronoiMesherTest, 78, "testElementDoesntRemoveLimitsAfterDuplicateInsertion" ) {}
+ void runTest() { suite_VoronoiMesherTest.testElementDoesntRemoveLimitsAfterDuplicateInsertion(); }
+} testDescription_suite_VoronoiMesherTest_testElementDoesntRemoveLimitsAfterDuplicateInsertion;
+
+static class TestDescription_suite_VoronoiMesherTest_testFillGeometryData : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_VoronoiMesherTest_testFillGeometryData() : CxxTest::RealTestDescription( Tests_VoronoiMesherTest, suiteDescription_VoronoiMesherTest, 94, "testFillGeometryData" ) {}
+ void runTest() { suite_VoronoiMesherTest.testFillGeometryData(); }
+} testDescription_suite_VoronoiMesherTest_testFillGeometryData;
+
+static class TestDescription_suite_VoronoiMesherTest_testAddRandomCells : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_VoronoiMesherTest_testAddRandomCells() : CxxTest::RealTestDescription( Tests_VoronoiMesherTest, suiteDescription_VoronoiMesherTest, 166, "testAddRandomCells" ) {}
+ void runTest() { suite_VoronoiMesherTest.testAddRandomCells(); }
+} testDescription_suite_VoronoiMesherTest_testAddRandomCells;
+
+static class TestDescription_suite_VoronoiMesherTest_testCollision : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_VoronoiMesherTest_testCollision() : CxxTest::RealTestDescription( Tests_VoronoiMesherTest, suiteDescription_VoronoiMesherTest, 208, "testCollision" ) {}
+ void runTest() { suite_VoronoiMesherTest.testCollision(); }
+} testDescription_suite_VoronoiMesherTest_testCollision;
+
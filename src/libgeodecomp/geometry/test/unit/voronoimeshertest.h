@@ -3,6 +3,9 @@
 #include <libgeodecomp/storage/containercell.h>
 #include <libgeodecomp/storage/grid.h>
 
+#include <algorithm>
+#include <map>
+
 using namespace LibGeoDecomp;
 
 namespace LibGeoDecomp {
@@ -54,7 +57,7 @@ class MockMesher : public VoronoiMesher<ContainerCellType>
 public:
     MockMesher(const Coord<2>& gridDim, const FloatCoord<2>& quadrantSize, double minCellDistance) :
         VoronoiMesher<ContainerCellType>(gridDim, quadrantSize, minCellDistance),
-        cellCounter(0)
+        cellCounter(1)
     {}
 
     virtual ~MockMesher()
@@ -62,7 +65,8 @@ public:
 
     virtual void addCell(ContainerCellType *container, const FloatCoord<DIM>& center)
     {
-        container->insert(cellCounter++, DummyCell(center));
+        container->insert(cellCounter, DummyCell(center, cellCounter));
+        ++cellCounter;
     }
 
     int cellCounter;
@@ -113,6 +117,9 @@ public:
 
         mesher.fillGeometryData(&grid);
 
+        double totalArea = 0;
+        std::map<int, std::vector<int> > neighbors;
+
         for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
             ContainerCellType cell = grid[*i];
             TS_ASSERT_EQUALS(cell.size(), std::size_t(16));
@@ -123,7 +130,35 @@ public:
                               << "  shape: " << j->shape << "\n";
                 }
                 TS_ASSERT_EQUALS(j->shape.size(), std::size_t(4));
-                TS_ASSERT(j->area > 0);
+
+                // elements are squares of 25x25, or clipped to
+                // 12.5 or 37.5 along the simulation space's boundary:
+                double width  = (j->center[0] == 0) ? 12.5 : ((j->center[0] == 475) ? 37.5 : 25);
+                double height = (j->center[1] == 0) ? 12.5 : ((j->center[1] == 275) ? 37.5 : 25);
+                TS_ASSERT_DELTA(width * height, j->area, 1e-9);
+                totalArea += j->area;
+
+                // boundaries of the simulation space have ID 0,
+                // diagonal neighbors only touch in a single point:
+                for (std::size_t k = 0; k < j->neighborIDs.size(); ++k) {
+                    if ((j->neighborIDs[k] != 0) && (j->neighborBoundaryLengths[k] > 1e-9)) {
+                        neighbors[j->id] << j->neighborIDs[k];
+                    }
+                }
+            }
+        }
+
+        TS_ASSERT_DELTA(500.0 * 300.0, totalArea, 1e-6);
+
+        TS_ASSERT_EQUALS(std::size_t(5 * 3 * 16), neighbors.size());
+        for (std::map<int, std::vector<int> >::iterator i = neighbors.begin(); i != neighbors.end(); ++i) {
+            TS_ASSERT_LESS_THAN_EQUALS(std::size_t(2), i->second.size());
+            TS_ASSERT_LESS_THAN_EQUALS(i->second.size(), std::size_t(4));
+
+            for (std::vector<int>::iterator j = i->second.begin(); j != i->second.end(); ++j) {
+                TS_ASSERT_DIFFERS(i->first, *j);
+                std::vector<int>& reverse = neighbors[*j];
+                TS_ASSERT(std::find(reverse.begin(), reverse.end(), i->first) != reverse.end());
             }
         }
     }
@@ -7,9 +7,14 @@
 #include <libgeodecomp/io/logger.h>
 #include <libgeodecomp/misc/apitraits.h>
 #include <libgeodecomp/misc/random.h>
+#include <libgeodecomp/misc/scopedtimer.h>
 #include <libgeodecomp/storage/gridbase.h>
 #include <algorithm>
+#include <deque>
 #include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace LibGeoDecomp {
 
@@ -29,12 +34,10 @@ class VoronoiMesher
 public:
     typedef CONTAINER_CELL ContainerCellType;
     typedef typename ContainerCellType::Cargo Cargo;
-    typedef ConvexPolytope<
-        typename APITraits::SelectCoordType<CONTAINER_CELL>::Value,
-        typename APITraits::SelectIDType<CONTAINER_CELL>::Value> ElementType;
-    typedef Plane<
-        typename APITraits::SelectCoordType<CONTAINER_CELL>::Value,
-        typename APITraits::SelectIDType<CONTAINER_CELL>::Value> EquationType;
+    typedef typename APITraits::SelectCoordType<CONTAINER_CELL>::Value CoordType;
+    typedef typename APITraits::SelectIDType<CONTAINER_CELL>::Value IDType;
+    typedef ConvexPolytope<CoordType, IDType> ElementType;
+    typedef Plane<CoordType, IDType> EquationType;
     typedef typename APITraits::SelectTopology<ContainerCellType>::Value Topology;
     static const int DIM = Topology::DIM;
     typedef GridBase<ContainerCellType, DIM> GridType;
@@ -77,74 +80,221 @@ public:
         }
     };
 
+    /**
+     * Computes shape, area and neighbor relationships of all
+     * elements in the grid. Containers are processed in parallel
+     * (via OpenMP, if available). Neighboring containers are read
+     * directly from the grid's memory if it allows this (see
+     * GridBase::streakAddress()), otherwise they're copied just
+     * once.
+     */
     void fillGeometryData(GridType *grid)
     {
+        double tStart = ScopedTimer::time();
         CoordBox<DIM> box = grid->boundingBox();
         FloatCoord<DIM> simSpaceDim = quadrantSize.scale(box.dimensions);
-        // statistics:
-        std::size_t maxShape = 0;
-        std::size_t maxNeighbors = 0;
-        std::size_t maxCells = 0;
-        double maxDiameter = 0;
 
+        CoordBox<DIM> haloBox(
+            box.origin - Coord<DIM>::diagonal(1),
+            box.dimensions + Coord<DIM>::diagonal(2));
+        std::vector<const ContainerCellType*> containers(haloBox.size());
+        // a deque won't invalidate pointers to its elements on push_back():
+        std::deque<ContainerCellType> copies;
+
+        for (typename CoordBox<DIM>::Iterator iter = haloBox.begin(); iter != haloBox.end(); ++iter) {
+            const ContainerCellType *container = grid->streakAddress(Streak<DIM>(*iter, iter->x() + 1));
+            if (container == 0) {
+                copies.push_back(grid->get(*iter));
+                container = &copies.back();
+            }
+
+            containers[haloIndex(haloBox, *iter)] = container;
+        }
+
+        std::vector<Coord<DIM> > coords;
         for (typename CoordBox<DIM>::Iterator iter = box.begin(); iter != box.end(); ++iter) {
-            Coord<2> containerCoord = *iter;
-            ContainerCellType container = grid->get(containerCoord);
-            maxCells = (std::max)(maxCells, container.size());
-
-            for (typename ContainerCellType::Iterator i = container.begin(); i != container.end(); ++i) {
-                Cargo& cell = *i;
-                ElementType e(cell.center, simSpaceDim);
-                for (int y = -1; y < 2; ++y) {
-                    for (int x = -1; x < 2; ++x) {
-                        ContainerCellType container2 =
-                            grid->get(containerCoord + Coord<2>(x, y));
-                        for (typename ContainerCellType::Iterator j = container2.begin();
-                             j != container2.end();
-                             ++j) {
-                            if (cell.center != j->center) {
-                                e << std::make_pair(j->center, i->id);
-                            }
-                        }
-                    }
-                }
+            coords.push_back(*iter);
+        }
 
-                e.updateGeometryData();
-                if (e.getDiameter() > quadrantSize.minElement()) {
-                    throw std::logic_error("element geometry too large for container cell");
-                }
+        // Results are buffered and written back in chunks as
+        // neighboring containers may still be read from the grid:
+        const long chunkSize = 1024;
+        std::vector<ContainerCellType> results;
+        std::vector<Statistics> statistics;
+        Statistics total;
+        std::string error;
 
-                cell.setArea(e.getVolume());
-                cell.setShape(e.getShape());
+        for (long chunkBegin = 0; chunkBegin < long(coords.size()); chunkBegin += chunkSize) {
+            long chunkEnd = (std::min)(long(coords.size()), chunkBegin + chunkSize);
+            results.resize(chunkEnd - chunkBegin);
+            statistics.assign(chunkEnd - chunkBegin, Statistics());
 
-                for (typename std::vector<EquationType>::const_iterator l = e.getLimits().begin();
-                     l != e.getLimits().end();
-                     ++l) {
-                    cell.pushNeighbor(l->neighborID, l->length, l->dir);
+#pragma omp parallel for schedule(dynamic)
+            for (long i = chunkBegin; i < chunkEnd; ++i) {
+                try {
+                    results[i - chunkBegin] = *containers[haloIndex(haloBox, coords[i])];
+                    fillContainer(
+                        &results[i - chunkBegin],
+                        coords[i],
+                        haloBox,
+                        containers,
+                        simSpaceDim,
+                        &statistics[i - chunkBegin]);
+                } catch (const std::exception& e) {
+#pragma omp critical
+                    {
+                        error = e.what();
+                    }
                 }
+            }
 
-                maxShape     = (std::max)(maxShape,     cell.shape.size());
-                maxNeighbors = (std::max)(maxNeighbors, cell.numberOfNeighbors());
-                maxDiameter  = (std::max)(maxDiameter,  e.getDiameter());
+            if (!error.empty()) {
+                throw std::logic_error(error);
             }
 
-            grid->set(containerCoord, container);
+            for (long i = chunkBegin; i < chunkEnd; ++i) {
+                grid->set(coords[i], results[i - chunkBegin]);
+                total.merge(statistics[i - chunkBegin]);
+            }
         }
 
         LOG(DBG,
-            "VoronoiMesher::fillGeometryData(maxShape: " << maxShape
-            << ", maxNeighbors: " << maxNeighbors
-            << ", maxDiameter: " << maxDiameter
-            << ", maxCells: " << maxCells << ")");
+            "VoronoiMesher::fillGeometryData(maxShape: " << total.maxShape
+            << ", maxNeighbors: " << total.maxNeighbors
+            << ", maxDiameter: " << total.maxDiameter
+            << ", maxCells: " << total.maxCells << ")");
+        LOG(INFO,
+            "VoronoiMesher::fillGeometryData() took " << (ScopedTimer::time() - tStart)
+            << "s for " << coords.size() << " containers");
     }
 
     virtual void addCell(ContainerCellType *container, const FloatCoord<DIM>& center) = 0;
 
 protected:
+    /**
+     * Bounds of the elements' geometry, for diagnostics only.
+     */
+    class Statistics
+    {
+    public:
+        Statistics() :
+            maxShape(0),
+            maxNeighbors(0),
+            maxCells(0),
+            maxDiameter(0)
+        {}
+
+        void merge(const Statistics& other)
+        {
+            maxShape     = (std::max)(maxShape,     other.maxShape);
+            maxNeighbors = (std::max)(maxNeighbors, other.maxNeighbors);
+            maxCells     = (std::max)(maxCells,     other.maxCells);
+            maxDiameter  = (std::max)(maxDiameter,  other.maxDiameter);
+        }
+
+        std::size_t maxShape;
+        std::size_t maxNeighbors;
+        std::size_t maxCells;
+        double maxDiameter;
+    };
+
+    /**
+     * A potential neighbor of an element, sortable by distance.
+     */
+    class Candidate
+    {
+    public:
+        Candidate(double distance, const CoordType& center, const IDType& id) :
+            distance(distance),
+            center(center),
+            id(id)
+        {}
+
+        bool operator<(const Candidate& other) const
+        {
+            return distance < other.distance;
+        }
+
+        double distance;
+        CoordType center;
+        IDType id;
+    };
+
     Coord<DIM> gridDim;
     FloatCoord<DIM> quadrantSize;
     double minCellDistance;
 
+    static std::size_t haloIndex(const CoordBox<DIM>& haloBox, const Coord<DIM>& coord)
+    {
+        return (coord - haloBox.origin).toIndex(haloBox.dimensions);
+    }
+
+    void fillContainer(
+        ContainerCellType *container,
+        const Coord<DIM>& containerCoord,
+        const CoordBox<DIM>& haloBox,
+        const std::vector<const ContainerCellType*>& containers,
+        const FloatCoord<DIM>& simSpaceDim,
+        Statistics *statistics) const
+    {
+        statistics->maxCells = (std::max)(statistics->maxCells, container->size());
+        std::vector<Candidate> candidates;
+
+        for (typename ContainerCellType::Iterator i = container->begin(); i != container->end(); ++i) {
+            Cargo& cell = *i;
+            candidates.clear();
+
+            for (int y = -1; y < 2; ++y) {
+                for (int x = -1; x < 2; ++x) {
+                    const ContainerCellType& container2 =
+                        *containers[haloIndex(haloBox, containerCoord + Coord<2>(x, y))];
+                    for (typename ContainerCellType::const_iterator j = container2.begin();
+                         j != container2.end();
+                         ++j) {
+                        if (cell.center != j->center) {
+                            CoordType delta = j->center - cell.center;
+                            candidates.push_back(Candidate(delta * delta, j->center, j->id));
+                        }
+                    }
+                }
+            }
+
+            // Inserting the nearest neighbors first shrinks the
+            // element quickly, so that the remaining candidates are
+            // soon too far away to have any effect:
+            std::sort(candidates.begin(), candidates.end());
+
+            ElementType e(cell.center, simSpaceDim);
+            for (typename std::vector<Candidate>::const_iterator j = candidates.begin();
+                 j != candidates.end();
+                 ++j) {
+                if (j->distance > 4 * e.getRadiusSquared()) {
+                    break;
+                }
+
+                e << std::make_pair(j->center, j->id);
+            }
+
+            e.updateGeometryData();
+            if (e.getDiameter() > quadrantSize.minElement()) {
+                throw std::logic_error("element geometry too large for container cell");
+            }
+
+            cell.setArea(e.getVolume());
+            cell.setShape(e.getShape());
+
+            for (typename std::vector<EquationType>::const_iterator l = e.getLimits().begin();
+                 l != e.getLimits().end();
+                 ++l) {
+                cell.pushNeighbor(l->neighborID, l->length, l->dir);
+            }
+
+            statistics->maxShape     = (std::max)(statistics->maxShape,     cell.shape.size());
+            statistics->maxNeighbors = (std::max)(statistics->maxNeighbors, cell.numberOfNeighbors());
+            statistics->maxDiameter  = (std::max)(statistics->maxDiameter,  e.getDiameter());
+        }
+    }
+
 
     FloatCoord<DIM> randCoord()
     {
@@ -0,0 +1,206 @@
+#ifndef LIBGEODECOMP_IO_ASYNCOUTPUTQUEUE_H
+#define LIBGEODECOMP_IO_ASYNCOUTPUTQUEUE_H
+
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_CPP14
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * Decides what AsyncWriter and AsyncParallelWriter do if all staging
+ * buffers are still in use by the I/O thread: either wait until one
+ * becomes available or drop the current time step's output.
+ */
+enum AsyncOutputPolicy {
+    ASYNC_OUTPUT_BLOCK,
+    ASYNC_OUTPUT_SKIP_FRAME
+};
+
+/**
+ * A bounded queue of staging buffers ("frames") which are processed
+ * by a single background thread. The simulation acquires a free
+ * frame, fills it and submits it; the I/O thread invokes the callback
+ * on submitted frames in order and then returns them to the pool.
+ * Frames are allocated once and recycled, so no memory is allocated
+ * during the simulation once the frames have reached their final
+ * size.
+ *
+ * Exceptions thrown by the callback are rethrown on the simulation
+ * thread by the next call to acquire() or drain().
+ */
+template<typename FRAME>
+class AsyncOutputQueue
+{
+public:
+    typedef std::function<void(FRAME&)> Callback;
+
+    AsyncOutputQueue(
+        const Callback& callback,
+        std::size_t capacity,
+        AsyncOutputPolicy policy) :
+        callback(callback),
+        frames(capacity),
+        policy(policy),
+        numSkipped(0),
+        busy(false),
+        shutdown(false)
+    {
+        if (capacity == 0) {
+            throw std::invalid_argument("AsyncOutputQueue needs at least one frame");
+        }
+
+        for (std::size_t i = 0; i < frames.size(); ++i) {
+            freeFrames.push_back(&frames[i]);
+        }
+    }
+
+    /**
+     * Flushes all pending frames before terminating the I/O thread.
+     */
+    ~AsyncOutputQueue()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            shutdown = true;
+        }
+        condition.notify_all();
+
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    /**
+     * Returns a free frame. If none is available and the frame is
+     * skippable, the policy decides whether we wait or return 0 (in
+     * which case the caller should drop this time step's output).
+     */
+    FRAME *acquire(bool skippable)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        rethrowError();
+
+        if (freeFrames.empty() && skippable && (policy == ASYNC_OUTPUT_SKIP_FRAME)) {
+            ++numSkipped;
+            return 0;
+        }
+
+        condition.wait(lock, [this]{ return !freeFrames.empty() || error; });
+        rethrowError();
+
+        FRAME *ret = freeFrames.back();
+        freeFrames.pop_back();
+        return ret;
+    }
+
+    /**
+     * Hands a frame obtained via acquire() to the I/O thread.
+     */
+    void submit(FRAME *frame)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pendingFrames.push_back(frame);
+
+            if (!worker.joinable()) {
+                worker = std::thread(&AsyncOutputQueue::run, this);
+            }
+        }
+        condition.notify_all();
+    }
+
+    /**
+     * Blocks until all submitted frames have been processed.
+     */
+    void drain()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this]{ return (pendingFrames.empty() && !busy) || error; });
+        rethrowError();
+    }
+
+    /**
+     * Number of frames dropped so far due to ASYNC_OUTPUT_SKIP_FRAME.
+     */
+    std::size_t skippedFrames() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return numSkipped;
+    }
+
+private:
+    Callback callback;
+    std::vector<FRAME> frames;
+    std::vector<FRAME*> freeFrames;
+    std::deque<FRAME*> pendingFrames;
+    AsyncOutputPolicy policy;
+    std::size_t numSkipped;
+    bool busy;
+    bool shutdown;
+    std::exception_ptr error;
+    mutable std::mutex mutex;
+    std::condition_variable condition;
+    std::thread worker;
+
+    AsyncOutputQueue(const AsyncOutputQueue&);
+    AsyncOutputQueue& operator=(const AsyncOutputQueue&);
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        for (;;) {
+            condition.wait(lock, [this]{ return !pendingFrames.empty() || shutdown; });
+            if (pendingFrames.empty()) {
+                return;
+            }
+
+            FRAME *frame = pendingFrames.front();
+            pendingFrames.pop_front();
+            busy = true;
+            lock.unlock();
+
+            std::exception_ptr callbackError;
+            try {
+                callback(*frame);
+            } catch (...) {
+                callbackError = std::current_exception();
+            }
+
+            lock.lock();
+            if (callbackError) {
+                error = callbackError;
+            }
+            busy = false;
+            freeFrames.push_back(frame);
+            condition.notify_all();
+        }
+    }
+
+    /**
+     * Expects mutex to be held by the caller.
+     */
+    void rethrowError()
+    {
+        if (error) {
+            std::exception_ptr e = error;
+            error = std::exception_ptr();
+            std::rethrow_exception(e);
+        }
+    }
+};
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,226 @@
+#ifndef LIBGEODECOMP_IO_ASYNCPARALLELWRITER_H
+#define LIBGEODECOMP_IO_ASYNCPARALLELWRITER_H
+
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_CPP14
+
+#include <libgeodecomp/io/asyncoutputqueue.h>
+#include <libgeodecomp/io/parallelwriter.h>
+#include <libgeodecomp/misc/clonable.h>
+#include <libgeodecomp/misc/sharedptr.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+
+namespace LibGeoDecomp {
+
+/**
+ * The ParallelWriter counterpart of AsyncWriter: all calls to
+ * stepFinished() belonging to one time step (up to and including
+ * the one with lastCall set) copy only their validRegion into a
+ * staging buffer. Once the step is complete, the calls are replayed
+ * on the delegate from a background I/O thread.
+ *
+ * Delegates which use MPI (e.g. BOVWriter or ParallelMPIIOWriter)
+ * require MPI to be initialized with MPI_THREAD_MULTIPLE. As their
+ * calls are collective, they must also use ASYNC_OUTPUT_BLOCK:
+ * skipping frames would be decided independently on each rank.
+ */
+template<typename CELL_TYPE>
+class AsyncParallelWriter : public Clonable<ParallelWriter<CELL_TYPE>, AsyncParallelWriter<CELL_TYPE> >
+{
+public:
+    typedef typename ParallelWriter<CELL_TYPE>::GridType GridType;
+    typedef typename ParallelWriter<CELL_TYPE>::Topology Topology;
+    typedef DisplacedGrid<CELL_TYPE, Topology> StorageGridType;
+
+    static const int DIM = Topology::DIM;
+
+    using ParallelWriter<CELL_TYPE>::region;
+
+    explicit AsyncParallelWriter(
+        ParallelWriter<CELL_TYPE> *writer,
+        std::size_t queueLength = 2,
+        AsyncOutputPolicy policy = ASYNC_OUTPUT_BLOCK) :
+        Clonable<ParallelWriter<CELL_TYPE>, AsyncParallelWriter<CELL_TYPE> >(writer->getPrefix(), writer->getPeriod()),
+        writer(writer),
+        queueLength(queueLength),
+        policy(policy),
+        currentFrame(0),
+        skipping(false)
+    {
+        initQueue();
+    }
+
+    /**
+     * Clones get their own delegate and I/O thread.
+     */
+    AsyncParallelWriter(const AsyncParallelWriter& other) :
+        Clonable<ParallelWriter<CELL_TYPE>, AsyncParallelWriter<CELL_TYPE> >(other.writer->getPrefix(), other.writer->getPeriod()),
+        writer(other.writer->clone()),
+        queueLength(other.queueLength),
+        policy(other.policy),
+        currentFrame(0),
+        skipping(false)
+    {
+        region = other.region;
+        initQueue();
+    }
+
+    ~AsyncParallelWriter()
+    {
+        // flush all pending frames while the delegate is still alive:
+        queue.reset();
+    }
+
+    /**
+     * Pending output still refers to the old region, so we need to
+     * flush it before the delegate gets notified.
+     */
+    virtual void setRegion(const Region<DIM>& newRegion)
+    {
+        queue->drain();
+        region = newRegion;
+        writer->setRegion(newRegion);
+    }
+
+    virtual void stepFinished(
+        const GridType& grid,
+        const Region<DIM>& validRegion,
+        const Coord<DIM>& globalDimensions,
+        unsigned step,
+        WriterEvent event,
+        std::size_t rank,
+        bool lastCall)
+    {
+        if (region.empty()) {
+            throw std::logic_error("AsyncParallelWriter::setRegion() needs to be called before stepFinished()");
+        }
+
+        if ((currentFrame == 0) && !skipping) {
+            currentFrame = queue->acquire(event == WRITER_STEP_FINISHED);
+            skipping = (currentFrame == 0);
+
+            if (currentFrame != 0) {
+                currentFrame->calls.clear();
+            }
+        }
+
+        if (skipping) {
+            skipping = !lastCall;
+            return;
+        }
+
+        stage(grid, validRegion);
+        currentFrame->calls.push_back(Call(validRegion, globalDimensions, step, event, rank, lastCall));
+
+        if (lastCall) {
+            queue->submit(currentFrame);
+            currentFrame = 0;
+
+            if (event == WRITER_ALL_DONE) {
+                queue->drain();
+            }
+        }
+    }
+
+    /**
+     * Number of time steps whose output was dropped because the I/O
+     * thread couldn't keep up (only with ASYNC_OUTPUT_SKIP_FRAME).
+     */
+    std::size_t skippedFrames() const
+    {
+        return queue->skippedFrames();
+    }
+
+private:
+    /**
+     * The parameters of one invocation of stepFinished().
+     */
+    class Call
+    {
+    public:
+        Call(
+            const Region<DIM>& validRegion,
+            const Coord<DIM>& globalDimensions,
+            unsigned step,
+            WriterEvent event,
+            std::size_t rank,
+            bool lastCall) :
+            validRegion(validRegion),
+            globalDimensions(globalDimensions),
+            step(step),
+            event(event),
+            rank(rank),
+            lastCall(lastCall)
+        {}
+
+        Region<DIM> validRegion;
+        Coord<DIM> globalDimensions;
+        unsigned step;
+        WriterEvent event;
+        std::size_t rank;
+        bool lastCall;
+    };
+
+    /**
+     * Staged cells of one time step, along with the calls to replay.
+     */
+    class Frame
+    {
+    public:
+        StorageGridType grid;
+        std::vector<Call> calls;
+    };
+
+    typename SharedPtr<ParallelWriter<CELL_TYPE> >::Type writer;
+    std::size_t queueLength;
+    AsyncOutputPolicy policy;
+    Frame *currentFrame;
+    bool skipping;
+    typename SharedPtr<AsyncOutputQueue<Frame> >::Type queue;
+
+    AsyncParallelWriter& operator=(const AsyncParallelWriter&);
+
+    void initQueue()
+    {
+        queue.reset(new AsyncOutputQueue<Frame>(
+                        [this](Frame& frame) {
+                            write(frame);
+                        },
+                        queueLength,
+                        policy));
+    }
+
+    void stage(const GridType& grid, const Region<DIM>& validRegion)
+    {
+        StorageGridType& stagingGrid = currentFrame->grid;
+        CoordBox<DIM> box = region.boundingBox();
+        if (!(stagingGrid.boundingBox() == box)) {
+            stagingGrid = StorageGridType(box, grid.getEdge(), grid.getEdge(), grid.topologicalDimensions());
+        }
+        stagingGrid.setEdge(grid.getEdge());
+
+        for (typename Region<DIM>::StreakIterator i = validRegion.beginStreak(); i != validRegion.endStreak(); ++i) {
+            grid.get(*i, &stagingGrid[i->origin]);
+        }
+    }
+
+    void write(const Frame& frame)
+    {
+        for (typename std::vector<Call>::const_iterator i = frame.calls.begin(); i != frame.calls.end(); ++i) {
+            writer->stepFinished(
+                frame.grid,
+                i->validRegion,
+                i->globalDimensions,
+                i->step,
+                i->event,
+                i->rank,
+                i->lastCall);
+        }
+    }
+};
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,140 @@
+#ifndef LIBGEODECOMP_IO_ASYNCWRITER_H
+#define LIBGEODECOMP_IO_ASYNCWRITER_H
+
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_CPP14
+
+#include <libgeodecomp/io/asyncoutputqueue.h>
+#include <libgeodecomp/io/writer.h>
+#include <libgeodecomp/misc/clonable.h>
+#include <libgeodecomp/misc/sharedptr.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+
+namespace LibGeoDecomp {
+
+/**
+ * Decouples a Writer from the simulation: stepFinished() merely
+ * copies the grid into a staging buffer and the delegate Writer is
+ * called back from a background I/O thread, so formatting and disk
+ * I/O overlap with the following time steps. Wrap any Writer like
+ * this:
+ *
+ *   sim.addWriter(new AsyncWriter<Cell>(new PPMWriter<Cell>(...)));
+ *
+ * At most queueLength snapshots are held in memory. If all of them
+ * are in use, the policy decides whether the simulation waits for
+ * the I/O thread or skips the current time step's output. The
+ * events WRITER_INITIALIZED and WRITER_ALL_DONE are never skipped,
+ * and all output has been written once stepFinished() returns for
+ * WRITER_ALL_DONE.
+ */
+template<typename CELL_TYPE>
+class AsyncWriter : public Clonable<Writer<CELL_TYPE>, AsyncWriter<CELL_TYPE> >
+{
+public:
+    typedef typename Writer<CELL_TYPE>::GridType GridType;
+    typedef typename Writer<CELL_TYPE>::Topology Topology;
+    typedef DisplacedGrid<CELL_TYPE, Topology> StorageGridType;
+
+    static const int DIM = Topology::DIM;
+
+    explicit AsyncWriter(
+        Writer<CELL_TYPE> *writer,
+        std::size_t queueLength = 2,
+        AsyncOutputPolicy policy = ASYNC_OUTPUT_BLOCK) :
+        Clonable<Writer<CELL_TYPE>, AsyncWriter<CELL_TYPE> >(writer->getPrefix(), writer->getPeriod()),
+        writer(writer),
+        queueLength(queueLength),
+        policy(policy)
+    {
+        initQueue();
+    }
+
+    /**
+     * Clones get their own delegate and I/O thread.
+     */
+    AsyncWriter(const AsyncWriter& other) :
+        Clonable<Writer<CELL_TYPE>, AsyncWriter<CELL_TYPE> >(other.writer->getPrefix(), other.writer->getPeriod()),
+        writer(other.writer->clone()),
+        queueLength(other.queueLength),
+        policy(other.policy)
+    {
+        initQueue();
+    }
+
+    ~AsyncWriter()
+    {
+        // flush all pending frames while the delegate is still alive:
+        queue.reset();
+    }
+
+    virtual void stepFinished(const GridType& grid, unsigned step, WriterEvent event)
+    {
+        Frame *frame = queue->acquire(event == WRITER_STEP_FINISHED);
+        if (frame == 0) {
+            return;
+        }
+
+        CoordBox<DIM> box = grid.boundingBox();
+        if (!(frame->grid.boundingBox() == box)) {
+            frame->grid = StorageGridType(box, grid.getEdge(), grid.getEdge(), grid.topologicalDimensions());
+        }
+        frame->grid.setEdge(grid.getEdge());
+
+        for (typename CoordBox<DIM>::StreakIterator i = box.beginStreak(); i != box.endStreak(); ++i) {
+            grid.get(*i, &frame->grid[i->origin]);
+        }
+
+        frame->step = step;
+        frame->event = event;
+        queue->submit(frame);
+
+        if (event == WRITER_ALL_DONE) {
+            queue->drain();
+        }
+    }
+
+    /**
+     * Number of time steps whose output was dropped because the I/O
+     * thread couldn't keep up (only with ASYNC_OUTPUT_SKIP_FRAME).
+     */
+    std::size_t skippedFrames() const
+    {
+        return queue->skippedFrames();
+    }
+
+private:
+    /**
+     * A snapshot of the grid, waiting to be written.
+     */
+    class Frame
+    {
+    public:
+        StorageGridType grid;
+        unsigned step;
+        WriterEvent event;
+    };
+
+    typename SharedPtr<Writer<CELL_TYPE> >::Type writer;
+    std::size_t queueLength;
+    AsyncOutputPolicy policy;
+    typename SharedPtr<AsyncOutputQueue<Frame> >::Type queue;
+
+    AsyncWriter& operator=(const AsyncWriter&);
+
+    void initQueue()
+    {
+        queue.reset(new AsyncOutputQueue<Frame>(
+                        [this](Frame& frame) {
+                            writer->stepFinished(frame.grid, frame.step, frame.event);
+                        },
+                        queueLength,
+                        policy));
+    }
+};
+
+}
+
+#endif
+
+#endif
@@ -5,7 +5,9 @@
 #include <libgeodecomp/geometry/region.h>
 #include <libgeodecomp/storage/selector.h>
 
+#include <algorithm>
 #include <fstream>
+#include <vector>
 
 namespace LibGeoDecomp {
 
@@ -61,11 +63,18 @@ public:
         file.close();
     }
 
+    /**
+     * Writes the Selector's member of all cells of the grid. Cells
+     * are gathered in slabs of whole planes (up to maxBlockSize
+     * bytes, but at least one plane) with one saveMemberUnchecked()
+     * call each, and each slab is written with a single call, too.
+     */
     template<typename GRID_TYPE>
     static void writeGrid(
         const std::string& filename,
         const GRID_TYPE& grid,
-        const Selector<CELL_TYPE>& selector)
+        const Selector<CELL_TYPE>& selector,
+        const std::size_t maxBlockSize = MAX_BLOCK_SIZE)
     {
         std::ofstream file;
         file.open(filename.c_str(), std::ios::binary);
@@ -73,25 +82,30 @@ public:
             throw std::runtime_error("BOVOutput::writeGrid() could not open output file " + filename);
         }
 
-        std::vector<char> buffer;
-        Coord<DIM> dimensions = grid.dimensions();
-        std::size_t length = dimensions.x();
-        std::size_t byteSize = length * selector.sizeOfExternal();
-        buffer.resize(byteSize);
-
         CoordBox<DIM> boundingBox = grid.boundingBox();
-        for (typename CoordBox<DIM>::StreakIterator i = boundingBox.beginStreak();
-             i != boundingBox.endStreak();
-             ++i) {
-            Streak<DIM> s(*i);
-
-            Region<DIM> tempRegion;
-            tempRegion << s;
-            grid.saveMemberUnchecked(&buffer[0], MemoryLocation::HOST, selector, tempRegion);
-
-            file.write(
-                &buffer[0],
-                byteSize);
+        Coord<DIM> dimensions = boundingBox.dimensions;
+        if (dimensions.prod() == 0) {
+            return;
+        }
+
+        // a slab spans whole planes orthogonal to the last axis:
+        int slabExtent = dimensions[DIM - 1];
+        std::size_t planeByteSize = dimensions.prod() / slabExtent * selector.sizeOfExternal();
+        int planesPerSlab = std::max<std::size_t>(1, maxBlockSize / planeByteSize);
+        planesPerSlab = (std::min)(planesPerSlab, slabExtent);
+
+        std::vector<char> buffer(planesPerSlab * planeByteSize);
+
+        for (int offset = 0; offset < slabExtent; offset += planesPerSlab) {
+            CoordBox<DIM> slab = boundingBox;
+            slab.origin[DIM - 1] += offset;
+            slab.dimensions[DIM - 1] = (std::min)(planesPerSlab, slabExtent - offset);
+
+            Region<DIM> slabRegion;
+            slabRegion << slab;
+            grid.saveMemberUnchecked(&buffer[0], MemoryLocation::HOST, selector, slabRegion);
+
+            file.write(&buffer[0], slab.dimensions[DIM - 1] * planeByteSize);
         }
 
         file.close();
@@ -123,6 +137,13 @@ public:
             throw std::runtime_error("BOVOutput::writeRegion() could not open output file " + filenameData);
         }
 
+        // buffer rows until MAX_BLOCK_SIZE is reached instead of
+        // writing each cell individually:
+        std::size_t rowLength = boundingBox.dimensions.x();
+        std::size_t rowsPerBlock = std::max<std::size_t>(1, MAX_BLOCK_SIZE / sizeof(float) / (std::max)(rowLength, std::size_t(1)));
+        std::vector<float> buffer;
+        buffer.reserve(rowsPerBlock * rowLength);
+
         ITER1 regionIter = start;
         for (typename CoordBox<DIM>::Iterator i = boundingBox.begin(); i != boundingBox.end(); ++i) {
             float num = 0;
@@ -131,9 +152,24 @@ public:
                 ++regionIter;
             }
 
-            file.write(reinterpret_cast<char*>(&num), sizeof(float));
+            buffer.push_back(num);
+            if (buffer.size() == buffer.capacity()) {
+                file.write(reinterpret_cast<char*>(&buffer[0]), buffer.size() * sizeof(float));
+                buffer.clear();
+            }
+        }
+
+        if (!buffer.empty()) {
+            file.write(reinterpret_cast<char*>(&buffer[0]), buffer.size() * sizeof(float));
         }
     }
+
+private:
+    /**
+     * Upper bound for the buffers used to assemble data before
+     * writing it to disk.
+     */
+    static const std::size_t MAX_BLOCK_SIZE = 64 * 1024 * 1024;
 };
 
 }
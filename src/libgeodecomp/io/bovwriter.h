@@ -10,7 +10,9 @@
 #include <libgeodecomp/misc/clonable.h>
 #include <libgeodecomp/storage/selector.h>
 
+#include <algorithm>
 #include <iomanip>
+#include <vector>
 
 namespace LibGeoDecomp {
 
@@ -18,6 +20,11 @@ namespace LibGeoDecomp {
  * writes simulation snapshots compatible with VisIt's Brick of Values
  * (BOV) format using MPI-IO. Uses a selector which maps a cell to a
  * primitive data type so that it can be fed into VisIt or ParaView.
+ *
+ * Each rank gathers its bricklet with a single saveMember call and
+ * all ranks write their bricklets with one collective MPI-IO call,
+ * which lets the MPI library aggregate the many small streaks into
+ * large, contiguous file accesses.
  */
 template<typename CELL_TYPE>
 class BOVWriter : public Clonable<ParallelWriter<CELL_TYPE>, BOVWriter<CELL_TYPE> >
@@ -42,6 +49,7 @@ public:
         Clonable<ParallelWriter<CELL_TYPE>, BOVWriter<CELL_TYPE> >(prefix, period),
         selector(member, "var"),
         brickletDim(brickletDim),
+        comm(communicator),
         datatype(selector.mpiDatatype())
     {}
 
@@ -82,6 +90,7 @@ private:
     Coord<3> brickletDim;
     MPI_Comm comm;
     MPI_Datatype datatype;
+    std::vector<char> buffer;
 
     std::string filename(unsigned step, const std::string& suffix) const
     {
@@ -141,7 +150,24 @@ private:
         MPI_File file = mpiio.openFileForWrite(
             filename(step, "data"), comm);
         MPI_Aint varLength = mpiio.getLength(datatype);
-        std::vector<char> buffer;
+        int dataComponents = selector.arity();
+
+        std::size_t byteSize = region.size() * selector.sizeOfExternal();
+        if (buffer.size() < byteSize) {
+            buffer.resize(byteSize);
+        }
+        if (region.size() > 0) {
+            grid.saveMemberUnchecked(&buffer[0], MemoryLocation::HOST, selector, region);
+        }
+
+        // MPI requires monotonically increasing displacements for
+        // file views, but on torus topologies the normalized streaks
+        // may be out of order. Hence we sort the streaks by file
+        // offset and let the memory datatype pick their data from
+        // the buffer accordingly.
+        std::vector<StreakLocation> locations;
+        locations.reserve(region.numStreaks());
+        MPI_Aint bufferOffset = 0;
 
         for (typename Region<DIM>::StreakIterator i = region.beginStreak();
              i != region.endStreak();
@@ -150,25 +176,67 @@ private:
             // topologies the coordnates may exceed the bounding box
             // (especially negative coordnates may occurr).
             Coord<DIM> coord = Topology::normalize(i->origin, dimensions);
-            int dataComponents = selector.arity();
-            MPI_Offset index = coord.toIndex(dimensions) * varLength * dataComponents;
-            MPI_File_seek(file, index, MPI_SEEK_SET);
             int length = i->endX - i->origin.x();
-            std::size_t byteSize = length * selector.sizeOfExternal();
 
-            if (buffer.size() != byteSize) {
-                buffer.resize(byteSize);
-            }
+            StreakLocation location;
+            location.fileOffset = coord.toIndex(dimensions) * varLength * dataComponents;
+            location.bufferOffset = bufferOffset;
+            location.length = length * dataComponents;
+            locations.push_back(location);
 
-            Region<DIM> tempRegion;
-            tempRegion << *i;
-            grid.saveMemberUnchecked(&buffer[0], MemoryLocation::HOST, selector, tempRegion);
+            bufferOffset += length * selector.sizeOfExternal();
+        }
+        std::sort(locations.begin(), locations.end());
+
+        std::vector<int> lengths(locations.size());
+        std::vector<MPI_Aint> fileOffsets(locations.size());
+        std::vector<MPI_Aint> bufferOffsets(locations.size());
+        for (std::size_t i = 0; i < locations.size(); ++i) {
+            lengths[i] = locations[i].length;
+            fileOffsets[i] = locations[i].fileOffset;
+            bufferOffsets[i] = locations[i].bufferOffset;
+        }
 
-            MPI_File_write(file, &buffer[0], length, datatype, MPI_STATUS_IGNORE);
+        MPI_Datatype fileType = datatype;
+        MPI_Datatype memoryType = datatype;
+        int count = 0;
+
+        if (!locations.empty()) {
+            MPI_Type_create_hindexed(locations.size(), &lengths[0], &fileOffsets[0], datatype, &fileType);
+            MPI_Type_commit(&fileType);
+            MPI_Type_create_hindexed(locations.size(), &lengths[0], &bufferOffsets[0], datatype, &memoryType);
+            MPI_Type_commit(&memoryType);
+            count = 1;
+        }
+
+        MPI_File_set_view(file, 0, datatype, fileType, const_cast<char*>("native"), MPI_INFO_NULL);
+        char *data = buffer.empty() ? 0 : &buffer[0];
+        MPI_File_write_all(file, data, count, memoryType, MPI_STATUS_IGNORE);
+
+        if (!locations.empty()) {
+            MPI_Type_free(&fileType);
+            MPI_Type_free(&memoryType);
         }
 
         MPI_File_close(&file);
     }
+
+    /**
+     * Position of a streak within the buffer and within the output
+     * file.
+     */
+    class StreakLocation
+    {
+    public:
+        MPI_Aint fileOffset;
+        MPI_Aint bufferOffset;
+        int length;
+
+        inline bool operator<(const StreakLocation& other) const
+        {
+            return fileOffset < other.fileOffset;
+        }
+    };
 };
 
 }
@@ -9,6 +9,11 @@
 #include <libgeodecomp/misc/clonable.h>
 #include <libgeodecomp/storage/gridtypeselector.h>
 #include <libgeodecomp/misc/sharedptr.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+
+#ifdef LIBGEODECOMP_WITH_CPP14
+#include <thread>
+#endif
 
 namespace LibGeoDecomp {
 
@@ -17,6 +22,13 @@ namespace LibGeoDecomp {
  * together with a DistributedSimulator. Good for testing, but doesn't
  * scale, as all memory is concentrated on one node and IO is
  * serialized to that node. Use with care!
+ *
+ * The cells are collected via MPI_Gatherv(), so the root receives
+ * from all nodes concurrently (and the MPI library may use a tree
+ * algorithm) instead of one node after another. In asynchronous mode
+ * the root hands the assembled grid to the delegate Writer on a
+ * background thread and continues with the simulation. For this it
+ * keeps two global grids in memory.
  */
 template<typename CELL_TYPE>
 class CollectingWriter : public Clonable<ParallelWriter<CELL_TYPE>, CollectingWriter<CELL_TYPE> >
@@ -36,13 +48,22 @@ public:
         Writer<CELL_TYPE> *writer,
         int root = 0,
         MPI_Comm communicator = MPI_COMM_WORLD,
-        MPI_Datatype mpiDatatype = SerializationBuffer<CELL_TYPE>::cellMPIDataType()) :
+        MPI_Datatype mpiDatatype = SerializationBuffer<CELL_TYPE>::cellMPIDataType(),
+        bool asynchronous = false) :
         Clonable<ParallelWriter<CELL_TYPE>, CollectingWriter<CELL_TYPE> >("",  1),
         writer(writer),
         mpiLayer(communicator),
         root(root),
-        datatype(mpiDatatype)
+        datatype(mpiDatatype),
+        asynchronous(asynchronous),
+        currentGrid(0)
     {
+#ifndef LIBGEODECOMP_WITH_CPP14
+        if (asynchronous) {
+            throw std::invalid_argument("asynchronous output requires C++14 support");
+        }
+#endif
+
         if ((mpiLayer.rank() != root) && (writer != 0)) {
             throw std::invalid_argument("can't call back a writer on a node other than the root");
         }
@@ -58,6 +79,13 @@ public:
         period = mpiLayer.broadcast(period, root);
     }
 
+#ifdef LIBGEODECOMP_WITH_CPP14
+    ~CollectingWriter()
+    {
+        waitForWriter();
+    }
+#endif
+
     virtual void stepFinished(
         const SimulatorGridType& grid,
         const Region<DIM>& validRegion,
@@ -69,50 +97,43 @@ public:
     {
         SerializationBuffer<CELL_TYPE>::resize(&buffer, validRegion.size());
         grid.saveRegion(&buffer, validRegion);
+        std::vector<Streak<DIM> > streaks = validRegion.toVector();
 
-        if (mpiLayer.rank() == root) {
-            if (globalGrid.boundingBox().dimensions != globalDimensions) {
-                Region<DIM> region;
-                region << CoordBox<DIM>(Coord<DIM>(), globalDimensions);
-                globalGrid = StorageGridType(region);
-            }
+        std::vector<int> numStreaks = mpiLayer.gather(int(streaks.size()), root);
+        std::vector<int> bufferSizes = mpiLayer.gather(int(buffer.size()), root);
+        std::vector<Streak<DIM> > allStreaks(sum(numStreaks));
+        gatherBuffer.resize(sum(bufferSizes));
 
-            globalGrid.loadRegion(buffer, validRegion);
-            globalGrid.setEdge(grid.getEdge());
+        mpiLayer.gatherV(streaks, numStreaks, root, allStreaks, Typemaps::lookup<Streak<DIM> >());
+        mpiLayer.gatherV(buffer, bufferSizes, root, gatherBuffer, datatype);
+
+        if (mpiLayer.rank() != root) {
+            return;
         }
 
-        for (int sender = 0; sender < mpiLayer.size(); ++sender) {
-            if (sender != root) {
-                if (mpiLayer.rank() == root) {
-                    Region<DIM> recvRegion;
-                    mpiLayer.recvRegion(&recvRegion, sender);
-                    SerializationBuffer<CELL_TYPE>::resize(&buffer, recvRegion.size());
-
-                    mpiLayer.recv(
-                        buffer.data(),
-                        sender,
-                        buffer.size(),
-                        MPILayer::COLLECTING_WRITER,
-                        SerializationBuffer<CELL_TYPE>::cellMPIDataType());
-                    mpiLayer.waitAll();
-                    globalGrid.loadRegion(buffer, recvRegion);
-                }
-                if (mpiLayer.rank() == sender) {
-                    mpiLayer.sendRegion(validRegion, root);
-                    mpiLayer.send(
-                        buffer.data(),
-                        root,
-                        buffer.size(),
-                        MPILayer::COLLECTING_WRITER,
-                        SerializationBuffer<CELL_TYPE>::cellMPIDataType());
-                }
-            }
+        StorageGridType& globalGrid = globalGrids[currentGrid];
+        if (globalGrid.boundingBox().dimensions != globalDimensions) {
+            Region<DIM> region;
+            region << CoordBox<DIM>(Coord<DIM>(), globalDimensions);
+            globalGrid = StorageGridType(region);
         }
+        globalGrid.setEdge(grid.getEdge());
+
+        typename std::vector<Streak<DIM> >::iterator streakCursor = allStreaks.begin();
+        typename BufferType::iterator bufferCursor = gatherBuffer.begin();
+        for (int sender = 0; sender < mpiLayer.size(); ++sender) {
+            Region<DIM> recvRegion;
+            recvRegion.load(streakCursor, streakCursor + numStreaks[sender]);
+            streakCursor += numStreaks[sender];
 
-        mpiLayer.waitAll();
+            buffer.assign(bufferCursor, bufferCursor + bufferSizes[sender]);
+            bufferCursor += bufferSizes[sender];
 
-        if (lastCall && (mpiLayer.rank() == root)) {
-            writer->stepFinished(globalGrid, step, event);
+            globalGrid.loadRegion(buffer, recvRegion);
+        }
+
+        if (lastCall) {
+            writeGlobalGrid(step, event);
         }
     }
 
@@ -120,9 +141,51 @@ private:
     typename SharedPtr<Writer<CELL_TYPE> >::Type writer;
     MPILayer mpiLayer;
     int root;
-    StorageGridType globalGrid;
+    StorageGridType globalGrids[2];
     BufferType buffer;
+    BufferType gatherBuffer;
     MPI_Datatype datatype;
+    bool asynchronous;
+    int currentGrid;
+#ifdef LIBGEODECOMP_WITH_CPP14
+    typename SharedPtr<std::thread>::Type writerThread;
+#endif
+
+    /**
+     * In asynchronous mode the grid is handed to a background thread
+     * and the next time step will be collected in the other grid. The
+     * final call is always synchronous so that all output is complete
+     * once the simulation returns.
+     */
+    void writeGlobalGrid(unsigned step, WriterEvent event)
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        waitForWriter();
+
+        if (asynchronous && (event != WRITER_ALL_DONE)) {
+            writerThread.reset(new std::thread(
+                                   &CollectingWriter::callWriter, this, currentGrid, step, event));
+            currentGrid = 1 - currentGrid;
+            return;
+        }
+#endif
+
+        callWriter(currentGrid, step, event);
+    }
+
+    void callWriter(int gridIndex, unsigned step, WriterEvent event)
+    {
+        writer->stepFinished(globalGrids[gridIndex], step, event);
+    }
+
+#ifdef LIBGEODECOMP_WITH_CPP14
+    void waitForWriter()
+    {
+        if (writerThread && writerThread->joinable()) {
+            writerThread->join();
+        }
+    }
+#endif
 };
 
 }
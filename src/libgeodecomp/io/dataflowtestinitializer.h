@@ -0,0 +1,191 @@
+#ifndef LIBGEODECOMP_IO_DATAFLOWTESTINITIALIZER_H
+#define LIBGEODECOMP_IO_DATAFLOWTESTINITIALIZER_H
+
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/geometry/regionbasedadjacency.h>
+#include <libgeodecomp/io/initializer.h>
+#include <libgeodecomp/misc/apitraits.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+
+#include <stdexcept>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+#ifdef LIBGEODECOMP_WITH_CPP14
+
+/**
+ * Message type of the DataflowTestModel: records who sent it to whom
+ * for which nano step, so that the receiver can validate it.
+ */
+class DataflowTestMessage
+{
+public:
+    explicit DataflowTestMessage(int sender = -1, int receiver = -1, int globalNanoStep = -1) :
+        sender(sender),
+        receiver(receiver),
+        globalNanoStep(globalNanoStep)
+    {}
+
+    bool operator==(const DataflowTestMessage& other) const
+    {
+        return
+            (sender         == other.sender) &&
+            (receiver       == other.receiver) &&
+            (globalNanoStep == other.globalNanoStep);
+    }
+
+    int sender;
+    int receiver;
+    int globalNanoStep;
+};
+
+/**
+ * Sends messages to only half of its neighbors per nano step (the
+ * others receive default messages) and counts every deviation from
+ * the expected sequence of events and messages.
+ */
+class DataflowTestModel
+{
+public:
+    static const int NANO_STEPS = 3;
+
+    class API :
+        public APITraits::HasUnstructuredTopology,
+        public APITraits::HasNanoSteps<NANO_STEPS>,
+        public APITraits::HasCustomMessageType<DataflowTestMessage>
+    {};
+
+    explicit DataflowTestModel(
+        int id = -1,
+        const std::vector<int>& neighbors = std::vector<int>(),
+        int failingNanoStep = -1) :
+        id(id),
+        neighbors(neighbors),
+        nextGlobalNanoStep(0),
+        errors(0),
+        failingNanoStep(failingNanoStep)
+    {}
+
+    template<typename HOOD, typename EVENT>
+    void update(HOOD&& hood, const EVENT& event)
+    {
+        int globalNanoStep = event.step() * NANO_STEPS + event.nanoStep();
+        if (globalNanoStep == failingNanoStep) {
+            throw std::runtime_error("DataflowTestModel failing as requested");
+        }
+        if (globalNanoStep != nextGlobalNanoStep) {
+            ++errors;
+        }
+        if (hood.neighbors() != neighbors) {
+            ++errors;
+        }
+
+        for (std::size_t i = 0; i < neighbors.size(); ++i) {
+            int neighbor = neighbors[i];
+            DataflowTestMessage expected;
+            if ((globalNanoStep > 0) && sendsTo(neighbor, id, globalNanoStep - 1)) {
+                expected = DataflowTestMessage(neighbor, id, globalNanoStep);
+            }
+
+            if (!(hood[neighbor] == expected)) {
+                ++errors;
+            }
+        }
+
+        for (std::size_t i = 0; i < neighbors.size(); ++i) {
+            if (sendsTo(id, neighbors[i], globalNanoStep)) {
+                hood.send(neighbors[i], DataflowTestMessage(id, neighbors[i], globalNanoStep + 1));
+            }
+        }
+
+        ++nextGlobalNanoStep;
+    }
+
+    int id;
+    std::vector<int> neighbors;
+    int nextGlobalNanoStep;
+    int errors;
+    int failingNanoStep;
+
+private:
+    static bool sendsTo(int sender, int receiver, int globalNanoStep)
+    {
+        return ((sender + receiver + globalNanoStep) % 2) == 0;
+    }
+};
+
+/**
+ * Sets up a chain in which each cell is connected to the two
+ * preceding and the two following cells. All cells throw when
+ * reaching failingNanoStep (if set).
+ */
+class DataflowTestInitializer : public Initializer<DataflowTestModel>
+{
+public:
+    DataflowTestInitializer(int gridSize, int myMaxSteps, int failingNanoStep = -1) :
+        gridSize(gridSize),
+        myMaxSteps(myMaxSteps),
+        failingNanoStep(failingNanoStep)
+    {}
+
+    void grid(GridBase<DataflowTestModel, 1> *grid)
+    {
+        CoordBox<1> box = grid->boundingBox();
+        for (CoordBox<1>::Iterator i = box.begin(); i != box.end(); ++i) {
+            grid->set(*i, DataflowTestModel(i->x(), getNeighbors(i->x()), failingNanoStep));
+        }
+    }
+
+    Coord<1> gridDimensions() const
+    {
+        return Coord<1>(gridSize);
+    }
+
+    unsigned startStep() const
+    {
+        return 0;
+    }
+
+    unsigned maxSteps() const
+    {
+        return myMaxSteps;
+    }
+
+    AdjacencyPtr getAdjacency(const Region<1>& region) const
+    {
+        AdjacencyPtr adjacency(new RegionBasedAdjacency());
+
+        for (Region<1>::Iterator i = region.begin(); i != region.end(); ++i) {
+            std::vector<int> neighbors = getNeighbors(i->x());
+            for (std::size_t j = 0; j < neighbors.size(); ++j) {
+                adjacency->insert(i->x(), neighbors[j]);
+            }
+        }
+
+        return adjacency;
+    }
+
+private:
+    int gridSize;
+    int myMaxSteps;
+    int failingNanoStep;
+
+    std::vector<int> getNeighbors(int id) const
+    {
+        std::vector<int> neighbors;
+        for (int i = id - 2; i <= id + 2; ++i) {
+            if ((i != id) && (i >= 0) && (i < gridSize)) {
+                neighbors << i;
+            }
+        }
+
+        return neighbors;
+    }
+};
+
+#endif
+
+}
+
+#endif
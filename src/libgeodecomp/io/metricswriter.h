@@ -0,0 +1,196 @@
+#ifndef LIBGEODECOMP_IO_METRICSWRITER_H
+#define LIBGEODECOMP_IO_METRICSWRITER_H
+
+#include <iostream>
+#include <stdexcept>
+
+#include <libgeodecomp/io/parallelwriter.h>
+#include <libgeodecomp/io/writer.h>
+#include <libgeodecomp/misc/clonable.h>
+#include <libgeodecomp/misc/metrics.h>
+
+namespace LibGeoDecomp {
+
+#ifdef _MSC_BUILD
+#pragma warning( push )
+#pragma warning( disable : 4626 )
+#endif
+
+/**
+ * Periodically reports the Metrics of the current process: cell
+ * updates per second (MLUPS, including redundant ghost zone updates),
+ * per-step averages of all counters (e.g. ghost zone bytes sent) and
+ * p50/p99/max of all latency histograms (e.g. time spent waiting for
+ * PatchLinks) over the steps since the last report. Records are
+ * written either as CSV or as JSON lines, one per report, which is
+ * easy to feed into monitoring and regression alarms.
+ *
+ * Like the TracingWriter it can be used as a Writer or as a
+ * ParallelWriter. In the latter case each rank reports its own
+ * metrics, or only outputRank if set.
+ */
+template<typename CELL_TYPE>
+class MetricsWriter :
+        public Clonable<Writer<CELL_TYPE>, MetricsWriter<CELL_TYPE> >,
+        public Clonable<ParallelWriter<CELL_TYPE>, MetricsWriter<CELL_TYPE> >
+{
+public:
+    typedef typename Writer<CELL_TYPE>::GridType WriterGridType;
+    typedef typename ParallelWriter<CELL_TYPE>::GridType ParallelWriterGridType;
+    typedef typename ParallelWriter<CELL_TYPE>::Topology Topology;
+
+    static const int DIM = Topology::DIM;
+    static const int OUTPUT_ON_ALL_RANKS = -1;
+
+    enum Format {
+        CSV,
+        JSON
+    };
+
+    explicit MetricsWriter(
+        const unsigned period = 1,
+        Format format = CSV,
+        int outputRank = OUTPUT_ON_ALL_RANKS,
+        std::ostream& stream = std::cerr) :
+        Clonable<Writer<CELL_TYPE>, MetricsWriter<CELL_TYPE> >("", period),
+        Clonable<ParallelWriter<CELL_TYPE>, MetricsWriter<CELL_TYPE> >("", period),
+        format(format),
+        outputRank(outputRank),
+        stream(stream),
+        lastStep(0)
+    {}
+
+#ifdef LIBGEODECOMP_WITH_CPP14
+    inline MetricsWriter(const MetricsWriter& other) = default;
+    inline MetricsWriter(MetricsWriter&& other) = default;
+#endif
+
+    virtual void stepFinished(const WriterGridType& /* grid */, unsigned step, WriterEvent event)
+    {
+        stepFinished(step, event, 0);
+    }
+
+    virtual void stepFinished(
+        const ParallelWriterGridType& /* grid */,
+        const Region<DIM>& /* validRegion */,
+        const Coord<DIM>& /* globalDimensions */,
+        unsigned step,
+        WriterEvent event,
+        std::size_t rank,
+        bool lastCall)
+    {
+        if (lastCall && ((outputRank == OUTPUT_ON_ALL_RANKS) || (outputRank == (int)rank))) {
+            stepFinished(step, event, rank);
+        }
+    }
+
+private:
+    Format format;
+    int outputRank;
+    std::ostream& stream;
+    Metrics::Snapshot lastSnapshot;
+    unsigned lastStep;
+
+    void stepFinished(unsigned step, WriterEvent event, std::size_t rank)
+    {
+        switch (event) {
+        case WRITER_INITIALIZED:
+            lastSnapshot = Metrics::snapshot();
+            lastStep = step;
+            if (format == CSV) {
+                printHeader();
+            }
+            break;
+        case WRITER_STEP_FINISHED:
+            if ((step % Writer<CELL_TYPE>::period) == 0) {
+                report(step, rank);
+            }
+            break;
+        case WRITER_ALL_DONE:
+            if (step != lastStep) {
+                report(step, rank);
+            }
+            break;
+        default:
+            throw std::invalid_argument("unknown event");
+        }
+    }
+
+    void printHeader()
+    {
+        stream << "rank,step,elapsed,mlups";
+        for (int i = 0; i < Metrics::NUM_COUNTERS; ++i) {
+            stream << "," << Metrics::name(Metrics::Counter(i));
+        }
+        for (int i = 0; i < Metrics::NUM_HISTOGRAMS; ++i) {
+            std::string name = Metrics::name(Metrics::Histogram(i));
+            stream << "," << name << "_count"
+                   << "," << name << "_p50"
+                   << "," << name << "_p99"
+                   << "," << name << "_max";
+        }
+        stream << "\n";
+        stream.flush();
+    }
+
+    void report(unsigned step, std::size_t rank)
+    {
+        Metrics::Snapshot now = Metrics::snapshot();
+        Metrics::Snapshot delta = now - lastSnapshot;
+        unsigned steps = (step > lastStep) ? (step - lastStep) : 1;
+        lastSnapshot = now;
+        lastStep = step;
+
+        double mlups = 0;
+        if (delta.time > 0) {
+            mlups = delta.counters[Metrics::CELLS_UPDATED] / delta.time / 1000.0 / 1000.0;
+        }
+
+        if (format == CSV) {
+            stream << rank << "," << step << "," << delta.time << "," << mlups;
+            for (int i = 0; i < Metrics::NUM_COUNTERS; ++i) {
+                stream << "," << (double(delta.counters[i]) / steps);
+            }
+            for (int i = 0; i < Metrics::NUM_HISTOGRAMS; ++i) {
+                const Metrics::HistogramSnapshot& histogram = delta.histograms[i];
+                stream << "," << histogram.count
+                       << "," << histogram.percentile(0.5)
+                       << "," << histogram.percentile(0.99)
+                       << "," << histogram.max();
+            }
+        } else {
+            stream << "{\"rank\":" << rank
+                   << ",\"step\":" << step
+                   << ",\"elapsed\":" << delta.time
+                   << ",\"mlups\":" << mlups
+                   << ",\"counters\":{";
+            for (int i = 0; i < Metrics::NUM_COUNTERS; ++i) {
+                stream << ((i == 0) ? "" : ",")
+                       << "\"" << Metrics::name(Metrics::Counter(i)) << "\":"
+                       << (double(delta.counters[i]) / steps);
+            }
+            stream << "},\"histograms\":{";
+            for (int i = 0; i < Metrics::NUM_HISTOGRAMS; ++i) {
+                const Metrics::HistogramSnapshot& histogram = delta.histograms[i];
+                stream << ((i == 0) ? "" : ",")
+                       << "\"" << Metrics::name(Metrics::Histogram(i)) << "\":{"
+                       << "\"count\":" << histogram.count
+                       << ",\"p50\":" << histogram.percentile(0.5)
+                       << ",\"p99\":" << histogram.percentile(0.99)
+                       << ",\"max\":" << histogram.max() << "}";
+            }
+            stream << "}}";
+        }
+
+        stream << "\n";
+        stream.flush();
+    }
+};
+
+#ifdef _MSC_BUILD
+#pragma warning( pop )
+#endif
+
+}
+
+#endif
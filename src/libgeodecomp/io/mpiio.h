@@ -10,10 +10,27 @@
 #include <libgeodecomp/geometry/region.h>
 #include <libgeodecomp/loadbalancer/randombalancer.h>
 
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
 namespace LibGeoDecomp {
 
 /**
  * Utility class which bundles common MPI-based input/output code.
+ *
+ * All files share the same format: a header (the grid's dimensions,
+ * the time step, maxSteps and the edge cell) is followed by all cells
+ * of the grid in row-major order. As the layout doesn't depend on the
+ * domain decomposition, snapshots written by any number of processes
+ * can be read by any other number of processes.
+ *
+ * Reading and writing are collective operations on the given
+ * communicator: each process sets a file view which covers its Region
+ * and then transfers all of its cells with a single call to
+ * MPI_File_read_all()/MPI_File_write_all(). This lets the MPI
+ * implementation aggregate the requests, which is much faster on
+ * parallel file systems than issuing one request per Streak.
  */
 template<
     typename CELL_TYPE,
@@ -42,22 +59,19 @@ public:
         MPI_File_read(file, &cell, 1, mpiDatatype, MPI_STATUS_IGNORE);
         grid->setEdge(cell);
 
-        for (typename Region<DIM>::StreakIterator i = region.beginStreak();
-             i != region.endStreak();
-             ++i) {
-            // the coords need to be normalized because on torus
-            // topologies the coordnates may exceed the bounding box
-            // (especially negative coordnates may occurr).
-            Coord<DIM> coord = TOPOLOGY::normalize(i->origin, dimensions);
-            MPI_File_seek(
-                file,
-                offset(headerLength, coord, dimensions, cellLength),
-                MPI_SEEK_SET);
-            int length = i->endX - i->origin.x();
-            std::vector<CELL_TYPE> vec(length);
-
-            MPI_File_read(file, &vec[0], length, mpiDatatype, MPI_STATUS_IGNORE);
-            grid->set(*i, &vec[0]);
+        std::vector<ChunkVec<DIM> > layers = sortStreaks(region, dimensions, cellLength, comm);
+        for (typename std::vector<ChunkVec<DIM> >::iterator layer = layers.begin();
+             layer != layers.end();
+             ++layer) {
+            std::vector<CELL_TYPE> buffer(countCells(*layer));
+            setFileView(file, headerLength, *layer, mpiDatatype);
+            MPI_File_read_all(file, bufferPointer(&buffer), buffer.size(), mpiDatatype, MPI_STATUS_IGNORE);
+
+            CELL_TYPE *cursor = bufferPointer(&buffer);
+            for (typename ChunkVec<DIM>::iterator i = layer->begin(); i != layer->end(); ++i) {
+                grid->set(i->streak, cursor);
+                cursor += i->streak.length();
+            }
         }
 
         MPI_File_close(&file);
@@ -111,28 +125,36 @@ public:
                            1, mpiDatatype,  MPI_STATUS_IGNORE);
         }
 
-        for (typename Region<DIM>::StreakIterator i = region.beginStreak();
-             i != region.endStreak();
-             ++i) {
-            // the coords need to be normalized because on torus
-            // topologies the coordnates may exceed the bounding box
-            // (especially negative coordnates may occurr).
-            Coord<DIM> coord = TOPOLOGY::normalize(i->origin, dimensions);
-            MPI_File_seek(
-                file,
-                offset(headerLength, coord, dimensions, cellLength),
-                MPI_SEEK_SET);
+        std::vector<ChunkVec<DIM> > layers = sortStreaks(region, dimensions, cellLength, comm);
+        for (typename std::vector<ChunkVec<DIM> >::iterator layer = layers.begin();
+             layer != layers.end();
+             ++layer) {
+            std::vector<CELL_TYPE> buffer(countCells(*layer));
 
-            int length = i->endX - i->origin.x();
-            std::vector<CELL_TYPE> vec(length);
-            grid.get(*i, &vec[0]);
+            CELL_TYPE *cursor = bufferPointer(&buffer);
+            for (typename ChunkVec<DIM>::iterator i = layer->begin(); i != layer->end(); ++i) {
+                grid.get(i->streak, cursor);
+                cursor += i->streak.length();
+            }
 
-            MPI_File_write(file, &vec[0], length, mpiDatatype, MPI_STATUS_IGNORE);
+            setFileView(file, headerLength, *layer, mpiDatatype);
+            MPI_File_write_all(file, bufferPointer(&buffer), buffer.size(), mpiDatatype, MPI_STATUS_IGNORE);
         }
 
         MPI_File_close(&file);
     }
 
+    /**
+     * Yields the file name under which MPIIOWriter and
+     * ParallelMPIIOWriter store the snapshot of the given time step.
+     */
+    static std::string filename(const std::string& prefix, unsigned step)
+    {
+        std::ostringstream buf;
+        buf << prefix << std::setfill('0') << std::setw(5) << step << ".mpiio";
+        return buf.str();
+    }
+
     MPI_File openFileForRead(
         const std::string& filename,
         MPI_Comm comm)
@@ -177,17 +199,153 @@ public:
     }
 
 private:
+    /**
+     * A Streak along with the offset (relative to the end of the
+     * header) of its cells within the file.
+     */
+    template<int DIM>
+    class Chunk
+    {
+    public:
+        Chunk(const Streak<DIM>& streak, MPI_Aint offset) :
+            streak(streak),
+            offset(offset)
+        {}
+
+        inline bool operator<(const Chunk& other) const
+        {
+            return offset < other.offset;
+        }
+
+        Streak<DIM> streak;
+        MPI_Aint offset;
+    };
+
+    template<int DIM>
+    class ChunkVec : public std::vector<Chunk<DIM> >
+    {};
+
     // fixme: use MPILayer for MPI-IO
     MPILayer mpiLayer;
 
+    /**
+     * MPI requires the displacements of a file view to be
+     * monotonically increasing. On torus topologies the Streaks of a
+     * Region may wrap around the grid's boundaries (e.g. for ghost
+     * zones), so we need to sort them by their position within the
+     * file. Should some of them overlap, then they'll be distributed
+     * among multiple layers, each of which is non-overlapping. The
+     * number of layers is synchronized among all processes as each
+     * layer requires one collective operation.
+     */
     template<int DIM>
-    MPI_Offset offset(
-        const MPI_Offset& headerLength,
-        const Coord<DIM>& c,
+    std::vector<ChunkVec<DIM> > sortStreaks(
+        const Region<DIM>& region,
         const Coord<DIM>& dimensions,
-        const MPI_Aint& cellLength)
+        const MPI_Aint& cellLength,
+        const MPI_Comm& comm)
+    {
+        ChunkVec<DIM> chunks;
+        chunks.reserve(region.numStreaks());
+
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak();
+             i != region.endStreak();
+             ++i) {
+            // the coords need to be normalized because on torus
+            // topologies the coordnates may exceed the bounding box
+            // (especially negative coordnates may occurr).
+            Coord<DIM> coord = TOPOLOGY::normalize(i->origin, dimensions);
+            chunks.push_back(Chunk<DIM>(*i, MPI_Aint(coord.toIndex(dimensions)) * cellLength));
+        }
+        std::stable_sort(chunks.begin(), chunks.end());
+
+        std::vector<ChunkVec<DIM> > layers;
+        std::vector<MPI_Aint> layerEnds;
+        for (typename ChunkVec<DIM>::iterator i = chunks.begin(); i != chunks.end(); ++i) {
+            std::size_t layer = 0;
+            while ((layer < layers.size()) && (layerEnds[layer] > i->offset)) {
+                ++layer;
+            }
+            if (layer == layers.size()) {
+                layers.push_back(ChunkVec<DIM>());
+                layerEnds.push_back(0);
+            }
+
+            layers[layer].push_back(*i);
+            layerEnds[layer] = i->offset + i->streak.length() * cellLength;
+        }
+
+        unsigned localLayers = layers.size();
+        unsigned globalLayers = 0;
+        MPI_Allreduce(&localLayers, &globalLayers, 1, MPI_UNSIGNED, MPI_MAX, comm);
+        layers.resize(globalLayers);
+
+        return layers;
+    }
+
+    /**
+     * Restricts the file view of the calling process to the given
+     * chunks. Each Streak's cells are stored contiguously, starting at
+     * the offset of its first cell.
+     */
+    template<int DIM>
+    void setFileView(
+        MPI_File file,
+        const MPI_Offset& headerLength,
+        const ChunkVec<DIM>& chunks,
+        const MPI_Datatype& mpiDatatype)
+    {
+        int cellSize;
+        MPI_Type_size(mpiDatatype, &cellSize);
+
+        // dummy elements ensure valid pointers even if the view is empty:
+        std::vector<int> lengths(1, 0);
+        std::vector<MPI_Aint> displacements(1, 0);
+        lengths.reserve(chunks.size() + 1);
+        displacements.reserve(chunks.size() + 1);
+
+        for (typename ChunkVec<DIM>::const_iterator i = chunks.begin(); i != chunks.end(); ++i) {
+            lengths.push_back(i->streak.length() * cellSize);
+            displacements.push_back(i->offset);
+        }
+
+        MPI_Datatype fileType;
+        MPI_Type_create_hindexed(
+            chunks.size(),
+            &lengths[1],
+            &displacements[1],
+            MPI_BYTE,
+            &fileType);
+        MPI_Type_commit(&fileType);
+
+        MPI_File_set_view(
+            file,
+            headerLength,
+            MPI_BYTE,
+            fileType,
+            const_cast<char*>("native"),
+            MPI_INFO_NULL);
+        MPI_Type_free(&fileType);
+    }
+
+    template<int DIM>
+    std::size_t countCells(const ChunkVec<DIM>& chunks) const
+    {
+        std::size_t ret = 0;
+        for (typename ChunkVec<DIM>::const_iterator i = chunks.begin(); i != chunks.end(); ++i) {
+            ret += i->streak.length();
+        }
+
+        return ret;
+    }
+
+    /**
+     * std::vector::data() is C++11, hence this workaround.
+     */
+    CELL_TYPE *bufferPointer(std::vector<CELL_TYPE> *buffer)
     {
-        return headerLength + c.toIndex(dimensions) * cellLength;
+        static CELL_TYPE dummy;
+        return buffer->empty() ? &dummy : &(*buffer)[0];
     }
 
     template<int DIM>
@@ -36,6 +36,25 @@ public:
             &dimensions, &currentStep, &maximumSteps, file, communicator);
     }
 
+    /**
+     * Restarts from the snapshot which MPIIOWriter or
+     * ParallelMPIIOWriter stored for the given prefix and time step.
+     * The number of processes may differ from the one used for
+     * writing the snapshot.
+     */
+    MPIIOInitializer(
+        const std::string& prefix,
+        unsigned step,
+        const MPI_Datatype& mpiDatatype = Typemaps::lookup<CELL_TYPE>(),
+        const MPI_Comm& comm = MPI_COMM_WORLD) :
+        file(MPIIO<CELL_TYPE>::filename(prefix, step)),
+        datatype(mpiDatatype),
+        communicator(comm)
+    {
+        mpiio.readMetadata(
+            &dimensions, &currentStep, &maximumSteps, file, communicator);
+    }
+
     virtual void grid(GridBase<CELL_TYPE, DIM> *target)
     {
         Region<DIM> region;
@@ -69,9 +69,7 @@ private:
 
     std::string filename(unsigned step) const
     {
-        std::ostringstream buf;
-        buf << prefix << std::setfill('0') << std::setw(5) << step << ".mpiio";
-        return buf.str();
+        return MPIIO<CELL_TYPE>::filename(prefix, step);
     }
 };
 
@@ -0,0 +1,14 @@
+set(SOURCES ${SOURCES}
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}action.h
+  ${RELATIVE_PATH}commandserver.h
+  ${RELATIVE_PATH}getaction.h
+  ${RELATIVE_PATH}gethandler.h
+  ${RELATIVE_PATH}handler.h
+  ${RELATIVE_PATH}interactor.h
+  ${RELATIVE_PATH}passthroughaction.h
+  ${RELATIVE_PATH}pipe.h
+  ${RELATIVE_PATH}setaction.h
+  ${RELATIVE_PATH}waitaction.h
+)
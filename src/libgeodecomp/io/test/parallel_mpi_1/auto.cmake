@@ -0,0 +1,30 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}asciiwritertest.cpp
+  ${RELATIVE_PATH}ioexceptiontest.cpp
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}metricswritertest.cpp
+  ${RELATIVE_PATH}mpiiotest.cpp
+  ${RELATIVE_PATH}mpiiowritertest.cpp
+  ${RELATIVE_PATH}plottertest.cpp
+  ${RELATIVE_PATH}ppmwritertest.cpp
+  ${RELATIVE_PATH}qtwidgetwritertest.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+  ${RELATIVE_PATH}testinitializertest.cpp
+  ${RELATIVE_PATH}teststeerertest.cpp
+  ${RELATIVE_PATH}tracingwritertest.cpp
+  ${RELATIVE_PATH}writertest.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}asciiwritertest.h
+  ${RELATIVE_PATH}ioexceptiontest.h
+  ${RELATIVE_PATH}metricswritertest.h
+  ${RELATIVE_PATH}mpiiotest.h
+  ${RELATIVE_PATH}mpiiowritertest.h
+  ${RELATIVE_PATH}plottertest.h
+  ${RELATIVE_PATH}ppmwritertest.h
+  ${RELATIVE_PATH}qtwidgetwritertest.h
+  ${RELATIVE_PATH}testinitializertest.h
+  ${RELATIVE_PATH}teststeerertest.h
+  ${RELATIVE_PATH}tracingwritertest.h
+  ${RELATIVE_PATH}writertest.h
+)
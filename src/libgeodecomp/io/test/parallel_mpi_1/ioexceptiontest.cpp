@@ -0,0 +1,44 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_IOExceptionTest_init = false;
+#include "/root/repo/src/libgeodecomp/io/test/parallel_mpi_1/ioexceptiontest.h"
+
+static IOExceptionTest suite_IOExceptionTest;
+
+static CxxTest::List Tests_IOExceptionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_IOExceptionTest( "/root/repo/src/libgeodecomp/io/test/parallel_mpi_1/ioexceptiontest.h", 9, "IOExceptionTest", suite_IOExceptionTest, Tests_IOExceptionTest );
+
+static class TestDescription_suite_IOExceptionTest_testIOException : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_IOExceptionTest_testIOException() : CxxTest::RealTestDescription( Tests_IOExceptionTest, suiteDescription_IOExceptionTest, 13, "testIOException" ) {}
+ void runTest() { suite_IOExceptionTest.testIOException(); }
+} testDescription_suite_IOExceptionTest_testIOException;
+
+static class TestDescription_suite_IOExceptionTest_testExceptionWithoutErrorcode : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_IOExceptionTest_testExceptionWithoutErrorcode() : CxxTest::RealTestDescription( Tests_IOExceptionTest, suiteDescription_IOExceptionTest, 21, "testExceptionWithoutErrorcode" ) {}
+ void runTest() { suite_IOExceptionTest.testExceptionWithoutErrorcode(); }
+} testDescription_suite_IOExceptionTest_testExceptionWithoutErrorcode;
+
@@ -0,0 +1,44 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_MetricsWriterTest_init = false;
+#include "/root/repo/src/libgeodecomp/io/test/parallel_mpi_1/metricswritertest.h"
+
+static MetricsWriterTest suite_MetricsWriterTest;
+
+static CxxTest::List Tests_MetricsWriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MetricsWriterTest( "/root/repo/src/libgeodecomp/io/test/parallel_mpi_1/metricswritertest.h", 13, "MetricsWriterTest", suite_MetricsWriterTest, Tests_MetricsWriterTest );
+
+static class TestDescription_suite_MetricsWriterTest_testCSV : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MetricsWriterTest_testCSV() : CxxTest::RealTestDescription( Tests_MetricsWriterTest, suiteDescription_MetricsWriterTest, 27, "testCSV" ) {}
+ void runTest() { suite_MetricsWriterTest.testCSV(); }
+} testDescription_suite_MetricsWriterTest_testCSV;
+
+static class TestDescription_suite_MetricsWriterTest_testJSON : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MetricsWriterTest_testJSON() : CxxTest::RealTestDescription( Tests_MetricsWriterTest, suiteDescription_MetricsWriterTest, 61, "testJSON" ) {}
+ void runTest() { suite_MetricsWriterTest.testJSON(); }
+} testDescription_suite_MetricsWriterTest_testJSON;
+
@@ -0,0 +1,85 @@
+#include <sstream>
+#include <cxxtest/TestSuite.h>
+#include <libgeodecomp/io/metricswriter.h>
+#include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/misc/stringops.h>
+#include <libgeodecomp/misc/testcell.h>
+#include <libgeodecomp/parallelization/serialsimulator.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class MetricsWriterTest : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+        init = new TestInitializer<TestCell<2> >();
+        simulator = new SerialSimulator<TestCell<2> >(init);
+    }
+
+    void tearDown()
+    {
+        delete simulator;
+    }
+
+    void testCSV()
+    {
+        std::ostringstream output;
+        simulator->addWriter(new MetricsWriter<TestCell<2> >(5, MetricsWriter<TestCell<2> >::CSV, 0, output));
+        simulator->run();
+
+        std::vector<std::string> lines = StringOps::tokenize(output.str(), "\n");
+        unsigned steps = init->maxSteps() - init->startStep();
+        // header, one record per 5 steps plus the final one:
+        TS_ASSERT_EQUALS(std::size_t(1 + (steps + 4) / 5), lines.size());
+
+        std::vector<std::string> header = StringOps::tokenize(lines[0], ",");
+        TS_ASSERT_EQUALS(std::size_t(4 + Metrics::NUM_COUNTERS + 4 * Metrics::NUM_HISTOGRAMS), header.size());
+        TS_ASSERT_EQUALS("rank",                   header[0]);
+        TS_ASSERT_EQUALS("mlups",                  header[3]);
+        TS_ASSERT_EQUALS("cells_updated",          header[4]);
+        TS_ASSERT_EQUALS("patch_link_wait_count",  header[8]);
+        TS_ASSERT_EQUALS("writer_latency_max",     header[15]);
+
+        for (std::size_t i = 1; i < lines.size(); ++i) {
+            std::vector<std::string> record = StringOps::tokenize(lines[i], ",");
+            TS_ASSERT_EQUALS(header.size(), record.size());
+            TS_ASSERT_EQUALS("0", record[0]);
+
+            // every cell gets updated once per nano step:
+            double cellsPerStep = StringOps::atof(record[4]);
+            TS_ASSERT_EQUALS(double(init->gridDimensions().prod()) * TestCell<2>::NANO_STEPS, cellsPerStep);
+            TS_ASSERT_LESS_THAN(0, StringOps::atof(record[3]));
+        }
+
+        std::vector<std::string> last = StringOps::tokenize(lines.back(), ",");
+        TS_ASSERT_EQUALS(StringOps::itoa(init->maxSteps()), last[1]);
+    }
+
+    void testJSON()
+    {
+        std::ostringstream output;
+        simulator->addWriter(new MetricsWriter<TestCell<2> >(10, MetricsWriter<TestCell<2> >::JSON, 0, output));
+        simulator->run();
+
+        std::vector<std::string> lines = StringOps::tokenize(output.str(), "\n");
+        unsigned steps = init->maxSteps() - init->startStep();
+        TS_ASSERT_EQUALS(std::size_t((steps + 9) / 10), lines.size());
+
+        for (std::size_t i = 0; i < lines.size(); ++i) {
+            TS_ASSERT_EQUALS(std::size_t(0), lines[i].find("{\"rank\":0,\"step\":"));
+            TS_ASSERT_DIFFERS(std::string::npos, lines[i].find(",\"counters\":{\"cells_updated\":"));
+            TS_ASSERT_DIFFERS(std::string::npos, lines[i].find(",\"histograms\":{\"patch_link_wait\":{\"count\":0,"));
+            TS_ASSERT_DIFFERS(std::string::npos, lines[i].find("\"writer_latency\":{\"count\":"));
+            TS_ASSERT_EQUALS(std::string("}}"), lines[i].substr(lines[i].size() - 2));
+        }
+    }
+
+private:
+    TestInitializer<TestCell<2> > *init;
+    MonolithicSimulator<TestCell<2> > *simulator;
+};
+
+}
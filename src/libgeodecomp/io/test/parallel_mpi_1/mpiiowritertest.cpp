@@ -0,0 +1,38 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_MPIIOWriterTest_init = false;
+#include "/root/repo/src/libgeodecomp/io/test/parallel_mpi_1/mpiiowritertest.h"
+
+static MPIIOWriterTest suite_MPIIOWriterTest;
+
+static CxxTest::List Tests_MPIIOWriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MPIIOWriterTest( "/root/repo/src/libgeodecomp/io/test/parallel_mpi_1/mpiiowritertest.h", 15, "MPIIOWriterTest", suite_MPIIOWriterTest, Tests_MPIIOWriterTest );
+
+static class TestDescription_suite_MPIIOWriterTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MPIIOWriterTest_testBasic() : CxxTest::RealTestDescription( Tests_MPIIOWriterTest, suiteDescription_MPIIOWriterTest, 33, "testBasic" ) {}
+ void runTest() { suite_MPIIOWriterTest.testBasic(); }
+} testDescription_suite_MPIIOWriterTest_testBasic;
+
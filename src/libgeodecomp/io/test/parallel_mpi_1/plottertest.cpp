@@ -0,0 +1,55 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_PlotterTest_init = false;
+#include "/root/repo/src/libgeodecomp/io/test/parallel_mpi_1/plottertest.h"
+
+static PlotterTest suite_PlotterTest;
+
+static CxxTest::List Tests_PlotterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PlotterTest( "/root/repo/src/libgeodecomp/io/test/parallel_mpi_1/plottertest.h", 21, "PlotterTest", suite_PlotterTest, Tests_PlotterTest );
+
+static class TestDescription_suite_PlotterTest_testPlotGridDimensions : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PlotterTest_testPlotGridDimensions() : CxxTest::RealTestDescription( Tests_PlotterTest, suiteDescription_PlotterTest, 42, "testPlotGridDimensions" ) {}
+ void runTest() { suite_PlotterTest.testPlotGridDimensions(); }
+} testDescription_suite_PlotterTest_testPlotGridDimensions;
+
+static class TestDescription_suite_PlotterTest_testPlotGridContent : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PlotterTest_testPlotGridContent() : CxxTest::RealTestDescription( Tests_PlotterTest, suiteDescription_PlotterTest, 59, "testPlotGridContent" ) {}
+ void runTest() { suite_PlotterTest.testPlotGridContent(); }
+} testDescription_suite_PlotterTest_testPlotGridContent;
+
+static class TestDescription_suite_PlotterTest_testPlotGridInViewportUpperLeft : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PlotterTest_testPlotGridInViewportUpperLeft() : CxxTest::RealTestDescription( Tests_PlotterTest, suiteDescription_PlotterTest, 95, "testPlotGridInViewportUpperLeft" ) {}
+ void runTest() { suite_PlotterTest.testPlotGridInViewportUpperLeft(); }
+} testDescription_suite_PlotterTest_testPlotGridInViewportUpperLeft;
+
+static class TestDescription_suite_PlotterTest_testPlotGridInViewportLarge : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PlotterTest_testPlotGridInViewportLarge() : CxxTest::RealTestDescription( Tests_PlotterTest, suiteDescription_PlotterTest, 142, "testPlotGridInViewportLarge" ) {}
+ void runTest() { suite_PlotterTest.testPlotGridInViewportLarge(); }
+} testDescription_suite_PlotterTest_testPlotGridInViewportLarge;
+
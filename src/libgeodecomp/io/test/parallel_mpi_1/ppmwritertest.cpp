@@ -0,0 +1,51 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_PPMWriterTest_init = false;
+#include "/root/repo/src/libgeodecomp/io/test/parallel_mpi_1/ppmwritertest.h"
+
+static PPMWriterTest suite_PPMWriterTest;
+
+static CxxTest::List Tests_PPMWriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PPMWriterTest( "/root/repo/src/libgeodecomp/io/test/parallel_mpi_1/ppmwritertest.h", 24, "PPMWriterTest", suite_PPMWriterTest, Tests_PPMWriterTest );
+
+static class TestDescription_suite_PPMWriterTest_testWritePPM : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PPMWriterTest_testWritePPM() : CxxTest::RealTestDescription( Tests_PPMWriterTest, suiteDescription_PPMWriterTest, 47, "testWritePPM" ) {}
+ void runTest() { suite_PPMWriterTest.testWritePPM(); }
+} testDescription_suite_PPMWriterTest_testWritePPM;
+
+static class TestDescription_suite_PPMWriterTest_testWritePPMPeriod : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PPMWriterTest_testWritePPMPeriod() : CxxTest::RealTestDescription( Tests_PPMWriterTest, suiteDescription_PPMWriterTest, 88, "testWritePPMPeriod" ) {}
+ void runTest() { suite_PPMWriterTest.testWritePPMPeriod(); }
+} testDescription_suite_PPMWriterTest_testWritePPMPeriod;
+
+static class TestDescription_suite_PPMWriterTest_testFileOpenError : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PPMWriterTest_testFileOpenError() : CxxTest::RealTestDescription( Tests_PPMWriterTest, suiteDescription_PPMWriterTest, 109, "testFileOpenError" ) {}
+ void runTest() { suite_PPMWriterTest.testFileOpenError(); }
+} testDescription_suite_PPMWriterTest_testFileOpenError;
+
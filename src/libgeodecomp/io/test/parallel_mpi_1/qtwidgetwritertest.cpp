@@ -0,0 +1,43 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_QtWidgetWriterTest_init = false;
+#include "/root/repo/src/libgeodecomp/io/test/parallel_mpi_1/qtwidgetwritertest.h"
+
+static QtWidgetWriterTest suite_QtWidgetWriterTest;
+
+static CxxTest::List Tests_QtWidgetWriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_QtWidgetWriterTest( "/root/repo/src/libgeodecomp/io/test/parallel_mpi_1/qtwidgetwritertest.h", 74, "QtWidgetWriterTest", suite_QtWidgetWriterTest, Tests_QtWidgetWriterTest );
+
+static class TestDescription_suite_QtWidgetWriterTest_testWithPalette : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_QtWidgetWriterTest_testWithPalette() : CxxTest::RealTestDescription( Tests_QtWidgetWriterTest, suiteDescription_QtWidgetWriterTest, 77, "testWithPalette" ) {}
+ void runTest() { suite_QtWidgetWriterTest.testWithPalette(); }
+} testDescription_suite_QtWidgetWriterTest_testWithPalette;
+
+static class TestDescription_suite_QtWidgetWriterTest_testWithQuickPalette : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_QtWidgetWriterTest_testWithQuickPalette() : CxxTest::RealTestDescription( Tests_QtWidgetWriterTest, suiteDescription_QtWidgetWriterTest, 135, "testWithQuickPalette" ) {}
+ void runTest() { suite_QtWidgetWriterTest.testWithQuickPalette(); }
+} testDescription_suite_QtWidgetWriterTest_testWithQuickPalette;
+
@@ -0,0 +1,37 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_TestSteererTest_init = false;
+#include "/root/repo/src/libgeodecomp/io/test/parallel_mpi_1/teststeerertest.h"
+
+static TestSteererTest suite_TestSteererTest;
+
+static CxxTest::List Tests_TestSteererTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TestSteererTest( "/root/repo/src/libgeodecomp/io/test/parallel_mpi_1/teststeerertest.h", 13, "TestSteererTest", suite_TestSteererTest, Tests_TestSteererTest );
+
+static class TestDescription_suite_TestSteererTest_testCycleJump : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestSteererTest_testCycleJump() : CxxTest::RealTestDescription( Tests_TestSteererTest, suiteDescription_TestSteererTest, 34, "testCycleJump" ) {}
+ void runTest() { suite_TestSteererTest.testCycleJump(); }
+} testDescription_suite_TestSteererTest_testCycleJump;
+
@@ -0,0 +1,39 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_WriterTest_init = false;
+#include "/root/repo/src/libgeodecomp/io/test/parallel_mpi_1/writertest.h"
+
+static WriterTest suite_WriterTest;
+
+static CxxTest::List Tests_WriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_WriterTest( "/root/repo/src/libgeodecomp/io/test/parallel_mpi_1/writertest.h", 34, "WriterTest", suite_WriterTest, Tests_WriterTest );
+
+static class TestDescription_suite_WriterTest_testPeriodMustBePositive : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_WriterTest_testPeriodMustBePositive() : CxxTest::RealTestDescription( Tests_WriterTest, suiteDescription_WriterTest, 50, "testPeriodMustBePositive" ) {}
+ void runTest() { suite_WriterTest.testPeriodMustBePositive(); }
+} testDescription_suite_WriterTest_testPeriodMustBePositive;
+
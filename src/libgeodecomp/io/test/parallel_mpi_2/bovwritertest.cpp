@@ -0,0 +1,44 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_BOVWriterTest_init = false;
+#include "/root/repo/src/libgeodecomp/io/test/parallel_mpi_2/bovwritertest.h"
+
+static BOVWriterTest suite_BOVWriterTest;
+
+static CxxTest::List Tests_BOVWriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BOVWriterTest( "/root/repo/src/libgeodecomp/io/test/parallel_mpi_2/bovwritertest.h", 15, "BOVWriterTest", suite_BOVWriterTest, Tests_BOVWriterTest );
+
+static class TestDescription_suite_BOVWriterTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BOVWriterTest_testBasic() : CxxTest::RealTestDescription( Tests_BOVWriterTest, suiteDescription_BOVWriterTest, 33, "testBasic" ) {}
+ void runTest() { suite_BOVWriterTest.testBasic(); }
+} testDescription_suite_BOVWriterTest_testBasic;
+
+static class TestDescription_suite_BOVWriterTest_testTorusWithUnorderedStreaks : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BOVWriterTest_testTorusWithUnorderedStreaks() : CxxTest::RealTestDescription( Tests_BOVWriterTest, suiteDescription_BOVWriterTest, 83, "testTorusWithUnorderedStreaks" ) {}
+ void runTest() { suite_BOVWriterTest.testTorusWithUnorderedStreaks(); }
+} testDescription_suite_BOVWriterTest_testTorusWithUnorderedStreaks;
+
@@ -3,6 +3,7 @@
 #include <libgeodecomp/io/bovwriter.h>
 #include <libgeodecomp/io/testinitializer.h>
 #include <libgeodecomp/parallelization/stripingsimulator.h>
+#include <libgeodecomp/storage/displacedgrid.h>
 
 #include <cxxtest/TestSuite.h>
 #include <unistd.h>
@@ -79,6 +80,68 @@ public:
         }
     }
 
+    void testTorusWithUnorderedStreaks()
+    {
+        typedef TestCell<
+            2,
+            Stencils::Moore<2, 1>,
+            Topologies::Torus<2>::Topology> CellType;
+        typedef Topologies::Torus<2>::Topology Topology;
+
+        Coord<2> dimensions(10, 6);
+        CoordBox<2> box(Coord<2>(), dimensions);
+        DisplacedGrid<CellType, Topology, true> grid(box, CellType(), CellType(), dimensions);
+        TestInitializer<CellType>(dimensions).grid(&grid);
+
+        // Coordinates beyond the grid's bounds are wrapped around by
+        // the BOVWriter. Once normalized, rank 0's first streak (row
+        // -1, i.e. 5) lands at the end of the file and the streaks of
+        // row 1 appear in reverse order:
+        Region<2> region;
+        if (MPILayer().rank() == 0) {
+            region << Streak<2>(Coord<2>( 0, -1), 10)
+                   << Streak<2>(Coord<2>( 0,  0), 10)
+                   << Streak<2>(Coord<2>(-4,  1), -1)
+                   << Streak<2>(Coord<2>( 0,  1),  3);
+        } else {
+            region << Streak<2>(Coord<2>( 3,  1),  6)
+                   << Streak<2>(Coord<2>( 9,  1), 10)
+                   << Streak<2>(Coord<2>( 0,  2), 10)
+                   << Streak<2>(Coord<2>( 0,  3), 10)
+                   << Streak<2>(Coord<2>( 0, -2), 10);
+        }
+
+        BOVWriter<CellType> writer(
+            Selector<CellType>(&CellType::testValue, "val"),
+            "testbovwritertorus",
+            1);
+        writer.stepFinished(grid, region, dimensions, 0, WRITER_INITIALIZED, MPILayer().rank(), true);
+
+        MPILayer().barrier();
+
+        if (MPILayer().rank() == 0) {
+            std::vector<float> expected;
+            for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+                expected << grid.get(*i).testValue;
+            }
+
+            std::vector<float> actual(dimensions.prod());
+            MPIIO<CellType, Topology> mpiio;
+            MPI_File file = mpiio.openFileForRead(
+                "testbovwritertorus.00000.data", MPI_COMM_SELF);
+            MPI_Offset size;
+            MPI_File_get_size(file, &size);
+            TS_ASSERT_EQUALS(MPI_Offset(dimensions.prod() * sizeof(float)), size);
+            MPI_File_read(file, &actual[0], dimensions.prod(), MPI_FLOAT, MPI_STATUS_IGNORE);
+            MPI_File_close(&file);
+
+            TS_ASSERT_EQUALS(expected, actual);
+
+            files << "testbovwritertorus.00000.data"
+                  << "testbovwritertorus.00000.bov";
+        }
+    }
+
     Grid<float, Topologies::Cube<3>::Topology> readGrid(
         std::string filename,
         Coord<3> dimensions)
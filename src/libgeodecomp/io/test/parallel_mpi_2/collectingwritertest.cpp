@@ -0,0 +1,49 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CollectingWriterTest_init = false;
+#include "/root/repo/src/libgeodecomp/io/test/parallel_mpi_2/collectingwritertest.h"
+
+static CollectingWriterTest suite_CollectingWriterTest;
+
+static CxxTest::List Tests_CollectingWriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CollectingWriterTest( "/root/repo/src/libgeodecomp/io/test/parallel_mpi_2/collectingwritertest.h", 14, "CollectingWriterTest", suite_CollectingWriterTest, Tests_CollectingWriterTest );
+
+static class TestDescription_suite_CollectingWriterTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CollectingWriterTest_testBasic() : CxxTest::RealTestDescription( Tests_CollectingWriterTest, suiteDescription_CollectingWriterTest, 37, "testBasic" ) {}
+ void runTest() { suite_CollectingWriterTest.testBasic(); }
+} testDescription_suite_CollectingWriterTest_testBasic;
+
+static class TestDescription_suite_CollectingWriterTest_testSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CollectingWriterTest_testSoA() : CxxTest::RealTestDescription( Tests_CollectingWriterTest, suiteDescription_CollectingWriterTest, 60, "testSoA" ) {}
+ void runTest() { suite_CollectingWriterTest.testSoA(); }
+} testDescription_suite_CollectingWriterTest_testSoA;
+
+static class TestDescription_suite_CollectingWriterTest_testAsynchronous : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CollectingWriterTest_testAsynchronous() : CxxTest::RealTestDescription( Tests_CollectingWriterTest, suiteDescription_CollectingWriterTest, 94, "testAsynchronous" ) {}
+ void runTest() { suite_CollectingWriterTest.testAsynchronous(); }
+} testDescription_suite_CollectingWriterTest_testAsynchronous;
+
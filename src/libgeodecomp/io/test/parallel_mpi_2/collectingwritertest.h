@@ -91,6 +91,43 @@ public:
         }
     }
 
+    void testAsynchronous()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        TestInitializer<TestCell<3> > *init = new TestInitializer<TestCell<3> >();
+
+        LoadBalancer *balancer = MPILayer().rank()? 0 : new RandomBalancer;
+        StripingSimulator<TestCell<3> > sim(init, balancer);
+
+        MemoryWriter<TestCell<3> > *writer = 0;
+        if (MPILayer().rank() == 0) {
+            writer = new MemoryWriter<TestCell<3> >(2);
+        }
+
+        sim.addWriter(
+            new CollectingWriter<TestCell<3> >(
+                writer,
+                0,
+                MPI_COMM_WORLD,
+                SerializationBuffer<TestCell<3> >::cellMPIDataType(),
+                true));
+        sim.run();
+
+        if (MPILayer().rank() == 0) {
+            int size = writer->getGrids().size();
+            TS_ASSERT_EQUALS(TestInitializer<TestCell<3> >().maxSteps() / 2 + 2, size);
+
+            for (int i = 0; i < (size - 1); ++i) {
+                unsigned cycle = APITraits::SelectNanoSteps<TestCell<3> >::VALUE * i * 2;
+                TS_ASSERT_TEST_GRID(MemoryWriter<TestCell<3> >::GridType, writer->getGrids()[i], cycle);
+            }
+
+            unsigned cycle = APITraits::SelectNanoSteps<TestCell<3> >::VALUE * TestInitializer<TestCell<3> >().maxSteps();
+            TS_ASSERT_TEST_GRID(MemoryWriter<TestCell<3> >::GridType, writer->getGrids()[size - 1], cycle);
+        }
+#endif
+    }
+
 private:
     SharedPtr<StripingSimulator<TestCell<3> > >::Type sim;
     MemoryWriter<TestCell<3> > *writer;
@@ -0,0 +1,54 @@
+#include <libgeodecomp/geometry/partitions/recursivebisectionpartition.h>
+#include <libgeodecomp/io/metricswriter.h>
+#include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/loadbalancer/noopbalancer.h>
+#include <libgeodecomp/misc/stringops.h>
+#include <libgeodecomp/misc/testcell.h>
+#include <libgeodecomp/parallelization/hiparsimulator.h>
+
+#include <sstream>
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class MetricsWriterTest : public CxxTest::TestSuite
+{
+public:
+    void testGhostZoneMetrics()
+    {
+        HiParSimulator<TestCell<2>, RecursiveBisectionPartition<2> > simulator(
+            new TestInitializer<TestCell<2> >(Coord<2>(40, 30), 20, 0),
+            new NoOpBalancer(),
+            1000,
+            2);
+
+        std::ostringstream output;
+        simulator.addWriter(
+            new MetricsWriter<TestCell<2> >(
+                5,
+                MetricsWriter<TestCell<2> >::CSV,
+                MetricsWriter<TestCell<2> >::OUTPUT_ON_ALL_RANKS,
+                output));
+        simulator.run();
+
+        std::vector<std::string> lines = StringOps::tokenize(output.str(), "\n");
+        TS_ASSERT_EQUALS(std::size_t(5), lines.size());
+
+        for (std::size_t i = 1; i < lines.size(); ++i) {
+            std::vector<std::string> record = StringOps::tokenize(lines[i], ",");
+            TS_ASSERT_EQUALS(StringOps::itoa(MPILayer().rank()), record[0]);
+
+            // each rank updates at least half of the grid per nano step:
+            TS_ASSERT_LESS_THAN_EQUALS(600.0 * TestCell<2>::NANO_STEPS, StringOps::atof(record[4]));
+            // ghost zones are exchanged in both directions...
+            TS_ASSERT_LESS_THAN(0, StringOps::atof(record[5]));
+            TS_ASSERT_LESS_THAN(0, StringOps::atof(record[6]));
+            // ...and every receive and send is timed:
+            TS_ASSERT_LESS_THAN(0, StringOps::atoi(record[8]));
+        }
+    }
+};
+
+}
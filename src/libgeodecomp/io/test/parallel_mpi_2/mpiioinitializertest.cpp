@@ -0,0 +1,44 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_MPIIOInitializerTest_init = false;
+#include "/root/repo/src/libgeodecomp/io/test/parallel_mpi_2/mpiioinitializertest.h"
+
+static MPIIOInitializerTest suite_MPIIOInitializerTest;
+
+static CxxTest::List Tests_MPIIOInitializerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MPIIOInitializerTest( "/root/repo/src/libgeodecomp/io/test/parallel_mpi_2/mpiioinitializertest.h", 18, "MPIIOInitializerTest", suite_MPIIOInitializerTest, Tests_MPIIOInitializerTest );
+
+static class TestDescription_suite_MPIIOInitializerTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MPIIOInitializerTest_testBasic() : CxxTest::RealTestDescription( Tests_MPIIOInitializerTest, suiteDescription_MPIIOInitializerTest, 38, "testBasic" ) {}
+ void runTest() { suite_MPIIOInitializerTest.testBasic(); }
+} testDescription_suite_MPIIOInitializerTest_testBasic;
+
+static class TestDescription_suite_MPIIOInitializerTest_testRestartOnDifferentNumberOfProcesses : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MPIIOInitializerTest_testRestartOnDifferentNumberOfProcesses() : CxxTest::RealTestDescription( Tests_MPIIOInitializerTest, suiteDescription_MPIIOInitializerTest, 101, "testRestartOnDifferentNumberOfProcesses" ) {}
+ void runTest() { suite_MPIIOInitializerTest.testRestartOnDifferentNumberOfProcesses(); }
+} testDescription_suite_MPIIOInitializerTest_testRestartOnDifferentNumberOfProcesses;
+
@@ -3,6 +3,7 @@
 #include <libgeodecomp/io/parallelmpiiowriter.h>
 #include <libgeodecomp/io/testinitializer.h>
 #include <libgeodecomp/io/tracingwriter.h>
+#include <libgeodecomp/loadbalancer/noopbalancer.h>
 #include <libgeodecomp/misc/tempfile.h>
 #include <libgeodecomp/parallelization/serialsimulator.h>
 #include <libgeodecomp/parallelization/stripingsimulator.h>
@@ -96,6 +97,66 @@ public:
             TS_ASSERT_EQUALS(expected, actual);
         }
     }
+
+    void testRestartOnDifferentNumberOfProcesses()
+    {
+        MPIIO<TestCell<3> > mpiio;
+        files << "testmpiioinitializer3_00000.mpiio"
+              << "testmpiioinitializer3_00005.mpiio"
+              << "testmpiioinitializer3_00010.mpiio"
+              << "testmpiioinitializer3_00015.mpiio"
+              << "testmpiioinitializer3_00020.mpiio"
+              << "testmpiioinitializer3_00021.mpiio";
+        files << "testmpiioinitializer4_00010.mpiio"
+              << "testmpiioinitializer4_00015.mpiio"
+              << "testmpiioinitializer4_00020.mpiio"
+              << "testmpiioinitializer4_00021.mpiio";
+
+        // both processes write collectively to the same files...
+        TestInitializer<TestCell<3> > *init = new TestInitializer<TestCell<3> >();
+        Coord<3> dimensions = init->gridDimensions();
+        StripingSimulator<TestCell<3> > sim(init, MPILayer().rank()? 0 : new NoOpBalancer);
+        sim.addWriter(
+            new ParallelMPIIOWriter<TestCell<3> >(
+                "testmpiioinitializer3_",
+                5,
+                init->maxSteps()));
+        sim.run();
+        MPILayer().barrier();
+
+        // ...and a single process restarts from one of the snapshots:
+        if (rank == 0) {
+            MPIIOInitializer<TestCell<3> > *restartInit = new MPIIOInitializer<TestCell<3> >(
+                "testmpiioinitializer3_",
+                10,
+                Typemaps::lookup<TestCell<3> >(),
+                MPI_COMM_SELF);
+            TS_ASSERT_EQUALS(unsigned(10), restartInit->startStep());
+            TS_ASSERT_EQUALS(dimensions, restartInit->gridDimensions());
+
+            SerialSimulator<TestCell<3> > restartSim(restartInit);
+            restartSim.addWriter(
+                new MPIIOWriter<TestCell<3> >(
+                    "testmpiioinitializer4_",
+                    5,
+                    restartInit->maxSteps(),
+                    MPI_COMM_SELF));
+            restartSim.run();
+
+            typedef APITraits::SelectTopology<TestCell<3> >::Value Topology;
+            Grid<TestCell<3>, Topology> expected(dimensions);
+            Grid<TestCell<3>, Topology> actual(dimensions);
+
+            Region<3> region;
+            region << CoordBox<3>(Coord<3>(), dimensions);
+            mpiio.readRegion(&expected, "testmpiioinitializer3_00021.mpiio", region, MPI_COMM_SELF);
+            mpiio.readRegion(&actual,   "testmpiioinitializer4_00021.mpiio", region, MPI_COMM_SELF);
+
+            TS_ASSERT_EQUALS(expected, actual);
+        }
+
+        MPILayer().barrier();
+    }
 };
 
 }
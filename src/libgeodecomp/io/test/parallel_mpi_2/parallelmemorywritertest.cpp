@@ -0,0 +1,38 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ParallelMemoryWriterTest_init = false;
+#include "/root/repo/src/libgeodecomp/io/test/parallel_mpi_2/parallelmemorywritertest.h"
+
+static ParallelMemoryWriterTest suite_ParallelMemoryWriterTest;
+
+static CxxTest::List Tests_ParallelMemoryWriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ParallelMemoryWriterTest( "/root/repo/src/libgeodecomp/io/test/parallel_mpi_2/parallelmemorywritertest.h", 40, "ParallelMemoryWriterTest", suite_ParallelMemoryWriterTest, Tests_ParallelMemoryWriterTest );
+
+static class TestDescription_suite_ParallelMemoryWriterTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelMemoryWriterTest_testBasic() : CxxTest::RealTestDescription( Tests_ParallelMemoryWriterTest, suiteDescription_ParallelMemoryWriterTest, 60, "testBasic" ) {}
+ void runTest() { suite_ParallelMemoryWriterTest.testBasic(); }
+} testDescription_suite_ParallelMemoryWriterTest_testBasic;
+
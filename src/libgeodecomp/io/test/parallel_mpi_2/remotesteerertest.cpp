@@ -0,0 +1,75 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_RemoteSteererTest_init = false;
+#include "/root/repo/src/libgeodecomp/io/test/parallel_mpi_2/remotesteerertest.h"
+
+static RemoteSteererTest suite_RemoteSteererTest;
+
+static CxxTest::List Tests_RemoteSteererTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RemoteSteererTest( "/root/repo/src/libgeodecomp/io/test/parallel_mpi_2/remotesteerertest.h", 24, "RemoteSteererTest", suite_RemoteSteererTest, Tests_RemoteSteererTest );
+
+static class TestDescription_suite_RemoteSteererTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RemoteSteererTest_testBasic() : CxxTest::RealTestDescription( Tests_RemoteSteererTest, suiteDescription_RemoteSteererTest, 127, "testBasic" ) {}
+ void runTest() { suite_RemoteSteererTest.testBasic(); }
+} testDescription_suite_RemoteSteererTest_testBasic;
+
+static class TestDescription_suite_RemoteSteererTest_testNonExistentAction : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RemoteSteererTest_testNonExistentAction() : CxxTest::RealTestDescription( Tests_RemoteSteererTest, suiteDescription_RemoteSteererTest, 160, "testNonExistentAction" ) {}
+ void runTest() { suite_RemoteSteererTest.testNonExistentAction(); }
+} testDescription_suite_RemoteSteererTest_testNonExistentAction;
+
+static class TestDescription_suite_RemoteSteererTest_testInvalidHandler : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RemoteSteererTest_testInvalidHandler() : CxxTest::RealTestDescription( Tests_RemoteSteererTest, suiteDescription_RemoteSteererTest, 175, "testInvalidHandler" ) {}
+ void runTest() { suite_RemoteSteererTest.testInvalidHandler(); }
+} testDescription_suite_RemoteSteererTest_testInvalidHandler;
+
+static class TestDescription_suite_RemoteSteererTest_testHandlerNotFound1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RemoteSteererTest_testHandlerNotFound1() : CxxTest::RealTestDescription( Tests_RemoteSteererTest, suiteDescription_RemoteSteererTest, 206, "testHandlerNotFound1" ) {}
+ void runTest() { suite_RemoteSteererTest.testHandlerNotFound1(); }
+} testDescription_suite_RemoteSteererTest_testHandlerNotFound1;
+
+static class TestDescription_suite_RemoteSteererTest_testHandlerNotFound2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RemoteSteererTest_testHandlerNotFound2() : CxxTest::RealTestDescription( Tests_RemoteSteererTest, suiteDescription_RemoteSteererTest, 239, "testHandlerNotFound2" ) {}
+ void runTest() { suite_RemoteSteererTest.testHandlerNotFound2(); }
+} testDescription_suite_RemoteSteererTest_testHandlerNotFound2;
+
+static class TestDescription_suite_RemoteSteererTest_testHandlerNotFound3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RemoteSteererTest_testHandlerNotFound3() : CxxTest::RealTestDescription( Tests_RemoteSteererTest, suiteDescription_RemoteSteererTest, 272, "testHandlerNotFound3" ) {}
+ void runTest() { suite_RemoteSteererTest.testHandlerNotFound3(); }
+} testDescription_suite_RemoteSteererTest_testHandlerNotFound3;
+
+static class TestDescription_suite_RemoteSteererTest_testGetSet : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RemoteSteererTest_testGetSet() : CxxTest::RealTestDescription( Tests_RemoteSteererTest, suiteDescription_RemoteSteererTest, 304, "testGetSet" ) {}
+ void runTest() { suite_RemoteSteererTest.testGetSet(); }
+} testDescription_suite_RemoteSteererTest_testGetSet;
+
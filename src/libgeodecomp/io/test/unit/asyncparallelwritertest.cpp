@@ -0,0 +1,51 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_AsyncParallelWriterTest_init = false;
+#include "/root/repo/src/libgeodecomp/io/test/unit/asyncparallelwritertest.h"
+
+static AsyncParallelWriterTest suite_AsyncParallelWriterTest;
+
+static CxxTest::List Tests_AsyncParallelWriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_AsyncParallelWriterTest( "/root/repo/src/libgeodecomp/io/test/unit/asyncparallelwritertest.h", 87, "AsyncParallelWriterTest", suite_AsyncParallelWriterTest, Tests_AsyncParallelWriterTest );
+
+static class TestDescription_suite_AsyncParallelWriterTest_testReplaysCallsPerStep : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AsyncParallelWriterTest_testReplaysCallsPerStep() : CxxTest::RealTestDescription( Tests_AsyncParallelWriterTest, suiteDescription_AsyncParallelWriterTest, 111, "testReplaysCallsPerStep" ) {}
+ void runTest() { suite_AsyncParallelWriterTest.testReplaysCallsPerStep(); }
+} testDescription_suite_AsyncParallelWriterTest_testReplaysCallsPerStep;
+
+static class TestDescription_suite_AsyncParallelWriterTest_testSkipFrame : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AsyncParallelWriterTest_testSkipFrame() : CxxTest::RealTestDescription( Tests_AsyncParallelWriterTest, suiteDescription_AsyncParallelWriterTest, 156, "testSkipFrame" ) {}
+ void runTest() { suite_AsyncParallelWriterTest.testSkipFrame(); }
+} testDescription_suite_AsyncParallelWriterTest_testSkipFrame;
+
+static class TestDescription_suite_AsyncParallelWriterTest_testRequiresRegion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AsyncParallelWriterTest_testRequiresRegion() : CxxTest::RealTestDescription( Tests_AsyncParallelWriterTest, suiteDescription_AsyncParallelWriterTest, 179, "testRequiresRegion" ) {}
+ void runTest() { suite_AsyncParallelWriterTest.testRequiresRegion(); }
+} testDescription_suite_AsyncParallelWriterTest_testRequiresRegion;
+
@@ -0,0 +1,199 @@
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/io/asyncparallelwriter.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+#include <libgeodecomp/misc/testcell.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+#ifdef LIBGEODECOMP_WITH_CPP14
+
+/**
+ * Records what the writer below receives and lets tests stall it.
+ */
+class AsyncParallelWriterTestLog
+{
+public:
+    AsyncParallelWriterTestLog() :
+        open(true)
+    {}
+
+    void setOpen(bool newOpen)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            open = newOpen;
+        }
+        condition.notify_all();
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool open;
+    std::vector<unsigned> steps;
+    std::vector<bool> lastCalls;
+    std::vector<Region<2> > regions;
+    std::vector<Region<2> > validRegions;
+    std::vector<double> values;
+};
+
+/**
+ * Waits until the log is open and then records its parameters and
+ * the sum of the testValues within the validRegion.
+ */
+class AsyncParallelWriterTestWriter :
+        public Clonable<ParallelWriter<TestCell<2> >, AsyncParallelWriterTestWriter>
+{
+public:
+    explicit AsyncParallelWriterTestWriter(SharedPtr<AsyncParallelWriterTestLog>::Type log) :
+        Clonable<ParallelWriter<TestCell<2> >, AsyncParallelWriterTestWriter>("bar", 2),
+        log(log)
+    {}
+
+    void stepFinished(
+        const GridType& grid,
+        const RegionType& validRegion,
+        const CoordType& globalDimensions,
+        unsigned step,
+        WriterEvent event,
+        std::size_t rank,
+        bool lastCall)
+    {
+        std::unique_lock<std::mutex> lock(log->mutex);
+        log->condition.wait(lock, [this]{ return log->open; });
+
+        double sum = 0;
+        for (Region<2>::Iterator i = validRegion.begin(); i != validRegion.end(); ++i) {
+            sum += grid.get(*i).testValue;
+        }
+
+        log->steps << step;
+        log->lastCalls << lastCall;
+        log->regions << region;
+        log->validRegions << validRegion;
+        log->values << sum;
+    }
+
+private:
+    SharedPtr<AsyncParallelWriterTestLog>::Type log;
+};
+
+#endif
+
+class AsyncParallelWriterTest : public CxxTest::TestSuite
+{
+public:
+#ifdef LIBGEODECOMP_WITH_CPP14
+    typedef DisplacedGrid<TestCell<2> > GridType;
+
+    void setUp()
+    {
+        log.reset(new AsyncParallelWriterTestLog);
+
+        region.clear();
+        region << Streak<2>(Coord<2>(10, 20), 30)
+               << Streak<2>(Coord<2>(15, 21), 25);
+        ghost.clear();
+        ghost << Streak<2>(Coord<2>(10, 20), 12);
+        inner = region - ghost;
+
+        grid = GridType(region.boundingBox());
+        for (Region<2>::Iterator i = region.begin(); i != region.end(); ++i) {
+            grid[*i].testValue = 1;
+        }
+    }
+#endif
+
+    void testReplaysCallsPerStep()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        AsyncParallelWriter<TestCell<2> > writer(new AsyncParallelWriterTestWriter(log));
+        TS_ASSERT_EQUALS("bar", writer.getPrefix());
+        TS_ASSERT_EQUALS(unsigned(2), writer.getPeriod());
+
+        writer.setRegion(region);
+        log->setOpen(false);
+
+        writer.stepFinished(grid, ghost, Coord<2>(100, 100), 2, WRITER_STEP_FINISHED, 0, false);
+        // cells outside of validRegion mustn't be read
+        // (the ghost has been written above, the inner set hasn't):
+        for (Region<2>::Iterator i = ghost.begin(); i != ghost.end(); ++i) {
+            grid[*i].testValue = 1000;
+        }
+        writer.stepFinished(grid, inner, Coord<2>(100, 100), 2, WRITER_STEP_FINISHED, 0, true);
+        for (Region<2>::Iterator i = inner.begin(); i != inner.end(); ++i) {
+            grid[*i].testValue = 1000;
+        }
+
+        log->setOpen(true);
+        writer.stepFinished(grid, region, Coord<2>(100, 100), 4, WRITER_ALL_DONE, 0, true);
+
+        std::vector<unsigned> expectedSteps;
+        expectedSteps << 2 << 2 << 4;
+        TS_ASSERT_EQUALS(expectedSteps, log->steps);
+
+        std::vector<bool> expectedLastCalls;
+        expectedLastCalls << false << true << true;
+        TS_ASSERT_EQUALS(expectedLastCalls, log->lastCalls);
+
+        std::vector<Region<2> > expectedValidRegions;
+        expectedValidRegions << ghost << inner << region;
+        TS_ASSERT_EQUALS(expectedValidRegions, log->validRegions);
+
+        std::vector<double> expectedValues;
+        expectedValues << ghost.size() << inner.size() << 1000.0 * region.size();
+        TS_ASSERT_EQUALS(expectedValues, log->values);
+
+        // setRegion() is forwarded to the delegate:
+        TS_ASSERT_EQUALS(region, log->regions.front());
+#endif
+    }
+
+    void testSkipFrame()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        AsyncParallelWriter<TestCell<2> > writer(new AsyncParallelWriterTestWriter(log), 1, ASYNC_OUTPUT_SKIP_FRAME);
+        writer.setRegion(region);
+        log->setOpen(false);
+
+        writer.stepFinished(grid, region, Coord<2>(100, 100), 2, WRITER_STEP_FINISHED, 0, true);
+        // all calls of a skipped step are dropped:
+        writer.stepFinished(grid, ghost,  Coord<2>(100, 100), 4, WRITER_STEP_FINISHED, 0, false);
+        writer.stepFinished(grid, inner,  Coord<2>(100, 100), 4, WRITER_STEP_FINISHED, 0, true);
+        TS_ASSERT_EQUALS(std::size_t(1), writer.skippedFrames());
+
+        log->setOpen(true);
+        writer.stepFinished(grid, ghost,  Coord<2>(100, 100), 6, WRITER_ALL_DONE, 0, false);
+        writer.stepFinished(grid, inner,  Coord<2>(100, 100), 6, WRITER_ALL_DONE, 0, true);
+
+        std::vector<unsigned> expectedSteps;
+        expectedSteps << 2 << 6 << 6;
+        TS_ASSERT_EQUALS(expectedSteps, log->steps);
+#endif
+    }
+
+    void testRequiresRegion()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        AsyncParallelWriter<TestCell<2> > writer(new AsyncParallelWriterTestWriter(log));
+        TS_ASSERT_THROWS(
+            writer.stepFinished(grid, region, Coord<2>(100, 100), 2, WRITER_STEP_FINISHED, 0, true),
+            std::logic_error&);
+#endif
+    }
+
+private:
+#ifdef LIBGEODECOMP_WITH_CPP14
+    SharedPtr<AsyncParallelWriterTestLog>::Type log;
+    Region<2> region;
+    Region<2> ghost;
+    Region<2> inner;
+    GridType grid;
+#endif
+};
+
+}
@@ -0,0 +1,63 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_AsyncWriterTest_init = false;
+#include "/root/repo/src/libgeodecomp/io/test/unit/asyncwritertest.h"
+
+static AsyncWriterTest suite_AsyncWriterTest;
+
+static CxxTest::List Tests_AsyncWriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_AsyncWriterTest( "/root/repo/src/libgeodecomp/io/test/unit/asyncwritertest.h", 74, "AsyncWriterTest", suite_AsyncWriterTest, Tests_AsyncWriterTest );
+
+static class TestDescription_suite_AsyncWriterTest_testForwardsAllEvents : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AsyncWriterTest_testForwardsAllEvents() : CxxTest::RealTestDescription( Tests_AsyncWriterTest, suiteDescription_AsyncWriterTest, 87, "testForwardsAllEvents" ) {}
+ void runTest() { suite_AsyncWriterTest.testForwardsAllEvents(); }
+} testDescription_suite_AsyncWriterTest_testForwardsAllEvents;
+
+static class TestDescription_suite_AsyncWriterTest_testSnapshotsGrid : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AsyncWriterTest_testSnapshotsGrid() : CxxTest::RealTestDescription( Tests_AsyncWriterTest, suiteDescription_AsyncWriterTest, 112, "testSnapshotsGrid" ) {}
+ void runTest() { suite_AsyncWriterTest.testSnapshotsGrid(); }
+} testDescription_suite_AsyncWriterTest_testSnapshotsGrid;
+
+static class TestDescription_suite_AsyncWriterTest_testSkipFrame : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AsyncWriterTest_testSkipFrame() : CxxTest::RealTestDescription( Tests_AsyncWriterTest, suiteDescription_AsyncWriterTest, 133, "testSkipFrame" ) {}
+ void runTest() { suite_AsyncWriterTest.testSkipFrame(); }
+} testDescription_suite_AsyncWriterTest_testSkipFrame;
+
+static class TestDescription_suite_AsyncWriterTest_testErrorsArePropagated : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AsyncWriterTest_testErrorsArePropagated() : CxxTest::RealTestDescription( Tests_AsyncWriterTest, suiteDescription_AsyncWriterTest, 156, "testErrorsArePropagated" ) {}
+ void runTest() { suite_AsyncWriterTest.testErrorsArePropagated(); }
+} testDescription_suite_AsyncWriterTest_testErrorsArePropagated;
+
+static class TestDescription_suite_AsyncWriterTest_testClone : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AsyncWriterTest_testClone() : CxxTest::RealTestDescription( Tests_AsyncWriterTest, suiteDescription_AsyncWriterTest, 165, "testClone" ) {}
+ void runTest() { suite_AsyncWriterTest.testClone(); }
+} testDescription_suite_AsyncWriterTest_testClone;
+
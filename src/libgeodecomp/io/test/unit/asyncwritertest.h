@@ -0,0 +1,187 @@
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/io/asyncwriter.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+#include <libgeodecomp/misc/testcell.h>
+#include <libgeodecomp/storage/grid.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+#ifdef LIBGEODECOMP_WITH_CPP14
+
+/**
+ * Records what the writer below receives and lets tests stall it.
+ */
+class AsyncWriterTestLog
+{
+public:
+    AsyncWriterTestLog() :
+        open(true)
+    {}
+
+    void setOpen(bool newOpen)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            open = newOpen;
+        }
+        condition.notify_all();
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool open;
+    std::vector<unsigned> steps;
+    std::vector<WriterEvent> events;
+    std::vector<double> values;
+};
+
+/**
+ * Waits until the log is open and then records the step and the
+ * testValue of cell (1, 2). Throws on step 666.
+ */
+class AsyncWriterTestWriter : public Clonable<Writer<TestCell<2> >, AsyncWriterTestWriter>
+{
+public:
+    explicit AsyncWriterTestWriter(SharedPtr<AsyncWriterTestLog>::Type log) :
+        Clonable<Writer<TestCell<2> >, AsyncWriterTestWriter>("foo", 3),
+        log(log)
+    {}
+
+    void stepFinished(const GridType& grid, unsigned step, WriterEvent event)
+    {
+        std::unique_lock<std::mutex> lock(log->mutex);
+        log->condition.wait(lock, [this]{ return log->open; });
+
+        if (step == 666) {
+            throw std::runtime_error("disk full");
+        }
+
+        log->steps << step;
+        log->events << event;
+        log->values << grid.get(Coord<2>(1, 2)).testValue;
+    }
+
+private:
+    SharedPtr<AsyncWriterTestLog>::Type log;
+};
+
+#endif
+
+class AsyncWriterTest : public CxxTest::TestSuite
+{
+public:
+#ifdef LIBGEODECOMP_WITH_CPP14
+    typedef Grid<TestCell<2> > GridType;
+
+    void setUp()
+    {
+        log.reset(new AsyncWriterTestLog);
+        grid = GridType(Coord<2>(10, 5));
+    }
+#endif
+
+    void testForwardsAllEvents()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        AsyncWriter<TestCell<2> > writer(new AsyncWriterTestWriter(log), 1);
+        TS_ASSERT_EQUALS("foo", writer.getPrefix());
+        TS_ASSERT_EQUALS(unsigned(3), writer.getPeriod());
+
+        writer.stepFinished(grid, 0, WRITER_INITIALIZED);
+        for (unsigned i = 1; i < 10; ++i) {
+            writer.stepFinished(grid, i, WRITER_STEP_FINISHED);
+        }
+        writer.stepFinished(grid, 10, WRITER_ALL_DONE);
+
+        // WRITER_ALL_DONE waits for all output to complete:
+        std::vector<unsigned> expectedSteps;
+        for (unsigned i = 0; i <= 10; ++i) {
+            expectedSteps << i;
+        }
+        TS_ASSERT_EQUALS(expectedSteps, log->steps);
+        TS_ASSERT_EQUALS(WRITER_INITIALIZED, log->events.front());
+        TS_ASSERT_EQUALS(WRITER_ALL_DONE,    log->events.back());
+        TS_ASSERT_EQUALS(std::size_t(0), writer.skippedFrames());
+#endif
+    }
+
+    void testSnapshotsGrid()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        AsyncWriter<TestCell<2> > writer(new AsyncWriterTestWriter(log), 2);
+        log->setOpen(false);
+
+        grid[Coord<2>(1, 2)].testValue = 1;
+        writer.stepFinished(grid, 1, WRITER_STEP_FINISHED);
+        grid[Coord<2>(1, 2)].testValue = 2;
+        writer.stepFinished(grid, 2, WRITER_STEP_FINISHED);
+        grid[Coord<2>(1, 2)].testValue = 3;
+
+        log->setOpen(true);
+        writer.stepFinished(grid, 3, WRITER_ALL_DONE);
+
+        std::vector<double> expectedValues;
+        expectedValues << 1 << 2 << 3;
+        TS_ASSERT_EQUALS(expectedValues, log->values);
+#endif
+    }
+
+    void testSkipFrame()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        AsyncWriter<TestCell<2> > writer(new AsyncWriterTestWriter(log), 1, ASYNC_OUTPUT_SKIP_FRAME);
+        log->setOpen(false);
+
+        // the only frame is stuck in the I/O thread, so these get
+        // dropped:
+        writer.stepFinished(grid, 1, WRITER_STEP_FINISHED);
+        writer.stepFinished(grid, 2, WRITER_STEP_FINISHED);
+        writer.stepFinished(grid, 3, WRITER_STEP_FINISHED);
+        TS_ASSERT_EQUALS(std::size_t(2), writer.skippedFrames());
+
+        // ...but WRITER_ALL_DONE must not be skipped:
+        log->setOpen(true);
+        writer.stepFinished(grid, 4, WRITER_ALL_DONE);
+
+        std::vector<unsigned> expectedSteps;
+        expectedSteps << 1 << 4;
+        TS_ASSERT_EQUALS(expectedSteps, log->steps);
+#endif
+    }
+
+    void testErrorsArePropagated()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        AsyncWriter<TestCell<2> > writer(new AsyncWriterTestWriter(log));
+        writer.stepFinished(grid, 666, WRITER_STEP_FINISHED);
+        TS_ASSERT_THROWS(writer.stepFinished(grid, 667, WRITER_ALL_DONE), std::runtime_error&);
+#endif
+    }
+
+    void testClone()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        AsyncWriter<TestCell<2> > writer(new AsyncWriterTestWriter(log));
+        SharedPtr<Writer<TestCell<2> > >::Type clone(writer.clone());
+
+        clone->stepFinished(grid, 5, WRITER_ALL_DONE);
+        writer.stepFinished(grid, 6, WRITER_ALL_DONE);
+
+        std::vector<unsigned> expectedSteps;
+        expectedSteps << 5 << 6;
+        TS_ASSERT_EQUALS(expectedSteps, log->steps);
+#endif
+    }
+
+private:
+#ifdef LIBGEODECOMP_WITH_CPP14
+    SharedPtr<AsyncWriterTestLog>::Type log;
+    GridType grid;
+#endif
+};
+
+}
@@ -0,0 +1,28 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}asyncparallelwritertest.cpp
+  ${RELATIVE_PATH}asyncwritertest.cpp
+  ${RELATIVE_PATH}bovoutputtest.cpp
+  ${RELATIVE_PATH}clonableinitializerwrappertest.cpp
+  ${RELATIVE_PATH}initializertest.cpp
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+  ${RELATIVE_PATH}serialbovwritertest.cpp
+  ${RELATIVE_PATH}silowritertest.cpp
+  ${RELATIVE_PATH}steerertest.cpp
+  ${RELATIVE_PATH}timestringconversiontest.cpp
+  ${RELATIVE_PATH}unstructuredtestinitializertest.cpp
+  ${RELATIVE_PATH}visitwritertest.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}asyncparallelwritertest.h
+  ${RELATIVE_PATH}asyncwritertest.h
+  ${RELATIVE_PATH}bovoutputtest.h
+  ${RELATIVE_PATH}clonableinitializerwrappertest.h
+  ${RELATIVE_PATH}initializertest.h
+  ${RELATIVE_PATH}serialbovwritertest.h
+  ${RELATIVE_PATH}silowritertest.h
+  ${RELATIVE_PATH}steerertest.h
+  ${RELATIVE_PATH}timestringconversiontest.h
+  ${RELATIVE_PATH}unstructuredtestinitializertest.h
+  ${RELATIVE_PATH}visitwritertest.h
+)
@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_BOVOutputTest_init = false;
+#include "/root/repo/src/libgeodecomp/io/test/unit/bovoutputtest.h"
+
+static BOVOutputTest suite_BOVOutputTest;
+
+static CxxTest::List Tests_BOVOutputTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BOVOutputTest( "/root/repo/src/libgeodecomp/io/test/unit/bovoutputtest.h", 17, "BOVOutputTest", suite_BOVOutputTest, Tests_BOVOutputTest );
+
+static class TestDescription_suite_BOVOutputTest_testWriteGridInOneSlab : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BOVOutputTest_testWriteGridInOneSlab() : CxxTest::RealTestDescription( Tests_BOVOutputTest, suiteDescription_BOVOutputTest, 35, "testWriteGridInOneSlab" ) {}
+ void runTest() { suite_BOVOutputTest.testWriteGridInOneSlab(); }
+} testDescription_suite_BOVOutputTest_testWriteGridInOneSlab;
+
+static class TestDescription_suite_BOVOutputTest_testWriteGridInMultipleSlabs : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BOVOutputTest_testWriteGridInMultipleSlabs() : CxxTest::RealTestDescription( Tests_BOVOutputTest, suiteDescription_BOVOutputTest, 41, "testWriteGridInMultipleSlabs" ) {}
+ void runTest() { suite_BOVOutputTest.testWriteGridInMultipleSlabs(); }
+} testDescription_suite_BOVOutputTest_testWriteGridInMultipleSlabs;
+
+static class TestDescription_suite_BOVOutputTest_testWriteGridWithBlocksSmallerThanPlanes : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BOVOutputTest_testWriteGridWithBlocksSmallerThanPlanes() : CxxTest::RealTestDescription( Tests_BOVOutputTest, suiteDescription_BOVOutputTest, 50, "testWriteGridWithBlocksSmallerThanPlanes" ) {}
+ void runTest() { suite_BOVOutputTest.testWriteGridWithBlocksSmallerThanPlanes(); }
+} testDescription_suite_BOVOutputTest_testWriteGridWithBlocksSmallerThanPlanes;
+
@@ -0,0 +1,86 @@
+#include <libgeodecomp/io/bovoutput.h>
+#include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/misc/tempfile.h>
+#include <libgeodecomp/storage/grid.h>
+
+#include <cxxtest/TestSuite.h>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <unistd.h>
+#include <vector>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class BOVOutputTest : public CxxTest::TestSuite
+{
+public:
+    typedef Grid<TestCell<3>, Topologies::Cube<3>::Topology> GridType;
+
+    void setUp()
+    {
+        dimensions = Coord<3>(5, 4, 7);
+        grid = GridType(dimensions);
+        TestInitializer<TestCell<3> >(dimensions).grid(&grid);
+        filename = TempFile::serial("bovoutput");
+    }
+
+    void tearDown()
+    {
+        unlink(filename.c_str());
+    }
+
+    void testWriteGridInOneSlab()
+    {
+        BOVOutput<TestCell<3>, 3>::writeGrid(filename, grid, selector());
+        checkFile();
+    }
+
+    void testWriteGridInMultipleSlabs()
+    {
+        // 3 planes per slab, so the last of the 3 slabs is only 1
+        // plane thick:
+        std::size_t planeByteSize = dimensions.x() * dimensions.y() * sizeof(float);
+        BOVOutput<TestCell<3>, 3>::writeGrid(filename, grid, selector(), 3 * planeByteSize + 7);
+        checkFile();
+    }
+
+    void testWriteGridWithBlocksSmallerThanPlanes()
+    {
+        // slabs need to hold at least one plane:
+        BOVOutput<TestCell<3>, 3>::writeGrid(filename, grid, selector(), 1);
+        checkFile();
+    }
+
+private:
+    Coord<3> dimensions;
+    GridType grid;
+    std::string filename;
+
+    Selector<TestCell<3> > selector() const
+    {
+        return Selector<TestCell<3> >(&TestCell<3>::testValue, "val");
+    }
+
+    void checkFile()
+    {
+        std::vector<float> expected;
+        CoordBox<3> box(Coord<3>(), dimensions);
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            expected.push_back(grid[*i].testValue);
+        }
+
+        std::ifstream file(filename.c_str(), std::ios::binary);
+        TS_ASSERT(file);
+        std::vector<char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        TS_ASSERT_EQUALS(expected.size() * sizeof(float), bytes.size());
+
+        std::vector<float> actual(bytes.size() / sizeof(float));
+        std::copy(bytes.begin(), bytes.begin() + actual.size() * sizeof(float), reinterpret_cast<char*>(&actual[0]));
+        TS_ASSERT_EQUALS(expected, actual);
+    }
+};
+
+}
@@ -0,0 +1,38 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_InitializerTest_init = false;
+#include "/root/repo/src/libgeodecomp/io/test/unit/initializertest.h"
+
+static InitializerTest suite_InitializerTest;
+
+static CxxTest::List Tests_InitializerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_InitializerTest( "/root/repo/src/libgeodecomp/io/test/unit/initializertest.h", 27, "InitializerTest", suite_InitializerTest, Tests_InitializerTest );
+
+static class TestDescription_suite_InitializerTest_testSeedRNG : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_InitializerTest_testSeedRNG() : CxxTest::RealTestDescription( Tests_InitializerTest, suiteDescription_InitializerTest, 33, "testSeedRNG" ) {}
+ void runTest() { suite_InitializerTest.testSeedRNG(); }
+} testDescription_suite_InitializerTest_testSeedRNG;
+
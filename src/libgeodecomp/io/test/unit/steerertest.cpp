@@ -0,0 +1,38 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_SteererTest_init = false;
+#include "/root/repo/src/libgeodecomp/io/test/unit/steerertest.h"
+
+static SteererTest suite_SteererTest;
+
+static CxxTest::List Tests_SteererTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SteererTest( "/root/repo/src/libgeodecomp/io/test/unit/steerertest.h", 67, "SteererTest", suite_SteererTest, Tests_SteererTest );
+
+static class TestDescription_suite_SteererTest_testStaticDataModification : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SteererTest_testStaticDataModification() : CxxTest::RealTestDescription( Tests_SteererTest, suiteDescription_SteererTest, 87, "testStaticDataModification" ) {}
+ void runTest() { suite_SteererTest.testStaticDataModification(); }
+} testDescription_suite_SteererTest_testStaticDataModification;
+
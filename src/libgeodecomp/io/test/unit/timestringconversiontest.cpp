@@ -0,0 +1,43 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_TimeStringConversionTest_init = false;
+#include "/root/repo/src/libgeodecomp/io/test/unit/timestringconversiontest.h"
+
+static TimeStringConversionTest suite_TimeStringConversionTest;
+
+static CxxTest::List Tests_TimeStringConversionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TimeStringConversionTest( "/root/repo/src/libgeodecomp/io/test/unit/timestringconversiontest.h", 8, "TimeStringConversionTest", suite_TimeStringConversionTest, Tests_TimeStringConversionTest );
+
+static class TestDescription_suite_TimeStringConversionTest_testRenderISO : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimeStringConversionTest_testRenderISO() : CxxTest::RealTestDescription( Tests_TimeStringConversionTest, suiteDescription_TimeStringConversionTest, 11, "testRenderISO" ) {}
+ void runTest() { suite_TimeStringConversionTest.testRenderISO(); }
+} testDescription_suite_TimeStringConversionTest_testRenderISO;
+
+static class TestDescription_suite_TimeStringConversionTest_testRenderDuration : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimeStringConversionTest_testRenderDuration() : CxxTest::RealTestDescription( Tests_TimeStringConversionTest, suiteDescription_TimeStringConversionTest, 18, "testRenderDuration" ) {}
+ void runTest() { suite_TimeStringConversionTest.testRenderDuration(); }
+} testDescription_suite_TimeStringConversionTest_testRenderDuration;
+
@@ -0,0 +1,63 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_LoadBalancerTest_init = false;
+#include "/root/repo/src/libgeodecomp/loadbalancer/test/unit/loadbalancertest.h"
+
+static LoadBalancerTest suite_LoadBalancerTest;
+
+static CxxTest::List Tests_LoadBalancerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_LoadBalancerTest( "/root/repo/src/libgeodecomp/loadbalancer/test/unit/loadbalancertest.h", 21, "LoadBalancerTest", suite_LoadBalancerTest, Tests_LoadBalancerTest );
+
+static class TestDescription_suite_LoadBalancerTest_testInitialWeights1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_LoadBalancerTest_testInitialWeights1() : CxxTest::RealTestDescription( Tests_LoadBalancerTest, suiteDescription_LoadBalancerTest, 24, "testInitialWeights1" ) {}
+ void runTest() { suite_LoadBalancerTest.testInitialWeights1(); }
+} testDescription_suite_LoadBalancerTest_testInitialWeights1;
+
+static class TestDescription_suite_LoadBalancerTest_testInitialWeights2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_LoadBalancerTest_testInitialWeights2() : CxxTest::RealTestDescription( Tests_LoadBalancerTest, suiteDescription_LoadBalancerTest, 44, "testInitialWeights2" ) {}
+ void runTest() { suite_LoadBalancerTest.testInitialWeights2(); }
+} testDescription_suite_LoadBalancerTest_testInitialWeights2;
+
+static class TestDescription_suite_LoadBalancerTest_testInitialWeights3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_LoadBalancerTest_testInitialWeights3() : CxxTest::RealTestDescription( Tests_LoadBalancerTest, suiteDescription_LoadBalancerTest, 63, "testInitialWeights3" ) {}
+ void runTest() { suite_LoadBalancerTest.testInitialWeights3(); }
+} testDescription_suite_LoadBalancerTest_testInitialWeights3;
+
+static class TestDescription_suite_LoadBalancerTest_testInitialWeights4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_LoadBalancerTest_testInitialWeights4() : CxxTest::RealTestDescription( Tests_LoadBalancerTest, suiteDescription_LoadBalancerTest, 82, "testInitialWeights4" ) {}
+ void runTest() { suite_LoadBalancerTest.testInitialWeights4(); }
+} testDescription_suite_LoadBalancerTest_testInitialWeights4;
+
+static class TestDescription_suite_LoadBalancerTest_testInitialWeights5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_LoadBalancerTest_testInitialWeights5() : CxxTest::RealTestDescription( Tests_LoadBalancerTest, suiteDescription_LoadBalancerTest, 101, "testInitialWeights5" ) {}
+ void runTest() { suite_LoadBalancerTest.testInitialWeights5(); }
+} testDescription_suite_LoadBalancerTest_testInitialWeights5;
+
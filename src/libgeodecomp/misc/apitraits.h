@@ -196,6 +196,41 @@ public:
 
     // XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 
+    // determine whether a cell wants to be stored in a RegionGrid,
+    // which holds only the cells of a node's Region instead of its
+    // whole bounding box.
+    template<typename CELL, typename HAS_REGION_GRID = void>
+    class SelectRegionGrid
+    {
+    public:
+        typedef FalseType Value;
+    };
+
+    template<typename CELL>
+    class SelectRegionGrid<CELL, typename CELL::API::SupportsRegionGrid>
+    {
+    public:
+        typedef TrueType Value;
+    };
+
+    /**
+     * Use this qualifier in a cell's API to request that Simulators
+     * store it in a RegionGrid. This pays off for irregular
+     * partitions (e.g. HilbertPartition or HIndexingPartition) whose
+     * Regions are much smaller than their bounding boxes. Requires
+     * that the cell's neighbors are accessed via the ghost zone halo
+     * only, which holds for all Steppers. Simulators which keep the
+     * whole grid (e.g. SerialSimulator) fall back to a DisplacedGrid.
+     * Not available for SoA cells.
+     */
+    class HasRegionGrid
+    {
+    public:
+        typedef void SupportsRegionGrid;
+    };
+
+    // XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
     /**
      * Check whether cell has an updateLineX() member.
      */
@@ -0,0 +1,46 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}color.cpp
+  ${RELATIVE_PATH}patternoptimizer.cpp
+  ${RELATIVE_PATH}random.cpp
+  ${RELATIVE_PATH}simplexoptimizer.cpp
+  ${RELATIVE_PATH}tempfile.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}apitraits.h
+  ${RELATIVE_PATH}cacheblockingsimulationfactory.h
+  ${RELATIVE_PATH}chronometer.h
+  ${RELATIVE_PATH}clonable.h
+  ${RELATIVE_PATH}color.h
+  ${RELATIVE_PATH}counterbasedrandom.h
+  ${RELATIVE_PATH}cudaboostworkaround.h
+  ${RELATIVE_PATH}cudasimulationfactory.h
+  ${RELATIVE_PATH}cudautil.h
+  ${RELATIVE_PATH}eventtrace.h
+  ${RELATIVE_PATH}fpscounter.h
+  ${RELATIVE_PATH}likely.h
+  ${RELATIVE_PATH}limits.h
+  ${RELATIVE_PATH}math.h
+  ${RELATIVE_PATH}metrics.h
+  ${RELATIVE_PATH}nonpodtestcell.h
+  ${RELATIVE_PATH}numautil.h
+  ${RELATIVE_PATH}optimizer.h
+  ${RELATIVE_PATH}palette.h
+  ${RELATIVE_PATH}patternoptimizer.h
+  ${RELATIVE_PATH}quickpalette.h
+  ${RELATIVE_PATH}random.h
+  ${RELATIVE_PATH}scopedtimer.h
+  ${RELATIVE_PATH}serialsimulationfactory.h
+  ${RELATIVE_PATH}sharedptr.h
+  ${RELATIVE_PATH}simfabtestmodel.h
+  ${RELATIVE_PATH}simplexoptimizer.h
+  ${RELATIVE_PATH}simulationfactory.h
+  ${RELATIVE_PATH}simulationparameters.h
+  ${RELATIVE_PATH}stdcontaineroverloads.h
+  ${RELATIVE_PATH}stringops.h
+  ${RELATIVE_PATH}stringvec.h
+  ${RELATIVE_PATH}tempfile.h
+  ${RELATIVE_PATH}testcell.h
+  ${RELATIVE_PATH}testhelper.h
+  ${RELATIVE_PATH}threadpool.h
+  ${RELATIVE_PATH}unstructuredtestcell.h
+)
@@ -42,7 +42,14 @@ protected:
         int wavefrontWidth  = params["WavefrontWidth"];
         int wavefrontHeight = params["WavefrontHeight"];
 
-        Coord<2> wavefrontDim(wavefrontWidth, wavefrontHeight);
+        // the wavefront is orthogonal to the last axis, hence 2D
+        // models only use its width:
+        Coord<CacheBlockingSimulator<CELL>::DIM - 1> wavefrontDim;
+        wavefrontDim[0] = wavefrontWidth;
+        if (CacheBlockingSimulator<CELL>::DIM > 2) {
+            wavefrontDim[CacheBlockingSimulator<CELL>::DIM - 2] = wavefrontHeight;
+        }
+
         CacheBlockingSimulator<CELL> *sim =
             new CacheBlockingSimulator<CELL>(
                 initializer->clone(),
@@ -11,6 +11,22 @@ namespace LibGeoDecomp {
 
 namespace ChronometerHelpers {
 
+/**
+ * Signature of the function which gets notified of every timed
+ * event, see EventTrace.
+ */
+typedef void (*TraceHook)(int eventID, double begin, double end);
+
+/**
+ * Tracing is disabled as long as no hook is set, so timers pay only
+ * for a single branch.
+ */
+inline TraceHook& traceHook()
+{
+    static TraceHook hook = 0;
+    return hook;
+}
+
 /**
  * This class is a tool for counting the number of events and
  * converting their IDs to strings.
@@ -134,7 +150,11 @@ public:
                                                                     \
         ~CLASS_NAME()                                               \
         {                                                           \
-            t = elapsed();                                          \
+            double now = ScopedTimer::time();                       \
+            if (ChronometerHelpers::traceHook()) {                  \
+                ChronometerHelpers::traceHook()(ID, t, now);        \
+            }                                                       \
+            t = now - t;                                            \
         }                                                           \
     };
 }
@@ -319,7 +339,11 @@ public:
     template<typename EVENT>
     void tock(double startTime)
     {
-        addTime<EVENT>(ScopedTimer::time() - startTime);
+        double now = ScopedTimer::time();
+        if (ChronometerHelpers::traceHook()) {
+            ChronometerHelpers::traceHook()(EVENT::ID, startTime, now);
+        }
+        addTime<EVENT>(now - startTime);
     }
 
     std::string report()
@@ -0,0 +1,220 @@
+#ifndef LIBGEODECOMP_MISC_COUNTERBASEDRANDOM_H
+#define LIBGEODECOMP_MISC_COUNTERBASEDRANDOM_H
+
+#include <libflatarray/short_vec.hpp>
+#include <libgeodecomp/geometry/coord.h>
+
+#include <cstddef>
+
+namespace LibGeoDecomp {
+
+/**
+ * Counter-based pseudo random number generator, implementing
+ * Philox4x32-10 as described by Salmon et al. in "Parallel Random
+ * Numbers: As Easy as 1, 2, 3" (SC'11).
+ *
+ * Random wraps a single, global Mersenne Twister, which makes it
+ * unsuitable for being called from Cell::update(): multiple threads
+ * would race for its state, and the sequence of numbers a cell sees
+ * depends on the order in which cells are updated -- and thus on the
+ * number of ranks and threads. CounterBasedRandom holds no shared
+ * state. Each number is a pure function of a user supplied seed, the
+ * global coordinate (or ID) of the cell, the time step, the nano
+ * step and a per-generator draw index. Two generators constructed
+ * with the same arguments yield the same sequence, no matter which
+ * thread or rank owns the cell:
+ *
+ *   CounterBasedRandom rng(SEED, myGlobalCoord, myStep, nanoStep);
+ *   double p = rng.genDouble();
+ *
+ * Cells need to know their global coordinate and time step for this,
+ * which is typically achieved by storing them in the cell (see the
+ * ants example).
+ *
+ * Up to 2^12 nano steps and 2^22 numbers per generator are supported.
+ */
+class CounterBasedRandom
+{
+public:
+    static const int ROUNDS = 10;
+    static const unsigned MAX_NANO_STEPS = 1 << 12;
+    static const unsigned BLOCK_BITS = 20;
+
+    template<int DIM>
+    inline CounterBasedRandom(
+        const unsigned seed,
+        const Coord<DIM>& coord,
+        const unsigned step = 0,
+        const unsigned nanoStep = 0) :
+        block(nanoStep << BLOCK_BITS),
+        bufferIndex(4)
+    {
+        init(seed, coord, step);
+    }
+
+    /**
+     * Convenience constructor for unstructured grids, where cells
+     * are identified by their global ID.
+     */
+    inline CounterBasedRandom(
+        const unsigned seed,
+        const int id,
+        const unsigned step = 0,
+        const unsigned nanoStep = 0) :
+        block(nanoStep << BLOCK_BITS),
+        bufferIndex(4)
+    {
+        init(seed, Coord<1>(id), step);
+    }
+
+    /**
+     * Returns a number in [0, max). Like Random::genUnsigned() this
+     * uses a modulo operation, so the distribution is slightly
+     * biased for values of max which are not a power of two.
+     */
+    inline unsigned genUnsigned(const unsigned max = 0)
+    {
+        if (bufferIndex == 4) {
+            refill();
+        }
+
+        unsigned ret = buffer[bufferIndex++];
+        return max ? (ret % max) : ret;
+    }
+
+    /**
+     * Returns a number in [0, max), based on 53 random bits.
+     */
+    inline double genDouble(const double max = 1.0)
+    {
+        unsigned upper = genUnsigned() >> 5;
+        unsigned lower = genUnsigned() >> 6;
+        return toDouble(upper, lower) * max;
+    }
+
+    /**
+     * Yields one number in [0, 1) per cell for the count cells
+     * starting at start and extending along the x-axis, as required
+     * by updateLineX(). The result for each cell is the same as the
+     * first call to genDouble() of a generator constructed for that
+     * cell. Iterations are independent of each other, so compilers
+     * may vectorize this loop.
+     */
+    template<int DIM>
+    static inline void genDoubleLine(
+        const unsigned seed,
+        const Coord<DIM>& start,
+        const unsigned step,
+        const unsigned nanoStep,
+        double *target,
+        const std::size_t count)
+    {
+        CounterBasedRandom rng(seed, start, step, nanoStep);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            unsigned counter[4] = {
+                rng.counter[0] + unsigned(i),
+                rng.counter[1],
+                rng.counter[2],
+                rng.counter[3] };
+            unsigned key[2] = {
+                rng.key[0],
+                rng.block };
+
+            philox(counter, key);
+            target[i] = toDouble(counter[0] >> 5, counter[1] >> 6);
+        }
+    }
+
+    /**
+     * Batch variant of genDoubleLine() which directly yields a
+     * short_vec, e.g. for consumption in vectorized updateLineX()
+     * implementations.
+     */
+    template<typename CARGO, int ARITY, int DIM>
+    static inline LibFlatArray::short_vec<CARGO, ARITY> genShortVec(
+        const unsigned seed,
+        const Coord<DIM>& start,
+        const unsigned step,
+        const unsigned nanoStep)
+    {
+        double values[ARITY];
+        genDoubleLine(seed, start, step, nanoStep, values, ARITY);
+
+        CARGO buffer[ARITY];
+        for (int i = 0; i < ARITY; ++i) {
+            buffer[i] = CARGO(values[i]);
+        }
+
+        return LibFlatArray::short_vec<CARGO, ARITY>(buffer);
+    }
+
+    /**
+     * Applies the Philox4x32 bijection to counter, in place.
+     */
+    static inline void philox(unsigned counter[4], const unsigned key[2])
+    {
+        unsigned k0 = key[0];
+        unsigned k1 = key[1];
+
+        for (int i = 0; i < ROUNDS; ++i) {
+            unsigned long long product0 = 0xD2511F53ULL * counter[0];
+            unsigned long long product1 = 0xCD9E8D57ULL * counter[2];
+
+            unsigned hi0 = unsigned(product0 >> 32);
+            unsigned lo0 = unsigned(product0);
+            unsigned hi1 = unsigned(product1 >> 32);
+            unsigned lo1 = unsigned(product1);
+
+            counter[0] = hi1 ^ counter[1] ^ k0;
+            counter[1] = lo1;
+            counter[2] = hi0 ^ counter[3] ^ k1;
+            counter[3] = lo0;
+
+            k0 += 0x9E3779B9U;
+            k1 += 0xBB67AE85U;
+        }
+    }
+
+private:
+    unsigned counter[4];
+    unsigned key[2];
+    unsigned block;
+    unsigned buffer[4];
+    int bufferIndex;
+
+    template<int DIM>
+    inline void init(const unsigned seed, const Coord<DIM>& coord, const unsigned step)
+    {
+        key[0] = seed;
+        key[1] = 0;
+
+        counter[0] = 0;
+        counter[1] = 0;
+        counter[2] = 0;
+        counter[3] = step;
+
+        for (int i = 0; i < DIM; ++i) {
+            counter[i] = unsigned(coord[i]);
+        }
+    }
+
+    inline void refill()
+    {
+        for (int i = 0; i < 4; ++i) {
+            buffer[i] = counter[i];
+        }
+        key[1] = block++;
+        philox(buffer, key);
+        bufferIndex = 0;
+    }
+
+    static inline double toDouble(const unsigned upper, const unsigned lower)
+    {
+        return (upper * 67108864.0 + lower) * (1.0 / 9007199254740992.0);
+    }
+};
+
+}
+
+#endif
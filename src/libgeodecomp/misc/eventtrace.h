@@ -0,0 +1,477 @@
+#ifndef LIBGEODECOMP_MISC_EVENTTRACE_H
+#define LIBGEODECOMP_MISC_EVENTTRACE_H
+
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/misc/chronometer.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef LIBGEODECOMP_WITH_CPP14
+#include <atomic>
+#include <memory>
+#include <mutex>
+#endif
+
+namespace LibGeoDecomp {
+
+/**
+ * While a Chronometer only accumulates the total time spent per
+ * event type, the EventTrace records every single timed event
+ * (TimeTotal, TimeComputeInner, TimeCommunication...) with its begin
+ * and end timestamp, the ID of the thread which ran it and the
+ * global nano step the thread was working on at that time. This
+ * allows to pinpoint which rank or which ghost zone update is the
+ * straggler in a given step.
+ *
+ * Each thread records into its own ring buffer, so only the most
+ * recent events are retained (the number of overwritten events is
+ * reported via droppedEvents()). Recording requires C++14; without
+ * it enable() will throw. Tracing should be enabled, disabled or
+ * cleared only while no timed sections are running, i.e. not during
+ * Simulator::run().
+ *
+ * Traces can be exported as Chrome trace JSON (which is understood
+ * by chrome://tracing and Perfetto) or a compact binary format. See
+ * HiParSimulator::gatherTrace() for collecting traces from all ranks.
+ */
+class EventTrace
+{
+public:
+    /**
+     * One timed event, times are given in seconds.
+     */
+    class Event
+    {
+    public:
+        explicit Event(
+            int eventID = -1,
+            int thread = 0,
+            long nanoStep = -1,
+            double begin = 0,
+            double end = 0) :
+            eventID(eventID),
+            thread(thread),
+            nanoStep(nanoStep),
+            begin(begin),
+            end(end)
+        {}
+
+        bool operator==(const Event& other) const
+        {
+            return
+                (eventID  == other.eventID) &&
+                (thread   == other.thread) &&
+                (nanoStep == other.nanoStep) &&
+                (begin    == other.begin) &&
+                (end      == other.end);
+        }
+
+        /**
+         * Orders by begin time. Enclosing events come first if two
+         * events start at the same time. Identical intervals are
+         * ordered by ID as parent events are defined first.
+         */
+        bool operator<(const Event& other) const
+        {
+            if (begin != other.begin) {
+                return begin < other.begin;
+            }
+            if (end != other.end) {
+                return end > other.end;
+            }
+            return eventID < other.eventID;
+        }
+
+        int eventID;
+        int thread;
+        long nanoStep;
+        double begin;
+        double end;
+    };
+
+    typedef std::vector<Event> EventVec;
+
+    /**
+     * Starts recording, retaining up to capacity events per thread.
+     */
+    static void enable(std::size_t capacity = 1 << 16)
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        if (capacity == 0) {
+            throw std::invalid_argument("EventTrace capacity must be positive");
+        }
+
+        State& s = state();
+        {
+            std::lock_guard<std::mutex> lock(s.mutex);
+            if (capacity != s.capacity) {
+                s.capacity = capacity;
+                for (std::size_t i = 0; i < s.buffers.size(); ++i) {
+                    s.buffers[i]->reset(capacity);
+                }
+            }
+        }
+
+        s.enabled = true;
+        ChronometerHelpers::traceHook() = &EventTrace::record;
+#else
+        throw std::logic_error("EventTrace requires C++14");
+#endif
+    }
+
+    /**
+     * Stops recording, but retains all events recorded so far.
+     */
+    static void disable()
+    {
+        ChronometerHelpers::traceHook() = 0;
+#ifdef LIBGEODECOMP_WITH_CPP14
+        state().enabled = false;
+#endif
+    }
+
+    static bool enabled()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        return state().enabled;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * Discards all events recorded so far.
+     */
+    static void clear()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        State& s = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        for (std::size_t i = 0; i < s.buffers.size(); ++i) {
+            s.buffers[i]->reset(s.capacity);
+        }
+#endif
+    }
+
+    /**
+     * Tags all events subsequently recorded by the calling thread
+     * with the given global nano step. Steppers and Simulators call
+     * this before each update; it's a no-op unless tracing is
+     * enabled.
+     */
+    static void setNanoStep(long nanoStep)
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        if (state().enabled) {
+            threadBuffer().nanoStep = nanoStep;
+        }
+#endif
+    }
+
+    /**
+     * Records one event for the calling thread. This is the hook
+     * invoked by the Chronometer's timers.
+     */
+    static void record(int eventID, double begin, double end)
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        threadBuffer().push(eventID, begin, end);
+#endif
+    }
+
+    /**
+     * Returns the events of all threads, sorted by begin time.
+     */
+    static EventVec events()
+    {
+        EventVec ret;
+#ifdef LIBGEODECOMP_WITH_CPP14
+        State& s = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        for (std::size_t i = 0; i < s.buffers.size(); ++i) {
+            s.buffers[i]->copyTo(&ret);
+        }
+#endif
+        std::stable_sort(ret.begin(), ret.end());
+        return ret;
+    }
+
+    /**
+     * Number of events which were overwritten since the last
+     * clear() as the ring buffers were full.
+     */
+    static std::size_t droppedEvents()
+    {
+        std::size_t ret = 0;
+#ifdef LIBGEODECOMP_WITH_CPP14
+        State& s = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        for (std::size_t i = 0; i < s.buffers.size(); ++i) {
+            ret += s.buffers[i]->dropped;
+        }
+#endif
+        return ret;
+    }
+
+    /**
+     * Writes a Chrome trace JSON file. eventsPerRank[i] holds the
+     * events recorded on rank i, which is mapped to a process while
+     * threads map to threads. Timestamps are given in microseconds.
+     */
+    static void writeChromeTrace(std::ostream& stream, const std::vector<EventVec>& eventsPerRank)
+    {
+        std::ios_base::fmtflags flags = stream.flags();
+        std::streamsize precision = stream.precision();
+        stream << std::fixed << std::setprecision(3);
+
+        stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first = true;
+
+        for (std::size_t rank = 0; rank < eventsPerRank.size(); ++rank) {
+            if (!first) {
+                stream << ",";
+            }
+            first = false;
+            stream << "\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank
+                   << ",\"args\":{\"name\":\"rank " << rank << "\"}}";
+
+            const EventVec& events = eventsPerRank[rank];
+            for (EventVec::const_iterator i = events.begin(); i != events.end(); ++i) {
+                stream << ",\n{\"name\":\"" << eventName(i->eventID) << "\""
+                       << ",\"cat\":\"libgeodecomp\",\"ph\":\"X\""
+                       << ",\"pid\":" << rank
+                       << ",\"tid\":" << i->thread
+                       << ",\"ts\":" << (i->begin * 1e6)
+                       << ",\"dur\":" << ((i->end - i->begin) * 1e6)
+                       << ",\"args\":{\"nano_step\":" << i->nanoStep << "}}";
+            }
+        }
+
+        stream << "\n]}\n";
+
+        stream.flags(flags);
+        stream.precision(precision);
+    }
+
+    static void writeChromeTrace(std::ostream& stream, const EventVec& events)
+    {
+        writeChromeTrace(stream, std::vector<EventVec>(1, events));
+    }
+
+    /**
+     * Writes a compact binary trace, loosely modeled after OTF2: a
+     * definitions section mapping event IDs to names, followed by one
+     * event stream per rank. All values are stored in native byte
+     * order:
+     *
+     *   char[8] magic "LGDTRACE", uint32 version
+     *   uint32 numNames, numNames * (uint32 length, char[length] name)
+     *   uint32 numRanks, numRanks * (uint64 numEvents, numEvents *
+     *     (int32 eventID, int32 thread, int64 nanoStep, double begin, double end))
+     */
+    static void writeBinary(std::ostream& stream, const std::vector<EventVec>& eventsPerRank)
+    {
+        stream.write(magic(), 8);
+        writeValue<unsigned>(stream, VERSION);
+
+        writeValue<unsigned>(stream, Chronometer::NUM_INTERVALS);
+        for (std::size_t i = 0; i < Chronometer::NUM_INTERVALS; ++i) {
+            std::string name = eventName(static_cast<int>(i));
+            writeValue<unsigned>(stream, static_cast<unsigned>(name.size()));
+            stream.write(name.c_str(), name.size());
+        }
+
+        writeValue<unsigned>(stream, static_cast<unsigned>(eventsPerRank.size()));
+        for (std::size_t rank = 0; rank < eventsPerRank.size(); ++rank) {
+            const EventVec& events = eventsPerRank[rank];
+            writeValue<unsigned long long>(stream, events.size());
+
+            for (EventVec::const_iterator i = events.begin(); i != events.end(); ++i) {
+                writeValue<int>(stream, i->eventID);
+                writeValue<int>(stream, i->thread);
+                writeValue<long long>(stream, i->nanoStep);
+                writeValue<double>(stream, i->begin);
+                writeValue<double>(stream, i->end);
+            }
+        }
+
+        if (!stream) {
+            throw std::runtime_error("could not write binary event trace");
+        }
+    }
+
+    /**
+     * Reads a trace written by writeBinary(). Event names are
+     * skipped as they can be recovered from the event IDs.
+     */
+    static std::vector<EventVec> readBinary(std::istream& stream)
+    {
+        char header[8];
+        stream.read(header, 8);
+        if (!stream || (std::memcmp(header, magic(), 8) != 0) || (readValue<unsigned>(stream) != VERSION)) {
+            throw std::runtime_error("not a binary event trace");
+        }
+
+        unsigned numNames = readValue<unsigned>(stream);
+        for (unsigned i = 0; i < numNames; ++i) {
+            unsigned length = readValue<unsigned>(stream);
+            stream.ignore(length);
+        }
+
+        std::vector<EventVec> ret(readValue<unsigned>(stream));
+        for (std::size_t rank = 0; rank < ret.size(); ++rank) {
+            unsigned long long numEvents = readValue<unsigned long long>(stream);
+
+            for (unsigned long long i = 0; i < numEvents; ++i) {
+                Event event;
+                event.eventID  = readValue<int>(stream);
+                event.thread   = readValue<int>(stream);
+                event.nanoStep = static_cast<long>(readValue<long long>(stream));
+                event.begin    = readValue<double>(stream);
+                event.end      = readValue<double>(stream);
+                ret[rank].push_back(event);
+            }
+        }
+
+        return ret;
+    }
+
+private:
+    static const unsigned VERSION = 1;
+
+    static const char *magic()
+    {
+        return "LGDTRACE";
+    }
+
+#ifdef LIBGEODECOMP_WITH_CPP14
+    /**
+     * Ring buffer holding the events of one thread. Only its owning
+     * thread writes to it, so no locking is required while recording.
+     */
+    class ThreadBuffer
+    {
+    public:
+        ThreadBuffer(int thread, std::size_t capacity) :
+            thread(thread),
+            nanoStep(-1)
+        {
+            reset(capacity);
+        }
+
+        void reset(std::size_t newCapacity)
+        {
+            capacity = newCapacity;
+            next = 0;
+            dropped = 0;
+            events.clear();
+            events.shrink_to_fit();
+        }
+
+        void push(int eventID, double begin, double end)
+        {
+            Event event(eventID, thread, nanoStep, begin, end);
+
+            // the buffer grows lazily, so that short-lived threads
+            // don't allocate the full capacity:
+            if (events.size() < capacity) {
+                events.push_back(event);
+                return;
+            }
+
+            events[next] = event;
+            next = (next + 1) % capacity;
+            ++dropped;
+        }
+
+        void copyTo(EventVec *target) const
+        {
+            target->insert(target->end(), events.begin() + next, events.end());
+            target->insert(target->end(), events.begin(), events.begin() + next);
+        }
+
+        int thread;
+        long nanoStep;
+        std::size_t capacity;
+        std::size_t next;
+        std::size_t dropped;
+        EventVec events;
+    };
+
+    /**
+     * Buffers are owned by the State and outlive their threads so
+     * that their events can still be exported.
+     */
+    class State
+    {
+    public:
+        State() :
+            enabled(false),
+            capacity(1 << 16)
+        {}
+
+        std::atomic<bool> enabled;
+        std::mutex mutex;
+        std::size_t capacity;
+        std::vector<std::unique_ptr<ThreadBuffer> > buffers;
+    };
+
+    static State& state()
+    {
+        static State s;
+        return s;
+    }
+
+    static ThreadBuffer& threadBuffer()
+    {
+        static thread_local ThreadBuffer *buffer = 0;
+        if (buffer == 0) {
+            State& s = state();
+            std::lock_guard<std::mutex> lock(s.mutex);
+            s.buffers.push_back(std::unique_ptr<ThreadBuffer>(
+                                    new ThreadBuffer(static_cast<int>(s.buffers.size()), s.capacity)));
+            buffer = s.buffers.back().get();
+        }
+
+        return *buffer;
+    }
+#endif
+
+    static std::string eventName(int eventID)
+    {
+        try {
+            return ChronometerHelpers::EventToString()(eventID);
+        } catch (const std::invalid_argument&) {
+            return "unknown event";
+        }
+    }
+
+    template<typename T>
+    static void writeValue(std::ostream& stream, T value)
+    {
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    static T readValue(std::istream& stream)
+    {
+        T value;
+        stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+        if (!stream) {
+            throw std::runtime_error("truncated binary event trace");
+        }
+
+        return value;
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,327 @@
+#ifndef LIBGEODECOMP_MISC_METRICS_H
+#define LIBGEODECOMP_MISC_METRICS_H
+
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/misc/scopedtimer.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef LIBGEODECOMP_WITH_CPP14
+#include <atomic>
+#endif
+
+namespace LibGeoDecomp {
+
+/**
+ * Process-wide counters and latency histograms which are updated on
+ * the hot path (UpdateFunctor, PatchLink, PatchBuffer, writers) and
+ * are cheap enough to stay enabled in production runs: each update
+ * costs a single relaxed atomic increment, at most once per call --
+ * never per cell.
+ *
+ * All values are cumulative. Readers such as the MetricsWriter take
+ * snapshots and subtract them to get the values for a window of time
+ * steps, so multiple readers won't interfere. Without C++14 the
+ * counters are plain integers and hence not thread-safe.
+ *
+ * Histograms use logarithmic buckets (16 per power of two), so
+ * percentiles are accurate to roughly 3%.
+ */
+class Metrics
+{
+public:
+    enum Counter {
+        CELLS_UPDATED,
+        GHOST_BYTES_SENT,
+        GHOST_BYTES_RECEIVED,
+        PATCH_BUFFER_CELLS,
+        NUM_COUNTERS
+    };
+
+    /**
+     * All histograms record durations in seconds.
+     */
+    enum Histogram {
+        PATCH_LINK_WAIT,
+        WRITER_LATENCY,
+        NUM_HISTOGRAMS
+    };
+
+    static const int SUB_BUCKETS = 16;
+    static const int MIN_EXPONENT = -30;
+    static const int NUM_OCTAVES = 48;
+    static const int NUM_BUCKETS = SUB_BUCKETS * NUM_OCTAVES;
+
+    typedef unsigned long long ValueType;
+
+    /**
+     * Bucket counts of one histogram at a given point in time (or,
+     * after subtraction, within a window).
+     */
+    class HistogramSnapshot
+    {
+    public:
+        HistogramSnapshot() :
+            buckets(NUM_BUCKETS, 0),
+            count(0)
+        {}
+
+        HistogramSnapshot& operator-=(const HistogramSnapshot& other)
+        {
+            for (std::size_t i = 0; i < buckets.size(); ++i) {
+                buckets[i] -= other.buckets[i];
+            }
+            count -= other.count;
+
+            return *this;
+        }
+
+        /**
+         * Returns the smallest recorded value v so that a fraction q
+         * of all recorded values is less or equal to v, or 0 if the
+         * histogram is empty.
+         */
+        double percentile(double q) const
+        {
+            if (count == 0) {
+                return 0;
+            }
+
+            ValueType rank = ValueType(std::ceil(q * count));
+            if (rank == 0) {
+                rank = 1;
+            }
+
+            ValueType seen = 0;
+            for (int i = 0; i < NUM_BUCKETS; ++i) {
+                seen += buckets[i];
+                if (seen >= rank) {
+                    return bucketValue(i);
+                }
+            }
+
+            return bucketValue(NUM_BUCKETS - 1);
+        }
+
+        double max() const
+        {
+            for (int i = NUM_BUCKETS - 1; i >= 0; --i) {
+                if (buckets[i] != 0) {
+                    return bucketValue(i);
+                }
+            }
+
+            return 0;
+        }
+
+        std::vector<ValueType> buckets;
+        ValueType count;
+    };
+
+    /**
+     * All counters and histograms, along with the time at which they
+     * were read.
+     */
+    class Snapshot
+    {
+    public:
+        Snapshot() :
+            time(0),
+            counters(NUM_COUNTERS, 0),
+            histograms(NUM_HISTOGRAMS)
+        {}
+
+        Snapshot operator-(const Snapshot& other) const
+        {
+            Snapshot ret(*this);
+            ret.time -= other.time;
+
+            for (int i = 0; i < NUM_COUNTERS; ++i) {
+                ret.counters[i] -= other.counters[i];
+            }
+            for (int i = 0; i < NUM_HISTOGRAMS; ++i) {
+                ret.histograms[i] -= other.histograms[i];
+            }
+
+            return ret;
+        }
+
+        double time;
+        std::vector<ValueType> counters;
+        std::vector<HistogramSnapshot> histograms;
+    };
+
+    /**
+     * Records the lifetime of an object in the given histogram.
+     */
+    class ScopedLatency
+    {
+    public:
+        explicit ScopedLatency(Histogram histogram) :
+            histogram(histogram),
+            startTime(ScopedTimer::time())
+        {}
+
+        ~ScopedLatency()
+        {
+            Metrics::record(histogram, ScopedTimer::time() - startTime);
+        }
+
+    private:
+        Histogram histogram;
+        double startTime;
+    };
+
+    static void add(Counter counter, ValueType delta)
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        state().counters[counter].fetch_add(delta, std::memory_order_relaxed);
+#else
+        state().counters[counter] += delta;
+#endif
+    }
+
+    static void record(Histogram histogram, double value)
+    {
+        State& s = state();
+#ifdef LIBGEODECOMP_WITH_CPP14
+        s.buckets[histogram][bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+#else
+        s.buckets[histogram][bucketIndex(value)] += 1;
+#endif
+    }
+
+    static Snapshot snapshot()
+    {
+        Snapshot ret;
+        ret.time = ScopedTimer::time();
+        State& s = state();
+
+        for (int i = 0; i < NUM_COUNTERS; ++i) {
+            ret.counters[i] = s.counters[i];
+        }
+
+        for (int i = 0; i < NUM_HISTOGRAMS; ++i) {
+            HistogramSnapshot& histogram = ret.histograms[i];
+            for (int j = 0; j < NUM_BUCKETS; ++j) {
+                histogram.buckets[j] = s.buckets[i][j];
+                histogram.count += histogram.buckets[j];
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     * Zeroes all counters and histograms. Only meant for tests as
+     * it would interfere with other readers.
+     */
+    static void reset()
+    {
+        State& s = state();
+        for (int i = 0; i < NUM_COUNTERS; ++i) {
+            s.counters[i] = 0;
+        }
+        for (int i = 0; i < NUM_HISTOGRAMS; ++i) {
+            for (int j = 0; j < NUM_BUCKETS; ++j) {
+                s.buckets[i][j] = 0;
+            }
+        }
+    }
+
+    static std::string name(Counter counter)
+    {
+        switch (counter) {
+        case CELLS_UPDATED:
+            return "cells_updated";
+        case GHOST_BYTES_SENT:
+            return "ghost_bytes_sent";
+        case GHOST_BYTES_RECEIVED:
+            return "ghost_bytes_received";
+        case PATCH_BUFFER_CELLS:
+            return "patch_buffer_cells";
+        default:
+            throw std::invalid_argument("unknown counter");
+        }
+    }
+
+    static std::string name(Histogram histogram)
+    {
+        switch (histogram) {
+        case PATCH_LINK_WAIT:
+            return "patch_link_wait";
+        case WRITER_LATENCY:
+            return "writer_latency";
+        default:
+            throw std::invalid_argument("unknown histogram");
+        }
+    }
+
+    /**
+     * Maps a value to its bucket. Values below 2^MIN_EXPONENT
+     * (including 0) end up in the first, values beyond the range
+     * in the last bucket.
+     */
+    static int bucketIndex(double value)
+    {
+        if (!(value > 0)) {
+            return 0;
+        }
+
+        // value = mantissa * 2^exponent with mantissa in [0.5, 1):
+        int exponent;
+        double mantissa = std::frexp(value, &exponent);
+        int octave = exponent - 1 - MIN_EXPONENT;
+        if (octave < 0) {
+            return 0;
+        }
+        if (octave >= NUM_OCTAVES) {
+            return NUM_BUCKETS - 1;
+        }
+
+        int sub = int((mantissa * 2 - 1) * SUB_BUCKETS);
+        return octave * SUB_BUCKETS + sub;
+    }
+
+    /**
+     * The value representing a bucket, i.e. the center of its range.
+     */
+    static double bucketValue(int index)
+    {
+        int octave = index / SUB_BUCKETS;
+        int sub = index % SUB_BUCKETS;
+        double lower = 1.0 + double(sub) / SUB_BUCKETS;
+        return std::ldexp(lower + 0.5 / SUB_BUCKETS, octave + MIN_EXPONENT);
+    }
+
+private:
+#ifdef LIBGEODECOMP_WITH_CPP14
+    typedef std::atomic<ValueType> CounterType;
+#else
+    typedef ValueType CounterType;
+#endif
+
+    /**
+     * Holds all counters. Function-local static storage is
+     * zero-initialized before anything else.
+     */
+    class State
+    {
+    public:
+        CounterType counters[NUM_COUNTERS];
+        CounterType buckets[NUM_HISTOGRAMS][NUM_BUCKETS];
+    };
+
+    static State& state()
+    {
+        static State s;
+        return s;
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,232 @@
+#ifndef LIBGEODECOMP_MISC_NUMAUTIL_H
+#define LIBGEODECOMP_MISC_NUMAUTIL_H
+
+#include <libgeodecomp/config.h>
+
+#include <cstddef>
+#include <vector>
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#include <omp.h>
+#endif
+
+#ifdef __linux__
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace LibGeoDecomp {
+
+/**
+ * A loose collection of helpers for placing threads and memory on
+ * multi-socket (NUMA) machines. We talk to the Linux kernel directly
+ * instead of requiring libnuma. On other systems all functions
+ * degrade gracefully: pinning and page migration become no-ops and
+ * NUMA nodes are reported as unknown (-1).
+ */
+class NUMAUtil
+{
+public:
+    /**
+     * Pins each OpenMP thread to one CPU of the process's affinity
+     * mask, round robin by thread number. Returns false if pinning
+     * is not supported on this system.
+     */
+    static bool pinThreads()
+    {
+#if defined(__linux__) && defined(CPU_SETSIZE)
+        cpu_set_t mask;
+        if (sched_getaffinity(0, sizeof(mask), &mask) != 0) {
+            return false;
+        }
+
+        std::vector<int> cpus;
+        for (int i = 0; i < CPU_SETSIZE; ++i) {
+            if (CPU_ISSET(i, &mask)) {
+                cpus.push_back(i);
+            }
+        }
+        if (cpus.empty()) {
+            return false;
+        }
+
+        bool success = true;
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel reduction(&&:success)
+#endif
+        {
+            cpu_set_t threadMask;
+            CPU_ZERO(&threadMask);
+            CPU_SET(cpus[threadNum() % cpus.size()], &threadMask);
+            success = (sched_setaffinity(0, sizeof(threadMask), &threadMask) == 0);
+        }
+
+        return success;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * Returns the NUMA node on which the calling thread is currently
+     * running, or -1 if that can't be determined.
+     */
+    static int currentNode()
+    {
+#if defined(__linux__) && defined(SYS_getcpu)
+        unsigned cpu = 0;
+        unsigned node = 0;
+        if (syscall(SYS_getcpu, &cpu, &node, 0) != 0) {
+            return -1;
+        }
+
+        return static_cast<int>(node);
+#else
+        return -1;
+#endif
+    }
+
+    /**
+     * Migrates all pages which overlap the memory range [begin, end)
+     * to the given NUMA node. The effect is the same as if the pages
+     * had been first touched by a thread running on that node.
+     */
+    static void movePages(const void *begin, const void *end, int node)
+    {
+        if (node < 0) {
+            return;
+        }
+
+        std::vector<void*> pages = pageAddresses(begin, end);
+        if (pages.empty()) {
+            return;
+        }
+
+        std::vector<int> nodes(pages.size(), node);
+        std::vector<int> status(pages.size());
+        movePagesSyscall(pages, &nodes[0], &status[0]);
+    }
+
+    /**
+     * Counts how many pages of the range [begin, end) reside on each
+     * NUMA node. The result is indexed by node; pages which haven't
+     * been touched yet or whose location is unknown aren't counted.
+     */
+    static std::vector<std::size_t> pagesPerNode(const void *begin, const void *end)
+    {
+        std::vector<std::size_t> ret;
+        std::vector<void*> pages = pageAddresses(begin, end);
+        if (pages.empty()) {
+            return ret;
+        }
+
+        // passing no target nodes makes the kernel report the
+        // pages' current location instead of moving them:
+        std::vector<int> status(pages.size(), -1);
+        if (!movePagesSyscall(pages, 0, &status[0])) {
+            return ret;
+        }
+
+        for (std::size_t i = 0; i < status.size(); ++i) {
+            if (status[i] < 0) {
+                continue;
+            }
+
+            std::size_t node = static_cast<std::size_t>(status[i]);
+            if (node >= ret.size()) {
+                ret.resize(node + 1, 0);
+            }
+            ++ret[node];
+        }
+
+        return ret;
+    }
+
+    /**
+     * Counts the OpenMP threads per NUMA node, based on where they
+     * are running right now (which is only meaningful if they've
+     * been pinned).
+     */
+    static std::vector<std::size_t> threadsPerNode()
+    {
+        std::vector<int> nodes(numThreads(), -1);
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel
+#endif
+        {
+            nodes[threadNum()] = currentNode();
+        }
+
+        std::vector<std::size_t> ret;
+        for (std::size_t i = 0; i < nodes.size(); ++i) {
+            if (nodes[i] < 0) {
+                continue;
+            }
+
+            std::size_t node = static_cast<std::size_t>(nodes[i]);
+            if (node >= ret.size()) {
+                ret.resize(node + 1, 0);
+            }
+            ++ret[node];
+        }
+
+        return ret;
+    }
+
+    static int threadNum()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        return omp_get_thread_num();
+#else
+        return 0;
+#endif
+    }
+
+    static int numThreads()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        return omp_get_max_threads();
+#else
+        return 1;
+#endif
+    }
+
+private:
+    static std::vector<void*> pageAddresses(const void *begin, const void *end)
+    {
+        std::vector<void*> ret;
+#ifdef __linux__
+        if (end <= begin) {
+            return ret;
+        }
+
+        std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        std::size_t first = reinterpret_cast<std::size_t>(begin) / pageSize;
+        std::size_t last  = (reinterpret_cast<std::size_t>(end) + pageSize - 1) / pageSize;
+
+        ret.reserve(last - first);
+        for (std::size_t page = first; page < last; ++page) {
+            ret.push_back(reinterpret_cast<void*>(page * pageSize));
+        }
+#endif
+        return ret;
+    }
+
+    static bool movePagesSyscall(std::vector<void*>& pages, const int *nodes, int *status)
+    {
+#if defined(__linux__) && defined(SYS_move_pages)
+        // MPOL_MF_MOVE from numaif.h: move only pages which are
+        // exclusively used by this process.
+        const int flags = (1 << 1);
+        return syscall(SYS_move_pages, 0, pages.size(), &pages[0], nodes, status, flags) == 0;
+#else
+        return false;
+#endif
+    }
+};
+
+}
+
+#endif
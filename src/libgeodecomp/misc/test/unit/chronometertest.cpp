@@ -0,0 +1,68 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ChronometerTest_init = false;
+#include "/root/repo/src/libgeodecomp/misc/test/unit/chronometertest.h"
+
+static ChronometerTest suite_ChronometerTest;
+
+static CxxTest::List Tests_ChronometerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ChronometerTest( "/root/repo/src/libgeodecomp/misc/test/unit/chronometertest.h", 15, "ChronometerTest", suite_ChronometerTest, Tests_ChronometerTest );
+
+static class TestDescription_suite_ChronometerTest_testWorkRatio1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ChronometerTest_testWorkRatio1() : CxxTest::RealTestDescription( Tests_ChronometerTest, suiteDescription_ChronometerTest, 28, "testWorkRatio1" ) {}
+ void runTest() { suite_ChronometerTest.testWorkRatio1(); }
+} testDescription_suite_ChronometerTest_testWorkRatio1;
+
+static class TestDescription_suite_ChronometerTest_testWorkRatio2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ChronometerTest_testWorkRatio2() : CxxTest::RealTestDescription( Tests_ChronometerTest, suiteDescription_ChronometerTest, 44, "testWorkRatio2" ) {}
+ void runTest() { suite_ChronometerTest.testWorkRatio2(); }
+} testDescription_suite_ChronometerTest_testWorkRatio2;
+
+static class TestDescription_suite_ChronometerTest_testAddition : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ChronometerTest_testAddition() : CxxTest::RealTestDescription( Tests_ChronometerTest, suiteDescription_ChronometerTest, 73, "testAddition" ) {}
+ void runTest() { suite_ChronometerTest.testAddition(); }
+} testDescription_suite_ChronometerTest_testAddition;
+
+static class TestDescription_suite_ChronometerTest_testReport : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ChronometerTest_testReport() : CxxTest::RealTestDescription( Tests_ChronometerTest, suiteDescription_ChronometerTest, 105, "testReport" ) {}
+ void runTest() { suite_ChronometerTest.testReport(); }
+} testDescription_suite_ChronometerTest_testReport;
+
+static class TestDescription_suite_ChronometerTest_testAddTime : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ChronometerTest_testAddTime() : CxxTest::RealTestDescription( Tests_ChronometerTest, suiteDescription_ChronometerTest, 133, "testAddTime" ) {}
+ void runTest() { suite_ChronometerTest.testAddTime(); }
+} testDescription_suite_ChronometerTest_testAddTime;
+
+static class TestDescription_suite_ChronometerTest_testTock : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ChronometerTest_testTock() : CxxTest::RealTestDescription( Tests_ChronometerTest, suiteDescription_ChronometerTest, 142, "testTock" ) {}
+ void runTest() { suite_ChronometerTest.testTock(); }
+} testDescription_suite_ChronometerTest_testTock;
+
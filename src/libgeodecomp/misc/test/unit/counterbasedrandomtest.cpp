@@ -0,0 +1,62 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CounterBasedRandomTest_init = false;
+#include "/root/repo/src/libgeodecomp/misc/test/unit/counterbasedrandomtest.h"
+
+static CounterBasedRandomTest suite_CounterBasedRandomTest;
+
+static CxxTest::List Tests_CounterBasedRandomTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CounterBasedRandomTest( "/root/repo/src/libgeodecomp/misc/test/unit/counterbasedrandomtest.h", 10, "CounterBasedRandomTest", suite_CounterBasedRandomTest, Tests_CounterBasedRandomTest );
+
+static class TestDescription_suite_CounterBasedRandomTest_testKnownAnswers : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CounterBasedRandomTest_testKnownAnswers() : CxxTest::RealTestDescription( Tests_CounterBasedRandomTest, suiteDescription_CounterBasedRandomTest, 13, "testKnownAnswers" ) {}
+ void runTest() { suite_CounterBasedRandomTest.testKnownAnswers(); }
+} testDescription_suite_CounterBasedRandomTest_testKnownAnswers;
+
+static class TestDescription_suite_CounterBasedRandomTest_testReproducibility : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CounterBasedRandomTest_testReproducibility() : CxxTest::RealTestDescription( Tests_CounterBasedRandomTest, suiteDescription_CounterBasedRandomTest, 41, "testReproducibility" ) {}
+ void runTest() { suite_CounterBasedRandomTest.testReproducibility(); }
+} testDescription_suite_CounterBasedRandomTest_testReproducibility;
+
+static class TestDescription_suite_CounterBasedRandomTest_testIndependentStreams : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CounterBasedRandomTest_testIndependentStreams() : CxxTest::RealTestDescription( Tests_CounterBasedRandomTest, suiteDescription_CounterBasedRandomTest, 62, "testIndependentStreams" ) {}
+ void runTest() { suite_CounterBasedRandomTest.testIndependentStreams(); }
+} testDescription_suite_CounterBasedRandomTest_testIndependentStreams;
+
+static class TestDescription_suite_CounterBasedRandomTest_testDistribution : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CounterBasedRandomTest_testDistribution() : CxxTest::RealTestDescription( Tests_CounterBasedRandomTest, suiteDescription_CounterBasedRandomTest, 90, "testDistribution" ) {}
+ void runTest() { suite_CounterBasedRandomTest.testDistribution(); }
+} testDescription_suite_CounterBasedRandomTest_testDistribution;
+
+static class TestDescription_suite_CounterBasedRandomTest_testLineGeneration : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CounterBasedRandomTest_testLineGeneration() : CxxTest::RealTestDescription( Tests_CounterBasedRandomTest, suiteDescription_CounterBasedRandomTest, 118, "testLineGeneration" ) {}
+ void runTest() { suite_CounterBasedRandomTest.testLineGeneration(); }
+} testDescription_suite_CounterBasedRandomTest_testLineGeneration;
+
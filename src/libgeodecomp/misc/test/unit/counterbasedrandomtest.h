@@ -0,0 +1,140 @@
+#include <libgeodecomp/misc/counterbasedrandom.h>
+
+#include <vector>
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class CounterBasedRandomTest : public CxxTest::TestSuite
+{
+public:
+    void testKnownAnswers()
+    {
+        // reference values from the Random123 distribution:
+        unsigned counter1[4] = { 0, 0, 0, 0 };
+        unsigned key1[2] = { 0, 0 };
+        CounterBasedRandom::philox(counter1, key1);
+        TS_ASSERT_EQUALS(0x6627e8d5U, counter1[0]);
+        TS_ASSERT_EQUALS(0xe169c58dU, counter1[1]);
+        TS_ASSERT_EQUALS(0xbc57ac4cU, counter1[2]);
+        TS_ASSERT_EQUALS(0x9b00dbd8U, counter1[3]);
+
+        unsigned counter2[4] = { 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU };
+        unsigned key2[2] = { 0xffffffffU, 0xffffffffU };
+        CounterBasedRandom::philox(counter2, key2);
+        TS_ASSERT_EQUALS(0x408f276dU, counter2[0]);
+        TS_ASSERT_EQUALS(0x41c83b0eU, counter2[1]);
+        TS_ASSERT_EQUALS(0xa20bc7c6U, counter2[2]);
+        TS_ASSERT_EQUALS(0x6d5451fdU, counter2[3]);
+
+        unsigned counter3[4] = { 0x243f6a88U, 0x85a308d3U, 0x13198a2eU, 0x03707344U };
+        unsigned key3[2] = { 0xa4093822U, 0x299f31d0U };
+        CounterBasedRandom::philox(counter3, key3);
+        TS_ASSERT_EQUALS(0xd16cfe09U, counter3[0]);
+        TS_ASSERT_EQUALS(0x94fdccebU, counter3[1]);
+        TS_ASSERT_EQUALS(0x5001e420U, counter3[2]);
+        TS_ASSERT_EQUALS(0x24126ea1U, counter3[3]);
+    }
+
+    void testReproducibility()
+    {
+        std::vector<unsigned> vec1;
+        std::vector<unsigned> vec2;
+
+        CounterBasedRandom rng1(47, Coord<3>(1, 2, 3), 10, 1);
+        for (int i = 0; i < 20; ++i) {
+            vec1.push_back(rng1.genUnsigned());
+        }
+
+        // interleaving other generators must not affect the sequence:
+        CounterBasedRandom rng2(47, Coord<3>(1, 2, 3), 10, 1);
+        for (int i = 0; i < 20; ++i) {
+            CounterBasedRandom other(47, Coord<3>(i, 2, 3), 10, 1);
+            other.genUnsigned();
+            vec2.push_back(rng2.genUnsigned());
+        }
+
+        TS_ASSERT_EQUALS(vec1, vec2);
+    }
+
+    void testIndependentStreams()
+    {
+        unsigned reference = CounterBasedRandom(47, Coord<2>(5, 6), 10, 0).genUnsigned();
+
+        TS_ASSERT_DIFFERS(reference, CounterBasedRandom(48, Coord<2>(5, 6), 10, 0).genUnsigned());
+        TS_ASSERT_DIFFERS(reference, CounterBasedRandom(47, Coord<2>(6, 5), 10, 0).genUnsigned());
+        TS_ASSERT_DIFFERS(reference, CounterBasedRandom(47, Coord<2>(5, 7), 10, 0).genUnsigned());
+        TS_ASSERT_DIFFERS(reference, CounterBasedRandom(47, Coord<2>(5, 6), 11, 0).genUnsigned());
+        TS_ASSERT_DIFFERS(reference, CounterBasedRandom(47, Coord<2>(5, 6), 10, 1).genUnsigned());
+
+        // IDs of unstructured grids behave like 1D coordinates:
+        TS_ASSERT_EQUALS(
+            CounterBasedRandom(47, Coord<1>(4711), 10, 0).genUnsigned(),
+            CounterBasedRandom(47, 4711, 10, 0).genUnsigned());
+
+        // draws beyond the first block are fresh, too:
+        CounterBasedRandom rng(47, Coord<2>(5, 6), 10, 0);
+        std::vector<unsigned> values;
+        for (int i = 0; i < 12; ++i) {
+            values.push_back(rng.genUnsigned());
+        }
+        for (int i = 0; i < 12; ++i) {
+            for (int j = i + 1; j < 12; ++j) {
+                TS_ASSERT_DIFFERS(values[i], values[j]);
+            }
+        }
+    }
+
+    void testDistribution()
+    {
+        double sum = 0;
+        int histogram[10] = { 0 };
+
+        for (int i = 0; i < 10000; ++i) {
+            double value = CounterBasedRandom(11, Coord<2>(i % 100, i / 100), 3, 0).genDouble();
+            TS_ASSERT_LESS_THAN_EQUALS(0.0, value);
+            TS_ASSERT_LESS_THAN(value, 1.0);
+
+            sum += value;
+            ++histogram[int(value * 10)];
+        }
+
+        TS_ASSERT_LESS_THAN(4900, sum);
+        TS_ASSERT_LESS_THAN(sum, 5100);
+        for (int i = 0; i < 10; ++i) {
+            TS_ASSERT_LESS_THAN(900, histogram[i]);
+            TS_ASSERT_LESS_THAN(histogram[i], 1100);
+        }
+
+        CounterBasedRandom rng(11, Coord<1>(0), 3, 0);
+        for (int i = 0; i < 1000; ++i) {
+            TS_ASSERT_LESS_THAN(rng.genUnsigned(7), unsigned(7));
+            TS_ASSERT_LESS_THAN(rng.genDouble(0.5), 0.5);
+        }
+    }
+
+    void testLineGeneration()
+    {
+        Coord<3> start(10, 20, 30);
+        std::vector<double> line(37);
+        CounterBasedRandom::genDoubleLine(4711, start, 5, 2, &line[0], line.size());
+
+        for (int i = 0; i < 37; ++i) {
+            CounterBasedRandom rng(4711, start + Coord<3>(i, 0, 0), 5, 2);
+            TS_ASSERT_EQUALS(rng.genDouble(), line[i]);
+        }
+
+        double buffer[8];
+        LibFlatArray::short_vec<double, 8> vec =
+            CounterBasedRandom::genShortVec<double, 8>(4711, start + Coord<3>(8, 0, 0), 5, 2);
+        &buffer[0] << vec;
+
+        for (int i = 0; i < 8; ++i) {
+            TS_ASSERT_EQUALS(line[8 + i], buffer[i]);
+        }
+    }
+};
+
+}
@@ -0,0 +1,63 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_EventTraceTest_init = false;
+#include "/root/repo/src/libgeodecomp/misc/test/unit/eventtracetest.h"
+
+static EventTraceTest suite_EventTraceTest;
+
+static CxxTest::List Tests_EventTraceTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_EventTraceTest( "/root/repo/src/libgeodecomp/misc/test/unit/eventtracetest.h", 15, "EventTraceTest", suite_EventTraceTest, Tests_EventTraceTest );
+
+static class TestDescription_suite_EventTraceTest_testRecordsNestedEvents : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EventTraceTest_testRecordsNestedEvents() : CxxTest::RealTestDescription( Tests_EventTraceTest, suiteDescription_EventTraceTest, 28, "testRecordsNestedEvents" ) {}
+ void runTest() { suite_EventTraceTest.testRecordsNestedEvents(); }
+} testDescription_suite_EventTraceTest_testRecordsNestedEvents;
+
+static class TestDescription_suite_EventTraceTest_testRingBufferRetainsMostRecentEvents : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EventTraceTest_testRingBufferRetainsMostRecentEvents() : CxxTest::RealTestDescription( Tests_EventTraceTest, suiteDescription_EventTraceTest, 69, "testRingBufferRetainsMostRecentEvents" ) {}
+ void runTest() { suite_EventTraceTest.testRingBufferRetainsMostRecentEvents(); }
+} testDescription_suite_EventTraceTest_testRingBufferRetainsMostRecentEvents;
+
+static class TestDescription_suite_EventTraceTest_testThreadsRecordSeparately : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EventTraceTest_testThreadsRecordSeparately() : CxxTest::RealTestDescription( Tests_EventTraceTest, suiteDescription_EventTraceTest, 94, "testThreadsRecordSeparately" ) {}
+ void runTest() { suite_EventTraceTest.testThreadsRecordSeparately(); }
+} testDescription_suite_EventTraceTest_testThreadsRecordSeparately;
+
+static class TestDescription_suite_EventTraceTest_testChromeTrace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EventTraceTest_testChromeTrace() : CxxTest::RealTestDescription( Tests_EventTraceTest, suiteDescription_EventTraceTest, 127, "testChromeTrace" ) {}
+ void runTest() { suite_EventTraceTest.testChromeTrace(); }
+} testDescription_suite_EventTraceTest_testChromeTrace;
+
+static class TestDescription_suite_EventTraceTest_testBinaryRoundTrip : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_EventTraceTest_testBinaryRoundTrip() : CxxTest::RealTestDescription( Tests_EventTraceTest, suiteDescription_EventTraceTest, 150, "testBinaryRoundTrip" ) {}
+ void runTest() { suite_EventTraceTest.testBinaryRoundTrip(); }
+} testDescription_suite_EventTraceTest_testBinaryRoundTrip;
+
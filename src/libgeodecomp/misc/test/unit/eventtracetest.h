@@ -0,0 +1,167 @@
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/misc/eventtrace.h>
+
+#include <cxxtest/TestSuite.h>
+#include <sstream>
+
+#ifdef LIBGEODECOMP_WITH_CPP14
+#include <thread>
+#endif
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class EventTraceTest : public CxxTest::TestSuite
+{
+public:
+    void tearDown()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        // restore the default capacity:
+        EventTrace::enable();
+#endif
+        EventTrace::disable();
+        EventTrace::clear();
+    }
+
+    void testRecordsNestedEvents()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        Chronometer chrono;
+        EventTrace::enable();
+        EventTrace::setNanoStep(7);
+        {
+            TimeTotal t(&chrono);
+            ScopedTimer::busyWait(100);
+            {
+                TimeComputeInner t(&chrono);
+                ScopedTimer::busyWait(1000);
+            }
+            ScopedTimer::busyWait(100);
+        }
+        EventTrace::disable();
+
+        {
+            // not recorded any more:
+            TimeOutput t(&chrono);
+        }
+
+        EventTrace::EventVec events = EventTrace::events();
+        TS_ASSERT_EQUALS(std::size_t(2), events.size());
+        TS_ASSERT_EQUALS(int(TimeTotal::ID),        events[0].eventID);
+        TS_ASSERT_EQUALS(int(TimeComputeInner::ID), events[1].eventID);
+
+        for (std::size_t i = 0; i < events.size(); ++i) {
+            TS_ASSERT_EQUALS(7, events[i].nanoStep);
+            TS_ASSERT_EQUALS(events[0].thread, events[i].thread);
+        }
+
+        TS_ASSERT_LESS_THAN(events[0].begin, events[1].begin);
+        TS_ASSERT_LESS_THAN(events[1].end,   events[0].end);
+        TS_ASSERT_LESS_THAN_EQUALS(0.001, events[1].end - events[1].begin);
+
+        // totals are unaffected by tracing:
+        TS_ASSERT_DELTA(events[1].end - events[1].begin, chrono.interval<TimeComputeInner>(), 1e-9);
+#endif
+    }
+
+    void testRingBufferRetainsMostRecentEvents()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        Chronometer chrono;
+        EventTrace::enable(4);
+
+        for (int i = 0; i < 6; ++i) {
+            EventTrace::setNanoStep(i);
+            chrono.tock<TimeCommunication>(ScopedTimer::time());
+        }
+
+        EventTrace::EventVec events = EventTrace::events();
+        TS_ASSERT_EQUALS(std::size_t(4), events.size());
+        TS_ASSERT_EQUALS(std::size_t(2), EventTrace::droppedEvents());
+        for (std::size_t i = 0; i < events.size(); ++i) {
+            TS_ASSERT_EQUALS(long(i + 2), events[i].nanoStep);
+            TS_ASSERT_EQUALS(int(TimeCommunication::ID), events[i].eventID);
+        }
+
+        EventTrace::clear();
+        TS_ASSERT_EQUALS(std::size_t(0), EventTrace::events().size());
+        TS_ASSERT_EQUALS(std::size_t(0), EventTrace::droppedEvents());
+#endif
+    }
+
+    void testThreadsRecordSeparately()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        EventTrace::enable();
+        Chronometer chrono1;
+        Chronometer chrono2;
+
+        std::thread thread1([&chrono1]{
+                EventTrace::setNanoStep(1);
+                TimePatchAccepters t(&chrono1);
+            });
+        std::thread thread2([&chrono2]{
+                EventTrace::setNanoStep(2);
+                TimePatchProviders t(&chrono2);
+            });
+        thread1.join();
+        thread2.join();
+
+        EventTrace::EventVec events = EventTrace::events();
+        TS_ASSERT_EQUALS(std::size_t(2), events.size());
+        TS_ASSERT_DIFFERS(events[0].thread, events[1].thread);
+
+        for (std::size_t i = 0; i < events.size(); ++i) {
+            if (events[i].eventID == TimePatchAccepters::ID) {
+                TS_ASSERT_EQUALS(1, events[i].nanoStep);
+            } else {
+                TS_ASSERT_EQUALS(int(TimePatchProviders::ID), events[i].eventID);
+                TS_ASSERT_EQUALS(2, events[i].nanoStep);
+            }
+        }
+#endif
+    }
+
+    void testChromeTrace()
+    {
+        std::vector<EventTrace::EventVec> events(2);
+        events[0].push_back(EventTrace::Event(TimeComputeInner::ID, 0, 3, 1.0, 1.5));
+        events[1].push_back(EventTrace::Event(TimeCommunication::ID, 2, 4, 2.0, 2.25));
+
+        std::stringstream buf;
+        EventTrace::writeChromeTrace(buf, events);
+        std::string trace = buf.str();
+
+        TS_ASSERT_EQUALS(0, trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+        TS_ASSERT_DIFFERS(
+            std::string::npos,
+            trace.find("{\"name\":\"compute_time_inner\",\"cat\":\"libgeodecomp\",\"ph\":\"X\","
+                       "\"pid\":0,\"tid\":0,\"ts\":1000000.000,\"dur\":500000.000,\"args\":{\"nano_step\":3}}"));
+        TS_ASSERT_DIFFERS(
+            std::string::npos,
+            trace.find("{\"name\":\"communication_time\",\"cat\":\"libgeodecomp\",\"ph\":\"X\","
+                       "\"pid\":1,\"tid\":2,\"ts\":2000000.000,\"dur\":250000.000,\"args\":{\"nano_step\":4}}"));
+        TS_ASSERT_DIFFERS(std::string::npos, trace.find("\"args\":{\"name\":\"rank 1\"}"));
+        TS_ASSERT_EQUALS(trace.size() - 4, trace.rfind("\n]}\n"));
+    }
+
+    void testBinaryRoundTrip()
+    {
+        std::vector<EventTrace::EventVec> events(3);
+        events[0].push_back(EventTrace::Event(TimeTotal::ID,        0, 0, 1.0, 3.0));
+        events[0].push_back(EventTrace::Event(TimeComputeGhost::ID, 1, 1, 1.5, 2.0));
+        events[2].push_back(EventTrace::Event(TimeInput::ID,        0, 9, 4.0, 4.5));
+
+        std::stringstream buf;
+        EventTrace::writeBinary(buf, events);
+        TS_ASSERT_EQUALS(0, buf.str().find("LGDTRACE"));
+        TS_ASSERT_EQUALS(events, EventTrace::readBinary(buf));
+
+        std::stringstream garbage("no trace at all");
+        TS_ASSERT_THROWS(EventTrace::readBinary(garbage), std::runtime_error&);
+    }
+};
+
+}
@@ -0,0 +1,49 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_LimitsTest_init = false;
+#include "/root/repo/src/libgeodecomp/misc/test/unit/limitstest.h"
+
+static LimitsTest suite_LimitsTest;
+
+static CxxTest::List Tests_LimitsTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_LimitsTest( "/root/repo/src/libgeodecomp/misc/test/unit/limitstest.h", 9, "LimitsTest", suite_LimitsTest, Tests_LimitsTest );
+
+static class TestDescription_suite_LimitsTest_testInt : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_LimitsTest_testInt() : CxxTest::RealTestDescription( Tests_LimitsTest, suiteDescription_LimitsTest, 12, "testInt" ) {}
+ void runTest() { suite_LimitsTest.testInt(); }
+} testDescription_suite_LimitsTest_testInt;
+
+static class TestDescription_suite_LimitsTest_testFloat : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_LimitsTest_testFloat() : CxxTest::RealTestDescription( Tests_LimitsTest, suiteDescription_LimitsTest, 27, "testFloat" ) {}
+ void runTest() { suite_LimitsTest.testFloat(); }
+} testDescription_suite_LimitsTest_testFloat;
+
+static class TestDescription_suite_LimitsTest_testDouble : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_LimitsTest_testDouble() : CxxTest::RealTestDescription( Tests_LimitsTest, suiteDescription_LimitsTest, 37, "testDouble" ) {}
+ void runTest() { suite_LimitsTest.testDouble(); }
+} testDescription_suite_LimitsTest_testDouble;
+
@@ -0,0 +1,63 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_MetricsTest_init = false;
+#include "/root/repo/src/libgeodecomp/misc/test/unit/metricstest.h"
+
+static MetricsTest suite_MetricsTest;
+
+static CxxTest::List Tests_MetricsTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MetricsTest( "/root/repo/src/libgeodecomp/misc/test/unit/metricstest.h", 10, "MetricsTest", suite_MetricsTest, Tests_MetricsTest );
+
+static class TestDescription_suite_MetricsTest_testCounters : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MetricsTest_testCounters() : CxxTest::RealTestDescription( Tests_MetricsTest, suiteDescription_MetricsTest, 23, "testCounters" ) {}
+ void runTest() { suite_MetricsTest.testCounters(); }
+} testDescription_suite_MetricsTest_testCounters;
+
+static class TestDescription_suite_MetricsTest_testBucketResolution : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MetricsTest_testBucketResolution() : CxxTest::RealTestDescription( Tests_MetricsTest, suiteDescription_MetricsTest, 35, "testBucketResolution" ) {}
+ void runTest() { suite_MetricsTest.testBucketResolution(); }
+} testDescription_suite_MetricsTest_testBucketResolution;
+
+static class TestDescription_suite_MetricsTest_testPercentiles : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MetricsTest_testPercentiles() : CxxTest::RealTestDescription( Tests_MetricsTest, suiteDescription_MetricsTest, 49, "testPercentiles" ) {}
+ void runTest() { suite_MetricsTest.testPercentiles(); }
+} testDescription_suite_MetricsTest_testPercentiles;
+
+static class TestDescription_suite_MetricsTest_testSnapshotDifference : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MetricsTest_testSnapshotDifference() : CxxTest::RealTestDescription( Tests_MetricsTest, suiteDescription_MetricsTest, 67, "testSnapshotDifference" ) {}
+ void runTest() { suite_MetricsTest.testSnapshotDifference(); }
+} testDescription_suite_MetricsTest_testSnapshotDifference;
+
+static class TestDescription_suite_MetricsTest_testNames : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MetricsTest_testNames() : CxxTest::RealTestDescription( Tests_MetricsTest, suiteDescription_MetricsTest, 92, "testNames" ) {}
+ void runTest() { suite_MetricsTest.testNames(); }
+} testDescription_suite_MetricsTest_testNames;
+
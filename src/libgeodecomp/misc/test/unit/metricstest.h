@@ -0,0 +1,100 @@
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/misc/metrics.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class MetricsTest : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+        Metrics::reset();
+    }
+
+    void tearDown()
+    {
+        Metrics::reset();
+    }
+
+    void testCounters()
+    {
+        Metrics::add(Metrics::CELLS_UPDATED, 100);
+        Metrics::add(Metrics::CELLS_UPDATED, 23);
+        Metrics::add(Metrics::GHOST_BYTES_SENT, 4711);
+
+        Metrics::Snapshot snapshot = Metrics::snapshot();
+        TS_ASSERT_EQUALS(Metrics::ValueType(123),  snapshot.counters[Metrics::CELLS_UPDATED]);
+        TS_ASSERT_EQUALS(Metrics::ValueType(4711), snapshot.counters[Metrics::GHOST_BYTES_SENT]);
+        TS_ASSERT_EQUALS(Metrics::ValueType(0),    snapshot.counters[Metrics::GHOST_BYTES_RECEIVED]);
+    }
+
+    void testBucketResolution()
+    {
+        TS_ASSERT_EQUALS(0, Metrics::bucketIndex(0));
+        TS_ASSERT_EQUALS(0, Metrics::bucketIndex(-1));
+        TS_ASSERT_EQUALS(0, Metrics::bucketIndex(1e-20));
+        TS_ASSERT_EQUALS(Metrics::NUM_BUCKETS - 1, Metrics::bucketIndex(1e20));
+
+        for (double value = 1e-8; value < 1e4; value *= 1.07) {
+            int index = Metrics::bucketIndex(value);
+            TS_ASSERT_DELTA(1.0, Metrics::bucketValue(index) / value, 0.5 / Metrics::SUB_BUCKETS);
+            TS_ASSERT(Metrics::bucketIndex(value * 1.07) >= index);
+        }
+    }
+
+    void testPercentiles()
+    {
+        for (int i = 1; i <= 100; ++i) {
+            Metrics::record(Metrics::PATCH_LINK_WAIT, i * 1e-3);
+        }
+
+        Metrics::HistogramSnapshot histogram = Metrics::snapshot().histograms[Metrics::PATCH_LINK_WAIT];
+        TS_ASSERT_EQUALS(Metrics::ValueType(100), histogram.count);
+        TS_ASSERT_DELTA(0.050, histogram.percentile(0.50), 0.050 * 0.04);
+        TS_ASSERT_DELTA(0.099, histogram.percentile(0.99), 0.099 * 0.04);
+        TS_ASSERT_DELTA(0.100, histogram.max(),            0.100 * 0.04);
+        TS_ASSERT_DELTA(0.001, histogram.percentile(0),    0.001 * 0.04);
+
+        Metrics::HistogramSnapshot empty = Metrics::snapshot().histograms[Metrics::WRITER_LATENCY];
+        TS_ASSERT_EQUALS(0.0, empty.percentile(0.5));
+        TS_ASSERT_EQUALS(0.0, empty.max());
+    }
+
+    void testSnapshotDifference()
+    {
+        Metrics::add(Metrics::PATCH_BUFFER_CELLS, 10);
+        Metrics::record(Metrics::WRITER_LATENCY, 1.0);
+        Metrics::Snapshot first = Metrics::snapshot();
+
+        Metrics::add(Metrics::PATCH_BUFFER_CELLS, 5);
+        Metrics::record(Metrics::WRITER_LATENCY, 0.001);
+        {
+            Metrics::ScopedLatency latency(Metrics::WRITER_LATENCY);
+            ScopedTimer::busyWait(1000);
+        }
+        Metrics::Snapshot second = Metrics::snapshot();
+
+        Metrics::Snapshot delta = second - first;
+        TS_ASSERT_LESS_THAN_EQUALS(0, delta.time);
+        TS_ASSERT_EQUALS(Metrics::ValueType(5), delta.counters[Metrics::PATCH_BUFFER_CELLS]);
+
+        // the 1s outlier was recorded before the window:
+        const Metrics::HistogramSnapshot& histogram = delta.histograms[Metrics::WRITER_LATENCY];
+        TS_ASSERT_EQUALS(Metrics::ValueType(2), histogram.count);
+        TS_ASSERT_LESS_THAN(histogram.max(), 0.5);
+        TS_ASSERT_LESS_THAN_EQUALS(0.001 * 0.96, histogram.max());
+    }
+
+    void testNames()
+    {
+        TS_ASSERT_EQUALS("cells_updated",   Metrics::name(Metrics::CELLS_UPDATED));
+        TS_ASSERT_EQUALS("patch_link_wait", Metrics::name(Metrics::PATCH_LINK_WAIT));
+        TS_ASSERT_THROWS(Metrics::name(Metrics::NUM_COUNTERS), std::invalid_argument&);
+    }
+};
+
+}
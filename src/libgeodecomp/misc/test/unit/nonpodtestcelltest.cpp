@@ -0,0 +1,38 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_NonPoDTestCellTest_init = false;
+#include "/root/repo/src/libgeodecomp/misc/test/unit/nonpodtestcelltest.h"
+
+static NonPoDTestCellTest suite_NonPoDTestCellTest;
+
+static CxxTest::List Tests_NonPoDTestCellTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_NonPoDTestCellTest( "/root/repo/src/libgeodecomp/misc/test/unit/nonpodtestcelltest.h", 10, "NonPoDTestCellTest", suite_NonPoDTestCellTest, Tests_NonPoDTestCellTest );
+
+static class TestDescription_suite_NonPoDTestCellTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_NonPoDTestCellTest_testBasic() : CxxTest::RealTestDescription( Tests_NonPoDTestCellTest, suiteDescription_NonPoDTestCellTest, 13, "testBasic" ) {}
+ void runTest() { suite_NonPoDTestCellTest.testBasic(); }
+} testDescription_suite_NonPoDTestCellTest_testBasic;
+
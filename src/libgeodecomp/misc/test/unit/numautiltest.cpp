@@ -0,0 +1,56 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_NUMAUtilTest_init = false;
+#include "/root/repo/src/libgeodecomp/misc/test/unit/numautiltest.h"
+
+static NUMAUtilTest suite_NUMAUtilTest;
+
+static CxxTest::List Tests_NUMAUtilTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_NUMAUtilTest( "/root/repo/src/libgeodecomp/misc/test/unit/numautiltest.h", 11, "NUMAUtilTest", suite_NUMAUtilTest, Tests_NUMAUtilTest );
+
+static class TestDescription_suite_NUMAUtilTest_testCurrentNode : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_NUMAUtilTest_testCurrentNode() : CxxTest::RealTestDescription( Tests_NUMAUtilTest, suiteDescription_NUMAUtilTest, 31, "testCurrentNode" ) {}
+ void runTest() { suite_NUMAUtilTest.testCurrentNode(); }
+} testDescription_suite_NUMAUtilTest_testCurrentNode;
+
+static class TestDescription_suite_NUMAUtilTest_testThreadsPerNode : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_NUMAUtilTest_testThreadsPerNode() : CxxTest::RealTestDescription( Tests_NUMAUtilTest, suiteDescription_NUMAUtilTest, 36, "testThreadsPerNode" ) {}
+ void runTest() { suite_NUMAUtilTest.testThreadsPerNode(); }
+} testDescription_suite_NUMAUtilTest_testThreadsPerNode;
+
+static class TestDescription_suite_NUMAUtilTest_testPagesPerNode : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_NUMAUtilTest_testPagesPerNode() : CxxTest::RealTestDescription( Tests_NUMAUtilTest, suiteDescription_NUMAUtilTest, 48, "testPagesPerNode" ) {}
+ void runTest() { suite_NUMAUtilTest.testPagesPerNode(); }
+} testDescription_suite_NUMAUtilTest_testPagesPerNode;
+
+static class TestDescription_suite_NUMAUtilTest_testMovePages : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_NUMAUtilTest_testMovePages() : CxxTest::RealTestDescription( Tests_NUMAUtilTest, suiteDescription_NUMAUtilTest, 62, "testMovePages" ) {}
+ void runTest() { suite_NUMAUtilTest.testMovePages(); }
+} testDescription_suite_NUMAUtilTest_testMovePages;
+
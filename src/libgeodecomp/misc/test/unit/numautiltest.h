@@ -0,0 +1,87 @@
+#include <libgeodecomp/misc/numautil.h>
+
+#include <cxxtest/TestSuite.h>
+#include <numeric>
+#include <vector>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class NUMAUtilTest : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+#ifdef __linux__
+        pageSize = sysconf(_SC_PAGESIZE);
+#else
+        pageSize = 4096;
+#endif
+        // touch all pages so that they're actually allocated:
+        buffer = std::vector<char>(16 * pageSize + 123, 'a');
+        begin = &buffer[0];
+        end = begin + buffer.size();
+
+        std::size_t first = reinterpret_cast<std::size_t>(begin) / pageSize;
+        std::size_t last = (reinterpret_cast<std::size_t>(end) + pageSize - 1) / pageSize;
+        spannedPages = last - first;
+    }
+
+    void testCurrentNode()
+    {
+        TS_ASSERT_LESS_THAN_EQUALS(-1, NUMAUtil::currentNode());
+    }
+
+    void testThreadsPerNode()
+    {
+        std::vector<std::size_t> threads = NUMAUtil::threadsPerNode();
+        std::size_t sum = std::accumulate(threads.begin(), threads.end(), std::size_t(0));
+
+        if (NUMAUtil::currentNode() < 0) {
+            TS_ASSERT_EQUALS(std::size_t(0), sum);
+        } else {
+            TS_ASSERT_EQUALS(std::size_t(NUMAUtil::numThreads()), sum);
+        }
+    }
+
+    void testPagesPerNode()
+    {
+        std::vector<std::size_t> pages = NUMAUtil::pagesPerNode(begin, end);
+        std::size_t sum = std::accumulate(pages.begin(), pages.end(), std::size_t(0));
+
+        // move_pages(2) may be unavailable (e.g. within containers),
+        // in which case no pages are reported at all:
+        if (sum > 0) {
+            TS_ASSERT_EQUALS(spannedPages, sum);
+        }
+
+        TS_ASSERT(NUMAUtil::pagesPerNode(begin, begin).empty());
+    }
+
+    void testMovePages()
+    {
+        int node = NUMAUtil::currentNode();
+        NUMAUtil::movePages(begin, end, node);
+        // invalid nodes are to be ignored:
+        NUMAUtil::movePages(begin, end, -1);
+
+        TS_ASSERT_EQUALS(std::vector<char>(buffer.size(), 'a'), buffer);
+
+        std::vector<std::size_t> pages = NUMAUtil::pagesPerNode(begin, end);
+        std::size_t sum = std::accumulate(pages.begin(), pages.end(), std::size_t(0));
+        if ((node >= 0) && (sum > 0)) {
+            TS_ASSERT_LESS_THAN(std::size_t(node), pages.size());
+            TS_ASSERT_EQUALS(spannedPages, pages[node]);
+        }
+    }
+
+private:
+    std::size_t pageSize;
+    std::size_t spannedPages;
+    std::vector<char> buffer;
+    char *begin;
+    char *end;
+};
+
+}
@@ -0,0 +1,37 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_QuickPaletteTest_init = false;
+#include "/root/repo/src/libgeodecomp/misc/test/unit/quickpalettetest.h"
+
+static QuickPaletteTest suite_QuickPaletteTest;
+
+static CxxTest::List Tests_QuickPaletteTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_QuickPaletteTest( "/root/repo/src/libgeodecomp/misc/test/unit/quickpalettetest.h", 8, "QuickPaletteTest", suite_QuickPaletteTest, Tests_QuickPaletteTest );
+
+static class TestDescription_suite_QuickPaletteTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_QuickPaletteTest_testBasic() : CxxTest::RealTestDescription( Tests_QuickPaletteTest, suiteDescription_QuickPaletteTest, 11, "testBasic" ) {}
+ void runTest() { suite_QuickPaletteTest.testBasic(); }
+} testDescription_suite_QuickPaletteTest_testBasic;
+
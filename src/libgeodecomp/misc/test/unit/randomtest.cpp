@@ -0,0 +1,56 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_RandomTest_init = false;
+#include "/root/repo/src/libgeodecomp/misc/test/unit/randomtest.h"
+
+static RandomTest suite_RandomTest;
+
+static CxxTest::List Tests_RandomTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RandomTest( "/root/repo/src/libgeodecomp/misc/test/unit/randomtest.h", 10, "RandomTest", suite_RandomTest, Tests_RandomTest );
+
+static class TestDescription_suite_RandomTest_testDouble1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RandomTest_testDouble1() : CxxTest::RealTestDescription( Tests_RandomTest, suiteDescription_RandomTest, 14, "testDouble1" ) {}
+ void runTest() { suite_RandomTest.testDouble1(); }
+} testDescription_suite_RandomTest_testDouble1;
+
+static class TestDescription_suite_RandomTest_testDouble2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RandomTest_testDouble2() : CxxTest::RealTestDescription( Tests_RandomTest, suiteDescription_RandomTest, 25, "testDouble2" ) {}
+ void runTest() { suite_RandomTest.testDouble2(); }
+} testDescription_suite_RandomTest_testDouble2;
+
+static class TestDescription_suite_RandomTest_testUnsigned : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RandomTest_testUnsigned() : CxxTest::RealTestDescription( Tests_RandomTest, suiteDescription_RandomTest, 36, "testUnsigned" ) {}
+ void runTest() { suite_RandomTest.testUnsigned(); }
+} testDescription_suite_RandomTest_testUnsigned;
+
+static class TestDescription_suite_RandomTest_testSeed : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RandomTest_testSeed() : CxxTest::RealTestDescription( Tests_RandomTest, suiteDescription_RandomTest, 50, "testSeed" ) {}
+ void runTest() { suite_RandomTest.testSeed(); }
+} testDescription_suite_RandomTest_testSeed;
+
@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ScopedTimerTest_init = false;
+#include "/root/repo/src/libgeodecomp/misc/test/unit/scopedtimertest.h"
+
+static ScopedTimerTest suite_ScopedTimerTest;
+
+static CxxTest::List Tests_ScopedTimerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ScopedTimerTest( "/root/repo/src/libgeodecomp/misc/test/unit/scopedtimertest.h", 10, "ScopedTimerTest", suite_ScopedTimerTest, Tests_ScopedTimerTest );
+
+static class TestDescription_suite_ScopedTimerTest_testTimeConsecutive : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScopedTimerTest_testTimeConsecutive() : CxxTest::RealTestDescription( Tests_ScopedTimerTest, suiteDescription_ScopedTimerTest, 14, "testTimeConsecutive" ) {}
+ void runTest() { suite_ScopedTimerTest.testTimeConsecutive(); }
+} testDescription_suite_ScopedTimerTest_testTimeConsecutive;
+
+static class TestDescription_suite_ScopedTimerTest_testTimeOverflow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScopedTimerTest_testTimeOverflow() : CxxTest::RealTestDescription( Tests_ScopedTimerTest, suiteDescription_ScopedTimerTest, 21, "testTimeOverflow" ) {}
+ void runTest() { suite_ScopedTimerTest.testTimeOverflow(); }
+} testDescription_suite_ScopedTimerTest_testTimeOverflow;
+
+static class TestDescription_suite_ScopedTimerTest_testBasicUsageAndBusyWait : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScopedTimerTest_testBasicUsageAndBusyWait() : CxxTest::RealTestDescription( Tests_ScopedTimerTest, suiteDescription_ScopedTimerTest, 34, "testBasicUsageAndBusyWait" ) {}
+ void runTest() { suite_ScopedTimerTest.testBasicUsageAndBusyWait(); }
+} testDescription_suite_ScopedTimerTest_testBasicUsageAndBusyWait;
+
@@ -84,9 +84,6 @@ public:
 
     void testCacheBlockingFitness()
     {
-        // fixme
-        return;
-
 #ifdef LIBGEODECOMP_WITH_THREADS
 #ifdef LIBGEODECOMP_WITH_CPP14
         for (int i = 1; i <= 2; ++i) {
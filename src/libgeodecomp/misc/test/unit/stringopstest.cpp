@@ -0,0 +1,68 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_StringOpsTest_init = false;
+#include "/root/repo/src/libgeodecomp/misc/test/unit/stringopstest.h"
+
+static StringOpsTest suite_StringOpsTest;
+
+static CxxTest::List Tests_StringOpsTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_StringOpsTest( "/root/repo/src/libgeodecomp/misc/test/unit/stringopstest.h", 9, "StringOpsTest", suite_StringOpsTest, Tests_StringOpsTest );
+
+static class TestDescription_suite_StringOpsTest_testItoa : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringOpsTest_testItoa() : CxxTest::RealTestDescription( Tests_StringOpsTest, suiteDescription_StringOpsTest, 13, "testItoa" ) {}
+ void runTest() { suite_StringOpsTest.testItoa(); }
+} testDescription_suite_StringOpsTest_testItoa;
+
+static class TestDescription_suite_StringOpsTest_testAtoi : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringOpsTest_testAtoi() : CxxTest::RealTestDescription( Tests_StringOpsTest, suiteDescription_StringOpsTest, 20, "testAtoi" ) {}
+ void runTest() { suite_StringOpsTest.testAtoi(); }
+} testDescription_suite_StringOpsTest_testAtoi;
+
+static class TestDescription_suite_StringOpsTest_testAtof : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringOpsTest_testAtof() : CxxTest::RealTestDescription( Tests_StringOpsTest, suiteDescription_StringOpsTest, 27, "testAtof" ) {}
+ void runTest() { suite_StringOpsTest.testAtof(); }
+} testDescription_suite_StringOpsTest_testAtof;
+
+static class TestDescription_suite_StringOpsTest_testTokenize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringOpsTest_testTokenize() : CxxTest::RealTestDescription( Tests_StringOpsTest, suiteDescription_StringOpsTest, 37, "testTokenize" ) {}
+ void runTest() { suite_StringOpsTest.testTokenize(); }
+} testDescription_suite_StringOpsTest_testTokenize;
+
+static class TestDescription_suite_StringOpsTest_testTokenize2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringOpsTest_testTokenize2() : CxxTest::RealTestDescription( Tests_StringOpsTest, suiteDescription_StringOpsTest, 62, "testTokenize2" ) {}
+ void runTest() { suite_StringOpsTest.testTokenize2(); }
+} testDescription_suite_StringOpsTest_testTokenize2;
+
+static class TestDescription_suite_StringOpsTest_testJoin : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StringOpsTest_testJoin() : CxxTest::RealTestDescription( Tests_StringOpsTest, suiteDescription_StringOpsTest, 74, "testJoin" ) {}
+ void runTest() { suite_StringOpsTest.testJoin(); }
+} testDescription_suite_StringOpsTest_testJoin;
+
@@ -0,0 +1,44 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_TempFileTest_init = false;
+#include "/root/repo/src/libgeodecomp/misc/test/unit/tempfiletest.h"
+
+static TempFileTest suite_TempFileTest;
+
+static CxxTest::List Tests_TempFileTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TempFileTest( "/root/repo/src/libgeodecomp/misc/test/unit/tempfiletest.h", 9, "TempFileTest", suite_TempFileTest, Tests_TempFileTest );
+
+static class TestDescription_suite_TempFileTest_testUniqueName : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TempFileTest_testUniqueName() : CxxTest::RealTestDescription( Tests_TempFileTest, suiteDescription_TempFileTest, 20, "testUniqueName" ) {}
+ void runTest() { suite_TempFileTest.testUniqueName(); }
+} testDescription_suite_TempFileTest_testUniqueName;
+
+static class TestDescription_suite_TempFileTest_testGeneratesSuitableNameForOpeningFileAndWriting : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TempFileTest_testGeneratesSuitableNameForOpeningFileAndWriting() : CxxTest::RealTestDescription( Tests_TempFileTest, suiteDescription_TempFileTest, 27, "testGeneratesSuitableNameForOpeningFileAndWriting" ) {}
+ void runTest() { suite_TempFileTest.testGeneratesSuitableNameForOpeningFileAndWriting(); }
+} testDescription_suite_TempFileTest_testGeneratesSuitableNameForOpeningFileAndWriting;
+
@@ -0,0 +1,44 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_TestHelperTest_init = false;
+#include "/root/repo/src/libgeodecomp/misc/test/unit/testhelpertest.h"
+
+static TestHelperTest suite_TestHelperTest;
+
+static CxxTest::List Tests_TestHelperTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TestHelperTest( "/root/repo/src/libgeodecomp/misc/test/unit/testhelpertest.h", 7, "TestHelperTest", suite_TestHelperTest, Tests_TestHelperTest );
+
+static class TestDescription_suite_TestHelperTest_testAssertFile : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestHelperTest_testAssertFile() : CxxTest::RealTestDescription( Tests_TestHelperTest, suiteDescription_TestHelperTest, 21, "testAssertFile" ) {}
+ void runTest() { suite_TestHelperTest.testAssertFile(); }
+} testDescription_suite_TestHelperTest_testAssertFile;
+
+static class TestDescription_suite_TestHelperTest_testAssertFileContentsEqual : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TestHelperTest_testAssertFileContentsEqual() : CxxTest::RealTestDescription( Tests_TestHelperTest, suiteDescription_TestHelperTest, 27, "testAssertFileContentsEqual" ) {}
+ void runTest() { suite_TestHelperTest.testAssertFileContentsEqual(); }
+} testDescription_suite_TestHelperTest_testAssertFileContentsEqual;
+
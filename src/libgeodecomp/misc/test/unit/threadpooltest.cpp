@@ -0,0 +1,63 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ThreadPoolTest_init = false;
+#include "/root/repo/src/libgeodecomp/misc/test/unit/threadpooltest.h"
+
+static ThreadPoolTest suite_ThreadPoolTest;
+
+static CxxTest::List Tests_ThreadPoolTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ThreadPoolTest( "/root/repo/src/libgeodecomp/misc/test/unit/threadpooltest.h", 11, "ThreadPoolTest", suite_ThreadPoolTest, Tests_ThreadPoolTest );
+
+static class TestDescription_suite_ThreadPoolTest_testRunsAllTasks : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThreadPoolTest_testRunsAllTasks() : CxxTest::RealTestDescription( Tests_ThreadPoolTest, suiteDescription_ThreadPoolTest, 14, "testRunsAllTasks" ) {}
+ void runTest() { suite_ThreadPoolTest.testRunsAllTasks(); }
+} testDescription_suite_ThreadPoolTest_testRunsAllTasks;
+
+static class TestDescription_suite_ThreadPoolTest_testNestedSubmission : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThreadPoolTest_testNestedSubmission() : CxxTest::RealTestDescription( Tests_ThreadPoolTest, suiteDescription_ThreadPoolTest, 30, "testNestedSubmission" ) {}
+ void runTest() { suite_ThreadPoolTest.testNestedSubmission(); }
+} testDescription_suite_ThreadPoolTest_testNestedSubmission;
+
+static class TestDescription_suite_ThreadPoolTest_testExceptionsArePropagated : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThreadPoolTest_testExceptionsArePropagated() : CxxTest::RealTestDescription( Tests_ThreadPoolTest, suiteDescription_ThreadPoolTest, 52, "testExceptionsArePropagated" ) {}
+ void runTest() { suite_ThreadPoolTest.testExceptionsArePropagated(); }
+} testDescription_suite_ThreadPoolTest_testExceptionsArePropagated;
+
+static class TestDescription_suite_ThreadPoolTest_testFailed : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThreadPoolTest_testFailed() : CxxTest::RealTestDescription( Tests_ThreadPoolTest, suiteDescription_ThreadPoolTest, 71, "testFailed" ) {}
+ void runTest() { suite_ThreadPoolTest.testFailed(); }
+} testDescription_suite_ThreadPoolTest_testFailed;
+
+static class TestDescription_suite_ThreadPoolTest_testDestructorCompletesTasks : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ThreadPoolTest_testDestructorCompletesTasks() : CxxTest::RealTestDescription( Tests_ThreadPoolTest, suiteDescription_ThreadPoolTest, 87, "testDestructorCompletesTasks" ) {}
+ void runTest() { suite_ThreadPoolTest.testDestructorCompletesTasks(); }
+} testDescription_suite_ThreadPoolTest_testDestructorCompletesTasks;
+
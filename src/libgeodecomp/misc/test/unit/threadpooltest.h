@@ -0,0 +1,103 @@
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/misc/threadpool.h>
+
+#include <cxxtest/TestSuite.h>
+#include <stdexcept>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class ThreadPoolTest : public CxxTest::TestSuite
+{
+public:
+    void testRunsAllTasks()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        ThreadPool pool(4);
+        TS_ASSERT_EQUALS(std::size_t(4), pool.size());
+
+        std::atomic<int> counter(0);
+        for (int i = 0; i < 1000; ++i) {
+            pool.submit([&counter]{ ++counter; });
+        }
+        pool.wait();
+
+        TS_ASSERT_EQUALS(1000, counter.load());
+#endif
+    }
+
+    void testNestedSubmission()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        ThreadPool pool(3);
+        std::atomic<int> counter(0);
+
+        // each task spawns two children, down to a depth of 10, so
+        // wait() has to cover tasks submitted by other tasks:
+        std::function<void(int)> spawn = [&](int depth) {
+            ++counter;
+            if (depth < 10) {
+                pool.submit([&spawn, depth]{ spawn(depth + 1); });
+                pool.submit([&spawn, depth]{ spawn(depth + 1); });
+            }
+        };
+        pool.submit([&spawn]{ spawn(0); });
+        pool.wait();
+
+        TS_ASSERT_EQUALS((1 << 11) - 1, counter.load());
+#endif
+    }
+
+    void testExceptionsArePropagated()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        ThreadPool pool(2);
+        std::atomic<int> counter(0);
+
+        pool.submit([]{ throw std::runtime_error("boom"); });
+        for (int i = 0; i < 10; ++i) {
+            pool.submit([&counter]{ ++counter; });
+        }
+        TS_ASSERT_THROWS(pool.wait(), std::runtime_error&);
+        TS_ASSERT_EQUALS(10, counter.load());
+        TS_ASSERT(!pool.failed());
+
+        // the error is reported only once:
+        pool.wait();
+#endif
+    }
+
+    void testFailed()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        ThreadPool pool(2);
+        TS_ASSERT(!pool.failed());
+
+        pool.submit([]{ throw std::runtime_error("boom"); });
+        while (!pool.failed()) {
+            std::this_thread::yield();
+        }
+
+        TS_ASSERT_THROWS(pool.wait(), std::runtime_error&);
+        TS_ASSERT(!pool.failed());
+#endif
+    }
+
+    void testDestructorCompletesTasks()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        std::atomic<int> counter(0);
+        {
+            ThreadPool pool(2);
+            for (int i = 0; i < 100; ++i) {
+                pool.submit([&counter]{ ++counter; });
+            }
+        }
+
+        TS_ASSERT_EQUALS(100, counter.load());
+#endif
+    }
+};
+
+}
@@ -0,0 +1,91 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_UnstructuredTestCellTest_init = false;
+#include "/root/repo/src/libgeodecomp/misc/test/unit/unstructuredtestcelltest.h"
+
+static UnstructuredTestCellTest suite_UnstructuredTestCellTest;
+
+static CxxTest::List Tests_UnstructuredTestCellTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_UnstructuredTestCellTest( "/root/repo/src/libgeodecomp/misc/test/unit/unstructuredtestcelltest.h", 15, "UnstructuredTestCellTest", suite_UnstructuredTestCellTest, Tests_UnstructuredTestCellTest );
+
+static class TestDescription_suite_UnstructuredTestCellTest_testBasicUpdates : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredTestCellTest_testBasicUpdates() : CxxTest::RealTestDescription( Tests_UnstructuredTestCellTest, suiteDescription_UnstructuredTestCellTest, 38, "testBasicUpdates" ) {}
+ void runTest() { suite_UnstructuredTestCellTest.testBasicUpdates(); }
+} testDescription_suite_UnstructuredTestCellTest_testBasicUpdates;
+
+static class TestDescription_suite_UnstructuredTestCellTest_testWeightsChecking : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredTestCellTest_testWeightsChecking() : CxxTest::RealTestDescription( Tests_UnstructuredTestCellTest, suiteDescription_UnstructuredTestCellTest, 54, "testWeightsChecking" ) {}
+ void runTest() { suite_UnstructuredTestCellTest.testWeightsChecking(); }
+} testDescription_suite_UnstructuredTestCellTest_testWeightsChecking;
+
+static class TestDescription_suite_UnstructuredTestCellTest_testNanoStepChecking : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredTestCellTest_testNanoStepChecking() : CxxTest::RealTestDescription( Tests_UnstructuredTestCellTest, suiteDescription_UnstructuredTestCellTest, 77, "testNanoStepChecking" ) {}
+ void runTest() { suite_UnstructuredTestCellTest.testNanoStepChecking(); }
+} testDescription_suite_UnstructuredTestCellTest_testNanoStepChecking;
+
+static class TestDescription_suite_UnstructuredTestCellTest_testIDChecking : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredTestCellTest_testIDChecking() : CxxTest::RealTestDescription( Tests_UnstructuredTestCellTest, suiteDescription_UnstructuredTestCellTest, 100, "testIDChecking" ) {}
+ void runTest() { suite_UnstructuredTestCellTest.testIDChecking(); }
+} testDescription_suite_UnstructuredTestCellTest_testIDChecking;
+
+static class TestDescription_suite_UnstructuredTestCellTest_testValidityChecking : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredTestCellTest_testValidityChecking() : CxxTest::RealTestDescription( Tests_UnstructuredTestCellTest, suiteDescription_UnstructuredTestCellTest, 123, "testValidityChecking" ) {}
+ void runTest() { suite_UnstructuredTestCellTest.testValidityChecking(); }
+} testDescription_suite_UnstructuredTestCellTest_testValidityChecking;
+
+static class TestDescription_suite_UnstructuredTestCellTest_testOperatorEquals : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredTestCellTest_testOperatorEquals() : CxxTest::RealTestDescription( Tests_UnstructuredTestCellTest, suiteDescription_UnstructuredTestCellTest, 146, "testOperatorEquals" ) {}
+ void runTest() { suite_UnstructuredTestCellTest.testOperatorEquals(); }
+} testDescription_suite_UnstructuredTestCellTest_testOperatorEquals;
+
+static class TestDescription_suite_UnstructuredTestCellTest_testSoAVariant1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredTestCellTest_testSoAVariant1() : CxxTest::RealTestDescription( Tests_UnstructuredTestCellTest, suiteDescription_UnstructuredTestCellTest, 174, "testSoAVariant1" ) {}
+ void runTest() { suite_UnstructuredTestCellTest.testSoAVariant1(); }
+} testDescription_suite_UnstructuredTestCellTest_testSoAVariant1;
+
+static class TestDescription_suite_UnstructuredTestCellTest_testSoAVariant2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredTestCellTest_testSoAVariant2() : CxxTest::RealTestDescription( Tests_UnstructuredTestCellTest, suiteDescription_UnstructuredTestCellTest, 203, "testSoAVariant2" ) {}
+ void runTest() { suite_UnstructuredTestCellTest.testSoAVariant2(); }
+} testDescription_suite_UnstructuredTestCellTest_testSoAVariant2;
+
+static class TestDescription_suite_UnstructuredTestCellTest_testSoAVariant3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredTestCellTest_testSoAVariant3() : CxxTest::RealTestDescription( Tests_UnstructuredTestCellTest, suiteDescription_UnstructuredTestCellTest, 232, "testSoAVariant3" ) {}
+ void runTest() { suite_UnstructuredTestCellTest.testSoAVariant3(); }
+} testDescription_suite_UnstructuredTestCellTest_testSoAVariant3;
+
+static class TestDescription_suite_UnstructuredTestCellTest_testSoAVariant4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredTestCellTest_testSoAVariant4() : CxxTest::RealTestDescription( Tests_UnstructuredTestCellTest, suiteDescription_UnstructuredTestCellTest, 263, "testSoAVariant4" ) {}
+ void runTest() { suite_UnstructuredTestCellTest.testSoAVariant4(); }
+} testDescription_suite_UnstructuredTestCellTest_testSoAVariant4;
+
@@ -0,0 +1,244 @@
+#ifndef LIBGEODECOMP_MISC_THREADPOOL_H
+#define LIBGEODECOMP_MISC_THREADPOOL_H
+
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_CPP14
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * A plain C++ work-stealing thread pool. Each worker owns a task
+ * queue. Tasks submitted from within a worker go to its own queue
+ * and are processed LIFO (the data they touch is likely still in
+ * cache), idle workers steal the oldest tasks from other queues.
+ * Tasks submitted from outside of the pool are distributed round
+ * robin.
+ */
+class ThreadPool
+{
+public:
+    typedef std::function<void()> Task;
+
+    /**
+     * Spawns numThreads workers, or one per hardware thread if
+     * numThreads is 0.
+     */
+    explicit ThreadPool(std::size_t numThreads = 0) :
+        outstandingTasks(0),
+        queuedTasks(0),
+        nextQueue(0),
+        shutdown(false)
+    {
+        if (numThreads == 0) {
+            numThreads = (std::max)(1u, std::thread::hardware_concurrency());
+        }
+
+        for (std::size_t i = 0; i < numThreads; ++i) {
+            queues.push_back(std::unique_ptr<Queue>(new Queue));
+        }
+        for (std::size_t i = 0; i < numThreads; ++i) {
+            threads.push_back(std::thread(&ThreadPool::work, this, i));
+        }
+    }
+
+    /**
+     * Completes all outstanding tasks before joining the workers.
+     */
+    ~ThreadPool()
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            allDone.wait(lock, [this]{ return outstandingTasks == 0; });
+            shutdown = true;
+        }
+        workAvailable.notify_all();
+
+        for (std::size_t i = 0; i < threads.size(); ++i) {
+            threads[i].join();
+        }
+    }
+
+    void submit(const Task& task)
+    {
+        ++outstandingTasks;
+
+        std::size_t index = currentWorker().pool == this ?
+            currentWorker().index :
+            (nextQueue++ % queues.size());
+        {
+            std::lock_guard<std::mutex> lock(queues[index]->mutex);
+            queues[index]->tasks.push_back(task);
+        }
+        ++queuedTasks;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+        }
+        workAvailable.notify_one();
+    }
+
+    /**
+     * Blocks until all submitted tasks, including those which they
+     * submitted in turn, have completed. Rethrows the first
+     * exception raised by a task since the last call.
+     */
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        allDone.wait(lock, [this]{ return outstandingTasks == 0; });
+
+        if (error) {
+            std::exception_ptr e = error;
+            error = std::exception_ptr();
+            std::rethrow_exception(e);
+        }
+    }
+
+    /**
+     * Returns true if a task has raised an exception which wait()
+     * hasn't rethrown yet. Allows threads which poll for other
+     * events while tasks are running to bail out early.
+     */
+    bool failed()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return bool(error);
+    }
+
+    std::size_t size() const
+    {
+        return threads.size();
+    }
+
+private:
+    /**
+     * A worker's task queue.
+     */
+    class Queue
+    {
+    public:
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    /**
+     * Identifies the pool and queue a worker thread belongs to.
+     */
+    class WorkerID
+    {
+    public:
+        WorkerID() :
+            pool(0),
+            index(0)
+        {}
+
+        const ThreadPool *pool;
+        std::size_t index;
+    };
+
+    std::vector<std::unique_ptr<Queue> > queues;
+    std::vector<std::thread> threads;
+    std::atomic<std::size_t> outstandingTasks;
+    std::atomic<std::size_t> queuedTasks;
+    std::atomic<std::size_t> nextQueue;
+    bool shutdown;
+    std::exception_ptr error;
+    std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable allDone;
+
+    ThreadPool(const ThreadPool&);
+    ThreadPool& operator=(const ThreadPool&);
+
+    static WorkerID& currentWorker()
+    {
+        static thread_local WorkerID id;
+        return id;
+    }
+
+    void work(std::size_t index)
+    {
+        currentWorker().pool = this;
+        currentWorker().index = index;
+
+        for (;;) {
+            Task task;
+            if (popOwn(index, &task) || steal(index, &task)) {
+                run(task);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(mutex);
+            workAvailable.wait(lock, [this]{ return shutdown || (queuedTasks > 0); });
+            if (shutdown && (queuedTasks == 0)) {
+                return;
+            }
+        }
+    }
+
+    void run(const Task& task)
+    {
+        try {
+            task();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+
+        if (--outstandingTasks == 0) {
+            std::lock_guard<std::mutex> lock(mutex);
+            allDone.notify_all();
+        }
+    }
+
+    bool popOwn(std::size_t index, Task *task)
+    {
+        Queue& queue = *queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            return false;
+        }
+
+        *task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        --queuedTasks;
+        return true;
+    }
+
+    bool steal(std::size_t index, Task *task)
+    {
+        for (std::size_t i = 1; i < queues.size(); ++i) {
+            Queue& queue = *queues[(index + i) % queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty()) {
+                continue;
+            }
+
+            *task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            --queuedTasks;
+            return true;
+        }
+
+        return false;
+    }
+};
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,21 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}hpxsimulator.cpp
+  ${RELATIVE_PATH}mocksimulator.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}autotuningsimulator.h
+  ${RELATIVE_PATH}cacheblockingsimulator.h
+  ${RELATIVE_PATH}cudasimulator.h
+  ${RELATIVE_PATH}dataflowsimulator.h
+  ${RELATIVE_PATH}distributedsimulator.h
+  ${RELATIVE_PATH}hierarchicalsimulator.h
+  ${RELATIVE_PATH}hiparsimulator.h
+  ${RELATIVE_PATH}hpxdataflowsimulator.h
+  ${RELATIVE_PATH}hpxsimulator.h
+  ${RELATIVE_PATH}mocksimulator.h
+  ${RELATIVE_PATH}monolithicsimulator.h
+  ${RELATIVE_PATH}openmpsimulator.h
+  ${RELATIVE_PATH}serialsimulator.h
+  ${RELATIVE_PATH}simulator.h
+  ${RELATIVE_PATH}stripingsimulator.h
+)
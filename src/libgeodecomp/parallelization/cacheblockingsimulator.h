@@ -12,10 +12,61 @@
 
 namespace LibGeoDecomp {
 
+namespace CacheBlockingSimulatorHelpers {
+
+/**
+ * The intermediate buffers of the pipeline only hold a few layers of
+ * the grid along the last axis, which are used as a ring buffer.
+ * Hence the buffers' topology wraps the last axis. All other axes
+ * behave like the model's topology.
+ */
+template<typename TOPOLOGY, int DIM = TOPOLOGY::DIM>
+class BufferTopology;
+
+/**
+ * see above
+ */
+template<typename TOPOLOGY>
+class BufferTopology<TOPOLOGY, 2>
+{
+public:
+    typedef TopologiesHelpers::Topology<2, TOPOLOGY::template WrapsAxis<0>::VALUE, true, false> Value;
+};
+
+/**
+ * see above
+ */
+template<typename TOPOLOGY>
+class BufferTopology<TOPOLOGY, 3>
+{
+public:
+    typedef TopologiesHelpers::Topology<
+        3,
+        TOPOLOGY::template WrapsAxis<0>::VALUE,
+        TOPOLOGY::template WrapsAxis<1>::VALUE,
+        true> Value;
+};
+
+}
+
 /**
- * CacheBlockingSimulator is an experimental simulator to explore the
- * infrastructure required to implement a pipelined wavefront update
- * algorith and which benefits is may provide.
+ * CacheBlockingSimulator implements temporal blocking via pipelined
+ * wavefronts for 2D and 3D models: the grid is cut into tiles (of
+ * size wavefrontDim) orthogonal to the last axis. Each thread sweeps
+ * a tile along the last axis and applies up to pipelineLength nano
+ * steps while the corresponding layers are still in cache. The
+ * intermediate time steps are stored in small per-thread ring
+ * buffers, which hold 2 * RADIUS + 1 layers each.
+ *
+ * To avoid synchronization between tiles, each pipeline stage
+ * updates its tile plus a halo which shrinks by the stencil's radius
+ * with each stage (overlapped tiling). This redundant computation is
+ * the price for reading and writing the full grids only once per
+ * pipelineLength nano steps, which pays off for bandwidth-bound
+ * stencil codes.
+ *
+ * Writers and Steerers are notified at their configured periods; the
+ * pipeline is shortened as needed to stop at these time steps.
  */
 template<typename CELL>
 class CacheBlockingSimulator : public MonolithicSimulator<CELL>
@@ -24,11 +75,14 @@ public:
     friend class CacheBlockingSimulatorTest;
 
     typedef typename APITraits::SelectTopology<CELL>::Value Topology;
-    typedef typename TopologiesHelpers::Topology<3, Topology::template WrapsAxis<0>::VALUE, Topology::template WrapsAxis<1>::VALUE, true> BufferTopology;
+    typedef typename APITraits::SelectStencil<CELL>::Value Stencil;
+    typedef typename CacheBlockingSimulatorHelpers::BufferTopology<Topology>::Value BufferTopology;
+    typedef typename MonolithicSimulator<CELL>::GridType GridBaseType;
     typedef Grid<CELL, Topology> GridType;
     typedef DisplacedGrid<CELL, BufferTopology> BufferType;
-    typedef std::vector<std::vector<Region<3> > > WavefrontFrames;
+    typedef typename Steerer<CELL>::SteererFeedback SteererFeedback;
     static const int DIM = Topology::DIM;
+    static const int RADIUS = Stencil::RADIUS;
 
     using MonolithicSimulator<CELL>::NANO_STEPS;
     using MonolithicSimulator<CELL>::chronometer;
@@ -40,28 +94,36 @@ public:
         MonolithicSimulator<CELL>(initializer),
         buffers(omp_get_max_threads()),
         pipelineLength(pipelineLength),
-        wavefrontDim(wavefrontDim)
+        wavefrontDim(wavefrontDim),
+        nanoStep(0)
     {
+        if (pipelineLength < 1) {
+            throw std::invalid_argument("pipelineLength needs to be positive");
+        }
+        for (int i = 0; i < (DIM - 1); ++i) {
+            if (wavefrontDim[i] < 1) {
+                throw std::invalid_argument("wavefrontDim needs to be positive");
+            }
+        }
+
+        stepNum = initializer->startStep();
         Coord<DIM> dim = initializer->gridBox().dimensions;
+        simArea << CoordBox<DIM>(Coord<DIM>(), dim);
         curGrid = new GridType(dim);
         newGrid = new GridType(dim);
         initializer->grid(curGrid);
         initializer->grid(newGrid);
 
-        Coord<DIM> bufferDim;
-
-        for (int i = 0; i < DIM - 1; ++i) {
-            bufferDim[i] = wavefrontDim[i] + 2 * pipelineLength - 2;
-        }
-        bufferDim[DIM - 1] = pipelineLength * 4 - 4;
-
+        CoordBox<DIM> bufferBox = stageBox(CoordBox<DIM>(Coord<DIM>(), dim), pipelineLength - 1);
+        bufferBox.dimensions[DIM - 1] = 2 * RADIUS + 1;
         for (std::size_t i = 0; i < buffers.size(); ++i) {
-            buffers[i] = BufferType(CoordBox<DIM>(Coord<DIM>(), bufferDim), curGrid->getEdgeCell(), curGrid->getEdgeCell());
+            buffers[i] = std::vector<BufferType>(
+                pipelineLength - 1,
+                BufferType(bufferBox, curGrid->getEdge(), curGrid->getEdge()));
         }
-        LOG(DBG, "created " << buffers.size() << " buffers");
+        LOG(Logger::DBG, "created " << buffers.size() << " sets of buffers");
 
-        generateFrames();
-        nanoStep = 0;
+        generateTiles();
     }
 
     virtual ~CacheBlockingSimulator()
@@ -70,38 +132,58 @@ public:
         delete curGrid;
     }
 
+    /**
+     * performs a single simulation step.
+     */
     virtual void step()
     {
-        // fixme
+        SteererFeedback feedback;
+        step(&feedback);
+    }
+
+    virtual void step(SteererFeedback *feedback)
+    {
+        TimeTotal t(&chronometer);
+
+        handleInput(STEERER_NEXT_STEP, feedback);
+        update(1);
+        ++stepNum;
+        handleOutput(currentWriterEvent());
     }
 
+    /**
+     * continue simulating until the maximum number of steps is
+     * reached. Time steps without any IO are merged so that the
+     * pipeline can be filled.
+     */
     virtual void run()
     {
         initializer->grid(curGrid);
         stepNum = initializer->startStep();
         nanoStep = 0;
+        setIORegions();
 
-        for(unsigned i = 0; i < writers.size(); ++i) {
-            writers[i]->stepFinished(
-                *getGrid(),
-                getStep(),
-                WRITER_INITIALIZED);
-        }
+        SteererFeedback feedback;
+        handleInput(STEERER_INITIALIZED, &feedback);
+        handleOutput(WRITER_INITIALIZED);
 
-        for (stepNum = initializer->startStep();
-             stepNum < initializer->maxSteps();) {
-            hop();
-        }
+        for (; stepNum < initializer->maxSteps();) {
+            if (feedback.simulationEnded()) {
+                break;
+            }
 
-        for(unsigned i = 0; i < writers.size(); ++i) {
-            writers[i]->stepFinished(
-                *getGrid(),
-                getStep(),
-                WRITER_ALL_DONE);
+            TimeTotal t(&chronometer);
+            handleInput(STEERER_NEXT_STEP, &feedback);
+            unsigned nextStep = nextIOStep();
+            update(nextStep - stepNum);
+            stepNum = nextStep;
+            handleOutput(currentWriterEvent());
         }
+
+        handleInput(STEERER_ALL_DONE, &feedback);
     }
 
-    virtual const GridType *getGrid()
+    virtual const GridBaseType *getGrid()
     {
         return curGrid;
     }
@@ -112,225 +194,298 @@ private:
     using MonolithicSimulator<CELL>::stepNum;
     using MonolithicSimulator<CELL>::writers;
     using MonolithicSimulator<CELL>::getStep;
+    using MonolithicSimulator<CELL>::gridDim;
 
     GridType *curGrid;
     GridType *newGrid;
-    std::vector<BufferType> buffers;
+    Region<DIM> simArea;
+    std::vector<std::vector<BufferType> > buffers;
     int pipelineLength;
     Coord<DIM - 1> wavefrontDim;
-    Grid<WavefrontFrames> frames;
+    std::vector<CoordBox<DIM> > tiles;
     unsigned nanoStep;
 
-    void generateFrames()
+    /**
+     * Cuts the grid into tiles along all axes but the last one. Axes
+     * which wrap around aren't tiled as the halos of the tiles would
+     * need to wrap around, too.
+     */
+    void generateTiles()
     {
-        Coord<DIM> gridDim = initializer->gridBox().dimensions;
+        Coord<DIM> dim = curGrid->getDimensions();
+        Coord<DIM> tileDim = dim;
+        Coord<DIM> numTiles = Coord<DIM>::diagonal(1);
 
-        Coord<DIM - 1> framesDim;
-        for (int i = 0; i < (DIM - 1); ++i) {
-            framesDim[i] = gridDim[i] / wavefrontDim[i];
-            if ((gridDim[i] % wavefrontDim[i]) != 0) {
-                framesDim[i] += 1;
+        for (int d = 0; d < (DIM - 1); ++d) {
+            if (!Topology::wrapsAxis(d)) {
+                tileDim[d] = wavefrontDim[d];
+                numTiles[d] = (dim[d] + tileDim[d] - 1) / tileDim[d];
             }
         }
-        frames.resize(framesDim);
 
-        for (int y = 0; y < framesDim.y(); ++y) {
-            for (int x = 0; x < framesDim.x(); ++x) {
-                frames[Coord<2>(x, y)] = generateWavefrontFrames(
-                    Coord<3>(x * wavefrontDim.x(),
-                             y * wavefrontDim.y(),
-                             0));
+        tiles.clear();
+        CoordBox<DIM> tileIndices(Coord<DIM>(), numTiles);
+        for (typename CoordBox<DIM>::Iterator i = tileIndices.begin(); i != tileIndices.end(); ++i) {
+            Coord<DIM> origin = i->scale(tileDim);
+            Coord<DIM> tileEnd = (origin + tileDim).min(dim);
+            tiles << CoordBox<DIM>(origin, tileEnd - origin);
+        }
+    }
+
+    /**
+     * Returns the box (orthogonal to the last axis) which a pipeline
+     * stage needs to update so that the following stages can
+     * complete their updates of the tile.
+     */
+    CoordBox<DIM> stageBox(const CoordBox<DIM>& tile, int stagesToGo) const
+    {
+        Coord<DIM> dim = curGrid->getDimensions();
+        CoordBox<DIM> ret = tile;
+        int halo = RADIUS * stagesToGo;
 
+        for (int d = 0; d < (DIM - 1); ++d) {
+            if (Topology::wrapsAxis(d)) {
+                ret.origin[d] = 0;
+                ret.dimensions[d] = dim[d];
+                continue;
             }
+
+            int start = (std::max)(0, tile.origin[d] - halo);
+            int end = (std::min)(dim[d], tile.origin[d] + tile.dimensions[d] + halo);
+            ret.origin[d] = start;
+            ret.dimensions[d] = end - start;
         }
+
+        return ret;
     }
 
-    WavefrontFrames generateWavefrontFrames(const Coord<DIM> offset)
+    /**
+     * Returns the next time step at which Writers or Steerers need to
+     * be notified (or the end of the simulation).
+     */
+    unsigned nextIOStep() const
     {
-        Coord<DIM> gridDim = initializer->gridBox().dimensions;
-        Coord<DIM> wavefrontRegionDim;
-        for (int i = 0; i < (DIM - 1); ++i) {
-            wavefrontRegionDim[i] = wavefrontDim[i];
+        unsigned ret = initializer->maxSteps();
+
+        for (std::size_t i = 0; i < writers.size(); ++i) {
+            unsigned period = writers[i]->getPeriod();
+            ret = (std::min)(ret, (stepNum / period + 1) * period);
         }
-        wavefrontRegionDim[DIM - 1] = gridDim[DIM - 1] - offset[DIM - 1];
-        Region<DIM> region;
-        region << CoordBox<DIM>(offset, wavefrontRegionDim);
-        std::vector<Region<3> > regions(pipelineLength);
-        regions[pipelineLength - 1] = region.expandWithTopology(
-            0, gridDim, Topologies::Cube<3>::Topology());
-
-        for (int i = pipelineLength - 2; i >= 0; --i) {
-            regions[i] = regions[i + 1].expandWithTopology(
-                1, gridDim, Topologies::Cube<3>::Topology());
+
+        for (std::size_t i = 0; i < steerers.size(); ++i) {
+            unsigned period = steerers[i]->getPeriod();
+            ret = (std::min)(ret, (stepNum / period + 1) * period);
         }
 
-        int wavefrontLength = gridDim[DIM - 1] + 1;
-        WavefrontFrames ret(wavefrontLength, std::vector<Region<DIM> >(pipelineLength));
+        return ret;
+    }
+
+    WriterEvent currentWriterEvent() const
+    {
+        return (stepNum == initializer->maxSteps()) ? WRITER_ALL_DONE : WRITER_STEP_FINISHED;
+    }
 
-        for (int index = 0; index < wavefrontLength; ++index) {
-            Coord<DIM> maskOrigin;
-            maskOrigin[DIM - 1] = index;
-            Topology::normalize(maskOrigin, initializer->gridDimensions());
-            Coord<DIM> maskDim = gridDim;
-            maskDim[DIM - 1] = 1;
+    /**
+     * advances the grid by the given number of time steps.
+     */
+    void update(unsigned steps)
+    {
+        unsigned remainingNanoSteps = steps * NANO_STEPS;
 
-            Region<DIM> mask;
-            mask << CoordBox<DIM>(maskOrigin, maskDim);
-            for (int i = 0; i < pipelineLength; ++i) {
-                ret[index][i] = regions[i] & mask;
-            }
+        while (remainingNanoSteps > 0) {
+            unsigned stages = (std::min)(remainingNanoSteps, unsigned(pipelineLength));
+            hop(stages);
+            remainingNanoSteps -= stages;
         }
-
-        return ret;
     }
 
-    void hop()
+    /**
+     * updates the whole grid by the given number of nano steps.
+     */
+    void hop(unsigned stages)
     {
         using std::swap;
-        TimeTotal t(&chronometer);
+        TimeCompute t(&chronometer);
 
-        CoordBox<DIM - 1> frameBox = frames.boundingBox();
-        // for (typename CoordBox<DIM -1>::Iterator waveIter = frameBox.begin();
-        //      waveIter != frameBox.end();
-        //      ++waveIter) {
-        //     updateWavefront(*waveIter);
-        // }
-
-#pragma omp parallel for
-        for (int y = 0; y < frameBox.dimensions.y(); ++y) {
-            for (int x = 0; x < frameBox.dimensions.x(); ++x) {
-                updateWavefront(&buffers[omp_get_thread_num()], Coord<2>(x, y));
-            }
+#pragma omp parallel for schedule(dynamic)
+        for (int i = 0; i < int(tiles.size()); ++i) {
+            updateTile(&buffers[omp_get_thread_num()], tiles[i], stages);
         }
 
         swap(curGrid, newGrid);
-        int curNanoStep = nanoStep + pipelineLength;
-        stepNum += curNanoStep / NANO_STEPS;
-        nanoStep = curNanoStep % NANO_STEPS;
+        nanoStep = (nanoStep + stages) % NANO_STEPS;
     }
 
-    void updateWavefront(BufferType *buffer, const Coord<DIM - 1>& wavefrontCoord)
+    /**
+     * Sweeps the tile along the last axis. Stage s lags RADIUS layers
+     * behind stage s - 1 so that all layers it depends on are
+     * available.
+     */
+    void updateTile(std::vector<BufferType> *tileBuffers, const CoordBox<DIM>& tile, int stages)
     {
-        LOG(INFO, "wavefrontCoord(" << wavefrontCoord << ")");
-        buffer->setEdge(curGrid->getEdge());
-        // buffer->fill(buffer->boundingBox(), curGrid->getEdgeCell());
-        fixBufferOrigin(buffer, wavefrontCoord);
-
-        int index = 0;
-        CoordBox<DIM> boundingBox = curGrid->boundingBox();
-        int maxIndex = boundingBox.origin[DIM - 1] + boundingBox.dimensions[DIM - 1];
-
-        // fill pipeline
-        for (; index < 2 * pipelineLength - 2; ++index) {
-            int lastStage = (index >> 1) + 1;
-            pipelinedUpdate(buffer, wavefrontCoord, index, index, 0, lastStage);
+        int lastStage = stages - 1;
+        int depth = curGrid->getDimensions()[DIM - 1];
+        bool wrapsLastAxis = Topology::wrapsAxis(DIM - 1);
+
+        std::vector<CoordBox<DIM> > boxes(stages);
+        std::vector<int> firstLayers(stages);
+        std::vector<int> endLayers(stages);
+        int firstIndex = 0;
+        int endIndex = 0;
+
+        for (int s = 0; s < stages; ++s) {
+            boxes[s] = stageBox(tile, lastStage - s);
+
+            if (wrapsLastAxis) {
+                // layers beyond the grid's boundary are recomputed
+                // redundantly as later stages depend on them:
+                firstLayers[s] = -RADIUS * (lastStage - s);
+                endLayers[s] = depth + RADIUS * (lastStage - s);
+            } else {
+                // intermediate stages pad the tile with edge cells:
+                int padding = (s == lastStage) ? 0 : RADIUS;
+                firstLayers[s] = -padding;
+                endLayers[s] = depth + padding;
+            }
+
+            firstIndex = (std::min)(firstIndex, firstLayers[s] + s * RADIUS);
+            endIndex = (std::max)(endIndex, endLayers[s] + s * RADIUS);
         }
 
-        // normal operation
-        for (; index < maxIndex; ++index) {
-            pipelinedUpdate(buffer, wavefrontCoord, index, index, 0, pipelineLength);
+        for (int s = 0; s < lastStage; ++s) {
+            CoordBox<DIM> bufferBox = boxes[s];
+            bufferBox.dimensions[DIM - 1] = 2 * RADIUS + 1;
+            (*tileBuffers)[s].resize(bufferBox);
+            (*tileBuffers)[s].setEdge(curGrid->getEdge());
         }
 
-        // let pipeline drain
-        for (; index < (maxIndex + 2 * pipelineLength - 2); ++index) {
-            int firstStage = (index - maxIndex + 1) >> 1 ;
-            pipelinedUpdate(buffer, wavefrontCoord, index, index, firstStage, pipelineLength);
+        for (int index = firstIndex; index < endIndex; ++index) {
+            for (int s = 0; s < stages; ++s) {
+                int layer = index - s * RADIUS;
+                if ((layer < firstLayers[s]) || (layer >= endLayers[s])) {
+                    continue;
+                }
+
+                unsigned curNanoStep = (nanoStep + s) % NANO_STEPS;
+                bool firstStage = (s == 0);
+                bool finalStage = (s == lastStage);
+                // the halo may exceed the grid's depth, so we can't
+                // rely on the Grid to wrap layers around:
+                int sourceLayer = firstStage ? normalize(layer, depth) : ringIndex(layer);
+                int targetLayer = finalStage ? layer : ringIndex(layer);
+
+                if (!wrapsLastAxis && ((layer < 0) || (layer >= depth))) {
+                    fillLayer(&(*tileBuffers)[s], boxes[s], targetLayer);
+                    continue;
+                }
+
+                Region<DIM> region;
+                region << layerBox(boxes[s], sourceLayer);
+                Coord<DIM> targetOffset;
+                targetOffset[DIM - 1] = targetLayer - sourceLayer;
+
+                if ( firstStage &&  finalStage) {
+                    updateLayer(region, targetOffset, *curGrid, newGrid, curNanoStep);
+                }
+                if ( firstStage && !finalStage) {
+                    updateLayer(region, targetOffset, *curGrid, &(*tileBuffers)[s], curNanoStep);
+                }
+                if (!firstStage &&  finalStage) {
+                    updateLayer(region, targetOffset, (*tileBuffers)[s - 1], newGrid, curNanoStep);
+                }
+                if (!firstStage && !finalStage) {
+                    updateLayer(region, targetOffset, (*tileBuffers)[s - 1], &(*tileBuffers)[s], curNanoStep);
+                }
+            }
         }
     }
 
-    void fixBufferOrigin(BufferType *buffer, const Coord<DIM - 1>& frameCoord)
+    template<typename GRID1, typename GRID2>
+    void updateLayer(
+        const Region<DIM>& region,
+        const Coord<DIM>& targetOffset,
+        const GRID1& sourceGrid,
+        GRID2 *targetGrid,
+        unsigned curNanoStep)
     {
-        Coord<DIM> bufferOrigin;
-        // fixme: wrong on boundary with Torus topology
-        for (int d = 0; d < (DIM - 1); ++d) {
-            bufferOrigin[d] = (std::max)(0, frameCoord[d] * wavefrontDim[d] - pipelineLength + 1);
+        UpdateFunctor<CELL>()(region, Coord<DIM>(), targetOffset, sourceGrid, targetGrid, curNanoStep);
+    }
+
+    void fillLayer(BufferType *buffer, const CoordBox<DIM>& box, int layer)
+    {
+        CoordBox<DIM> fillBox = layerBox(box, layer);
+        for (typename CoordBox<DIM>::Iterator i = fillBox.begin(); i != fillBox.end(); ++i) {
+            (*buffer)[*i] = buffer->getEdge();
         }
-        bufferOrigin[DIM - 1] = 0;
-        buffer->setOrigin(bufferOrigin);
     }
 
-    void pipelinedUpdate(
-        BufferType *buffer,
-        const Coord<DIM - 1>& frameCoord,
-        int globalIndex,
-        int localIndex,
-        int firstStage,
-        int lastStage)
+    CoordBox<DIM> layerBox(CoordBox<DIM> box, int layer) const
     {
-        LOG(DBG, "  pipelinedUpdate(frameCoord = " << frameCoord << ", globalIndex = " << globalIndex << ", localIndex = " << localIndex << ", firstStage = " << firstStage << ", lastStage = " << lastStage << ")");
-
-        for (int i = firstStage; i < lastStage; ++i) {
-            bool firstIteration = (i == 0);
-            bool lastIteration =  (i == (pipelineLength - 1));
-            int currentGlobalIndex = globalIndex - 2 * i;
-            bool needsFlushing = (i == firstStage) &&
-                (currentGlobalIndex >= newGrid->getDimensions()[DIM - 1]);
-            int sourceIndex = firstIteration ? currentGlobalIndex : normalizeIndex(localIndex + 2 - 4 * i);
-            int targetIndex = lastIteration  ? currentGlobalIndex : normalizeIndex(localIndex + 0 - 4 * i);
-
-            const Region<DIM>& updateFrame = frames[frameCoord][globalIndex - 2 * i][i];
-            unsigned curNanoStep = (nanoStep + i) % NANO_STEPS;
-
-            if ( firstIteration &&  lastIteration) {
-                frameUpdate(needsFlushing, updateFrame, sourceIndex, targetIndex, *curGrid, newGrid, curNanoStep);
-            }
+        box.origin[DIM - 1] = layer;
+        box.dimensions[DIM - 1] = 1;
+        return box;
+    }
 
-            if ( firstIteration && !lastIteration) {
-                frameUpdate(needsFlushing, updateFrame, sourceIndex, targetIndex, *curGrid, buffer,  curNanoStep);
-            }
+    /**
+     * maps a layer (i.e. its coordinate along the last axis) to its
+     * slot in the ring buffers.
+     */
+    int ringIndex(int layer) const
+    {
+        return normalize(layer, 2 * RADIUS + 1);
+    }
 
-            if (!firstIteration &&  lastIteration) {
-                frameUpdate(needsFlushing, updateFrame, sourceIndex, targetIndex, *buffer,  newGrid, curNanoStep);
-            }
+    static int normalize(int layer, int size)
+    {
+        return ((layer % size) + size) % size;
+    }
 
-            if (!firstIteration && !lastIteration) {
-                frameUpdate(needsFlushing, updateFrame, sourceIndex, targetIndex, *buffer,  buffer,  curNanoStep);
+    /**
+     * notifies all registered Writers
+     */
+    void handleOutput(WriterEvent event)
+    {
+        TimeOutput t(&chronometer);
+
+        for (unsigned i = 0; i < writers.size(); i++) {
+            if ((event != WRITER_STEP_FINISHED) ||
+                ((getStep() % writers[i]->getPeriod()) == 0)) {
+                writers[i]->stepFinished(
+                    *curGrid,
+                    getStep(),
+                    event);
             }
         }
     }
 
-    template<class GRID1, class GRID2>
-    void frameUpdate(
-        bool needsFlushing,
-        const Region<DIM>& updateFrame,
-        int sourceIndex,
-        int targetIndex,
-        const GRID1& sourceGrid,
-        GRID2 *targetGrid,
-        unsigned curNanoStep)
+    /**
+     * notifies all registered Steerers
+     */
+    void handleInput(SteererEvent event, SteererFeedback *feedback)
     {
-        LOG(DBG, "    frameUpdate("
-            << needsFlushing << ", "
-            << updateFrame.boundingBox() << ", "
-            << sourceIndex << ", "
-            << targetIndex <<  ")");
-
-        if (needsFlushing) {
-            // fixme: only works with cube topologies
-            Coord<DIM> fillOrigin = buffers[omp_get_thread_num()].getOrigin();
-            fillOrigin[DIM - 1] = targetIndex;
-            Coord<DIM> fillDim = buffers[omp_get_thread_num()].getDimensions();
-            fillDim[DIM - 1] = 1;
-
-            // buffers[omp_get_thread_num()].fill(
-            //     CoordBox<DIM>(fillOrigin, fillDim),
-            //     buffers[omp_get_thread_num()].getEdgeCell());
-        } else {
-            Coord<DIM> sourceOffset;
-            Coord<DIM> targetOffset;
-            sourceOffset[DIM - 1] = sourceIndex;
-            targetOffset[DIM - 1] = targetIndex;
-
-            UpdateFunctor<CELL>()(updateFrame, sourceOffset, targetOffset, sourceGrid, targetGrid, curNanoStep);
+        TimeInput t(&chronometer);
+
+        for (unsigned i = 0; i < steerers.size(); ++i) {
+            if ((event != STEERER_NEXT_STEP) ||
+                (stepNum % steerers[i]->getPeriod() == 0)) {
+                steerers[i]->nextStep(
+                    curGrid,
+                    simArea,
+                    gridDim,
+                    getStep(),
+                    event,
+                    0,
+                    true,
+                    feedback);
+            }
         }
-     }
+    }
 
-    // wraps the index (for 3D this will be the Z coordinate) around
-    // the buffer's dimension
-    int normalizeIndex(int localIndex)
+    void setIORegions()
     {
-        int bufferSize = buffers[0].getDimensions()[DIM - 1];
-        return (localIndex + bufferSize) % bufferSize;
+        for (unsigned i = 0; i < steerers.size(); i++) {
+            steerers[i]->setRegion(simArea);
+        }
     }
 };
 
@@ -0,0 +1,713 @@
+#ifndef LIBGEODECOMP_PARALLELIZATION_DATAFLOWSIMULATOR_H
+#define LIBGEODECOMP_PARALLELIZATION_DATAFLOWSIMULATOR_H
+
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_CPP14
+
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <libgeodecomp/communication/mpilayer.h>
+#endif
+
+#include <libgeodecomp/geometry/partitions/unstructuredstripingpartition.h>
+#include <libgeodecomp/geometry/partitionmanager.h>
+#include <libgeodecomp/loadbalancer/loadbalancer.h>
+#include <libgeodecomp/misc/threadpool.h>
+#include <libgeodecomp/parallelization/distributedsimulator.h>
+#include <libgeodecomp/storage/reorderingunstructuredgrid.h>
+#include <libgeodecomp/storage/unstructuredgrid.h>
+
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+namespace DataflowSimulatorHelpers {
+
+/**
+ * Same as HPXDataFlowSimulatorHelpers::UpdateEvent, passed to the
+ * cells instead of a plain nano step.
+ */
+class UpdateEvent
+{
+public:
+    inline
+    UpdateEvent(int nanoStep, int step) :
+        myNanoStep(nanoStep),
+        myStep(step)
+    {}
+
+    inline int nanoStep() const
+    {
+        return myNanoStep;
+    }
+
+    inline int step() const
+    {
+        return myStep;
+    }
+
+private:
+    int myNanoStep;
+    int myStep;
+};
+
+template<typename CELL, typename MESSAGE>
+class CellNode;
+
+/**
+ * Callback interface through which CellNodes hand ready updates and
+ * messages for other ranks to the DataflowSimulator.
+ */
+template<typename CELL, typename MESSAGE>
+class Scheduler
+{
+public:
+    virtual ~Scheduler()
+    {}
+
+    virtual void schedule(CellNode<CELL, MESSAGE> *node) = 0;
+
+    virtual void sendRemote(int rank, int sender, int receiver, int globalNanoStep, const MESSAGE& message) = 0;
+
+    virtual int endGlobalNanoStep() const = 0;
+};
+
+/**
+ * Holds a cell along with its incoming messages. An update may run
+ * once all neighbors have delivered their message for that nano step
+ * and the cell's previous update has completed. This is tracked by
+ * one counter per nano step, which replaces the futures used by
+ * HPXDataflowSimulator.
+ *
+ * As a cell can't update before its neighbors have completed the
+ * preceding nano step, neighbors are never more than two nano steps
+ * apart, so three message slots suffice.
+ */
+template<typename CELL, typename MESSAGE>
+class CellNode
+{
+public:
+    static const int SLOTS = 3;
+    static const unsigned NANO_STEPS = APITraits::SelectNanoSteps<CELL>::VALUE;
+
+    CellNode(const CELL& cell, int id, const std::vector<int>& neighbors, int globalNanoStep) :
+        cell(cell),
+        id(id),
+        neighbors(neighbors),
+        targets(neighbors.size(), 0),
+        targetIndices(neighbors.size(), -1),
+        targetRanks(neighbors.size(), -1),
+        globalNanoStep(globalNanoStep)
+    {
+        std::sort(this->neighbors.begin(), this->neighbors.end());
+
+        for (int i = 0; i < SLOTS; ++i) {
+            inbox[i].resize(neighbors.size());
+            missingInputs[i] = numInputs();
+        }
+
+        // the first update can't expect any messages:
+        missingInputs[globalNanoStep % SLOTS] = 0;
+    }
+
+    /**
+     * Returns the position of the given neighbor within neighbors,
+     * or -1 if it isn't a neighbor.
+     */
+    inline int neighborIndex(int neighbor) const
+    {
+        std::vector<int>::const_iterator i = std::lower_bound(neighbors.begin(), neighbors.end(), neighbor);
+        if ((i == neighbors.end()) || (*i != neighbor)) {
+            return -1;
+        }
+
+        return i - neighbors.begin();
+    }
+
+    /**
+     * Stores a message from the neighbor with the given index.
+     * Returns true if this completed the inputs for an update which
+     * should be scheduled.
+     */
+    inline bool deliver(int index, int targetGlobalNanoStep, const MESSAGE& message, int endGlobalNanoStep)
+    {
+        int slot = targetGlobalNanoStep % SLOTS;
+        inbox[slot][index] = message;
+
+        return (--missingInputs[slot] == 0) && (targetGlobalNanoStep < endGlobalNanoStep);
+    }
+
+    /**
+     * Runs the next update. Returns true if the following update is
+     * ready to run, too.
+     */
+    template<typename NEIGHBORHOOD>
+    inline bool update(Scheduler<CELL, MESSAGE> *scheduler)
+    {
+        int slot = globalNanoStep % SLOTS;
+        UpdateEvent event(globalNanoStep % NANO_STEPS, globalNanoStep / NANO_STEPS);
+        NEIGHBORHOOD hood(this, globalNanoStep + 1, scheduler);
+
+        cell.update(hood, event);
+        hood.sendEmptyMessagesToUnnotifiedNeighbors();
+
+        missingInputs[slot] = numInputs();
+        ++globalNanoStep;
+
+        return (--missingInputs[globalNanoStep % SLOTS] == 0) &&
+            (globalNanoStep < scheduler->endGlobalNanoStep());
+    }
+
+    inline bool ready() const
+    {
+        return missingInputs[globalNanoStep % SLOTS] == 0;
+    }
+
+    inline int numInputs() const
+    {
+        // all neighbors plus our own previous update:
+        return neighbors.size() + 1;
+    }
+
+    CELL cell;
+    int id;
+    std::vector<int> neighbors;
+    // per neighbor: the node if it's local, the index under which
+    // we're listed as its neighbor, and the owning rank if remote:
+    std::vector<CellNode*> targets;
+    std::vector<int> targetIndices;
+    std::vector<int> targetRanks;
+    std::vector<MESSAGE> inbox[SLOTS];
+    std::atomic<int> missingInputs[SLOTS];
+    int globalNanoStep;
+};
+
+/**
+ * Implements the Neighborhood interface of HPXDataflowSimulator:
+ * read the messages received for the current nano step and send
+ * messages to neighbors for the next one.
+ */
+template<typename CELL, typename MESSAGE>
+class Neighborhood
+{
+public:
+    typedef CellNode<CELL, MESSAGE> NodeType;
+
+    inline Neighborhood(
+        NodeType *node,
+        int targetGlobalNanoStep,
+        Scheduler<CELL, MESSAGE> *scheduler) :
+        node(node),
+        targetGlobalNanoStep(targetGlobalNanoStep),
+        scheduler(scheduler),
+        sentNeighbors(node->neighbors.size(), false)
+    {}
+
+    inline
+    const std::vector<int>& neighbors() const
+    {
+        return node->neighbors;
+    }
+
+    inline
+    const MESSAGE& operator[](int index) const
+    {
+        int i = node->neighborIndex(index);
+        if (i < 0) {
+            throw std::logic_error("ID not found for incoming messages");
+        }
+
+        return node->inbox[(targetGlobalNanoStep - 1) % NodeType::SLOTS][i];
+    }
+
+    inline
+    void send(int remoteCellID, const MESSAGE& message)
+    {
+        int i = node->neighborIndex(remoteCellID);
+        if (i < 0) {
+            throw std::logic_error("ID not found for outgoing messages");
+        }
+        if (sentNeighbors[i]) {
+            throw std::logic_error("only one message per neighbor and nano step may be sent");
+        }
+        sentNeighbors[i] = true;
+
+        NodeType *target = node->targets[i];
+        if (target == 0) {
+            scheduler->sendRemote(node->targetRanks[i], node->id, remoteCellID, targetGlobalNanoStep, message);
+            return;
+        }
+
+        if (target->deliver(node->targetIndices[i], targetGlobalNanoStep, message, scheduler->endGlobalNanoStep())) {
+            scheduler->schedule(target);
+        }
+    }
+
+    inline
+    void sendEmptyMessagesToUnnotifiedNeighbors()
+    {
+        for (std::size_t i = 0; i < sentNeighbors.size(); ++i) {
+            if (!sentNeighbors[i]) {
+                send(node->neighbors[i], MESSAGE());
+            }
+        }
+    }
+
+private:
+    NodeType *node;
+    int targetGlobalNanoStep;
+    Scheduler<CELL, MESSAGE> *scheduler;
+    std::vector<bool> sentNeighbors;
+};
+
+/**
+ * Wire format for messages crossing rank boundaries.
+ */
+template<typename MESSAGE>
+class RemoteMessage
+{
+public:
+    int sender;
+    int receiver;
+    int globalNanoStep;
+    MESSAGE message;
+};
+
+}
+
+/**
+ * A dataflow simulator for unstructured grids which, unlike
+ * HPXDataflowSimulator, needs no HPX: each cell's update runs as a
+ * task on a work-stealing ThreadPool as soon as the messages from
+ * all its neighbors have arrived. There are no global barriers, so
+ * fast parts of the mesh may run ahead of slow ones. Models written
+ * for HPXDataflowSimulator (update(hood, event), hood.send(),
+ * hood[neighborID]) work unchanged.
+ *
+ * If MPI is initialized and more than one rank participates, the
+ * grid is partitioned via PARTITION and messages for cells on other
+ * ranks are sent via MPI. These messages are batched per rank and
+ * all MPI calls are issued from the thread calling run(), so
+ * MPI_THREAD_FUNNELED suffices. Cross-rank messages are transferred
+ * bytewise and thus need to be trivially copyable.
+ *
+ * Just like HPXDataflowSimulator, this simulator doesn't yet call
+ * back Writers or Steerers.
+ */
+template<typename CELL, typename PARTITION = UnstructuredStripingPartition>
+class DataflowSimulator :
+        public DistributedSimulator<CELL>,
+        private DataflowSimulatorHelpers::Scheduler<CELL, typename APITraits::SelectMessageType<CELL>::Value>
+{
+public:
+    friend class DataflowSimulatorTest;
+
+    typedef typename APITraits::SelectMessageType<CELL>::Value MessageType;
+    typedef DistributedSimulator<CELL> ParentType;
+    typedef typename DistributedSimulator<CELL>::Topology Topology;
+    typedef DataflowSimulatorHelpers::CellNode<CELL, MessageType> NodeType;
+    typedef DataflowSimulatorHelpers::Neighborhood<CELL, MessageType> NeighborhoodType;
+    typedef DataflowSimulatorHelpers::RemoteMessage<MessageType> RemoteMessageType;
+    typedef ReorderingUnstructuredGrid<UnstructuredGrid<CELL> > GridType;
+
+    using DistributedSimulator<CELL>::NANO_STEPS;
+    using DistributedSimulator<CELL>::chronometer;
+    using DistributedSimulator<CELL>::initializer;
+    using DistributedSimulator<CELL>::stepNum;
+
+    /**
+     * numThreads is passed on to the ThreadPool (0 means one thread
+     * per core).
+     */
+    inline explicit DataflowSimulator(
+        Initializer<CELL> *initializer,
+        std::size_t numThreads = 0
+#ifdef LIBGEODECOMP_WITH_MPI
+        , MPI_Comm communicator = MPI_COMM_WORLD
+#endif
+                                      ) :
+        ParentType(initializer),
+        pool(numThreads),
+        rank(0),
+        numRanks(1),
+        currentGlobalNanoStep(initializer->startStep() * NANO_STEPS),
+        targetGlobalNanoStep(currentGlobalNanoStep),
+        numRemoteLinks(0),
+        finishedNodes(0),
+        expectedRemoteMessages(0),
+        receivedRemoteMessages(0)
+#ifdef LIBGEODECOMP_WITH_MPI
+        , communicator(communicator)
+#endif
+    {
+        stepNum = initializer->startStep();
+    }
+
+    void step()
+    {
+        runUntil(currentGlobalNanoStep + NANO_STEPS);
+    }
+
+    void run()
+    {
+        runUntil(initializer->maxSteps() * NANO_STEPS);
+    }
+
+    long currentNanoStep() const
+    {
+        return currentGlobalNanoStep;
+    }
+
+    void balanceLoad()
+    {
+        throw std::logic_error("DataflowSimulator::balanceLoad() not implemented");
+    }
+
+    std::vector<Chronometer> gatherStatistics()
+    {
+#ifdef LIBGEODECOMP_WITH_MPI
+        if (numRanks > 1) {
+            return MPILayer(communicator).gather(chronometer, 0);
+        }
+#endif
+        return std::vector<Chronometer>(1, chronometer);
+    }
+
+private:
+    ThreadPool pool;
+    int rank;
+    int numRanks;
+    int currentGlobalNanoStep;
+    int targetGlobalNanoStep;
+    std::vector<std::unique_ptr<NodeType> > nodes;
+    std::map<int, NodeType*> nodesByID;
+    std::size_t numRemoteLinks;
+    std::atomic<std::size_t> finishedNodes;
+    std::size_t expectedRemoteMessages;
+    std::size_t receivedRemoteMessages;
+    // remote messages which target a nano step of a future run:
+    std::vector<int> earlyRemoteMessages;
+    std::mutex outboxMutex;
+    std::map<int, std::vector<RemoteMessageType> > outbox;
+#ifdef LIBGEODECOMP_WITH_MPI
+    MPI_Comm communicator;
+    std::list<std::pair<std::vector<RemoteMessageType>, MPI_Request> > pendingSends;
+    static const int MESSAGE_TAG = 4712;
+#endif
+
+    void schedule(NodeType *node)
+    {
+        pool.submit([this, node]{ updateNode(node); });
+    }
+
+    void sendRemote(int targetRank, int sender, int receiver, int globalNanoStep, const MessageType& message)
+    {
+        RemoteMessageType remoteMessage;
+        remoteMessage.sender = sender;
+        remoteMessage.receiver = receiver;
+        remoteMessage.globalNanoStep = globalNanoStep;
+        remoteMessage.message = message;
+
+        std::lock_guard<std::mutex> lock(outboxMutex);
+        outbox[targetRank].push_back(remoteMessage);
+    }
+
+    int endGlobalNanoStep() const
+    {
+        return targetGlobalNanoStep;
+    }
+
+    /**
+     * Lets a node run ahead as long as its inputs are ready, which
+     * keeps its data in cache.
+     */
+    void updateNode(NodeType *node)
+    {
+        while (node->template update<NeighborhoodType>(this)) {}
+
+        if (node->globalNanoStep == targetGlobalNanoStep) {
+            ++finishedNodes;
+        }
+    }
+
+    void runUntil(int endNanoStep)
+    {
+        if (endNanoStep <= currentGlobalNanoStep) {
+            return;
+        }
+
+        TimeTotal t(&chronometer);
+        if (nodes.empty()) {
+            initNodes();
+        }
+
+        targetGlobalNanoStep = endNanoStep;
+        finishedNodes = 0;
+        expectedRemoteMessages += numRemoteLinks * (endNanoStep - currentGlobalNanoStep);
+        countEarlyRemoteMessages();
+
+        // collect first, as scheduled updates will in turn schedule
+        // their neighbors:
+        std::vector<NodeType*> readyNodes;
+        for (std::size_t i = 0; i < nodes.size(); ++i) {
+            if (nodes[i]->ready()) {
+                readyNodes.push_back(nodes[i].get());
+            }
+        }
+        for (std::size_t i = 0; i < readyNodes.size(); ++i) {
+            schedule(readyNodes[i]);
+        }
+
+        if (numRemoteLinks > 0) {
+            progressRemoteMessages();
+        }
+        pool.wait();
+
+        currentGlobalNanoStep = targetGlobalNanoStep;
+        stepNum = currentGlobalNanoStep / NANO_STEPS;
+    }
+
+    void initNodes()
+    {
+#ifdef LIBGEODECOMP_WITH_MPI
+        int mpiInitialized = 0;
+        MPI_Initialized(&mpiInitialized);
+        if (mpiInitialized) {
+            MPI_Comm_rank(communicator, &rank);
+            MPI_Comm_size(communicator, &numRanks);
+        }
+#endif
+
+        CoordBox<1> box = initializer->gridBox();
+        std::vector<double> rankSpeeds(numRanks, 1.0);
+        std::vector<std::size_t> weights = LoadBalancer::initialWeights(
+            box.dimensions.prod(),
+            rankSpeeds);
+
+        Region<1> globalRegion;
+        globalRegion << box;
+
+        typename SharedPtr<PARTITION>::Type partition(
+            new PARTITION(
+                box.origin,
+                box.dimensions,
+                0,
+                weights,
+                initializer->getAdjacency(globalRegion)));
+
+        PartitionManager<Topology> partitionManager;
+        partitionManager.resetRegions(
+            initializer,
+            box,
+            partition,
+            rank,
+            1);
+
+        Region<1> localRegion = partitionManager.ownRegion();
+        SharedPtr<Adjacency>::Type adjacency = initializer->getAdjacency(localRegion);
+
+        std::vector<int> neighbors;
+        for (Region<1>::Iterator i = localRegion.begin(); i != localRegion.end(); ++i) {
+            int id = i->x();
+            CoordBox<1> singleCellBox(Coord<1>(id), Coord<1>(1));
+            GridType grid(singleCellBox);
+            initializer->grid(&grid);
+
+            neighbors.clear();
+            adjacency->getNeighbors(id, &neighbors);
+            nodes.push_back(std::unique_ptr<NodeType>(
+                                new NodeType(grid.get(*i), id, neighbors, currentGlobalNanoStep)));
+            nodesByID[id] = nodes.back().get();
+        }
+
+        std::vector<Region<1> > rankRegions;
+        for (int r = 0; r < numRanks; ++r) {
+            rankRegions.push_back(partition->getRegion(r));
+        }
+
+        for (std::size_t i = 0; i < nodes.size(); ++i) {
+            NodeType& node = *nodes[i];
+
+            for (std::size_t j = 0; j < node.neighbors.size(); ++j) {
+                int neighbor = node.neighbors[j];
+                typename std::map<int, NodeType*>::iterator iter = nodesByID.find(neighbor);
+
+                if (iter != nodesByID.end()) {
+                    node.targets[j] = iter->second;
+                    node.targetIndices[j] = iter->second->neighborIndex(node.id);
+                    if (node.targetIndices[j] < 0) {
+                        throw std::logic_error("DataflowSimulator requires a symmetric adjacency");
+                    }
+                    continue;
+                }
+
+                for (int r = 0; r < numRanks; ++r) {
+                    if (rankRegions[r].count(Coord<1>(neighbor))) {
+                        node.targetRanks[j] = r;
+                        break;
+                    }
+                }
+                if (node.targetRanks[j] < 0) {
+                    throw std::logic_error("DataflowSimulator could not find owner of neighbor");
+                }
+                ++numRemoteLinks;
+            }
+        }
+
+        if ((numRemoteLinks > 0) && !std::is_trivially_copyable<MessageType>::value) {
+            throw std::logic_error("DataflowSimulator can only send trivially copyable messages to other ranks");
+        }
+    }
+
+    /**
+     * Drives the MPI transport until all local nodes are done and
+     * all messages have been exchanged. Returns early if a task
+     * failed as its node will never finish. runUntil() then
+     * rethrows the exception via ThreadPool::wait().
+     */
+    void progressRemoteMessages()
+    {
+#ifdef LIBGEODECOMP_WITH_MPI
+        using std::swap;
+
+        for (;;) {
+            if (pool.failed()) {
+                return;
+            }
+
+            bool nodesDone = (finishedNodes == nodes.size());
+
+            std::map<int, std::vector<RemoteMessageType> > messages;
+            {
+                std::lock_guard<std::mutex> lock(outboxMutex);
+                swap(messages, outbox);
+            }
+
+            for (typename std::map<int, std::vector<RemoteMessageType> >::iterator i = messages.begin();
+                 i != messages.end();
+                 ++i) {
+                pendingSends.push_back(std::make_pair(std::vector<RemoteMessageType>(), MPI_Request()));
+                swap(pendingSends.back().first, i->second);
+                MPI_Isend(
+                    &pendingSends.back().first[0],
+                    pendingSends.back().first.size() * sizeof(RemoteMessageType),
+                    MPI_BYTE,
+                    i->first,
+                    MESSAGE_TAG,
+                    communicator,
+                    &pendingSends.back().second);
+            }
+
+            receiveRemoteMessages();
+
+            for (typename std::list<std::pair<std::vector<RemoteMessageType>, MPI_Request> >::iterator i =
+                     pendingSends.begin();
+                 i != pendingSends.end();) {
+                int completed = 0;
+                MPI_Test(&i->second, &completed, MPI_STATUS_IGNORE);
+                if (completed) {
+                    i = pendingSends.erase(i);
+                } else {
+                    ++i;
+                }
+            }
+
+            if (nodesDone &&
+                messages.empty() &&
+                pendingSends.empty() &&
+                (receivedRemoteMessages == expectedRemoteMessages)) {
+                return;
+            }
+
+            std::this_thread::yield();
+        }
+#endif
+    }
+
+#ifdef LIBGEODECOMP_WITH_MPI
+    void receiveRemoteMessages()
+    {
+        std::vector<RemoteMessageType> buffer;
+
+        for (;;) {
+            int flag = 0;
+            MPI_Status status;
+            MPI_Iprobe(MPI_ANY_SOURCE, MESSAGE_TAG, communicator, &flag, &status);
+            if (!flag) {
+                return;
+            }
+
+            int byteSize = 0;
+            MPI_Get_count(&status, MPI_BYTE, &byteSize);
+            buffer.resize(byteSize / sizeof(RemoteMessageType));
+            MPI_Recv(
+                &buffer[0],
+                byteSize,
+                MPI_BYTE,
+                status.MPI_SOURCE,
+                MESSAGE_TAG,
+                communicator,
+                MPI_STATUS_IGNORE);
+
+            for (typename std::vector<RemoteMessageType>::iterator i = buffer.begin(); i != buffer.end(); ++i) {
+                deliverRemoteMessage(*i);
+            }
+        }
+    }
+#endif
+
+    void deliverRemoteMessage(const RemoteMessageType& remoteMessage)
+    {
+        typename std::map<int, NodeType*>::iterator iter = nodesByID.find(remoteMessage.receiver);
+        if (iter == nodesByID.end()) {
+            throw std::logic_error("DataflowSimulator received message for unknown cell");
+        }
+
+        NodeType *node = iter->second;
+        int index = node->neighborIndex(remoteMessage.sender);
+        if (index < 0) {
+            throw std::logic_error("DataflowSimulator received message from unknown neighbor");
+        }
+
+        // neighbors on other ranks may have already started their
+        // next run, so we need to account for their messages there:
+        if (remoteMessage.globalNanoStep > targetGlobalNanoStep) {
+            earlyRemoteMessages.push_back(remoteMessage.globalNanoStep);
+        } else {
+            ++receivedRemoteMessages;
+        }
+
+        if (node->deliver(index, remoteMessage.globalNanoStep, remoteMessage.message, targetGlobalNanoStep)) {
+            schedule(node);
+        }
+    }
+
+    void countEarlyRemoteMessages()
+    {
+        std::vector<int> stillEarly;
+        for (std::vector<int>::iterator i = earlyRemoteMessages.begin(); i != earlyRemoteMessages.end(); ++i) {
+            if (*i > targetGlobalNanoStep) {
+                stillEarly.push_back(*i);
+            } else {
+                ++receivedRemoteMessages;
+            }
+        }
+
+        using std::swap;
+        swap(stillEarly, earlyRemoteMessages);
+    }
+};
+
+}
+
+#endif
+
+#endif
@@ -10,8 +10,11 @@
 #include <libgeodecomp/geometry/partitions/unstructuredstripingpartition.h>
 #include <libgeodecomp/geometry/partitions/distributedptscotchunstructuredpartition.h>
 #include <libgeodecomp/loadbalancer/loadbalancer.h>
+#include <libgeodecomp/misc/eventtrace.h>
+#include <libgeodecomp/misc/limits.h>
 #include <libgeodecomp/misc/sharedptr.h>
 #include <libgeodecomp/parallelization/hierarchicalsimulator.h>
+#include <libgeodecomp/parallelization/nesting/migrationinitializer.h>
 #include <libgeodecomp/parallelization/nesting/parallelwriteradapter.h>
 #include <libgeodecomp/parallelization/nesting/steereradapter.h>
 #include <libgeodecomp/parallelization/nesting/mpiupdategroup.h>
@@ -29,6 +32,14 @@ namespace LibGeoDecomp {
  * inter-node or inter-NUMA-domain communication and OpenMP and/or
  * CUDA for local paralelism.
  *
+ * If a LoadBalancer is given, the ranks' relative loads (as measured
+ * by their Chronometers) are collected every loadBalancingPeriod
+ * steps. If the balancer returns new weights, then the cells which
+ * change ownership are migrated point-to-point and the UpdateGroup
+ * (including the PatchLinks) is rebuilt. Migration can only take
+ * place when all ghost zones are in sync and at the beginning of a
+ * time step, which is why it may be deferred by a few nano steps.
+ *
  * fixme: check if code runs with a communicator which is merely a subset of MPI_COMM_WORLD
  */
 template<
@@ -54,6 +65,11 @@ public:
     typedef typename ParentType::GridType GridType;
     typedef ParallelWriterAdapter<typename UpdateGroupType::GridType, CELL_TYPE> ParallelWriterAdapterType;
     typedef SteererAdapter<typename UpdateGroupType::GridType, CELL_TYPE> SteererAdapterType;
+    typedef typename SharedPtr<ParallelWriterAdapterType>::Type ParallelWriterAdapterPtr;
+    typedef typename SharedPtr<SteererAdapterType>::Type SteererAdapterPtr;
+    typedef typename UpdateGroupType::InitPtr InitPtr;
+    typedef MigrationInitializer<CELL_TYPE> MigrationInitializerType;
+    typedef typename MigrationInitializerType::BufferType BufferType;
 
     static const int DIM = Topology::DIM;
 
@@ -70,7 +86,9 @@ public:
             enableFineGrainedParallelism),
         balancer(balancer),
         ghostZoneWidth(ghostZoneWidth),
-        mpiLayer(communicator)
+        mpiLayer(communicator),
+        balancingEnabled(false),
+        partitionNanoStep(0)
     {}
 
     inline void run()
@@ -99,16 +117,20 @@ public:
     virtual void addSteerer(Steerer<CELL_TYPE> *steerer)
     {
         DistributedSimulator<CELL_TYPE>::addSteerer(steerer);
+        if (updateGroup) {
+            // adapters can only be handed to an UpdateGroup upon creation
+            return;
+        }
 
         // two adapters needed, just as for the writers
-        typename UpdateGroupType::PatchProviderPtr adapterGhost(
+        SteererAdapterPtr adapterGhost(
             new SteererAdapterType(
                 steerers.back(),
                 initializer->startStep(),
                 initializer->maxSteps(),
                 false));
 
-        typename UpdateGroupType::PatchProviderPtr adapterInnerSet(
+        SteererAdapterPtr adapterInnerSet(
             new SteererAdapterType(
                 steerers.back(),
                 initializer->startStep(),
@@ -122,17 +144,21 @@ public:
     virtual void addWriter(ParallelWriter<CELL_TYPE> *writer)
     {
         DistributedSimulator<CELL_TYPE>::addWriter(writer);
+        if (updateGroup) {
+            // adapters can only be handed to an UpdateGroup upon creation
+            return;
+        }
 
         // we need two adapters as each ParallelWriter needs to be
         // notified twice: once for the (inner) ghost zone, and once
         // for the inner set.
-        typename UpdateGroupType::PatchAccepterPtr adapterGhost(
+        ParallelWriterAdapterPtr adapterGhost(
             new ParallelWriterAdapterType(
                 writers.back(),
                 initializer->startStep(),
                 initializer->maxSteps(),
                 false));
-        typename UpdateGroupType::PatchAccepterPtr adapterInnerSet(
+        ParallelWriterAdapterPtr adapterInnerSet(
             new ParallelWriterAdapterType(
                 writers.back(),
                 initializer->startStep(),
@@ -143,12 +169,58 @@ public:
         writerAdaptersInner.push_back(adapterInnerSet);
     }
 
+    /**
+     * Statistics of UpdateGroups retired during load balancing are
+     * accumulated in the Simulator's own Chronometer.
+     */
     std::vector<Chronometer> gatherStatistics()
     {
         Chronometer stats = chronometer + updateGroup->statistics();
         return mpiLayer.gather(stats, 0);
     }
 
+    /**
+     * Collects the EventTrace of all ranks on rank 0, where element
+     * i of the result holds the events recorded on rank i. All other
+     * ranks receive an empty vector. The result can be passed to
+     * EventTrace::writeChromeTrace() or EventTrace::writeBinary().
+     */
+    std::vector<EventTrace::EventVec> gatherTrace()
+    {
+        EventTrace::EventVec events = EventTrace::events();
+        std::vector<char> buffer(events.size() * sizeof(EventTrace::Event));
+        if (!buffer.empty()) {
+            std::copy(
+                reinterpret_cast<const char*>(&events[0]),
+                reinterpret_cast<const char*>(&events[0]) + buffer.size(),
+                buffer.begin());
+        }
+
+        std::vector<int> lengths = mpiLayer.gather(int(buffer.size()), 0);
+        std::vector<char> allEvents;
+        if (mpiLayer.rank() == 0) {
+            allEvents.resize(sum(lengths));
+        }
+        mpiLayer.gatherV(buffer, lengths, 0, allEvents, MPI_CHAR);
+
+        std::vector<EventTrace::EventVec> ret;
+        if (mpiLayer.rank() != 0) {
+            return ret;
+        }
+
+        ret.resize(lengths.size());
+        const char *cursor = allEvents.empty() ? 0 : &allEvents[0];
+        for (std::size_t i = 0; i < lengths.size(); ++i) {
+            ret[i].resize(lengths[i] / sizeof(EventTrace::Event));
+            if (lengths[i] > 0) {
+                std::copy(cursor, cursor + lengths[i], reinterpret_cast<char*>(&ret[i][0]));
+            }
+            cursor += lengths[i];
+        }
+
+        return ret;
+    }
+
 private:
     using DistributedSimulator<CELL_TYPE>::initializer;
     using DistributedSimulator<CELL_TYPE>::steerers;
@@ -158,19 +230,32 @@ private:
     unsigned ghostZoneWidth;
     MPILayer mpiLayer;
     typename SharedPtr<UpdateGroupType>::Type updateGroup;
-
-    typename UpdateGroupType::PatchProviderVec steererAdaptersGhost;
-    typename UpdateGroupType::PatchProviderVec steererAdaptersInner;
-    typename UpdateGroupType::PatchAccepterVec writerAdaptersGhost;
-    typename UpdateGroupType::PatchAccepterVec writerAdaptersInner;
+    typename SharedPtr<PARTITION>::Type partition;
+    bool balancingEnabled;
+    LoadBalancer::WeightVec pendingWeights;
+    Chronometer lastBalancingStatistics;
+    long partitionNanoStep;
+
+    // adapters are kept around (and not just handed over to the
+    // UpdateGroup) as we need to reinstall them after migration:
+    std::vector<SteererAdapterPtr> steererAdaptersGhost;
+    std::vector<SteererAdapterPtr> steererAdaptersInner;
+    std::vector<ParallelWriterAdapterPtr> writerAdaptersGhost;
+    std::vector<ParallelWriterAdapterPtr> writerAdaptersInner;
 
     inline void nanoStep(long s)
     {
         long remainingNanoSteps = s;
         while (remainingNanoSteps > 0) {
             long hop = (std::min)(remainingNanoSteps, timeToNextEvent());
+            if (!pendingWeights.empty()) {
+                hop = (std::min)(hop, timeToNextMigration());
+            }
             updateGroup->update(hop);
             handleEvents();
+            if (!pendingWeights.empty() && (timeToNextMigration() == 0)) {
+                migrate();
+            }
             remainingNanoSteps -= hop;
         }
     }
@@ -192,8 +277,6 @@ private:
         }
 
         CoordBox<DIM> box = initializer->gridBox();
-        Region<DIM> globalRegion;
-        globalRegion << box;
 
         double mySpeed = APITraits::SelectSpeedGuide<CELL_TYPE>::value();
         std::vector<double> rankSpeeds = mpiLayer.allGather(mySpeed);
@@ -201,34 +284,60 @@ private:
             box.dimensions.prod(),
             rankSpeeds);
 
-        typename SharedPtr<PARTITION>::Type partition(
-            new PARTITION(
+        // the LoadBalancer is only required on rank 0:
+        int haveBalancer = balancer ? 1 : 0;
+        balancingEnabled = mpiLayer.broadcast(haveBalancer, 0);
+
+        // Initializers which also implement CostFunction get their
+        // load profile honored by the initial decomposition:
+        partition = makePartition(
+            weights,
+            dynamic_cast<const CostFunction<DIM>*>(&*initializer));
+        partitionNanoStep = initializer->startStep() * NANO_STEPS;
+        createUpdateGroup(initializer);
+
+        initEvents();
+    }
+
+    /**
+     * The weights from the LoadBalancer already reflect measured
+     * loads, hence a CostFunction should only be supplied for the
+     * initial decomposition.
+     */
+    inline typename SharedPtr<PARTITION>::Type makePartition(
+        const std::vector<std::size_t>& weights,
+        const CostFunction<DIM> *cost = 0)
+    {
+        CoordBox<DIM> box = initializer->gridBox();
+        Region<DIM> globalRegion;
+        globalRegion << box;
+
+        return typename SharedPtr<PARTITION>::Type(
+            PartitionFactory<PARTITION>::create(
                 box.origin,
                 box.dimensions,
                 0,
                 weights,
-                initializer->getAdjacency(globalRegion)));
+                initializer->getAdjacency(globalRegion),
+                cost));
+    }
 
+    inline void createUpdateGroup(const InitPtr& groupInitializer)
+    {
         updateGroup.reset(
             new UpdateGroupType(
                 partition,
-                box,
+                initializer->gridBox(),
                 ghostZoneWidth,
-                initializer,
+                groupInitializer,
                 static_cast<STEPPER*>(0),
-                writerAdaptersGhost,
-                writerAdaptersInner,
-                steererAdaptersGhost,
-                steererAdaptersInner,
+                typename UpdateGroupType::PatchAccepterVec(writerAdaptersGhost.begin(),  writerAdaptersGhost.end()),
+                typename UpdateGroupType::PatchAccepterVec(writerAdaptersInner.begin(),  writerAdaptersInner.end()),
+                typename UpdateGroupType::PatchProviderVec(steererAdaptersGhost.begin(), steererAdaptersGhost.end()),
+                typename UpdateGroupType::PatchProviderVec(steererAdaptersInner.begin(), steererAdaptersInner.end()),
                 enableFineGrainedParallelism,
                 mpiLayer.communicator()));
-
-        writerAdaptersGhost.clear();
-        writerAdaptersInner.clear();
-        steererAdaptersGhost.clear();
-        steererAdaptersInner.clear();
-
-        initEvents();
+        lastBalancingStatistics = Chronometer();
     }
 
     inline long currentNanoStep() const
@@ -237,17 +346,192 @@ private:
         return (long)now.first * NANO_STEPS + now.second;
     }
 
+    /**
+     * Collects the ranks' relative loads (compute time vs. wall clock
+     * time since the last invocation), lets the LoadBalancer on rank
+     * 0 decide on new weights and broadcasts those. The actual
+     * migration is deferred to the next suitable nano step, see
+     * timeToNextMigration().
+     */
     inline void balanceLoad()
     {
+        if (!balancingEnabled) {
+            return;
+        }
+
+        Chronometer statistics = updateGroup->statistics();
+        double computeTime =
+            statistics.interval<TimeCompute>() -
+            lastBalancingStatistics.interval<TimeCompute>();
+        double totalTime =
+            statistics.interval<TimeTotal>() -
+            lastBalancingStatistics.interval<TimeTotal>();
+        lastBalancingStatistics = statistics;
+
+        double relativeLoad = 0.5;
+        if (totalTime > 0) {
+            relativeLoad = computeTime / totalTime;
+        }
+        LoadBalancer::LoadVec loads = mpiLayer.gather(relativeLoad, 0);
+
+        LoadBalancer::WeightVec newWeights;
         if (mpiLayer.rank() == 0) {
-            if (!balancer) {
-                return;
+            newWeights = balancer->balance(updateGroup->getWeights(), loads);
+        }
+        newWeights = mpiLayer.broadcastVector(newWeights, 0);
+
+        if (newWeights.empty() || (newWeights == updateGroup->getWeights())) {
+            return;
+        }
+        if ((newWeights.size() != updateGroup->getWeights().size()) ||
+            (sum(newWeights) != sum(updateGroup->getWeights()))) {
+            throw std::logic_error("LoadBalancer returned weights which don't match the number of ranks or cells");
+        }
+
+        pendingWeights = newWeights;
+    }
+
+    /**
+     * Cells can only be migrated when the Stepper is at a ghost zone
+     * synchronization point (as only then the whole subdomain is
+     * valid) and at the beginning of a time step (as Initializers
+     * can't start at intermediate nano steps).
+     */
+    inline long timeToNextMigration() const
+    {
+        long period = ghostZoneWidth;
+        while (period % NANO_STEPS) {
+            period += ghostZoneWidth;
+        }
+
+        long elapsed = currentNanoStep() - partitionNanoStep;
+        return (period - elapsed % period) % period;
+    }
+
+    /**
+     * Switches to the partition described by pendingWeights: each
+     * rank sends those parts of its current subdomain which overlap
+     * with other ranks' new expanded regions (i.e. their new
+     * subdomains plus ghost zones) and receives its own new expanded
+     * region. The UpdateGroup is then rebuilt from the migrated
+     * cells.
+     */
+    inline void migrate()
+    {
+        if (timeToLastEvent() == 0) {
+            pendingWeights.clear();
+            return;
+        }
+
+        int size = mpiLayer.size();
+        int rank = mpiLayer.rank();
+        long nanoStep = currentNanoStep();
+        CoordBox<DIM> box = initializer->gridBox();
+
+        typename SharedPtr<PARTITION>::Type newPartition = makePartition(pendingWeights);
+        pendingWeights.clear();
+
+        PartitionManager<Topology> newPartitionManager;
+        newPartitionManager.resetRegions(
+            initializer,
+            box,
+            newPartition,
+            rank,
+            ghostZoneWidth);
+        const Region<DIM>& oldOwnRegion = partition->getRegion(rank);
+        const Region<DIM>& newExpandedRegion = newPartitionManager.ownExpandedRegion();
+
+        std::vector<Region<DIM> > outgoingRegions(size);
+        std::vector<Region<DIM> > incomingRegions(size);
+        std::vector<BufferType> outgoingCells(size);
+        std::vector<BufferType> incomingCells(size);
+        std::vector<int> outgoingSizes(size, 0);
+        std::vector<int> incomingSizes(size, 0);
+
+        for (int i = 0; i < size; ++i) {
+            outgoingRegions[i] = oldOwnRegion & newPartitionManager.getRegion(i, ghostZoneWidth);
+            incomingRegions[i] = partition->getRegion(i) & newExpandedRegion;
+
+            if (!outgoingRegions[i].empty()) {
+                outgoingCells[i] = SerializationBuffer<CELL_TYPE>::create(outgoingRegions[i]);
+                updateGroup->grid().saveRegion(&outgoingCells[i], outgoingRegions[i]);
+
+                if (outgoingCells[i].size() > std::size_t(Limits<int>::getMax())) {
+                    throw std::invalid_argument("buffer size exceeds std::numeric_limits<int>::max()");
+                }
+                outgoingSizes[i] = outgoingCells[i].size();
             }
+        }
 
-            LoadBalancer::LoadVec loads(mpiLayer.size(), 1.0);
-            LoadBalancer::WeightVec newWeights =
-                balancer->balance(updateGroup->getWeights(), loads);
-            // fixme: actually balance the load!
+        // cells which stay on this rank don't need to go through MPI:
+        std::swap(incomingCells[rank], outgoingCells[rank]);
+        incomingSizes[rank] = outgoingSizes[rank];
+        outgoingSizes[rank] = 0;
+        outgoingRegions[rank].clear();
+
+        // buffer sizes need to be transmitted first as serialized
+        // cells may vary in size (e.g. with Boost Serialization):
+        for (int i = 0; i < size; ++i) {
+            if (!outgoingRegions[i].empty()) {
+                mpiLayer.send(&outgoingSizes[i], i, 1, MPILayer::HIPAR_SIMULATOR);
+            }
+            if ((i != rank) && !incomingRegions[i].empty()) {
+                mpiLayer.recv(&incomingSizes[i], i, 1, MPILayer::HIPAR_SIMULATOR);
+            }
+        }
+        mpiLayer.wait(MPILayer::HIPAR_SIMULATOR);
+
+        MPI_Datatype datatype = SerializationBuffer<CELL_TYPE>::cellMPIDataType();
+        for (int i = 0; i < size; ++i) {
+            if (outgoingSizes[i] > 0) {
+                mpiLayer.send(
+                    SerializationBuffer<CELL_TYPE>::getData(outgoingCells[i]),
+                    i,
+                    outgoingSizes[i],
+                    MPILayer::HIPAR_SIMULATOR,
+                    datatype);
+            }
+            if ((i != rank) && (incomingSizes[i] > 0)) {
+                incomingCells[i].resize(incomingSizes[i]);
+                mpiLayer.recv(
+                    SerializationBuffer<CELL_TYPE>::getData(incomingCells[i]),
+                    i,
+                    incomingSizes[i],
+                    MPILayer::HIPAR_SIMULATOR,
+                    datatype);
+            }
+        }
+        mpiLayer.wait(MPILayer::HIPAR_SIMULATOR);
+        outgoingCells.clear();
+
+        // retiring the old UpdateGroup will complete any pending
+        // ghost zone transmissions of its PatchLinks.
+        chronometer += updateGroup->statistics();
+        updateGroup.reset();
+
+        // all IO up to the current nano step has been delivered by
+        // the old UpdateGroup:
+        resumeAdapters(&writerAdaptersGhost,  nanoStep);
+        resumeAdapters(&writerAdaptersInner,  nanoStep);
+        resumeAdapters(&steererAdaptersGhost, nanoStep);
+        resumeAdapters(&steererAdaptersInner, nanoStep);
+
+        partition = newPartition;
+        partitionNanoStep = nanoStep;
+        createUpdateGroup(
+            InitPtr(
+                new MigrationInitializerType(
+                    initializer,
+                    nanoStep / NANO_STEPS,
+                    incomingRegions,
+                    incomingCells)));
+    }
+
+    template<typename ADAPTER_VEC>
+    inline void resumeAdapters(ADAPTER_VEC *adapters, long nanoStep)
+    {
+        for (typename ADAPTER_VEC::iterator i = adapters->begin(); i != adapters->end(); ++i) {
+            (*i)->resume(nanoStep);
         }
     }
 };
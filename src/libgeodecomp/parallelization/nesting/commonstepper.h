@@ -98,6 +98,27 @@ public:
     virtual void update1() = 0;
 
 protected:
+    /**
+     * Hands CommonStepper::progressCommunication() to the
+     * UpdateFunctor, which calls it periodically while updating the
+     * inner set.
+     */
+    class ProgressFunctor
+    {
+    public:
+        inline explicit ProgressFunctor(CommonStepper *stepper) :
+            stepper(stepper)
+        {}
+
+        inline void operator()() const
+        {
+            stepper->progressCommunication();
+        }
+
+    private:
+        CommonStepper *stepper;
+    };
+
     std::vector<Region<DIM> > remappedInnerSets;
     std::vector<Region<DIM> > remappedRims;
     std::size_t curStep;
@@ -107,7 +128,6 @@ protected:
     typename SharedPtr<GridType>::Type newGrid;
     PatchBufferType2 rimBuffer;
     PatchBufferType1 kernelBuffer;
-    Region<DIM> kernelFraction;
     bool enableFineGrainedParallelism;
 
     virtual inline void notifyPatchAccepters(
@@ -155,6 +175,64 @@ protected:
         }
     }
 
+    /**
+     * Lets PatchAccepters (e.g. PatchLinks which send straight from
+     * grid memory) complete any outstanding reads of the grid, so we
+     * may modify the patches handed to them by put().
+     */
+    inline void flushPatchAccepters(const typename ParentType::PatchType& patchType)
+    {
+        TimePatchAccepters t(&chronometer);
+
+        for (typename ParentType::PatchAccepterList::iterator i =
+                 patchAccepters[patchType].begin();
+             i != patchAccepters[patchType].end();
+             ++i) {
+            (*i)->flush();
+        }
+    }
+
+    /**
+     * Tells the PatchProviders which grid their next get() will
+     * target, so asynchronous ones may receive straight into it.
+     */
+    inline void preparePatchProviders(const typename ParentType::PatchType& patchType, GridType *grid)
+    {
+        TimePatchProviders t(&chronometer);
+
+        for (typename ParentType::PatchProviderList::iterator i =
+                 patchProviders[patchType].begin();
+             i != patchProviders[patchType].end();
+             ++i) {
+            (*i)->prepare(grid);
+        }
+    }
+
+    /**
+     * Drives the asynchronous ghost zone transfers (i.e. the
+     * PatchLinks) forward, so they can complete while we're busy
+     * with the inner set instead of stalling the next ghost zone
+     * update.
+     */
+    inline void progressCommunication()
+    {
+        for (int patchType = ParentType::GHOST_PHASE_0; patchType <= ParentType::GHOST_PHASE_1; ++patchType) {
+            for (typename ParentType::PatchAccepterList::iterator i =
+                     patchAccepters[patchType].begin();
+                 i != patchAccepters[patchType].end();
+                 ++i) {
+                (*i)->progress();
+            }
+
+            for (typename ParentType::PatchProviderList::iterator i =
+                     patchProviders[patchType].begin();
+                 i != patchProviders[patchType].end();
+                 ++i) {
+                (*i)->progress();
+            }
+        }
+    }
+
     inline std::size_t globalNanoStep() const
     {
         return curStep * NANO_STEPS + curNanoStep;
@@ -254,12 +332,36 @@ protected:
             remove);
     }
 
+    /**
+     * Returns true if at least one PatchProvider of the given type
+     * is going to write to oldGrid at the given nano step.
+     */
+    inline bool patchProvidersPending(
+        const typename ParentType::PatchType& patchType,
+        std::size_t nanoStep)
+    {
+        for (typename ParentType::PatchProviderList::iterator i =
+                 patchProviders[patchType].begin();
+             i != patchProviders[patchType].end();
+             ++i) {
+            if (nanoStep == (*i)->nextAvailableNanoStep()) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Backs up the volatile kernel, i.e. only those parts of the
+     * kernel which the ghost zone update may overwrite.
+     */
     inline void saveKernel()
     {
         kernelBuffer.pushRequest(globalNanoStep());
         kernelBuffer.put(
             *oldGrid,
-            innerSet(ghostZoneWidth()),
+            getVolatileKernel(),
             partitionManager->getSimulationArea(),
             globalNanoStep(),
             partitionManager->rank());
@@ -287,14 +389,38 @@ protected:
 
     template<typename TOPOLOGY>
     inline GridType *makeGrid(
-        const Region<DIM>& /* unused: region */,
+        const Region<DIM>& region,
         const CoordBox<DIM>& boundingBox,
         const Coord<DIM>& topoDim,
         const TOPOLOGY& topo) const
+    {
+        return makeStructuredGrid(region, boundingBox, topoDim, static_cast<GridType*>(0));
+    }
+
+    template<typename GRID_TYPE>
+    inline GridType *makeStructuredGrid(
+        const Region<DIM>& /* unused: region */,
+        const CoordBox<DIM>& boundingBox,
+        const Coord<DIM>& topoDim,
+        GRID_TYPE * /* unused: tag */) const
     {
         return new GridType(boundingBox, CELL_TYPE(), CELL_TYPE(), topoDim);
     }
 
+    /**
+     * RegionGrids store just our Region and its ghost zone, not the
+     * whole bounding box.
+     */
+    template<typename CELL, typename TOPOLOGY>
+    inline GridType *makeStructuredGrid(
+        const Region<DIM>& region,
+        const CoordBox<DIM>& /* unused: boundingBox */,
+        const Coord<DIM>& topoDim,
+        RegionGrid<CELL, TOPOLOGY> * /* unused: tag */) const
+    {
+        return new GridType(region, CELL_TYPE(), CELL_TYPE(), topoDim);
+    }
+
     void remapRegions(const GridType& grid)
     {
         remappedInnerSets.reserve(ghostZoneWidth() + 1);
@@ -301,7 +301,6 @@ public:
     using CommonStepper<CELL_TYPE>::newGrid;
     using CommonStepper<CELL_TYPE>::rimBuffer;
     using CommonStepper<CELL_TYPE>::kernelBuffer;
-    using CommonStepper<CELL_TYPE>::kernelFraction;
 
     using typename ParentType::InitPtr;
     using typename ParentType::PartitionManagerPtr;
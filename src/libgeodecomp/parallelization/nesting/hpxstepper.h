@@ -42,7 +42,6 @@ public:
     using ParentType::newGrid;
     using ParentType::rimBuffer;
     using ParentType::kernelBuffer;
-    using ParentType::kernelFraction;
     using ParentType::enableFineGrainedParallelism;
 
     using typename ParentType::InitPtr;
@@ -0,0 +1,106 @@
+#ifndef LIBGEODECOMP_PARALLELIZATION_NESTING_MIGRATIONINITIALIZER_H
+#define LIBGEODECOMP_PARALLELIZATION_NESTING_MIGRATIONINITIALIZER_H
+
+#include <libgeodecomp/io/initializer.h>
+#include <libgeodecomp/misc/sharedptr.h>
+#include <libgeodecomp/storage/serializationbuffer.h>
+
+namespace LibGeoDecomp {
+
+/**
+ * The MigrationInitializer is used by hierarchical Simulators (e.g.
+ * the HiParSimulator) to rebuild an UpdateGroup after the domain
+ * decomposition has changed during load balancing. It behaves just
+ * like the Initializer it wraps, except that it starts at the time
+ * step of the migration and that it will overwrite the initial
+ * state with the cells that were received from the subdomains'
+ * previous owners.
+ */
+template<typename CELL>
+class MigrationInitializer : public Initializer<CELL>
+{
+public:
+    typedef typename Initializer<CELL>::AdjacencyPtr AdjacencyPtr;
+    typedef typename Initializer<CELL>::Topology Topology;
+    typedef typename SerializationBuffer<CELL>::BufferType BufferType;
+    typedef typename SharedPtr<Initializer<CELL> >::Type InitPtr;
+
+    const static int DIM = Topology::DIM;
+
+    /**
+     * Each buffer in migratedCells holds the cells of the
+     * corresponding Region in migratedRegions. Both vectors are
+     * expected to have the same length.
+     */
+    MigrationInitializer(
+        const InitPtr& delegate,
+        unsigned migrationStep,
+        const std::vector<Region<DIM> >& migratedRegions,
+        const std::vector<BufferType>& migratedCells) :
+        delegate(delegate),
+        migrationStep(migrationStep),
+        migratedRegions(migratedRegions),
+        migratedCells(migratedCells)
+    {
+        if (migratedRegions.size() != migratedCells.size()) {
+            throw std::invalid_argument("number of migrated regions and buffers doesn't match");
+        }
+    }
+
+    /**
+     * The wrapped Initializer is invoked first so that static data
+     * (e.g. the edge cell or the weights of unstructured grids) is
+     * set up, then the migrated cells replace the initial state.
+     */
+    virtual void grid(GridBase<CELL, DIM> *target)
+    {
+        delegate->grid(target);
+
+        for (std::size_t i = 0; i < migratedRegions.size(); ++i) {
+            if (!migratedRegions[i].empty()) {
+                target->loadRegion(migratedCells[i], migratedRegions[i]);
+            }
+        }
+    }
+
+    virtual CoordBox<DIM> gridBox()
+    {
+        return delegate->gridBox();
+    }
+
+    virtual Coord<DIM> gridDimensions() const
+    {
+        return delegate->gridDimensions();
+    }
+
+    virtual unsigned startStep() const
+    {
+        return migrationStep;
+    }
+
+    virtual unsigned maxSteps() const
+    {
+        return delegate->maxSteps();
+    }
+
+    virtual AdjacencyPtr getAdjacency(const Region<DIM>& region) const
+    {
+        return delegate->getAdjacency(region);
+    }
+
+    virtual AdjacencyPtr getReverseAdjacency(const Region<DIM>& region) const
+    {
+        const AdjacencyManufacturer<DIM>& manufacturer = *delegate;
+        return manufacturer.getReverseAdjacency(region);
+    }
+
+private:
+    InitPtr delegate;
+    unsigned migrationStep;
+    std::vector<Region<DIM> > migratedRegions;
+    std::vector<BufferType> migratedCells;
+};
+
+}
+
+#endif
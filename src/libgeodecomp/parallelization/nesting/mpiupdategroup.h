@@ -88,7 +88,8 @@ private:
                 target,
                 MPILayer::PATCH_LINK,
                 SerializationBuffer<CELL_TYPE>::cellMPIDataType(),
-                mpiLayer.communicator()));
+                mpiLayer.communicator(),
+                true));
 
     }
 
@@ -100,7 +101,8 @@ private:
                 source,
                 MPILayer::PATCH_LINK,
                 SerializationBuffer<CELL_TYPE>::cellMPIDataType(),
-                mpiLayer.communicator()));
+                mpiLayer.communicator(),
+                true));
     }
 };
 
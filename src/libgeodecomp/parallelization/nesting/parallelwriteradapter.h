@@ -2,6 +2,7 @@
 #define LIBGEODECOMP_PARALLELIZATION_NESTING_PARALLELWRITERADAPTER_H
 
 #include <libgeodecomp/io/parallelwriter.h>
+#include <libgeodecomp/misc/metrics.h>
 #include <libgeodecomp/misc/sharedptr.h>
 #include <libgeodecomp/storage/patchaccepter.h>
 
@@ -48,6 +49,27 @@ public:
         writer->setRegion(region);
     }
 
+    /**
+     * Discards all pending requests and re-arms the adapter for the
+     * first output after the given nano step. This is required when
+     * a Simulator rebuilds its Stepper in the middle of a run (e.g.
+     * after load balancing). Output up to and including nanoStep is
+     * assumed to have been delivered.
+     */
+    void resume(const std::size_t nanoStep)
+    {
+        requestedNanoSteps.clear();
+        if (nanoStep >= lastNanoStep) {
+            return;
+        }
+
+        std::size_t nextNanoStep = (nanoStep / stride + 1) * stride;
+        if (nextNanoStep < lastNanoStep) {
+            pushRequest(nextNanoStep);
+        }
+        pushRequest(lastNanoStep);
+    }
+
     virtual void put(
         const GRID_TYPE& grid,
         const Region<GRID_TYPE::DIM>& validRegion,
@@ -71,14 +93,17 @@ public:
             return;
         }
 
-        writer->stepFinished(
-            grid,
-            validRegion,
-            globalGridDimensions,
-            nanoStep / NANO_STEPS,
-            event,
-            rank,
-            lastCall);
+        {
+            Metrics::ScopedLatency latency(Metrics::WRITER_LATENCY);
+            writer->stepFinished(
+                grid,
+                validRegion,
+                globalGridDimensions,
+                nanoStep / NANO_STEPS,
+                event,
+                rank,
+                lastCall);
+        }
         erase_min(requestedNanoSteps);
         std::size_t nextNanoStep = nanoStep + stride;
         // first step might not be a multiple of the output period, so
@@ -50,6 +50,26 @@ public:
         steerer->setRegion(region);
     }
 
+    /**
+     * Counterpart to ParallelWriterAdapter::resume(): re-arms the
+     * adapter for the first steering event after the given nano
+     * step.
+     */
+    void resume(const std::size_t nanoStep)
+    {
+        storedNanoSteps.clear();
+        if (nanoStep >= lastNanoStep) {
+            return;
+        }
+
+        std::size_t stride = NANO_STEPS * steerer->getPeriod();
+        std::size_t nextNanoStep = (nanoStep / stride + 1) * stride;
+        if (nextNanoStep < lastNanoStep) {
+            storedNanoSteps << nextNanoStep;
+        }
+        storedNanoSteps << lastNanoStep;
+    }
+
     virtual void get(
         GRID_TYPE *destinationGrid,
         const Region<DIM>& patchableRegion,
@@ -0,0 +1,288 @@
+#ifndef LIBGEODECOMP_PARALLELIZATION_NESTING_TEMPORALBLOCKINGSTEPPER_H
+#define LIBGEODECOMP_PARALLELIZATION_NESTING_TEMPORALBLOCKINGSTEPPER_H
+
+#include <libgeodecomp/parallelization/nesting/vanillastepper.h>
+
+namespace LibGeoDecomp {
+
+/**
+ * The TemporalBlockingStepper behaves just like the VanillaStepper,
+ * but exploits wide ghost zones for cache reuse: while the
+ * VanillaStepper sweeps the whole inner set once per nano step, this
+ * Stepper updates all nano steps up to the next ghost zone
+ * synchronization in one skewed wavefront. The inner set is cut into
+ * slabs along the last axis. Step j + 1 trails step j by just enough
+ * slabs to satisfy the stencil's dependencies, so the slabs touched
+ * by all steps of one wave are still in cache when they're needed
+ * again.
+ *
+ * The wavefront schedule is exact even though only two grids are
+ * involved: each nano step performs exactly the same updates as
+ * before, merely the order of the updates changes.
+ *
+ * Temporal blocking is only applied if no PatchAccepter or
+ * PatchProvider of the inner set needs to be served in the middle of
+ * a block. Otherwise the Stepper falls back to updating single nano
+ * steps. The same holds if the inner set wraps around the last axis
+ * (periodic boundary conditions): its first slab would then depend on
+ * its last one, which the wavefront can't satisfy.
+ */
+template<typename CELL_TYPE, typename CONCURRENCY_SPEC>
+class TemporalBlockingStepper : public VanillaStepper<CELL_TYPE, CONCURRENCY_SPEC>
+{
+public:
+    friend class TemporalBlockingStepperTest;
+
+    typedef typename Stepper<CELL_TYPE>::Topology Topology;
+    const static int DIM = Topology::DIM;
+    const static unsigned NANO_STEPS = APITraits::SelectNanoSteps<CELL_TYPE>::VALUE;
+    const static int RADIUS = APITraits::SelectStencil<CELL_TYPE>::Value::RADIUS;
+
+    typedef VanillaStepper<CELL_TYPE, CONCURRENCY_SPEC> ParentType;
+    typedef typename ParentType::GridType GridType;
+    typedef typename ParentType::PatchAccepterVec PatchAccepterVec;
+    typedef typename ParentType::PatchProviderVec PatchProviderVec;
+    typedef typename ParentType::InitPtr InitPtr;
+    typedef typename ParentType::PartitionManagerPtr PartitionManagerPtr;
+    typedef typename ParentType::InnerSetConcurrencySpec InnerSetConcurrencySpec;
+
+    using ParentType::chronometer;
+    using ParentType::patchAccepters;
+    using ParentType::patchProviders;
+
+    using ParentType::innerSet;
+    using ParentType::innerSetConcurrencySpec;
+    using ParentType::remappedInnerSet;
+    using ParentType::globalNanoStep;
+    using ParentType::resetValidGhostZoneWidth;
+    using ParentType::update1;
+    using ParentType::updateGhost;
+
+    using ParentType::curStep;
+    using ParentType::curNanoStep;
+    using ParentType::validGhostZoneWidth;
+    using ParentType::ghostZoneWidth;
+    using ParentType::oldGrid;
+    using ParentType::newGrid;
+    using ParentType::enableFineGrainedParallelism;
+    using ParentType::partitionManager;
+
+    inline TemporalBlockingStepper(
+        PartitionManagerPtr partitionManager,
+        InitPtr initializer,
+        const PatchAccepterVec& ghostZonePatchAccepters = PatchAccepterVec(),
+        const PatchAccepterVec& innerSetPatchAccepters = PatchAccepterVec(),
+        const PatchProviderVec& ghostZonePatchProvidersPhase0 = PatchProviderVec(),
+        const PatchProviderVec& ghostZonePatchProvidersPhase1 = PatchProviderVec(),
+        const PatchProviderVec& innerSetPatchProviders = PatchProviderVec(),
+        bool enableFineGrainedParallelism = false) :
+        ParentType(
+            partitionManager,
+            initializer,
+            ghostZonePatchAccepters,
+            innerSetPatchAccepters,
+            ghostZonePatchProvidersPhase0,
+            ghostZonePatchProvidersPhase1,
+            innerSetPatchProviders,
+            enableFineGrainedParallelism)
+    {
+        setSlabThickness((std::max)(int(RADIUS), 1));
+    }
+
+    inline virtual void update(std::size_t nanoSteps)
+    {
+        for (std::size_t i = 0; i < nanoSteps;) {
+            std::size_t blockSize = validGhostZoneWidth;
+
+            if (supportsBlocking(Topology()) && !innerSetWraps &&
+                (blockSize > 1) && ((nanoSteps - i) >= blockSize) && !innerSetIOPending(blockSize)) {
+                updateBlock(blockSize);
+                i += blockSize;
+            } else {
+                update1();
+                ++i;
+            }
+        }
+    }
+
+    /**
+     * Sets the thickness (in cells along the last axis) of the slabs
+     * which make up the wavefront. Thinner slabs reduce the working
+     * set, but add overhead per slab.
+     */
+    inline void setSlabThickness(int newSlabThickness)
+    {
+        if (newSlabThickness < 1) {
+            throw std::invalid_argument("slab thickness needs to be positive");
+        }
+
+        slabThickness = newSlabThickness;
+        if (supportsBlocking(Topology())) {
+            initSlabs();
+        }
+    }
+
+private:
+    // slabbedInnerSets[i][s] is the intersection of
+    // remappedInnerSet(i) with slab s:
+    std::vector<std::vector<Region<DIM> > > slabbedInnerSets;
+    int slabThickness;
+    bool innerSetWraps;
+
+    /**
+     * returns true if any PatchAccepter or PatchProvider of the inner
+     * set would need to be notified within the next blockSize - 1
+     * nano steps.
+     */
+    inline bool innerSetIOPending(std::size_t blockSize)
+    {
+        std::size_t begin = globalNanoStep() + 1;
+        std::size_t end = globalNanoStep() + blockSize;
+
+        for (typename ParentType::PatchAccepterList::iterator i =
+                 patchAccepters[ParentType::INNER_SET].begin();
+             i != patchAccepters[ParentType::INNER_SET].end();
+             ++i) {
+            std::size_t nanoStep = (*i)->nextRequiredNanoStep();
+            if ((nanoStep >= begin) && (nanoStep < end)) {
+                return true;
+            }
+        }
+
+        for (typename ParentType::PatchProviderList::iterator i =
+                 patchProviders[ParentType::INNER_SET].begin();
+             i != patchProviders[ParentType::INNER_SET].end();
+             ++i) {
+            std::size_t nanoStep = (*i)->nextAvailableNanoStep();
+            if ((nanoStep >= begin) && (nanoStep < end)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * The stencil radius doesn't bound the distance of neighbors
+     * in unstructured grids, hence no skewed wavefronts there.
+     */
+    static bool supportsBlocking(const Topologies::Unstructured::Topology& /* unused */)
+    {
+        return false;
+    }
+
+    template<typename TOPOLOGY>
+    static bool supportsBlocking(const TOPOLOGY& /* unused */)
+    {
+        return true;
+    }
+
+    inline void initSlabs()
+    {
+        innerSetWraps = wrapsLastAxis(innerSet(0).boundingBox());
+        slabbedInnerSets.clear();
+        slabbedInnerSets.resize(ghostZoneWidth() + 1);
+
+        CoordBox<DIM> box = remappedInnerSet(0).boundingBox();
+        int depth = box.dimensions[DIM - 1];
+        int numSlabs = (depth + slabThickness - 1) / slabThickness;
+
+        for (unsigned i = 1; i <= ghostZoneWidth(); ++i) {
+            slabbedInnerSets[i].reserve(numSlabs);
+
+            for (int s = 0; s < numSlabs; ++s) {
+                CoordBox<DIM> slabBox = box;
+                slabBox.origin[DIM - 1] += s * slabThickness;
+                slabBox.dimensions[DIM - 1] = (std::min)(slabThickness, depth - s * slabThickness);
+
+                Region<DIM> slab;
+                slab << slabBox;
+                slabbedInnerSets[i].push_back(remappedInnerSet(i) & slab);
+            }
+        }
+    }
+
+    /**
+     * Returns true if the topology is periodic along the last axis
+     * and box touches both ends of the simulation space along it, so
+     * that cells in the first slab have neighbors in the last slab.
+     */
+    inline bool wrapsLastAxis(const CoordBox<DIM>& box) const
+    {
+        if (!Topology::template WrapsAxis<DIM - 1>::VALUE) {
+            return false;
+        }
+
+        int length = partitionManager->getSimulationArea()[DIM - 1];
+        return (box.origin[DIM - 1] <= 0) &&
+            ((box.origin[DIM - 1] + box.dimensions[DIM - 1]) >= length);
+    }
+
+    /**
+     * Updates the inner set by blockSize nano steps (which equals the
+     * remaining valid ghost zone width) and then hands over to the
+     * ghost zone update, just like blockSize calls of update1() would
+     * do.
+     */
+    inline void updateBlock(std::size_t blockSize)
+    {
+        using std::swap;
+        TimeTotal t(&chronometer);
+
+        unsigned firstIndex = ghostZoneWidth() - validGhostZoneWidth + 1;
+        {
+            TimeComputeInner t(&chronometer);
+
+            // step j + 1 may only enter a slab once step j has
+            // advanced RADIUS cells beyond it:
+            int lag = (RADIUS + slabThickness - 1) / slabThickness;
+            int numSlabs = slabbedInnerSets[firstIndex].size();
+            int numWaves = numSlabs + lag * (blockSize - 1);
+            GridType *grids[] = { &*oldGrid, &*newGrid };
+
+            for (int wave = 0; wave < numWaves; ++wave) {
+                for (std::size_t j = 0; j < blockSize; ++j) {
+                    int slab = wave - lag * j;
+                    if ((slab < 0) || (slab >= numSlabs)) {
+                        continue;
+                    }
+
+                    const Region<DIM>& region = slabbedInnerSets[firstIndex + j][slab];
+                    if (region.empty()) {
+                        continue;
+                    }
+
+                    UpdateFunctor<CELL_TYPE, InnerSetConcurrencySpec>()(
+                        region,
+                        Coord<DIM>(),
+                        Coord<DIM>(),
+                        *grids[j % 2],
+                        grids[(j + 1) % 2],
+                        (curNanoStep + j) % NANO_STEPS,
+                        innerSetConcurrencySpec());
+                }
+            }
+
+            if (blockSize % 2) {
+                swap(oldGrid, newGrid);
+            }
+
+            curNanoStep += blockSize;
+            curStep += curNanoStep / NANO_STEPS;
+            curNanoStep %= NANO_STEPS;
+            validGhostZoneWidth -= blockSize;
+        }
+
+        this->notifyPatchAccepters(innerSet(ghostZoneWidth()), ParentType::INNER_SET, globalNanoStep());
+
+        updateGhost();
+        resetValidGhostZoneWidth();
+
+        const Region<DIM>& nextRegion = innerSet(ghostZoneWidth() - validGhostZoneWidth);
+        this->notifyPatchProviders(nextRegion, ParentType::INNER_SET, globalNanoStep());
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,38 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_MPIUpdateGroupTest_init = false;
+#include "/root/repo/src/libgeodecomp/parallelization/nesting/test/parallel_mpi_1/mpiupdategrouptest.h"
+
+static MPIUpdateGroupTest suite_MPIUpdateGroupTest;
+
+static CxxTest::List Tests_MPIUpdateGroupTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MPIUpdateGroupTest( "/root/repo/src/libgeodecomp/parallelization/nesting/test/parallel_mpi_1/mpiupdategrouptest.h", 16, "MPIUpdateGroupTest", suite_MPIUpdateGroupTest, Tests_MPIUpdateGroupTest );
+
+static class TestDescription_suite_MPIUpdateGroupTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MPIUpdateGroupTest_testBasic() : CxxTest::RealTestDescription( Tests_MPIUpdateGroupTest, suiteDescription_MPIUpdateGroupTest, 52, "testBasic" ) {}
+ void runTest() { suite_MPIUpdateGroupTest.testBasic(); }
+} testDescription_suite_MPIUpdateGroupTest_testBasic;
+
@@ -0,0 +1,56 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_TemporalBlockingStepperTest_init = false;
+#include "/root/repo/src/libgeodecomp/parallelization/nesting/test/parallel_mpi_1/temporalblockingsteppertest.h"
+
+static TemporalBlockingStepperTest suite_TemporalBlockingStepperTest;
+
+static CxxTest::List Tests_TemporalBlockingStepperTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TemporalBlockingStepperTest( "/root/repo/src/libgeodecomp/parallelization/nesting/test/parallel_mpi_1/temporalblockingsteppertest.h", 13, "TemporalBlockingStepperTest", suite_TemporalBlockingStepperTest, Tests_TemporalBlockingStepperTest );
+
+static class TestDescription_suite_TemporalBlockingStepperTest_testUpdate2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TemporalBlockingStepperTest_testUpdate2D() : CxxTest::RealTestDescription( Tests_TemporalBlockingStepperTest, suiteDescription_TemporalBlockingStepperTest, 23, "testUpdate2D" ) {}
+ void runTest() { suite_TemporalBlockingStepperTest.testUpdate2D(); }
+} testDescription_suite_TemporalBlockingStepperTest_testUpdate2D;
+
+static class TestDescription_suite_TemporalBlockingStepperTest_testUpdate3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TemporalBlockingStepperTest_testUpdate3D() : CxxTest::RealTestDescription( Tests_TemporalBlockingStepperTest, suiteDescription_TemporalBlockingStepperTest, 31, "testUpdate3D" ) {}
+ void runTest() { suite_TemporalBlockingStepperTest.testUpdate3D(); }
+} testDescription_suite_TemporalBlockingStepperTest_testUpdate3D;
+
+static class TestDescription_suite_TemporalBlockingStepperTest_testUpdateRadius2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TemporalBlockingStepperTest_testUpdateRadius2() : CxxTest::RealTestDescription( Tests_TemporalBlockingStepperTest, suiteDescription_TemporalBlockingStepperTest, 39, "testUpdateRadius2" ) {}
+ void runTest() { suite_TemporalBlockingStepperTest.testUpdateRadius2(); }
+} testDescription_suite_TemporalBlockingStepperTest_testUpdateRadius2;
+
+static class TestDescription_suite_TemporalBlockingStepperTest_testInnerSetAccepter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TemporalBlockingStepperTest_testInnerSetAccepter() : CxxTest::RealTestDescription( Tests_TemporalBlockingStepperTest, suiteDescription_TemporalBlockingStepperTest, 45, "testInnerSetAccepter" ) {}
+ void runTest() { suite_TemporalBlockingStepperTest.testInnerSetAccepter(); }
+} testDescription_suite_TemporalBlockingStepperTest_testInnerSetAccepter;
+
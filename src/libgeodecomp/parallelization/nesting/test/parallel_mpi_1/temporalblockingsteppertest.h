@@ -0,0 +1,117 @@
+#include <cxxtest/TestSuite.h>
+
+#include <libgeodecomp.h>
+#include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/misc/testhelper.h>
+#include <libgeodecomp/parallelization/nesting/temporalblockingstepper.h>
+#include <libgeodecomp/storage/mockpatchaccepter.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class TemporalBlockingStepperTest : public CxxTest::TestSuite
+{
+public:
+    typedef TestCell<2> TestCellType2D;
+    typedef TestCell<3, Stencils::Moore<3, 1>, Topologies::Cube<3>::Topology> TestCellType3D;
+    typedef TestCell<2, Stencils::Moore<2, 2> > WideTestCellType;
+    typedef TestCell<2, Stencils::Moore<2, 1>, Topologies::Torus<2>::Topology> TorusTestCellType2D;
+    // TestCell<3> defaults to a torus:
+    typedef TestCell<3> TorusTestCellType3D;
+
+    void testUpdate2D()
+    {
+        checkUpdates<TestCellType2D>(Coord<2>(17, 12), 4, 1);
+        checkUpdates<TestCellType2D>(Coord<2>(17, 12), 3, 5);
+        checkUpdates<TorusTestCellType2D>(Coord<2>(17, 12), 4, 1);
+        checkUpdates<TorusTestCellType2D>(Coord<2>(17, 12), 3, 5);
+    }
+
+    void testUpdate3D()
+    {
+        checkUpdates<TestCellType3D>(Coord<3>(13, 12, 11), 3, 1);
+        checkUpdates<TestCellType3D>(Coord<3>(13, 12, 11), 5, 2);
+        checkUpdates<TorusTestCellType3D>(Coord<3>(13, 12, 11), 3, 1);
+        checkUpdates<TorusTestCellType3D>(Coord<3>(13, 12, 11), 5, 2);
+    }
+
+    void testUpdateRadius2()
+    {
+        checkUpdates<WideTestCellType>(Coord<2>(20, 21), 3, 1);
+        checkUpdates<WideTestCellType>(Coord<2>(20, 21), 4, 3);
+    }
+
+    void testInnerSetAccepter()
+    {
+        typedef TemporalBlockingStepper<TestCellType2D, UpdateFunctorHelpers::ConcurrencyNoP> StepperType;
+        typedef StepperType::GridType GridType;
+
+        SharedPtr<MockPatchAccepter<GridType> >::Type patchAccepter(new MockPatchAccepter<GridType>());
+        patchAccepter->pushRequest(6);
+        patchAccepter->pushRequest(9);
+
+        SharedPtr<StepperType>::Type stepper = makeStepper<StepperType, TestCellType2D>(Coord<2>(17, 12), 4);
+        stepper->addPatchAccepter(patchAccepter, StepperType::INNER_SET);
+
+        stepper->update(13);
+        TS_ASSERT_TEST_GRID(GridType, stepper->grid(), 13);
+        TS_ASSERT_EQUALS(std::size_t(2), patchAccepter->getOfferedNanoSteps().size());
+        TS_ASSERT_EQUALS(std::size_t(6), patchAccepter->getOfferedNanoSteps()[0]);
+        TS_ASSERT_EQUALS(std::size_t(9), patchAccepter->getOfferedNanoSteps()[1]);
+    }
+
+private:
+    template<typename STEPPER, typename CELL>
+    typename SharedPtr<STEPPER>::Type makeStepper(
+        const Coord<STEPPER::DIM>& dim,
+        unsigned ghostZoneWidth)
+    {
+        const int DIM = STEPPER::DIM;
+        typedef typename STEPPER::Topology Topology;
+        typedef typename STEPPER::InitPtr InitPtr;
+
+        InitPtr init(new TestInitializer<CELL>(dim));
+        CoordBox<DIM> box = init->gridBox();
+
+        std::vector<std::size_t> weights(1, box.dimensions.prod());
+        typename SharedPtr<Partition<DIM> >::Type partition(
+            new StripingPartition<DIM>(Coord<DIM>(), box.dimensions, 0, weights));
+        typename SharedPtr<AdjacencyManufacturer<DIM> >::Type adjacencyManufacturer(
+            new DummyAdjacencyManufacturer<DIM>);
+
+        typename SharedPtr<PartitionManager<Topology> >::Type partitionManager(
+            new PartitionManager<Topology>());
+        partitionManager->resetRegions(adjacencyManufacturer, box, partition, 0, ghostZoneWidth);
+        partitionManager->resetGhostZones(
+            std::vector<CoordBox<DIM> >(1, box),
+            std::vector<CoordBox<DIM> >(1, box));
+
+        return typename SharedPtr<STEPPER>::Type(new STEPPER(partitionManager, init));
+    }
+
+    template<typename CELL, int DIM>
+    void checkUpdates(const Coord<DIM>& dim, unsigned ghostZoneWidth, int slabThickness)
+    {
+        typedef TemporalBlockingStepper<CELL, UpdateFunctorHelpers::ConcurrencyNoP> StepperType;
+        typedef typename StepperType::GridType GridType;
+
+        typename SharedPtr<StepperType>::Type stepper = makeStepper<StepperType, CELL>(dim, ghostZoneWidth);
+        stepper->setSlabThickness(slabThickness);
+
+        unsigned expectedNanoStep = 0;
+        unsigned hops[] = { 1, 2, 3 * ghostZoneWidth, ghostZoneWidth + 1, 7, 2 * ghostZoneWidth };
+        for (int i = 0; i < 6; ++i) {
+            stepper->update(hops[i]);
+            expectedNanoStep += hops[i];
+
+            TS_ASSERT_TEST_GRID2(GridType, stepper->grid(), expectedNanoStep, typename);
+            TS_ASSERT_EQUALS(
+                expectedNanoStep,
+                stepper->currentStep().first * APITraits::SelectNanoSteps<CELL>::VALUE +
+                stepper->currentStep().second);
+        }
+    }
+};
+
+}
@@ -1,4 +1,5 @@
 #include <libgeodecomp.h>
+#include <libgeodecomp/geometry/partitions/hilbertpartition.h>
 #include <libgeodecomp/io/testinitializer.h>
 #include <libgeodecomp/misc/testhelper.h>
 #include <libgeodecomp/parallelization/nesting/vanillastepper.h>
@@ -97,6 +98,123 @@ public:
         checkInnerSet(2, 2);
     }
 
+    void testUpdateWithRegionGrid()
+    {
+        typedef TestCell<2, Stencils::Moore<2, 1>, Topologies::Cube<2>::Topology, APITraits::HasRegionGrid> CellType;
+        typedef VanillaStepper<CellType, UpdateFunctorHelpers::ConcurrencyEnableOpenMP> RegionGridStepperType;
+        typedef RegionGridStepperType::GridType RegionGridType;
+
+        SharedPtr<TestInitializer<CellType> >::Type regionGridInit(
+            new TestInitializer<CellType>(Coord<2>(17, 12)));
+        RegionGridStepperType regionGridStepper(partitionManager, regionGridInit);
+
+        // only our own region and its ghost zone get stored:
+        const RegionGridType& grid = regionGridStepper.grid();
+        TS_ASSERT_EQUALS(partitionManager->ownExpandedRegion().size(), grid.size());
+        TS_ASSERT_LESS_THAN(grid.size(), std::size_t(grid.boundingBox().dimensions.prod()));
+
+        // no ghost zone providers are attached, so we stay within
+        // one ghost zone period, just like testUpdate1():
+        for (int i = 1; i < ghostZoneWidth; ++i) {
+            regionGridStepper.update1();
+            TS_ASSERT_TEST_GRID_REGION(
+                RegionGridType,
+                regionGridStepper.grid(),
+                partitionManager->innerSet(i),
+                i);
+        }
+    }
+
+    void testUpdateWithRegionGridOnTorus()
+    {
+        typedef Topologies::Torus<2>::Topology Topology;
+        typedef TestCell<2, Stencils::Moore<2, 1>, Topology, APITraits::HasRegionGrid> RegionGridCellType;
+        typedef TestCell<2, Stencils::Moore<2, 1>, Topology> PlainCellType;
+        typedef VanillaStepper<RegionGridCellType, UpdateFunctorHelpers::ConcurrencyEnableOpenMP> RegionGridStepperType;
+        typedef VanillaStepper<PlainCellType, UpdateFunctorHelpers::ConcurrencyEnableOpenMP> PlainStepperType;
+        typedef RegionGridStepperType::GridType RegionGridType;
+        typedef PlainStepperType::GridType PlainGridType;
+
+        // a Hilbert curve yields irregular regions. We take rank 0,
+        // which starts in the origin, so its ghost zone wraps around
+        // the edges of the torus:
+        Coord<2> dim(32, 24);
+        CoordBox<2> box(Coord<2>(), dim);
+        std::vector<std::size_t> weights(4, dim.prod() / 4);
+        weights[3] += dim.prod() % 4;
+        SharedPtr<Partition<2> >::Type partition(
+            new HilbertPartition(Coord<2>(0, 0), dim, 0, weights));
+        SharedPtr<AdjacencyManufacturer<2> >::Type dummyAdjacencyManufacturer(new DummyAdjacencyManufacturer<2>);
+
+        SharedPtr<PartitionManager<Topology> >::Type torusPartitionManager(new PartitionManager<Topology>());
+        torusPartitionManager->resetRegions(
+            dummyAdjacencyManufacturer,
+            box,
+            partition,
+            0,
+            ghostZoneWidth);
+
+        std::vector<CoordBox<2> > boundingBoxes;
+        std::vector<CoordBox<2> > expandedBoundingBoxes;
+        for (int i = 0; i < 4; ++i) {
+            Region<2> region = partition->getRegion(i);
+            Region<2> expandedRegion = region.expandWithTopology(ghostZoneWidth, dim, Topology());
+
+            boundingBoxes.push_back(region.boundingBox());
+            expandedBoundingBoxes.push_back(expandedRegion.boundingBox());
+        }
+        torusPartitionManager->resetGhostZones(boundingBoxes, expandedBoundingBoxes);
+
+        RegionGridStepperType regionGridStepper(
+            torusPartitionManager,
+            SharedPtr<TestInitializer<RegionGridCellType> >::Type(new TestInitializer<RegionGridCellType>(dim)));
+        PlainStepperType plainStepper(
+            torusPartitionManager,
+            SharedPtr<TestInitializer<PlainCellType> >::Type(new TestInitializer<PlainCellType>(dim)));
+        TS_ASSERT_EQUALS(torusPartitionManager->ownExpandedRegion().size(), regionGridStepper.grid().size());
+
+        std::size_t wrappedLookups = 0;
+        for (int i = 1; i < ghostZoneWidth; ++i) {
+            // all neighbors of the inner set need to be found via
+            // their unwrapped coordinates, just like in the plain grid:
+            const RegionGridType& regionGrid = regionGridStepper.grid();
+            const PlainGridType& plainGrid = plainStepper.grid();
+            Region<2> innerSet = torusPartitionManager->innerSet(i - 1);
+
+            for (Region<2>::Iterator j = innerSet.begin(); j != innerSet.end(); ++j) {
+                for (int y = -1; y <= 1; ++y) {
+                    for (int x = -1; x <= 1; ++x) {
+                        Coord<2> neighbor = *j + Coord<2>(x, y);
+                        if (!box.inBounds(neighbor)) {
+                            ++wrappedLookups;
+                        }
+
+                        RegionGridCellType actual = regionGrid.get(neighbor);
+                        PlainCellType expected = plainGrid.get(neighbor);
+                        TS_ASSERT(!actual.isEdgeCell);
+                        TS_ASSERT_EQUALS(expected.pos, actual.pos);
+                        TS_ASSERT_EQUALS(expected.cycleCounter, actual.cycleCounter);
+                        TS_ASSERT_EQUALS(expected.testValue, actual.testValue);
+                    }
+                }
+            }
+            regionGridStepper.update1();
+            plainStepper.update1();
+            TS_ASSERT_TEST_GRID_REGION(
+                RegionGridType,
+                regionGridStepper.grid(),
+                torusPartitionManager->innerSet(i),
+                i);
+            TS_ASSERT_TEST_GRID_REGION(
+                PlainGridType,
+                plainStepper.grid(),
+                torusPartitionManager->innerSet(i),
+                i);
+        }
+
+        TS_ASSERT_LESS_THAN(std::size_t(0), wrappedLookups);
+    }
+
 private:
     int ghostZoneWidth;
     SharedPtr<TestInitializer<TestCell<2> > >::Type init;
@@ -0,0 +1,17 @@
+
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#include <libgeodecomp/communication/typemaps.h>
+
+int run_tests(int argc, char **argv);
+
+int main(int argc, char **argv)
+{
+    MPI_Init(&argc, &argv);
+    int res = run_tests(argc, argv);
+    MPI_Finalize();
+    return res;
+}
+
+#endif
@@ -0,0 +1,73 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_OffsetHelperTest_init = false;
+#include "/root/repo/src/libgeodecomp/parallelization/nesting/test/unit/offsethelpertest.h"
+
+static OffsetHelperTest suite_OffsetHelperTest;
+
+static CxxTest::List Tests_OffsetHelperTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_OffsetHelperTest( "/root/repo/src/libgeodecomp/parallelization/nesting/test/unit/offsethelpertest.h", 10, "OffsetHelperTest", suite_OffsetHelperTest, Tests_OffsetHelperTest );
+
+static class TestDescription_suite_OffsetHelperTest_testTorus2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OffsetHelperTest_testTorus2D() : CxxTest::RealTestDescription( Tests_OffsetHelperTest, suiteDescription_OffsetHelperTest, 13, "testTorus2D" ) {}
+ void runTest() { suite_OffsetHelperTest.testTorus2D(); }
+} testDescription_suite_OffsetHelperTest_testTorus2D;
+
+static class TestDescription_suite_OffsetHelperTest_testTorus3DWithRegionNearOrigin : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OffsetHelperTest_testTorus3DWithRegionNearOrigin() : CxxTest::RealTestDescription( Tests_OffsetHelperTest, suiteDescription_OffsetHelperTest, 36, "testTorus3DWithRegionNearOrigin" ) {}
+ void runTest() { suite_OffsetHelperTest.testTorus3DWithRegionNearOrigin(); }
+} testDescription_suite_OffsetHelperTest_testTorus3DWithRegionNearOrigin;
+
+static class TestDescription_suite_OffsetHelperTest_testTorus3DWithRegionCloseToFarCorner : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OffsetHelperTest_testTorus3DWithRegionCloseToFarCorner() : CxxTest::RealTestDescription( Tests_OffsetHelperTest, suiteDescription_OffsetHelperTest, 58, "testTorus3DWithRegionCloseToFarCorner" ) {}
+ void runTest() { suite_OffsetHelperTest.testTorus3DWithRegionCloseToFarCorner(); }
+} testDescription_suite_OffsetHelperTest_testTorus3DWithRegionCloseToFarCorner;
+
+static class TestDescription_suite_OffsetHelperTest_testTorus2DWithRegionOnCloseAndFarCorners : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OffsetHelperTest_testTorus2DWithRegionOnCloseAndFarCorners() : CxxTest::RealTestDescription( Tests_OffsetHelperTest, suiteDescription_OffsetHelperTest, 80, "testTorus2DWithRegionOnCloseAndFarCorners" ) {}
+ void runTest() { suite_OffsetHelperTest.testTorus2DWithRegionOnCloseAndFarCorners(); }
+} testDescription_suite_OffsetHelperTest_testTorus2DWithRegionOnCloseAndFarCorners;
+
+static class TestDescription_suite_OffsetHelperTest_testTorus3DWithRegionOnCloseAndFarCorners : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OffsetHelperTest_testTorus3DWithRegionOnCloseAndFarCorners() : CxxTest::RealTestDescription( Tests_OffsetHelperTest, suiteDescription_OffsetHelperTest, 102, "testTorus3DWithRegionOnCloseAndFarCorners" ) {}
+ void runTest() { suite_OffsetHelperTest.testTorus3DWithRegionOnCloseAndFarCorners(); }
+} testDescription_suite_OffsetHelperTest_testTorus3DWithRegionOnCloseAndFarCorners;
+
+static class TestDescription_suite_OffsetHelperTest_testTorus3DWithOrdinaryRegion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OffsetHelperTest_testTorus3DWithOrdinaryRegion() : CxxTest::RealTestDescription( Tests_OffsetHelperTest, suiteDescription_OffsetHelperTest, 124, "testTorus3DWithOrdinaryRegion" ) {}
+ void runTest() { suite_OffsetHelperTest.testTorus3DWithOrdinaryRegion(); }
+} testDescription_suite_OffsetHelperTest_testTorus3DWithOrdinaryRegion;
+
+static class TestDescription_suite_OffsetHelperTest_testCube2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OffsetHelperTest_testCube2D() : CxxTest::RealTestDescription( Tests_OffsetHelperTest, suiteDescription_OffsetHelperTest, 145, "testCube2D" ) {}
+ void runTest() { suite_OffsetHelperTest.testCube2D(); }
+} testDescription_suite_OffsetHelperTest_testCube2D;
+
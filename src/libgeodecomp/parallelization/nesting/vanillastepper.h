@@ -1,6 +1,7 @@
 #ifndef LIBGEODECOMP_PARALLELIZATION_NESTING_VANILLASTEPPER_H
 #define LIBGEODECOMP_PARALLELIZATION_NESTING_VANILLASTEPPER_H
 
+#include <libgeodecomp/misc/eventtrace.h>
 #include <libgeodecomp/parallelization/nesting/commonstepper.h>
 #include <libgeodecomp/storage/updatefunctor.h>
 
@@ -35,6 +36,8 @@ public:
     typedef typename ParentType::PatchProviderVec PatchProviderVec;
     typedef typename ParentType::InitPtr InitPtr;
     typedef typename ParentType::PartitionManagerPtr PartitionManagerPtr;
+    typedef UpdateFunctorHelpers::ConcurrencyWithProgress<
+        CONCURRENCY_SPEC, typename ParentType::ProgressFunctor> InnerSetConcurrencySpec;
 
     using ParentType::initializer;
     using ParentType::patchAccepters;
@@ -64,7 +67,6 @@ public:
     using ParentType::newGrid;
     using ParentType::rimBuffer;
     using ParentType::kernelBuffer;
-    using ParentType::kernelFraction;
     using ParentType::enableFineGrainedParallelism;
 
     inline VanillaStepper(
@@ -89,24 +91,37 @@ public:
         initGrids();
     }
 
-private:
+protected:
+    /**
+     * The inner set's update is where our ghost zone transfers have
+     * the time to complete, hence we let the UpdateFunctor drive
+     * them forward.
+     */
+    inline InnerSetConcurrencySpec innerSetConcurrencySpec()
+    {
+        return InnerSetConcurrencySpec(
+            CONCURRENCY_SPEC(false, enableFineGrainedParallelism),
+            typename ParentType::ProgressFunctor(this));
+    }
+
     inline void update1()
     {
         using std::swap;
+        EventTrace::setNanoStep(globalNanoStep());
         TimeTotal t(&chronometer);
         unsigned index = ghostZoneWidth() - --validGhostZoneWidth;
         const Region<DIM>& region = remappedInnerSet(index);
         {
             TimeComputeInner t(&chronometer);
 
-            UpdateFunctor<CELL_TYPE, CONCURRENCY_SPEC>()(
+            UpdateFunctor<CELL_TYPE, InnerSetConcurrencySpec>()(
                 region,
                 Coord<DIM>(),
                 Coord<DIM>(),
                 *oldGrid,
                 &*newGrid,
                 curNanoStep,
-                CONCURRENCY_SPEC(false, enableFineGrainedParallelism));
+                innerSetConcurrencySpec());
             swap(oldGrid, newGrid);
 
             ++curNanoStep;
@@ -157,16 +172,22 @@ private:
     inline void updateGhost()
     {
         using std::swap;
+        // With a ghost zone width of 1 the only update step writes
+        // to newGrid, so just the PatchProviders may touch the kernel:
+        bool kernelVolatile =
+            (ghostZoneWidth() > 1) ||
+            this->patchProvidersPending(ParentType::GHOST_PHASE_0, globalNanoStep()) ||
+            this->patchProvidersPending(ParentType::GHOST_PHASE_1, globalNanoStep());
+
         {
             TimeComputeGhost t(&chronometer);
 
-            // fixme: skip all this ghost zone buffering for
-            // ghostZoneWidth == 1?
-
             // 1: Prepare grid. The following update of the ghostzone will
             // destroy parts of the kernel, which is why we'll
             // save/restore those.
-            saveKernel();
+            if (kernelVolatile) {
+                saveKernel();
+            }
             // We need to restore the rim since it got destroyed while the
             // kernel was updated.
             restoreRim(false);
@@ -178,6 +199,7 @@ private:
         std::size_t curGlobalNanoStep = globalNanoStep();
 
         for (std::size_t t = 0; t < ghostZoneWidth(); ++t) {
+            EventTrace::setNanoStep(curGlobalNanoStep);
             this->notifyPatchProviders(rim(t), ParentType::GHOST_PHASE_0, globalNanoStep());
             this->notifyPatchProviders(rim(t), ParentType::GHOST_PHASE_1, globalNanoStep());
 
@@ -216,11 +238,23 @@ private:
                 swap(oldGrid, newGrid);
             }
 
-            // 3: restore grid for kernel update
+            // 3: restore grid for kernel update. Until the next
+            // ghost zone update the inner set's update won't touch
+            // the outer ghost zone, so the PatchProviders may fill it
+            // in the grid which will be oldGrid by then. Their
+            // receives need to be posted before we wait for the
+            // PatchAccepters' sends, or we might deadlock:
+            GridType *nextGhostGrid = (ghostZoneWidth() % 2) ? &*newGrid : &*oldGrid;
+            this->preparePatchProviders(ParentType::GHOST_PHASE_0, nextGhostGrid);
+            this->preparePatchProviders(ParentType::GHOST_PHASE_1, nextGhostGrid);
+            this->flushPatchAccepters(ParentType::GHOST_PHASE_0);
+
             curNanoStep = oldNanoStep;
             curStep = oldStep;
             restoreRim(true);
-            restoreKernel();
+            if (kernelVolatile) {
+                restoreKernel();
+            }
         }
     }
 };
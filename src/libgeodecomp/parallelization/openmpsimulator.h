@@ -6,15 +6,26 @@
 
 #include <libgeodecomp/communication/hpxserializationwrapper.h>
 #include <libgeodecomp/io/writer.h>
+#include <libgeodecomp/misc/metrics.h>
+#include <libgeodecomp/misc/numautil.h>
 #include <libgeodecomp/parallelization/serialsimulator.h>
 #include <libgeodecomp/storage/gridtypeselector.h>
 #include <libgeodecomp/storage/updatefunctor.h>
 
+#include <iomanip>
+#include <sstream>
+
 namespace LibGeoDecomp {
 
 /**
  * OpenMPSimulator is based on SerialSimulator, but is capable of
  * threading via OpenMP.
+ *
+ * On multi-socket machines enableNUMAPlacement should be set: it
+ * pins the threads to cores and places the grids' pages on the NUMA
+ * node of the thread which is going to update them. The update then
+ * uses static scheduling so that threads always process the same
+ * planes. See placementReport() to verify the placement.
  */
 template<typename CELL_TYPE>
 class OpenMPSimulator : public SerialSimulator<CELL_TYPE>
@@ -47,19 +58,63 @@ public:
      */
     explicit OpenMPSimulator(
         Initializer<CELL_TYPE> *initializer,
-        bool enableFineGrainedParallelism = false) :
+        bool enableFineGrainedParallelism = false,
+        bool enableNUMAPlacement = false) :
         SerialSimulator<CELL_TYPE>(initializer),
-        enableFineGrainedParallelism(enableFineGrainedParallelism)
-    {}
+        enableFineGrainedParallelism(enableFineGrainedParallelism),
+        enableNUMAPlacement(enableNUMAPlacement)
+    {
+        if (enableNUMAPlacement) {
+            NUMAUtil::pinThreads();
+            placePages(curGrid->data());
+            placePages(newGrid->data());
+        }
+    }
+
+    /**
+     * Lists per NUMA node (i.e. per socket) how many threads run
+     * there and how many pages of the two grids reside there.
+     * Complements the Chronometer's timings when checking whether
+     * NUMA placement is effective.
+     */
+    std::string placementReport() const
+    {
+        std::vector<std::size_t> threads = NUMAUtil::threadsPerNode();
+        std::vector<std::size_t> pages = pagesPerNode(curGrid->data());
+        std::vector<std::size_t> newPages = pagesPerNode(newGrid->data());
+
+        std::size_t numNodes = (std::max)(threads.size(), (std::max)(pages.size(), newPages.size()));
+        threads.resize(numNodes, 0);
+        pages.resize(numNodes, 0);
+        newPages.resize(numNodes, 0);
+
+        std::stringstream buf;
+        for (std::size_t i = 0; i < numNodes; ++i) {
+            std::stringstream node;
+            node << "numa_node_" << i;
+            buf << std::left << std::setw(20) << node.str()
+                << ": " << threads[i] << " threads, "
+                << (pages[i] + newPages[i]) << " pages\n";
+        }
+
+        return buf.str();
+    }
 
 protected:
     bool enableFineGrainedParallelism;
+    bool enableNUMAPlacement;
 
     void nanoStep(unsigned nanoStep)
     {
         using std::swap;
+        EventTrace::setNanoStep(long(stepNum) * NANO_STEPS + nanoStep);
         TimeCompute t(&chronometer);
 
+        // static scheduling (which the UpdateFunctor associates
+        // with non-ghost updates) keeps threads on the planes whose
+        // pages were placed for them:
+        bool dynamicScheduling = !enableNUMAPlacement;
+
         UpdateFunctor<CELL_TYPE, UpdateFunctorHelpers::ConcurrencyEnableOpenMP>()(
             simArea,
             Coord<DIM>(),
@@ -67,10 +122,64 @@ protected:
             *curGrid,
             newGrid,
             nanoStep,
-            UpdateFunctorHelpers::ConcurrencyEnableOpenMP(true, enableFineGrainedParallelism));
+            UpdateFunctorHelpers::ConcurrencyEnableOpenMP(dynamicScheduling, enableFineGrainedParallelism));
         swap(curGrid, newGrid);
     }
 
+    /**
+     * Moves the pages of each plane to the NUMA node of the thread
+     * which the UpdateFunctor's static schedule assigns to it. The
+     * grids have already been initialized (and thus touched) by the
+     * main thread, so we can't rely on the OS' first-touch policy.
+     */
+    void placePages(CELL_TYPE *cells)
+    {
+        Coord<DIM> dimensions = curGrid->boundingBox().dimensions;
+        std::size_t numPlanes = dimensions[DIM - 1];
+        std::size_t planeSize = dimensions.prod() / numPlanes;
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel
+#endif
+        {
+            std::size_t firstPlane = numPlanes;
+            std::size_t endPlane = 0;
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp for schedule(static)
+#endif
+            for (std::size_t c = 0; c < numPlanes; ++c) {
+                firstPlane = (std::min)(firstPlane, c);
+                endPlane = c + 1;
+            }
+
+            if (firstPlane < endPlane) {
+                NUMAUtil::movePages(
+                    cells + firstPlane * planeSize,
+                    cells + endPlane   * planeSize,
+                    NUMAUtil::currentNode());
+            }
+        }
+    }
+
+    /**
+     * SoA grids interleave all planes within each member array, so
+     * there is no contiguous chunk of memory per thread to place.
+     */
+    void placePages(char * /* unused: data */)
+    {}
+
+    std::vector<std::size_t> pagesPerNode(const CELL_TYPE *cells) const
+    {
+        std::size_t size = curGrid->boundingBox().dimensions.prod();
+        return NUMAUtil::pagesPerNode(cells, cells + size);
+    }
+
+    std::vector<std::size_t> pagesPerNode(const char * /* unused: data */) const
+    {
+        return std::vector<std::size_t>();
+    }
+
     /**
      * notifies all registered Writers
      */
@@ -82,6 +191,7 @@ protected:
         for (unsigned i = 0; i < writers.size(); i++) {
             if ((event != WRITER_STEP_FINISHED) ||
                 ((getStep() % writers[i]->getPeriod()) == 0)) {
+                Metrics::ScopedLatency latency(Metrics::WRITER_LATENCY);
                 writers[i]->stepFinished(
                     *curGrid,
                     getStep(),
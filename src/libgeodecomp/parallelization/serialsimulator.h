@@ -6,6 +6,8 @@
 
 #include <libgeodecomp/communication/hpxserializationwrapper.h>
 #include <libgeodecomp/io/writer.h>
+#include <libgeodecomp/misc/eventtrace.h>
+#include <libgeodecomp/misc/metrics.h>
 #include <libgeodecomp/parallelization/monolithicsimulator.h>
 #include <libgeodecomp/storage/gridtypeselector.h>
 #include <libgeodecomp/storage/updatefunctor.h>
@@ -132,6 +134,7 @@ protected:
     virtual void nanoStep(unsigned nanoStep)
     {
         using std::swap;
+        EventTrace::setNanoStep(long(stepNum) * NANO_STEPS + nanoStep);
         TimeCompute t(&chronometer);
 
         UpdateFunctor<CELL_TYPE>()(simArea, Coord<DIM>(), Coord<DIM>(), *curGrid, newGrid, nanoStep);
@@ -148,6 +151,7 @@ protected:
         for (unsigned i = 0; i < writers.size(); i++) {
             if ((event != WRITER_STEP_FINISHED) ||
                 ((getStep() % writers[i]->getPeriod()) == 0)) {
+                Metrics::ScopedLatency latency(Metrics::WRITER_LATENCY);
                 writers[i]->stepFinished(
                     *curGrid,
                     getStep(),
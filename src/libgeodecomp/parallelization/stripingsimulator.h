@@ -7,6 +7,8 @@
 #include <algorithm>
 #include <libgeodecomp/communication/mpilayer.h>
 #include <libgeodecomp/loadbalancer/loadbalancer.h>
+#include <libgeodecomp/misc/eventtrace.h>
+#include <libgeodecomp/misc/metrics.h>
 #include <libgeodecomp/misc/sharedptr.h>
 #include <libgeodecomp/misc/stringops.h>
 #include <libgeodecomp/parallelization/distributedsimulator.h>
@@ -20,6 +22,11 @@ namespace LibGeoDecomp {
  * This class aims at providing a very simple, but working parallel
  * simulation facility. It's not very modular, it's not fast, but it's
  * simple and it actually works.
+ *
+ * Each stripe is updated via OpenMP (if available), so running one
+ * rank per node is feasible. The ghost zones are sent before the
+ * interior is updated and MPI is kept progressing while the interior
+ * update is running, so communication overlaps with computation.
  */
 template<typename CELL_TYPE>
 class StripingSimulator : public DistributedSimulator<CELL_TYPE>
@@ -36,6 +43,7 @@ public:
     typedef typename Steerer<CELL_TYPE>::SteererFeedback SteererFeedback;
     typedef typename SerializationBuffer<CELL_TYPE>::BufferType BufferType;
     typedef typename DistributedSimulator<CELL_TYPE>::InitPtr InitPtr;
+    typedef UpdateFunctorHelpers::ConcurrencyEnableOpenMP ConcurrencySpec;
 
     static const int DIM = Topology::DIM;
     static const bool WRAP_EDGES = Topology::template WrapsAxis<DIM - 1>::VALUE;
@@ -58,11 +66,13 @@ public:
     explicit StripingSimulator(
         Initializer<CELL_TYPE> *initializer,
         LoadBalancer *balancer = 0,
-        unsigned loadBalancingPeriod = 1):
+        unsigned loadBalancingPeriod = 1,
+        bool enableFineGrainedParallelism = false):
         DistributedSimulator<CELL_TYPE>(initializer),
         balancer(balancer),
         partitions(partition(initializer->gridDimensions()[DIM - 1], MPILayer().size())),
-        loadBalancingPeriod(loadBalancingPeriod)
+        loadBalancingPeriod(loadBalancingPeriod),
+        enableFineGrainedParallelism(enableFineGrainedParallelism)
     {
         validateConstructorParams();
 
@@ -77,11 +87,13 @@ public:
     explicit StripingSimulator(
         const InitPtr& initializer,
         LoadBalancer *balancer = 0,
-        unsigned loadBalancingPeriod = 1):
+        unsigned loadBalancingPeriod = 1,
+        bool enableFineGrainedParallelism = false):
         DistributedSimulator<CELL_TYPE>(initializer),
         balancer(balancer),
         partitions(partition(initializer->gridDimensions()[DIM - 1], MPILayer().size())),
-        loadBalancingPeriod(loadBalancingPeriod)
+        loadBalancingPeriod(loadBalancingPeriod),
+        enableFineGrainedParallelism(enableFineGrainedParallelism)
     {
         validateConstructorParams();
 
@@ -105,35 +117,41 @@ public:
      */
     virtual void step()
     {
-        balanceLoad();
-
-        handleInput(STEERER_NEXT_STEP);
-
-        for (unsigned i = 0; i < NANO_STEPS; i++) {
-            nanoStep(i);
-        }
-
-        ++stepNum;
+        SteererFeedback feedback;
+        step(&feedback);
+    }
 
-        WriterEvent event = WRITER_STEP_FINISHED;
-        if (stepNum == initializer->maxSteps()) {
-            event = WRITER_ALL_DONE;
-        }
-        handleOutput(event);
+    virtual void step(SteererFeedback *feedback)
+    {
+        balanceLoad(feedback);
+        advance(feedback);
     }
 
     /**
-     * performs step() until the maximum number of steps is reached.
+     * performs step() until the maximum number of steps is reached
+     * or a Steerer on any node requests the simulation to end. Such
+     * requests are collected during load balancing, so the simulation
+     * may continue for up to loadBalancingPeriod - 1 steps after the
+     * request.
      */
     virtual void run()
     {
         initSimulation();
         setIORegions();
+
+        SteererFeedback feedback;
+        handleInput(STEERER_INITIALIZED, &feedback);
         handleOutput(WRITER_INITIALIZED);
 
         while (stepNum < initializer->maxSteps()) {
-            step();
+            if (balanceLoad(&feedback)) {
+                break;
+            }
+
+            advance(&feedback);
         }
+
+        handleInput(STEERER_ALL_DONE, &feedback);
     }
 
     inline unsigned getLoadBalancingPeriod() const
@@ -147,6 +165,30 @@ public:
     }
 
 private:
+    /**
+     * Keeps the ghost zone transfers moving while the interior is
+     * being updated. Without this most MPI implementations would only
+     * start transmitting once we wait for the ghost zones.
+     */
+    class ProgressFunctor
+    {
+    public:
+        inline explicit ProgressFunctor(MPILayer *mpilayer) :
+            mpilayer(mpilayer)
+        {}
+
+        inline void operator()() const
+        {
+            mpilayer->test(GHOSTREGION);
+        }
+
+    private:
+        MPILayer *mpilayer;
+    };
+
+    typedef UpdateFunctorHelpers::ConcurrencyWithProgress<
+        ConcurrencySpec, ProgressFunctor> InnerConcurrencySpec;
+
     MPILayer mpilayer;
     typename SharedPtr<LoadBalancer>::Type balancer;
     /**
@@ -176,6 +218,7 @@ private:
     // contains the start and stop rows for each node's stripe
     WeightVec partitions;
     unsigned loadBalancingPeriod;
+    bool enableFineGrainedParallelism;
 
     /**
      * these Regions will only be used by the UpdateFunctor. They
@@ -234,24 +277,68 @@ private:
     /**
      * the methods below are just used to structurize the step() method.
      */
-    void balanceLoad()
+    void advance(SteererFeedback *feedback)
+    {
+        handleInput(STEERER_NEXT_STEP, feedback);
+
+        for (unsigned i = 0; i < NANO_STEPS; i++) {
+            nanoStep(i);
+        }
+
+        ++stepNum;
+
+        WriterEvent event = WRITER_STEP_FINISHED;
+        if (stepNum == initializer->maxSteps()) {
+            event = WRITER_ALL_DONE;
+        }
+        handleOutput(event);
+    }
+
+    /**
+     * Besides the loads, rank 0 also collects the nodes' requests to
+     * end the simulation and broadcasts the verdict along with the
+     * new partitions. The decision to end the simulation needs to be
+     * collective: if only the nodes with a terminating Steerer
+     * bailed out, their neighbors would wait for ghost zones forever.
+     * Returns true if the simulation is to be ended.
+     */
+    bool balanceLoad(SteererFeedback *feedback)
     {
         if (stepNum % loadBalancingPeriod != 0) {
-            return;
+            return false;
         }
 
         // weird: GCC 4.7.3 refuses to let me use chronometer.ratio<Foo, Bar> directly.
         Chronometer& c = chronometer;
         double myRatio = c.template ratio<TimeCompute, TimeTotal>();
         chronometer.reset();
-        LoadVec loads = mpilayer.gather(myRatio, 0);
+
+        // each node sends its load and its end request:
+        double sendBuffer[] = { myRatio, feedback->simulationEnded() ? 1.0 : 0.0 };
+        std::vector<double> recvBuffer((mpilayer.rank() == 0) ? 2 * mpilayer.size() : 0);
+        mpilayer.gatherV(
+            sendBuffer,
+            2,
+            std::vector<int>(mpilayer.size(), 2),
+            0,
+            (mpilayer.rank() == 0) ? &recvBuffer[0] : 0);
         WeightVec newPartitionsSendBuffer;
 
         if (mpilayer.rank() == 0) {
+            LoadVec loads(mpilayer.size());
+            std::size_t endRequested = 0;
+            for (int i = 0; i < mpilayer.size(); ++i) {
+                loads[i] = recvBuffer[2 * i + 0];
+                if (recvBuffer[2 * i + 1] != 0) {
+                    endRequested = 1;
+                }
+            }
+
             WeightVec oldWorkloads = partitionsToWorkloads(partitions);
             WeightVec newWorkloads = balancer->balance(oldWorkloads, loads);
             validateLoads(newWorkloads, oldWorkloads);
             newPartitionsSendBuffer = workloadsToPartitions(newWorkloads);
+            newPartitionsSendBuffer << endRequested;
 
             for (int i = 0; i < mpilayer.size(); i++) {
                 mpilayer.sendVec(&newPartitionsSendBuffer, i, BALANCELOADS);
@@ -259,15 +346,23 @@ private:
         }
 
         WeightVec oldPartitions = partitions;
-        WeightVec newPartitions(partitions.size());
+        WeightVec newPartitions(partitions.size() + 1);
         mpilayer.recvVec(&newPartitions, 0, BALANCELOADS);
         mpilayer.wait(BALANCELOADS);
+        bool endSimulation = newPartitions.back();
+        newPartitions.pop_back();
 
         redistributeGrid(oldPartitions, newPartitions);
+
+        if (endSimulation) {
+            feedback->endSimulation();
+        }
+        return endSimulation;
     }
 
     void nanoStep(unsigned nanoStep)
     {
+        EventTrace::setNanoStep(long(stepNum) * NANO_STEPS + nanoStep);
         TimeTotal t(&chronometer);
 
         // we wait for ghostregions "just in time" to overlap
@@ -312,9 +407,8 @@ private:
         }
     }
 
-    void handleInput(SteererEvent event)
+    void handleInput(SteererEvent event, SteererFeedback *feedback)
     {
-        SteererFeedback feedback;
         // notify all registered Steerers
         waitForGhostRegions(curStripe);
 
@@ -327,11 +421,13 @@ private:
                     event,
                     mpilayer.rank(),
                     true,
-                    &feedback);
+                    feedback);
             }
         }
 
-        // fixme: apply SteererFeedback!
+        // setStaticData() has already been applied by the feedback
+        // itself. That's safe here as no update is running, while
+        // endSimulation() is evaluated collectively in balanceLoad().
     }
 
     void handleOutput(WriterEvent event)
@@ -339,6 +435,7 @@ private:
         for(unsigned i = 0; i < writers.size(); i++) {
             if ((event != WRITER_STEP_FINISHED) ||
                 ((getStep() % writers[i]->getPeriod()) == 0)) {
+                Metrics::ScopedLatency latency(Metrics::WRITER_LATENCY);
                 writers[i]->stepFinished(
                     *curStripe,
                     region,
@@ -369,15 +466,20 @@ private:
         return CoordBox<DIM>(startCorner, dim);
     }
 
-    void updateRegion(const Region<DIM>& region, unsigned nanoStep)
+    template<typename CONCURRENCY_SPEC>
+    void updateRegion(
+        const Region<DIM>& region,
+        unsigned nanoStep,
+        const CONCURRENCY_SPEC& concurrencySpec)
     {
-        UpdateFunctor<CELL_TYPE>()(
+        UpdateFunctor<CELL_TYPE, CONCURRENCY_SPEC>()(
             region,
             Coord<DIM>(),
             Coord<DIM>(),
             *curStripe,
             newStripe,
-            nanoStep);
+            nanoStep,
+            concurrencySpec);
     }
 
     /**
@@ -386,7 +488,10 @@ private:
     void updateInnerGhostRegion(unsigned nanoStep)
     {
         TimeComputeGhost t(&chronometer);
-        updateRegion(remappedInnerGhostRegion, nanoStep);
+        updateRegion(
+            remappedInnerGhostRegion,
+            nanoStep,
+            ConcurrencySpec(true, enableFineGrainedParallelism));
     }
 
     void recvOuterGhostRegion()
@@ -426,7 +531,12 @@ private:
     void updateInside(unsigned nanoStep)
     {
         TimeComputeInner t(&chronometer);
-        updateRegion(remappedInnerRegion, nanoStep);
+        updateRegion(
+            remappedInnerRegion,
+            nanoStep,
+            InnerConcurrencySpec(
+                ConcurrencySpec(false, enableFineGrainedParallelism),
+                ProgressFunctor(&mpilayer)));
     }
 
     Region<DIM> fillRegion(int startRow, int endRow)
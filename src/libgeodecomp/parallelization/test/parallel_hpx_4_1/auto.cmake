@@ -0,0 +1,11 @@
+set(SOURCES ${SOURCES}
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}hpxdataflowsimulatortest.h
+  ${RELATIVE_PATH}hpxsimulator2test.h
+  ${RELATIVE_PATH}hpxsimulator3test.h
+  ${RELATIVE_PATH}hpxsimulator4test.h
+  ${RELATIVE_PATH}hpxsimulator5test.h
+  ${RELATIVE_PATH}hpxsimulator6test.h
+  ${RELATIVE_PATH}hpxsimulatortest.h
+)
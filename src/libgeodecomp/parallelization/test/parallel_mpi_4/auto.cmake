@@ -0,0 +1,14 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}dataflowsimulatortest.cpp
+  ${RELATIVE_PATH}hiparsimulator2test.cpp
+  ${RELATIVE_PATH}hiparsimulatortest.cpp
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+  ${RELATIVE_PATH}stripingsimulatortest.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}dataflowsimulatortest.h
+  ${RELATIVE_PATH}hiparsimulator2test.h
+  ${RELATIVE_PATH}hiparsimulatortest.h
+  ${RELATIVE_PATH}stripingsimulatortest.h
+)
@@ -0,0 +1,51 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_DataflowSimulatorTest_init = false;
+#include "/root/repo/src/libgeodecomp/parallelization/test/parallel_mpi_4/dataflowsimulatortest.h"
+
+static DataflowSimulatorTest suite_DataflowSimulatorTest;
+
+static CxxTest::List Tests_DataflowSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_DataflowSimulatorTest( "/root/repo/src/libgeodecomp/parallelization/test/parallel_mpi_4/dataflowsimulatortest.h", 13, "DataflowSimulatorTest", suite_DataflowSimulatorTest, Tests_DataflowSimulatorTest );
+
+static class TestDescription_suite_DataflowSimulatorTest_testCrossRankEdges : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DataflowSimulatorTest_testCrossRankEdges() : CxxTest::RealTestDescription( Tests_DataflowSimulatorTest, suiteDescription_DataflowSimulatorTest, 16, "testCrossRankEdges" ) {}
+ void runTest() { suite_DataflowSimulatorTest.testCrossRankEdges(); }
+} testDescription_suite_DataflowSimulatorTest_testCrossRankEdges;
+
+static class TestDescription_suite_DataflowSimulatorTest_testStepwise : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DataflowSimulatorTest_testStepwise() : CxxTest::RealTestDescription( Tests_DataflowSimulatorTest, suiteDescription_DataflowSimulatorTest, 34, "testStepwise" ) {}
+ void runTest() { suite_DataflowSimulatorTest.testStepwise(); }
+} testDescription_suite_DataflowSimulatorTest_testStepwise;
+
+static class TestDescription_suite_DataflowSimulatorTest_testFailingTaskWithPendingRemoteLinks : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DataflowSimulatorTest_testFailingTaskWithPendingRemoteLinks() : CxxTest::RealTestDescription( Tests_DataflowSimulatorTest, suiteDescription_DataflowSimulatorTest, 49, "testFailingTaskWithPendingRemoteLinks" ) {}
+ void runTest() { suite_DataflowSimulatorTest.testFailingTaskWithPendingRemoteLinks(); }
+} testDescription_suite_DataflowSimulatorTest_testFailingTaskWithPendingRemoteLinks;
+
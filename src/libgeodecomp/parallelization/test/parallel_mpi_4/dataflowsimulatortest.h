@@ -0,0 +1,77 @@
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/communication/mpilayer.h>
+#include <libgeodecomp/io/dataflowtestinitializer.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+#include <libgeodecomp/parallelization/dataflowsimulator.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class DataflowSimulatorTest : public CxxTest::TestSuite
+{
+public:
+    void testCrossRankEdges()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        MPILayer mpiLayer;
+        DataflowSimulator<DataflowTestModel> sim(new DataflowTestInitializer(50, 13), 2);
+        sim.run();
+
+        TS_ASSERT_EQUALS(unsigned(13), sim.getStep());
+        // each rank runs only its own stripe, linked to its
+        // neighbors' stripes via MPI:
+        bool outermostRank = (mpiLayer.rank() == 0) || (mpiLayer.rank() == (mpiLayer.size() - 1));
+        TS_ASSERT_EQUALS(std::size_t(outermostRank ? 3 : 6), sim.numRemoteLinks);
+
+        int numCells = checkCells(sim, 13 * 3);
+        TS_ASSERT_EQUALS(50, sum(mpiLayer.allGather(numCells)));
+#endif
+    }
+
+    void testStepwise()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        DataflowSimulator<DataflowTestModel> sim(new DataflowTestInitializer(21, 9), 1);
+        for (int i = 1; i <= 5; ++i) {
+            sim.step();
+            checkCells(sim, i * 3);
+        }
+
+        sim.run();
+        TS_ASSERT_EQUALS(unsigned(9), sim.getStep());
+        checkCells(sim, 9 * 3);
+#endif
+    }
+
+    void testFailingTaskWithPendingRemoteLinks()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        // all cells throw on their first update, so the messages
+        // which the remote links are waiting for will never be sent.
+        // The simulator still needs to report the error instead of
+        // waiting for them forever:
+        DataflowSimulator<DataflowTestModel> sim(new DataflowTestInitializer(50, 13, 0), 2);
+        TS_ASSERT_THROWS(sim.run(), std::runtime_error&);
+        TS_ASSERT_LESS_THAN(std::size_t(0), sim.numRemoteLinks);
+#endif
+    }
+
+private:
+#ifdef LIBGEODECOMP_WITH_CPP14
+    int checkCells(const DataflowSimulator<DataflowTestModel>& sim, int expectedGlobalNanoStep)
+    {
+        for (std::size_t i = 0; i < sim.nodes.size(); ++i) {
+            const DataflowTestModel& cell = sim.nodes[i]->cell;
+            TS_ASSERT_EQUALS(0, cell.errors);
+            TS_ASSERT_EQUALS(expectedGlobalNanoStep, cell.nextGlobalNanoStep);
+        }
+
+        return sim.nodes.size();
+    }
+#endif
+};
+
+}
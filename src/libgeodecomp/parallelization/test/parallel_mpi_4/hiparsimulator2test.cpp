@@ -0,0 +1,44 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_HiParSimulator2Test_init = false;
+#include "/root/repo/src/libgeodecomp/parallelization/test/parallel_mpi_4/hiparsimulator2test.h"
+
+static HiParSimulator2Test suite_HiParSimulator2Test;
+
+static CxxTest::List Tests_HiParSimulator2Test = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HiParSimulator2Test( "/root/repo/src/libgeodecomp/parallelization/test/parallel_mpi_4/hiparsimulator2test.h", 13, "HiParSimulator2Test", suite_HiParSimulator2Test, Tests_HiParSimulator2Test );
+
+static class TestDescription_suite_HiParSimulator2Test_testSoAWithGhostZoneWidth1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulator2Test_testSoAWithGhostZoneWidth1() : CxxTest::RealTestDescription( Tests_HiParSimulator2Test, suiteDescription_HiParSimulator2Test, 22, "testSoAWithGhostZoneWidth1" ) {}
+ void runTest() { suite_HiParSimulator2Test.testSoAWithGhostZoneWidth1(); }
+} testDescription_suite_HiParSimulator2Test_testSoAWithGhostZoneWidth1;
+
+static class TestDescription_suite_HiParSimulator2Test_testSoAWithGhostZoneWidth3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulator2Test_testSoAWithGhostZoneWidth3() : CxxTest::RealTestDescription( Tests_HiParSimulator2Test, suiteDescription_HiParSimulator2Test, 44, "testSoAWithGhostZoneWidth3" ) {}
+ void runTest() { suite_HiParSimulator2Test.testSoAWithGhostZoneWidth3(); }
+} testDescription_suite_HiParSimulator2Test_testSoAWithGhostZoneWidth3;
+
@@ -0,0 +1,284 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_HiParSimulatorTest_init = false;
+#include "/root/repo/src/libgeodecomp/parallelization/test/parallel_mpi_4/hiparsimulatortest.h"
+
+static HiParSimulatorTest suite_HiParSimulatorTest;
+
+static CxxTest::List Tests_HiParSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HiParSimulatorTest( "/root/repo/src/libgeodecomp/parallelization/test/parallel_mpi_4/hiparsimulatortest.h", 84, "HiParSimulatorTest", suite_HiParSimulatorTest, Tests_HiParSimulatorTest );
+
+static class TestDescription_suite_HiParSimulatorTest_testStep : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testStep() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 127, "testStep" ) {}
+ void runTest() { suite_HiParSimulatorTest.testStep(); }
+} testDescription_suite_HiParSimulatorTest_testStep;
+
+static class TestDescription_suite_HiParSimulatorTest_testRun : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testRun() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 159, "testRun" ) {}
+ void runTest() { suite_HiParSimulatorTest.testRun(); }
+} testDescription_suite_HiParSimulatorTest_testRun;
+
+static class TestDescription_suite_HiParSimulatorTest_testGatherTrace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testGatherTrace() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 198, "testGatherTrace" ) {}
+ void runTest() { suite_HiParSimulatorTest.testGatherTrace(); }
+} testDescription_suite_HiParSimulatorTest_testGatherTrace;
+
+static class TestDescription_suite_HiParSimulatorTest_testLoadBalancingWithMigration : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testLoadBalancingWithMigration() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 235, "testLoadBalancingWithMigration" ) {}
+ void runTest() { suite_HiParSimulatorTest.testLoadBalancingWithMigration(); }
+} testDescription_suite_HiParSimulatorTest_testLoadBalancingWithMigration;
+
+static class TestDescription_suite_HiParSimulatorTest_testInitialPartitionHonorsCostFunction : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testInitialPartitionHonorsCostFunction() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 277, "testInitialPartitionHonorsCostFunction" ) {}
+ void runTest() { suite_HiParSimulatorTest.testInitialPartitionHonorsCostFunction(); }
+} testDescription_suite_HiParSimulatorTest_testInitialPartitionHonorsCostFunction;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererCallback : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererCallback() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 297, "testSteererCallback" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererCallback(); }
+} testDescription_suite_HiParSimulatorTest_testSteererCallback;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionalityBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionalityBasic() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 320, "testSteererFunctionalityBasic" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionalityBasic(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionalityBasic;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth1() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 337, "testSteererFunctionality2DWithGhostZoneWidth1" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality2DWithGhostZoneWidth1(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth1;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth2() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 356, "testSteererFunctionality2DWithGhostZoneWidth2" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality2DWithGhostZoneWidth2(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth2;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth3() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 375, "testSteererFunctionality2DWithGhostZoneWidth3" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality2DWithGhostZoneWidth3(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth3;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth4() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 394, "testSteererFunctionality2DWithGhostZoneWidth4" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality2DWithGhostZoneWidth4(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth4;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth5() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 413, "testSteererFunctionality2DWithGhostZoneWidth5" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality2DWithGhostZoneWidth5(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth5;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth6 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth6() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 432, "testSteererFunctionality2DWithGhostZoneWidth6" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality2DWithGhostZoneWidth6(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth6;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth1() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 451, "testSteererFunctionality3DWithGhostZoneWidth1" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality3DWithGhostZoneWidth1(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth1;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth2() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 470, "testSteererFunctionality3DWithGhostZoneWidth2" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality3DWithGhostZoneWidth2(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth2;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth3() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 489, "testSteererFunctionality3DWithGhostZoneWidth3" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality3DWithGhostZoneWidth3(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth3;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth4() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 508, "testSteererFunctionality3DWithGhostZoneWidth4" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality3DWithGhostZoneWidth4(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth4;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth5() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 527, "testSteererFunctionality3DWithGhostZoneWidth5" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality3DWithGhostZoneWidth5(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth5;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth6 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth6() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 546, "testSteererFunctionality3DWithGhostZoneWidth6" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality3DWithGhostZoneWidth6(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth6;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth1() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 565, "testWriterFunctionality2DWithGhostZoneWidth1" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality2DWithGhostZoneWidth1(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth1;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth2() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 627, "testWriterFunctionality2DWithGhostZoneWidth2" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality2DWithGhostZoneWidth2(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth2;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth3() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 689, "testWriterFunctionality2DWithGhostZoneWidth3" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality2DWithGhostZoneWidth3(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth3;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth4() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 751, "testWriterFunctionality2DWithGhostZoneWidth4" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality2DWithGhostZoneWidth4(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth4;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth5() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 813, "testWriterFunctionality2DWithGhostZoneWidth5" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality2DWithGhostZoneWidth5(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth5;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth6 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth6() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 875, "testWriterFunctionality2DWithGhostZoneWidth6" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality2DWithGhostZoneWidth6(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth6;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth1() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 937, "testWriterFunctionality3DWithGhostZoneWidth1" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality3DWithGhostZoneWidth1(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth1;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth2() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 999, "testWriterFunctionality3DWithGhostZoneWidth2" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality3DWithGhostZoneWidth2(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth2;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth3() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1061, "testWriterFunctionality3DWithGhostZoneWidth3" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality3DWithGhostZoneWidth3(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth3;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth4() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1135, "testWriterFunctionality3DWithGhostZoneWidth4" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality3DWithGhostZoneWidth4(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth4;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth5() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1197, "testWriterFunctionality3DWithGhostZoneWidth5" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality3DWithGhostZoneWidth5(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth5;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth6 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth6() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1259, "testWriterFunctionality3DWithGhostZoneWidth6" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality3DWithGhostZoneWidth6(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth6;
+
+static class TestDescription_suite_HiParSimulatorTest_testParallelWriterInvocation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testParallelWriterInvocation() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1321, "testParallelWriterInvocation" ) {}
+ void runTest() { suite_HiParSimulatorTest.testParallelWriterInvocation(); }
+} testDescription_suite_HiParSimulatorTest_testParallelWriterInvocation;
+
+static class TestDescription_suite_HiParSimulatorTest_testNonPoDCellLittleWithSmallGhost : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testNonPoDCellLittleWithSmallGhost() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1376, "testNonPoDCellLittleWithSmallGhost" ) {}
+ void runTest() { suite_HiParSimulatorTest.testNonPoDCellLittleWithSmallGhost(); }
+} testDescription_suite_HiParSimulatorTest_testNonPoDCellLittleWithSmallGhost;
+
+static class TestDescription_suite_HiParSimulatorTest_testNonPoDCellLittleWithBigGhost : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testNonPoDCellLittleWithBigGhost() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1392, "testNonPoDCellLittleWithBigGhost" ) {}
+ void runTest() { suite_HiParSimulatorTest.testNonPoDCellLittleWithBigGhost(); }
+} testDescription_suite_HiParSimulatorTest_testNonPoDCellLittleWithBigGhost;
+
+static class TestDescription_suite_HiParSimulatorTest_testNonPoDCellBigWithSmallGhost : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testNonPoDCellBigWithSmallGhost() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1408, "testNonPoDCellBigWithSmallGhost" ) {}
+ void runTest() { suite_HiParSimulatorTest.testNonPoDCellBigWithSmallGhost(); }
+} testDescription_suite_HiParSimulatorTest_testNonPoDCellBigWithSmallGhost;
+
+static class TestDescription_suite_HiParSimulatorTest_testNonPoDCellBigWithBigGhost : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testNonPoDCellBigWithBigGhost() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1424, "testNonPoDCellBigWithBigGhost" ) {}
+ void runTest() { suite_HiParSimulatorTest.testNonPoDCellBigWithBigGhost(); }
+} testDescription_suite_HiParSimulatorTest_testNonPoDCellBigWithBigGhost;
+
+static class TestDescription_suite_HiParSimulatorTest_testIO : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testIO() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1440, "testIO" ) {}
+ void runTest() { suite_HiParSimulatorTest.testIO(); }
+} testDescription_suite_HiParSimulatorTest_testIO;
+
+static class TestDescription_suite_HiParSimulatorTest_testUnstructured : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testUnstructured() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1446, "testUnstructured" ) {}
+ void runTest() { suite_HiParSimulatorTest.testUnstructured(); }
+} testDescription_suite_HiParSimulatorTest_testUnstructured;
+
+static class TestDescription_suite_HiParSimulatorTest_testUnstructuredSoA1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testUnstructuredSoA1() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1478, "testUnstructuredSoA1" ) {}
+ void runTest() { suite_HiParSimulatorTest.testUnstructuredSoA1(); }
+} testDescription_suite_HiParSimulatorTest_testUnstructuredSoA1;
+
+static class TestDescription_suite_HiParSimulatorTest_testUnstructuredSoA2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testUnstructuredSoA2() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1507, "testUnstructuredSoA2" ) {}
+ void runTest() { suite_HiParSimulatorTest.testUnstructuredSoA2(); }
+} testDescription_suite_HiParSimulatorTest_testUnstructuredSoA2;
+
+static class TestDescription_suite_HiParSimulatorTest_testUnstructuredSoA3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testUnstructuredSoA3() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1538, "testUnstructuredSoA3" ) {}
+ void runTest() { suite_HiParSimulatorTest.testUnstructuredSoA3(); }
+} testDescription_suite_HiParSimulatorTest_testUnstructuredSoA3;
+
+static class TestDescription_suite_HiParSimulatorTest_testUnstructuredSoA4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testUnstructuredSoA4() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1569, "testUnstructuredSoA4" ) {}
+ void runTest() { suite_HiParSimulatorTest.testUnstructuredSoA4(); }
+} testDescription_suite_HiParSimulatorTest_testUnstructuredSoA4;
+
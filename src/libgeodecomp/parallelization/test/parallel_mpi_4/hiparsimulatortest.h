@@ -9,6 +9,7 @@
 #include <libgeodecomp/io/unstructuredtestinitializer.h>
 #include <libgeodecomp/loadbalancer/mockbalancer.h>
 #include <libgeodecomp/loadbalancer/noopbalancer.h>
+#include <libgeodecomp/loadbalancer/randombalancer.h>
 #include <libgeodecomp/misc/nonpodtestcell.h>
 #include <libgeodecomp/misc/testcell.h>
 #include <libgeodecomp/misc/testhelper.h>
@@ -63,6 +64,23 @@ private:
     std::size_t cellsSeen;
 };
 
+/**
+ * Initializer which also knows its model's load profile: the lower
+ * quarter of the grid is 10x as expensive as the rest.
+ */
+class CostAwareTestInitializer : public TestInitializer<TestCell<2> >, public CostFunction<2>
+{
+public:
+    CostAwareTestInitializer(const Coord<2>& dim, unsigned maxSteps, unsigned startStep) :
+        TestInitializer<TestCell<2> >(dim, maxSteps, startStep)
+    {}
+
+    double operator()(const Coord<2>& coord) const
+    {
+        return (coord.y() < (gridDimensions().y() / 4)) ? 10 : 1;
+    }
+};
+
 class HiParSimulatorTest : public CxxTest::TestSuite
 {
 public:
@@ -163,13 +181,117 @@ public:
         TS_ASSERT_EQUALS(dim, grids[t].getDimensions());
 
         if (rank == 0) {
-            std::string expectedEvents;
-            for (int i = 0; i < 2; ++i) {
-                expectedEvents += "balance() [1415, 1415, 1415, 1416] [1, 1, 1, 1]\n";
+            // relative loads are measured, so we can only check the weights:
+            std::string expectedPrefix = "balance() [1415, 1415, 1415, 1416] [";
+            std::stringstream events(MockBalancer::events);
+            std::string line;
+            int numEvents = 0;
+            while (std::getline(events, line)) {
+                TS_ASSERT_EQUALS(expectedPrefix, line.substr(0, expectedPrefix.size()));
+                ++numEvents;
+            }
+
+            TS_ASSERT_EQUALS(2, numEvents);
+        }
+    }
+
+    void testGatherTrace()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        EventTrace::clear();
+        EventTrace::enable();
+        sim->step();
+        sim->step();
+        EventTrace::disable();
+
+        std::vector<EventTrace::EventVec> trace = sim->gatherTrace();
+        EventTrace::clear();
+
+        if (rank != 0) {
+            TS_ASSERT(trace.empty());
+            return;
+        }
+
+        TS_ASSERT_EQUALS(std::size_t(4), trace.size());
+        for (std::size_t i = 0; i < trace.size(); ++i) {
+            std::size_t innerUpdates = 0;
+
+            for (std::size_t j = 0; j < trace[i].size(); ++j) {
+                const EventTrace::Event& event = trace[i][j];
+                TS_ASSERT_LESS_THAN_EQUALS(event.begin, event.end);
+
+                if (event.eventID == TimeComputeInner::ID) {
+                    ++innerUpdates;
+                    TS_ASSERT_LESS_THAN_EQUALS(long(firstCycle), event.nanoStep);
+                    TS_ASSERT_LESS_THAN(event.nanoStep, long(firstCycle + 2 * NANO_STEPS));
+                }
             }
 
-            TS_ASSERT_EQUALS(expectedEvents, MockBalancer::events);
+            TS_ASSERT_EQUALS(std::size_t(2 * NANO_STEPS), innerUpdates);
+        }
+#endif
+    }
+
+    void testLoadBalancingWithMigration()
+    {
+        int outputPeriod = 1;
+        int loadBalancingPeriod = 5;
+        int ghostZoneWidth = 3;
+        TestInitializer<TestCell<2> > *init = new TestInitializer<TestCell<2> >(
+            Coord<2>(40, 61), 40, 3);
+
+        sim.reset(new SimulatorType(
+                      init,
+                      rank? 0 : new RandomBalancer(),
+                      loadBalancingPeriod,
+                      ghostZoneWidth));
+        memoryWriter = new MemoryWriterType(outputPeriod);
+        sim->addWriter(memoryWriter);
+
+        sim->step();
+        std::vector<std::size_t> initialWeights = sim->updateGroup->getWeights();
+        sim->run();
+        TS_ASSERT_DIFFERS(initialWeights, sim->updateGroup->getWeights());
+
+        MemoryWriterType::GridMap& grids = memoryWriter->getGrids();
+        for (unsigned t = 3; t <= 40; ++t) {
+            TS_ASSERT_TEST_GRID(
+                MemoryWriterType::GridType,
+                grids[t],
+                t * NANO_STEPS);
+            TS_ASSERT_EQUALS(Coord<2>(40, 61), grids[t].getDimensions());
+        }
+
+        TS_ASSERT_EQUALS(
+            sim->updateGroup->getWeights()[rank],
+            sim->updateGroup->partitionManager->ownRegion().size());
+
+        const Region<2>& region = sim->updateGroup->partitionManager->innerSet(ghostZoneWidth);
+        TS_ASSERT_TEST_GRID_REGION(
+            GridBaseType,
+            sim->updateGroup->grid(),
+            region,
+            40 * NANO_STEPS);
+    }
+
+    void testInitialPartitionHonorsCostFunction()
+    {
+        Coord<2> dim(32, 64);
+        CostAwareTestInitializer *init = new CostAwareTestInitializer(dim, 10, 0);
+        CostAwareTestInitializer costFunction(dim, 10, 0);
+
+        sim.reset(new SimulatorType(init, 0, 1000, 1));
+        sim->step();
+
+        // total cost: 16 * 32 * 10 + 48 * 32 = 6656, hence 1664 per rank:
+        const Region<2>& ownRegion = sim->updateGroup->partitionManager->ownRegion();
+        double cost = 0;
+        for (Region<2>::Iterator i = ownRegion.begin(); i != ownRegion.end(); ++i) {
+            cost += costFunction(*i);
         }
+        TS_ASSERT_LESS_THAN_EQUALS(1664 - 10, cost);
+        TS_ASSERT_LESS_THAN_EQUALS(cost, 1664 + 10);
+        TS_ASSERT_DIFFERS(std::size_t(dim.prod() / 4), ownRegion.size());
     }
 
     void testSteererCallback()
@@ -0,0 +1,207 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_StripingSimulatorTest_init = false;
+#include "/root/repo/src/libgeodecomp/parallelization/test/parallel_mpi_4/stripingsimulatortest.h"
+
+static StripingSimulatorTest suite_StripingSimulatorTest;
+
+static CxxTest::List Tests_StripingSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_StripingSimulatorTest( "/root/repo/src/libgeodecomp/parallelization/test/parallel_mpi_4/stripingsimulatortest.h", 41, "StripingSimulatorTest", suite_StripingSimulatorTest, Tests_StripingSimulatorTest );
+
+static class TestDescription_suite_StripingSimulatorTest_testNeighbors : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testNeighbors() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 76, "testNeighbors" ) {}
+ void runTest() { suite_StripingSimulatorTest.testNeighbors(); }
+} testDescription_suite_StripingSimulatorTest_testNeighbors;
+
+static class TestDescription_suite_StripingSimulatorTest_testInitRegions : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testInitRegions() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 97, "testInitRegions" ) {}
+ void runTest() { suite_StripingSimulatorTest.testInitRegions(); }
+} testDescription_suite_StripingSimulatorTest_testInitRegions;
+
+static class TestDescription_suite_StripingSimulatorTest_testStep : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testStep() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 127, "testStep" ) {}
+ void runTest() { suite_StripingSimulatorTest.testStep(); }
+} testDescription_suite_StripingSimulatorTest_testStep;
+
+static class TestDescription_suite_StripingSimulatorTest_testRun : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testRun() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 156, "testRun" ) {}
+ void runTest() { suite_StripingSimulatorTest.testRun(); }
+} testDescription_suite_StripingSimulatorTest_testRun;
+
+static class TestDescription_suite_StripingSimulatorTest_testEveryN1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testEveryN1() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 200, "testEveryN1" ) {}
+ void runTest() { suite_StripingSimulatorTest.testEveryN1(); }
+} testDescription_suite_StripingSimulatorTest_testEveryN1;
+
+static class TestDescription_suite_StripingSimulatorTest_testEveryN7 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testEveryN7() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 205, "testEveryN7" ) {}
+ void runTest() { suite_StripingSimulatorTest.testEveryN7(); }
+} testDescription_suite_StripingSimulatorTest_testEveryN7;
+
+static class TestDescription_suite_StripingSimulatorTest_testRedistributeGrid1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testRedistributeGrid1() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 210, "testRedistributeGrid1" ) {}
+ void runTest() { suite_StripingSimulatorTest.testRedistributeGrid1(); }
+} testDescription_suite_StripingSimulatorTest_testRedistributeGrid1;
+
+static class TestDescription_suite_StripingSimulatorTest_testRedistributeGrid2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testRedistributeGrid2() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 229, "testRedistributeGrid2" ) {}
+ void runTest() { suite_StripingSimulatorTest.testRedistributeGrid2(); }
+} testDescription_suite_StripingSimulatorTest_testRedistributeGrid2;
+
+static class TestDescription_suite_StripingSimulatorTest_testRedistributeGrid3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testRedistributeGrid3() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 287, "testRedistributeGrid3" ) {}
+ void runTest() { suite_StripingSimulatorTest.testRedistributeGrid3(); }
+} testDescription_suite_StripingSimulatorTest_testRedistributeGrid3;
+
+static class TestDescription_suite_StripingSimulatorTest_testRedistributeGrid4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testRedistributeGrid4() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 293, "testRedistributeGrid4" ) {}
+ void runTest() { suite_StripingSimulatorTest.testRedistributeGrid4(); }
+} testDescription_suite_StripingSimulatorTest_testRedistributeGrid4;
+
+static class TestDescription_suite_StripingSimulatorTest_testRedistributeGrid5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testRedistributeGrid5() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 299, "testRedistributeGrid5" ) {}
+ void runTest() { suite_StripingSimulatorTest.testRedistributeGrid5(); }
+} testDescription_suite_StripingSimulatorTest_testRedistributeGrid5;
+
+static class TestDescription_suite_StripingSimulatorTest_testBalanceLoad1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testBalanceLoad1() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 361, "testBalanceLoad1" ) {}
+ void runTest() { suite_StripingSimulatorTest.testBalanceLoad1(); }
+} testDescription_suite_StripingSimulatorTest_testBalanceLoad1;
+
+static class TestDescription_suite_StripingSimulatorTest_testBalanceLoad2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testBalanceLoad2() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 366, "testBalanceLoad2" ) {}
+ void runTest() { suite_StripingSimulatorTest.testBalanceLoad2(); }
+} testDescription_suite_StripingSimulatorTest_testBalanceLoad2;
+
+static class TestDescription_suite_StripingSimulatorTest_testBalanceLoad3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testBalanceLoad3() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 371, "testBalanceLoad3" ) {}
+ void runTest() { suite_StripingSimulatorTest.testBalanceLoad3(); }
+} testDescription_suite_StripingSimulatorTest_testBalanceLoad3;
+
+static class TestDescription_suite_StripingSimulatorTest_testBalanceLoad4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testBalanceLoad4() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 376, "testBalanceLoad4" ) {}
+ void runTest() { suite_StripingSimulatorTest.testBalanceLoad4(); }
+} testDescription_suite_StripingSimulatorTest_testBalanceLoad4;
+
+static class TestDescription_suite_StripingSimulatorTest_testLoadGathering : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testLoadGathering() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 381, "testLoadGathering" ) {}
+ void runTest() { suite_StripingSimulatorTest.testLoadGathering(); }
+} testDescription_suite_StripingSimulatorTest_testLoadGathering;
+
+static class TestDescription_suite_StripingSimulatorTest_testEmptyBalancer : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testEmptyBalancer() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 392, "testEmptyBalancer" ) {}
+ void runTest() { suite_StripingSimulatorTest.testEmptyBalancer(); }
+} testDescription_suite_StripingSimulatorTest_testEmptyBalancer;
+
+static class TestDescription_suite_StripingSimulatorTest_testParallelWriterInvocation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testParallelWriterInvocation() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 406, "testParallelWriterInvocation" ) {}
+ void runTest() { suite_StripingSimulatorTest.testParallelWriterInvocation(); }
+} testDescription_suite_StripingSimulatorTest_testParallelWriterInvocation;
+
+static class TestDescription_suite_StripingSimulatorTest_test3Dsimple : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_test3Dsimple() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 434, "test3Dsimple" ) {}
+ void runTest() { suite_StripingSimulatorTest.test3Dsimple(); }
+} testDescription_suite_StripingSimulatorTest_test3Dsimple;
+
+static class TestDescription_suite_StripingSimulatorTest_test3Dadvanced : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_test3Dadvanced() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 443, "test3Dadvanced" ) {}
+ void runTest() { suite_StripingSimulatorTest.test3Dadvanced(); }
+} testDescription_suite_StripingSimulatorTest_test3Dadvanced;
+
+static class TestDescription_suite_StripingSimulatorTest_testSteererFunctionality : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testSteererFunctionality() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 452, "testSteererFunctionality" ) {}
+ void runTest() { suite_StripingSimulatorTest.testSteererFunctionality(); }
+} testDescription_suite_StripingSimulatorTest_testSteererFunctionality;
+
+static class TestDescription_suite_StripingSimulatorTest_testSteererEndsSimulationOnAllNodes : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testSteererEndsSimulationOnAllNodes() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 466, "testSteererEndsSimulationOnAllNodes" ) {}
+ void runTest() { suite_StripingSimulatorTest.testSteererEndsSimulationOnAllNodes(); }
+} testDescription_suite_StripingSimulatorTest_testSteererEndsSimulationOnAllNodes;
+
+static class TestDescription_suite_StripingSimulatorTest_testSteererEndIsDeferredToLoadBalancing : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testSteererEndIsDeferredToLoadBalancing() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 481, "testSteererEndIsDeferredToLoadBalancing" ) {}
+ void runTest() { suite_StripingSimulatorTest.testSteererEndIsDeferredToLoadBalancing(); }
+} testDescription_suite_StripingSimulatorTest_testSteererEndIsDeferredToLoadBalancing;
+
+static class TestDescription_suite_StripingSimulatorTest_testSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testSoA() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 525, "testSoA" ) {}
+ void runTest() { suite_StripingSimulatorTest.testSoA(); }
+} testDescription_suite_StripingSimulatorTest_testSoA;
+
+static class TestDescription_suite_StripingSimulatorTest_testUnstructured : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testUnstructured() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 543, "testUnstructured" ) {}
+ void runTest() { suite_StripingSimulatorTest.testUnstructured(); }
+} testDescription_suite_StripingSimulatorTest_testUnstructured;
+
+static class TestDescription_suite_StripingSimulatorTest_testUnstructuredSoA1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testUnstructuredSoA1() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 565, "testUnstructuredSoA1" ) {}
+ void runTest() { suite_StripingSimulatorTest.testUnstructuredSoA1(); }
+} testDescription_suite_StripingSimulatorTest_testUnstructuredSoA1;
+
+static class TestDescription_suite_StripingSimulatorTest_testUnstructuredSoA2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testUnstructuredSoA2() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 586, "testUnstructuredSoA2" ) {}
+ void runTest() { suite_StripingSimulatorTest.testUnstructuredSoA2(); }
+} testDescription_suite_StripingSimulatorTest_testUnstructuredSoA2;
+
+static class TestDescription_suite_StripingSimulatorTest_testUnstructuredSoA3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testUnstructuredSoA3() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 606, "testUnstructuredSoA3" ) {}
+ void runTest() { suite_StripingSimulatorTest.testUnstructuredSoA3(); }
+} testDescription_suite_StripingSimulatorTest_testUnstructuredSoA3;
+
+static class TestDescription_suite_StripingSimulatorTest_testUnstructuredSoA4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_StripingSimulatorTest_testUnstructuredSoA4() : CxxTest::RealTestDescription( Tests_StripingSimulatorTest, suiteDescription_StripingSimulatorTest, 626, "testUnstructuredSoA4" ) {}
+ void runTest() { suite_StripingSimulatorTest.testUnstructuredSoA4(); }
+} testDescription_suite_StripingSimulatorTest_testUnstructuredSoA4;
+
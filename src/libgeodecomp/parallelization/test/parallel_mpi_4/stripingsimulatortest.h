@@ -463,6 +463,38 @@ public:
             cycle);
     }
 
+    void testSteererEndsSimulationOnAllNodes()
+    {
+        // only rank 1 requests the end, the others need to follow suit:
+        unsigned terminalStep = (rank == 1) ? 30 : 1000;
+        testSim->addSteerer(new TestSteererType(5, 1000, 0, terminalStep));
+        testSim->run();
+
+        TS_ASSERT_EQUALS(31, testSim->getStep());
+        TS_ASSERT_TEST_GRID_REGION(
+            GridBaseType,
+            *testSim->curStripe,
+            testSim->region,
+            31 * NANO_STEPS);
+    }
+
+    void testSteererEndIsDeferredToLoadBalancing()
+    {
+        // end requests are only collected every 4th step, i.e. at step 32:
+        LoadBalancer *balancer = rank == 0? new NoOpBalancer : 0;
+        testSim.reset(new StripingSimulator<TestCell<2> >(init, balancer, 4));
+        unsigned terminalStep = (rank == 1) ? 30 : 1000;
+        testSim->addSteerer(new TestSteererType(5, 1000, 0, terminalStep));
+        testSim->run();
+
+        TS_ASSERT_EQUALS(32, testSim->getStep());
+        TS_ASSERT_TEST_GRID_REGION(
+            GridBaseType,
+            *testSim->curStripe,
+            testSim->region,
+            32 * NANO_STEPS);
+    }
+
 // fixme
 //     void testNonPoDCellLittle()
 //     {
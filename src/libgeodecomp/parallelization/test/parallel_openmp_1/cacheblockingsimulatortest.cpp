@@ -0,0 +1,75 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CacheBlockingSimulatorTest_init = false;
+#include "/root/repo/src/libgeodecomp/parallelization/test/parallel_openmp_1/cacheblockingsimulatortest.h"
+
+static CacheBlockingSimulatorTest suite_CacheBlockingSimulatorTest;
+
+static CxxTest::List Tests_CacheBlockingSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CacheBlockingSimulatorTest( "/root/repo/src/libgeodecomp/parallelization/test/parallel_openmp_1/cacheblockingsimulatortest.h", 14, "CacheBlockingSimulatorTest", suite_CacheBlockingSimulatorTest, Tests_CacheBlockingSimulatorTest );
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_testRun2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_testRun2D() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 27, "testRun2D" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.testRun2D(); }
+} testDescription_suite_CacheBlockingSimulatorTest_testRun2D;
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_testRun2DTorus : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_testRun2DTorus() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 34, "testRun2DTorus" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.testRun2DTorus(); }
+} testDescription_suite_CacheBlockingSimulatorTest_testRun2DTorus;
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_testRun2DRadius2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_testRun2DRadius2() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 40, "testRun2DRadius2" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.testRun2DRadius2(); }
+} testDescription_suite_CacheBlockingSimulatorTest_testRun2DRadius2;
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_testRun3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_testRun3D() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 45, "testRun3D" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.testRun3D(); }
+} testDescription_suite_CacheBlockingSimulatorTest_testRun3D;
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_testStep : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_testStep() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 51, "testStep" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.testStep(); }
+} testDescription_suite_CacheBlockingSimulatorTest_testStep;
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_testWriterPeriods : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_testWriterPeriods() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 68, "testWriterPeriods" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.testWriterPeriods(); }
+} testDescription_suite_CacheBlockingSimulatorTest_testWriterPeriods;
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_testInvalidArguments : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_testInvalidArguments() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 90, "testInvalidArguments" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.testInvalidArguments(); }
+} testDescription_suite_CacheBlockingSimulatorTest_testInvalidArguments;
+
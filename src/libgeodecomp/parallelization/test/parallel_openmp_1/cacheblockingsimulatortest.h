@@ -1,10 +1,8 @@
 #include <cxxtest/TestSuite.h>
-#include <iomanip>
-#include <iostream>
-#include <sstream>
+#include <libgeodecomp/io/memorywriter.h>
 #include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/io/testwriter.h>
 #include <libgeodecomp/misc/sharedptr.h>
-#include <libgeodecomp/misc/stdcontaineroverloads.h>
 #include <libgeodecomp/misc/testcell.h>
 #include <libgeodecomp/misc/testhelper.h>
 #include <libgeodecomp/parallelization/cacheblockingsimulator.h>
@@ -16,110 +14,108 @@ namespace LibGeoDecomp {
 class CacheBlockingSimulatorTest : public CxxTest::TestSuite
 {
 public:
-    typedef TestCell<3, Stencils::Moore<3, 1>, Topologies::Cube<3>::Topology> TestCellType;
+    typedef TestCell<2> TestCell2D;
+    typedef TestCell<2, Stencils::Moore<2, 1>, Topologies::Torus<2>::Topology> TorusCell2D;
+    typedef TestCell<2, Stencils::Moore<2, 2> > WideCell2D;
+    typedef TestCell<3, Stencils::Moore<3, 1>, Topologies::Cube<3>::Topology> CubeCell3D;
+    typedef TestCell<3> TorusCell3D;
 
-    void setUp()
+    typedef GridBase<TestCell2D, 2> GridBaseType;
+
+    static const unsigned NANO_STEPS = APITraits::SelectNanoSteps<TestCell2D>::VALUE;
+
+    void testRun2D()
+    {
+        checkRun<TestCell2D>(Coord<2>(31, 20), 5, Coord<1>(7));
+        checkRun<TestCell2D>(Coord<2>(31, 20), 1, Coord<1>(100));
+        checkRun<TestCell2D>(Coord<2>(12, 3), 8, Coord<1>(1));
+    }
+
+    void testRun2DTorus()
+    {
+        checkRun<TorusCell2D>(Coord<2>(31, 20), 5, Coord<1>(7));
+        checkRun<TorusCell2D>(Coord<2>(9, 4), 6, Coord<1>(3));
+    }
+
+    void testRun2DRadius2()
+    {
+        checkRun<WideCell2D>(Coord<2>(31, 20), 4, Coord<1>(6));
+    }
+
+    void testRun3D()
+    {
+        checkRun<CubeCell3D>(Coord<3>(15, 12, 10), 4, Coord<2>(5, 4));
+        checkRun<TorusCell3D>(Coord<3>(15, 12, 10), 4, Coord<2>(5, 4));
+    }
+
+    void testStep()
+    {
+        CacheBlockingSimulator<TestCell2D> sim(
+            new TestInitializer<TestCell2D>(Coord<2>(20, 10), 10, 3),
+            6,
+            Coord<1>(4));
+        TS_ASSERT_EQUALS(3, sim.getStep());
+
+        sim.step();
+        TS_ASSERT_EQUALS(4, sim.getStep());
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim.getGrid(), 4 * NANO_STEPS);
+
+        sim.step();
+        TS_ASSERT_EQUALS(5, sim.getStep());
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim.getGrid(), 5 * NANO_STEPS);
+    }
+
+    void testWriterPeriods()
     {
+        CacheBlockingSimulator<TestCell2D> sim(
+            new TestInitializer<TestCell2D>(Coord<2>(20, 10), 21, 13),
+            7,
+            Coord<1>(8));
+        sim.addWriter(new TestWriter<TestCell2D>(4, 13, 21));
+        MemoryWriter<TestCell2D> *memoryWriter = new MemoryWriter<TestCell2D>(3);
+        sim.addWriter(memoryWriter);
+        sim.run();
+
+        // initial grid plus time steps 15, 18, and 21:
+        TS_ASSERT_EQUALS(std::size_t(4), memoryWriter->getGrids().size());
+        for (int i = 0; i < 4; ++i) {
+            unsigned step = (i == 0) ? 13 : (12 + 3 * i);
+            TS_ASSERT_TEST_GRID(
+                GridBaseType,
+                memoryWriter->getGrid(i),
+                step * NANO_STEPS);
+        }
     }
 
-    void tearDown()
+    void testInvalidArguments()
     {
-        // sim.reset();
+        TS_ASSERT_THROWS(
+            CacheBlockingSimulator<TestCell2D>(new TestInitializer<TestCell2D>(), 0, Coord<1>(4)),
+            std::invalid_argument&);
+        TS_ASSERT_THROWS(
+            CacheBlockingSimulator<TestCell2D>(new TestInitializer<TestCell2D>(), 2, Coord<1>(0)),
+            std::invalid_argument&);
     }
 
-    void testPipelinedUpdate()
+private:
+    template<typename CELL, int DIM>
+    void checkRun(const Coord<DIM>& dim, int pipelineLength, const Coord<DIM - 1>& wavefrontDim)
     {
-//         init(Coord<3>(40, 1, 20));
-
-//         sim->buffer.atEdge() = sim->curGrid->atEdge();
-//         sim->buffer.fill(sim->buffer.boundingBox(), sim->curGrid->getEdgeCell());
-//         sim->fixBufferOrigin(Coord<2>(0, 0));
-//         int i = 0;
-
-//         for (; i < 2 * pipelineLength - 2; ++i) {
-//             int lastStage = (i >> 1) + 1;
-//             sim->pipelinedUpdate(Coord<2>(0, 0), i, i, 0, lastStage);
-//         }
-//         for (; i < dim.z(); ++i) {
-//             sim->pipelinedUpdate(Coord<2>(0, 0), i, i, 0, pipelineLength);
-//         }
-//         for (; i < (dim.z() + 2 * pipelineLength - 2); ++i) {
-//             int firstStage = ((i - dim.z() + 1) >> 1);
-//             sim->pipelinedUpdate(Coord<2>(0, 0), i, i, firstStage, pipelineLength);
-//         }
-//     }
-
-//     void testUpdateWavefront()
-//     {
-//         init(Coord<3>(40, 30, 20));
-
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid), 0);
-//         sim->updateWavefront(Coord<2>(0, 0));
-//         sim->updateWavefront(Coord<2>(1, 0));
-//         sim->updateWavefront(Coord<2>(2, 0));
-
-//         sim->updateWavefront(Coord<2>(0, 1));
-//         sim->updateWavefront(Coord<2>(1, 1));
-//         sim->updateWavefront(Coord<2>(2, 1));
-
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->newGrid), pipelineLength);
-//     }
-
-//     void testHop1()
-//     {
-//         init(Coord<3>(40, 30, 20));
-
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid),  0);
-//         sim->hop();
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid),  5);
-//         sim->hop();
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid), 10);
-//         sim->hop();
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid), 15);
-//     }
-
-//     void testHop2()
-//     {
-//         init(Coord<3>(40, 30, 20), 7);
-
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid),  0);
-//         sim->hop();
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid),  7);
-//         sim->hop();
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid), 14);
-//         sim->hop();
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid), 21);
-//     }
-
-//     void testHop3()
-//     {
-//         init(Coord<3>(40, 30, 20), 1);
-
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid),  0);
-//         sim->hop();
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid),  1);
-//         sim->hop();
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid),  2);
-//         sim->hop();
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid),  3);
-//     }
-
-// private:
-//     int pipelineLength;
-//     Coord<3> dim;
-//     SharedPtr<CacheBlockingSimulator<TestCellType> >::Type sim;
-
-//     void init(const Coord<3>& gridDim, int newPipelineLength = 5, const Coord<2> wavefrontDim = Coord<2>(16, 16))
-//     {
-//         pipelineLength = newPipelineLength;
-//         dim = gridDim;
-//         sim.reset(new CacheBlockingSimulator<TestCellType>(
-//                       new TestInitializer<TestCellType>(
-//                           dim,
-//                           10000,
-//                           0),
-//                       pipelineLength,
-//                       wavefrontDim));
+        unsigned startStep = 2;
+        unsigned maxSteps = 9;
+        CacheBlockingSimulator<CELL> sim(
+            new TestInitializer<CELL>(dim, maxSteps, startStep),
+            pipelineLength,
+            wavefrontDim);
+        sim.run();
+
+        TS_ASSERT_EQUALS(maxSteps, sim.getStep());
+        typedef GridBase<CELL, DIM> GridType;
+        TS_ASSERT_TEST_GRID2(
+            GridType,
+            *sim.getGrid(),
+            maxSteps * APITraits::SelectNanoSteps<CELL>::VALUE,
+            typename);
     }
 };
 
@@ -1,5 +1,6 @@
 #include <cxxtest/TestSuite.h>
 #include <iostream>
+#include <sstream>
 #include <libflatarray/short_vec.hpp>
 #include <libgeodecomp/io/memorywriter.h>
 #include <libgeodecomp/io/mockinitializer.h>
@@ -213,6 +214,56 @@ public:
         TS_ASSERT_TEST_GRID(GridBaseType, *sim.getGrid(), 21 * NANO_STEPS_3D);
     }
 
+    void testNUMAPlacement()
+    {
+        OpenMPSimulator<TestCell<3> > sim(new TestInitializer<TestCell<3> >(), false, true);
+        TS_ASSERT_TEST_GRID(GridBase3D, *sim.getGrid(), 0);
+
+        sim.run();
+        TS_ASSERT_TEST_GRID(GridBase3D, *sim.getGrid(), 21 * NANO_STEPS_3D);
+
+        // we can't expect a particular distribution, but on Linux
+        // at least one node needs to be listed:
+        std::string report = sim.placementReport();
+#ifdef __linux__
+        TS_ASSERT_DIFFERS(std::string::npos, report.find("numa_node_0"));
+#endif
+    }
+
+    void testNUMAPlacementWithUnevenPlanes()
+    {
+        // 7 planes don't divide evenly among the 4 threads, and
+        // each plane spans multiple pages, so a placement that
+        // would cut the grids along rows instead of planes or lose
+        // the trailing planes would show up in the page count:
+        Coord<3> dim(64, 37, 7);
+        OpenMPSimulator<TestCell<3> > sim(new TestInitializer<TestCell<3> >(dim, 5, 0), false, true);
+        sim.run();
+        TS_ASSERT_TEST_GRID(GridBase3D, *sim.getGrid(), 5 * NANO_STEPS_3D);
+
+        std::size_t pages = 0;
+        std::stringstream report(sim.placementReport());
+        std::string line;
+        while (std::getline(report, line)) {
+            std::stringstream buf(line.substr(line.find(':') + 1));
+            std::size_t nodeThreads;
+            std::size_t nodePages;
+            std::string dummy;
+            buf >> nodeThreads >> dummy >> nodePages;
+            pages += nodePages;
+        }
+
+#ifdef __linux__
+        // move_pages(2) may be unavailable, in which case no pages are
+        // reported. Otherwise all pages of both grids need to show up:
+        std::size_t pageSize = sysconf(_SC_PAGESIZE);
+        std::size_t minPages = 2 * (dim.prod() * sizeof(TestCell<3>) / pageSize);
+        if (pages > 0) {
+            TS_ASSERT_LESS_THAN_EQUALS(minPages, pages);
+        }
+#endif
+    }
+
 private:
     SharedPtr<MockWriter<>::EventsStore>::Type events;
     SharedPtr<OpenMPSimulator<TestCell<2> > >::Type simulator;
@@ -0,0 +1,75 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_AutotuningSimulatorWithoutCUDATest_init = false;
+#include "/root/repo/src/libgeodecomp/parallelization/test/unit/autotuningsimulatorwithoutcudatest.h"
+
+static AutotuningSimulatorWithoutCUDATest suite_AutotuningSimulatorWithoutCUDATest;
+
+static CxxTest::List Tests_AutotuningSimulatorWithoutCUDATest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_AutotuningSimulatorWithoutCUDATest( "/root/repo/src/libgeodecomp/parallelization/test/unit/autotuningsimulatorwithoutcudatest.h", 17, "AutotuningSimulatorWithoutCUDATest", suite_AutotuningSimulatorWithoutCUDATest, Tests_AutotuningSimulatorWithoutCUDATest );
+
+static class TestDescription_suite_AutotuningSimulatorWithoutCUDATest_testBasicPatternOptimized : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorWithoutCUDATest_testBasicPatternOptimized() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorWithoutCUDATest, suiteDescription_AutotuningSimulatorWithoutCUDATest, 29, "testBasicPatternOptimized" ) {}
+ void runTest() { suite_AutotuningSimulatorWithoutCUDATest.testBasicPatternOptimized(); }
+} testDescription_suite_AutotuningSimulatorWithoutCUDATest_testBasicPatternOptimized;
+
+static class TestDescription_suite_AutotuningSimulatorWithoutCUDATest_testNormalizeSteps : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorWithoutCUDATest_testNormalizeSteps() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorWithoutCUDATest, suiteDescription_AutotuningSimulatorWithoutCUDATest, 41, "testNormalizeSteps" ) {}
+ void runTest() { suite_AutotuningSimulatorWithoutCUDATest.testNormalizeSteps(); }
+} testDescription_suite_AutotuningSimulatorWithoutCUDATest_testNormalizeSteps;
+
+static class TestDescription_suite_AutotuningSimulatorWithoutCUDATest_testBasicSimplexOptimized : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorWithoutCUDATest_testBasicSimplexOptimized() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorWithoutCUDATest, suiteDescription_AutotuningSimulatorWithoutCUDATest, 76, "testBasicSimplexOptimized" ) {}
+ void runTest() { suite_AutotuningSimulatorWithoutCUDATest.testBasicSimplexOptimized(); }
+} testDescription_suite_AutotuningSimulatorWithoutCUDATest_testBasicSimplexOptimized;
+
+static class TestDescription_suite_AutotuningSimulatorWithoutCUDATest_testAddOwnSimulationsForCacheBlockingSim : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorWithoutCUDATest_testAddOwnSimulationsForCacheBlockingSim() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorWithoutCUDATest, suiteDescription_AutotuningSimulatorWithoutCUDATest, 88, "testAddOwnSimulationsForCacheBlockingSim" ) {}
+ void runTest() { suite_AutotuningSimulatorWithoutCUDATest.testAddOwnSimulationsForCacheBlockingSim(); }
+} testDescription_suite_AutotuningSimulatorWithoutCUDATest_testAddOwnSimulationsForCacheBlockingSim;
+
+static class TestDescription_suite_AutotuningSimulatorWithoutCUDATest_testManuallyParamterizedCacheBlockingSim : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorWithoutCUDATest_testManuallyParamterizedCacheBlockingSim() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorWithoutCUDATest, suiteDescription_AutotuningSimulatorWithoutCUDATest, 108, "testManuallyParamterizedCacheBlockingSim" ) {}
+ void runTest() { suite_AutotuningSimulatorWithoutCUDATest.testManuallyParamterizedCacheBlockingSim(); }
+} testDescription_suite_AutotuningSimulatorWithoutCUDATest_testManuallyParamterizedCacheBlockingSim;
+
+static class TestDescription_suite_AutotuningSimulatorWithoutCUDATest_testInvalidArgumentsForCacheBlockingSim : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorWithoutCUDATest_testInvalidArgumentsForCacheBlockingSim() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorWithoutCUDATest, suiteDescription_AutotuningSimulatorWithoutCUDATest, 129, "testInvalidArgumentsForCacheBlockingSim" ) {}
+ void runTest() { suite_AutotuningSimulatorWithoutCUDATest.testInvalidArgumentsForCacheBlockingSim(); }
+} testDescription_suite_AutotuningSimulatorWithoutCUDATest_testInvalidArgumentsForCacheBlockingSim;
+
+static class TestDescription_suite_AutotuningSimulatorWithoutCUDATest_testAddWriter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutotuningSimulatorWithoutCUDATest_testAddWriter() : CxxTest::RealTestDescription( Tests_AutotuningSimulatorWithoutCUDATest, suiteDescription_AutotuningSimulatorWithoutCUDATest, 142, "testAddWriter" ) {}
+ void runTest() { suite_AutotuningSimulatorWithoutCUDATest.testAddWriter(); }
+} testDescription_suite_AutotuningSimulatorWithoutCUDATest_testAddWriter;
+
@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_DataflowSimulatorTest_init = false;
+#include "/root/repo/src/libgeodecomp/parallelization/test/unit/dataflowsimulatortest.h"
+
+static DataflowSimulatorTest suite_DataflowSimulatorTest;
+
+static CxxTest::List Tests_DataflowSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_DataflowSimulatorTest( "/root/repo/src/libgeodecomp/parallelization/test/unit/dataflowsimulatortest.h", 11, "DataflowSimulatorTest", suite_DataflowSimulatorTest, Tests_DataflowSimulatorTest );
+
+static class TestDescription_suite_DataflowSimulatorTest_testRun : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DataflowSimulatorTest_testRun() : CxxTest::RealTestDescription( Tests_DataflowSimulatorTest, suiteDescription_DataflowSimulatorTest, 14, "testRun" ) {}
+ void runTest() { suite_DataflowSimulatorTest.testRun(); }
+} testDescription_suite_DataflowSimulatorTest_testRun;
+
+static class TestDescription_suite_DataflowSimulatorTest_testStepwise : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DataflowSimulatorTest_testStepwise() : CxxTest::RealTestDescription( Tests_DataflowSimulatorTest, suiteDescription_DataflowSimulatorTest, 26, "testStepwise" ) {}
+ void runTest() { suite_DataflowSimulatorTest.testStepwise(); }
+} testDescription_suite_DataflowSimulatorTest_testStepwise;
+
+static class TestDescription_suite_DataflowSimulatorTest_testSingleThread : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DataflowSimulatorTest_testSingleThread() : CxxTest::RealTestDescription( Tests_DataflowSimulatorTest, suiteDescription_DataflowSimulatorTest, 42, "testSingleThread" ) {}
+ void runTest() { suite_DataflowSimulatorTest.testSingleThread(); }
+} testDescription_suite_DataflowSimulatorTest_testSingleThread;
+
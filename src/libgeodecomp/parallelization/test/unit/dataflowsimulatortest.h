@@ -0,0 +1,66 @@
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/io/dataflowtestinitializer.h>
+#include <libgeodecomp/parallelization/dataflowsimulator.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class DataflowSimulatorTest : public CxxTest::TestSuite
+{
+public:
+    void testRun()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        DataflowSimulator<DataflowTestModel> sim(new DataflowTestInitializer(50, 13), 4);
+        sim.run();
+
+        TS_ASSERT_EQUALS(unsigned(13), sim.getStep());
+        TS_ASSERT_EQUALS(13 * 3, sim.currentNanoStep());
+        checkCells(sim, 50, 13 * 3);
+#endif
+    }
+
+    void testStepwise()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        DataflowSimulator<DataflowTestModel> sim(new DataflowTestInitializer(31, 10), 3);
+        for (int i = 1; i <= 4; ++i) {
+            sim.step();
+            TS_ASSERT_EQUALS(unsigned(i), sim.getStep());
+            checkCells(sim, 31, i * 3);
+        }
+
+        sim.run();
+        TS_ASSERT_EQUALS(unsigned(10), sim.getStep());
+        checkCells(sim, 31, 10 * 3);
+#endif
+    }
+
+    void testSingleThread()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        DataflowSimulator<DataflowTestModel> sim(new DataflowTestInitializer(7, 20), 1);
+        sim.run();
+        checkCells(sim, 7, 20 * 3);
+#endif
+    }
+
+private:
+#ifdef LIBGEODECOMP_WITH_CPP14
+    void checkCells(const DataflowSimulator<DataflowTestModel>& sim, std::size_t expectedCells, int expectedGlobalNanoStep)
+    {
+        TS_ASSERT_EQUALS(expectedCells, sim.nodes.size());
+
+        for (std::size_t i = 0; i < sim.nodes.size(); ++i) {
+            const DataflowTestModel& cell = sim.nodes[i]->cell;
+            TS_ASSERT_EQUALS(0, cell.errors);
+            TS_ASSERT_EQUALS(expectedGlobalNanoStep, cell.nextGlobalNanoStep);
+        }
+    }
+#endif
+};
+
+}
@@ -204,6 +204,16 @@ public:
         TS_ASSERT(writer->allEventsDone());
     }
 
+    void testRegionGridCellOnTorus()
+    {
+        typedef TestCell<2, Stencils::Moore<2, 1>, Topologies::Torus<2>::Topology, APITraits::HasRegionGrid> CellType;
+        typedef GridBase<CellType, 2> GridBaseType;
+
+        SerialSimulator<CellType> sim(new TestInitializer<CellType>(Coord<2>(17, 12), 10, 0));
+        sim.run();
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim.getGrid(), 10 * NANO_STEPS_2D);
+    }
+
     void testSteererCanTerminateSimulation()
     {
         unsigned eventStep = 15;
@@ -237,6 +237,18 @@ public:
                      cells);
     }
 
+    virtual const CELL_TYPE *streakAddress(const Streak<DIM>& streak) const
+    {
+        Streak<DIM> relativeStreak(streak.origin - origin, streak.endX - origin.x());
+        if (TOPOLOGICALLY_CORRECT) {
+            Coord<DIM> normalizedOrigin = Topology::normalize(relativeStreak.origin, topoDimensions);
+            relativeStreak.endX += normalizedOrigin.x() - relativeStreak.origin.x();
+            relativeStreak.origin = normalizedOrigin;
+        }
+
+        return delegate.streakAddress(relativeStreak);
+    }
+
     virtual void setEdge(const CELL_TYPE& cell)
     {
         getEdgeCell() = cell;
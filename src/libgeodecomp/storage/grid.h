@@ -238,6 +238,15 @@ public:
         }
     }
 
+    virtual const CELL_TYPE *streakAddress(const Streak<DIM>& streak) const
+    {
+        if (!boundingBox().inBounds(streak)) {
+            return 0;
+        }
+
+        return &(*this)[streak.origin];
+    }
+
     virtual void setEdge(const CELL_TYPE& cell)
     {
         getEdgeCell() = cell;
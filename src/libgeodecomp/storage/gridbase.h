@@ -116,6 +116,18 @@ public:
      */
     virtual void get(const Streak<DIM>&, CELL *) const = 0;
 
+    /**
+     * Grids which store their cells in plain arrays (i.e. AoS grids)
+     * may return the address of the Streak's first cell. The Streak's
+     * cells are then guaranteed to be consecutive in memory, which
+     * allows callers (e.g. the VoronoiMesher) to read them without
+     * copying. Returns NULL if this isn't possible (the default).
+     */
+    virtual const CELL *streakAddress(const Streak<DIM>& /* streak */) const
+    {
+        return 0;
+    }
+
     /**
      * The edge cell is returned for out-of-bounds accesses on
      * non-periodic boundaries. If can be set via this function.
@@ -4,6 +4,7 @@
 #include <libgeodecomp/config.h>
 
 #include <libgeodecomp/storage/displacedgrid.h>
+#include <libgeodecomp/storage/regiongrid.h>
 #include <libgeodecomp/storage/reorderingunstructuredgrid.h>
 #include <libgeodecomp/storage/soagrid.h>
 #include <libgeodecomp/storage/unstructuredgrid.h>
@@ -13,6 +14,37 @@
 
 namespace LibGeoDecomp {
 
+namespace GridTypeSelectorHelpers {
+
+/**
+ * Picks the grid for AoS cells: RegionGrid if the cell asks for it
+ * (see APITraits::HasRegionGrid), DisplacedGrid otherwise. RegionGrid
+ * relies on the topological dimensions to wrap coordinates on
+ * periodic topologies, hence it's only used for topologically
+ * correct grids (i.e. within the Steppers, which always supply
+ * them). Simulators which store the whole grid (e.g. the
+ * SerialSimulator) get a DisplacedGrid, which then wraps at its own
+ * edges.
+ */
+template<typename CELL_TYPE, typename TOPOLOGY, bool TOPOLOGICALLY_CORRECT, typename SUPPORTS_REGION_GRID>
+class AoSGridSelector
+{
+public:
+    typedef DisplacedGrid<CELL_TYPE, TOPOLOGY, TOPOLOGICALLY_CORRECT> Value;
+};
+
+/**
+ * see above.
+ */
+template<typename CELL_TYPE, typename TOPOLOGY>
+class AoSGridSelector<CELL_TYPE, TOPOLOGY, true, APITraits::TrueType>
+{
+public:
+    typedef RegionGrid<CELL_TYPE, TOPOLOGY> Value;
+};
+
+}
+
 /**
  * This class can be used by Simulators to deduce from a cell's API a
  * suitable grid type for internal storage of the simulation state.
@@ -28,7 +60,11 @@ template<typename CELL_TYPE, typename TOPOLOGY, bool TOPOLOGICALLY_CORRECT>
 class GridTypeSelector<CELL_TYPE, TOPOLOGY, TOPOLOGICALLY_CORRECT, APITraits::FalseType>
 {
 public:
-    typedef DisplacedGrid<CELL_TYPE, TOPOLOGY, TOPOLOGICALLY_CORRECT> Value;
+    typedef typename GridTypeSelectorHelpers::AoSGridSelector<
+        CELL_TYPE,
+        TOPOLOGY,
+        TOPOLOGICALLY_CORRECT,
+        typename APITraits::SelectRegionGrid<CELL_TYPE>::Value>::Value Value;
 };
 
 /**
@@ -57,6 +57,23 @@ public:
         // empty as most implementations won't need it anyway.
     }
 
+    /**
+     * Gives implementations which rely on asynchronous transfers
+     * (e.g. PatchLink) a chance to drive them forward. Steppers call
+     * this repeatedly while they're busy updating the inner set.
+     */
+    virtual void progress()
+    {}
+
+    /**
+     * Implementations which keep reading from the grid after put()
+     * has returned (e.g. PatchLink's zero-copy sends) complete these
+     * reads here. Steppers which call this need to do so before they
+     * modify the region of the grid which they've handed to put().
+     */
+    virtual void flush()
+    {}
+
     virtual std::size_t nextRequiredNanoStep() const
     {
         if (requestedNanoSteps.empty()) {
@@ -1,9 +1,11 @@
 #ifndef LIBGEODECOMP_STORAGE_PATCHBUFFER_H
 #define LIBGEODECOMP_STORAGE_PATCHBUFFER_H
 
-#include <deque>
+#include <algorithm>
+#include <libgeodecomp/misc/metrics.h>
 #include <libgeodecomp/storage/patchaccepter.h>
 #include <libgeodecomp/storage/patchprovider.h>
+#include <libgeodecomp/storage/serializationbuffer.h>
 
 namespace LibGeoDecomp {
 
@@ -13,6 +15,11 @@ namespace LibGeoDecomp {
  * implement overlapping communication and calculation (and hence need
  * to buffer certain parts of the grid which will be temporarily
  * overwritten).
+ *
+ * Buffers are kept in a ring and recycled once they've been
+ * retrieved, so after warming up put() and get() won't touch the
+ * heap. Unlike the PatchBufferFixed the ring grows if more fragments
+ * than its initial depth are stored at a time.
  */
 template<class GRID_TYPE1, class GRID_TYPE2>
 class PatchBuffer :
@@ -30,9 +37,17 @@ public:
     using PatchProvider<GRID_TYPE2>::checkNanoStepGet;
     using PatchProvider<GRID_TYPE2>::storedNanoSteps;
 
-    explicit PatchBuffer(const Region<DIM>& region = Region<DIM>()) :
-        region(region)
-    {}
+    explicit PatchBuffer(const Region<DIM>& region = Region<DIM>(), std::size_t depth = 2) :
+        region(region),
+        indexRead(0),
+        numStored(0),
+        numAllocations(0)
+    {
+        ring.reserve(depth);
+        for (std::size_t i = 0; i < depth; ++i) {
+            allocate();
+        }
+    }
 
     virtual void put(
         const GRID_TYPE1& grid,
@@ -48,11 +63,18 @@ public:
             return;
         }
 
-        storedRegions.push_back(BufferType());
-        BufferType& buffer = storedRegions.back();
-        buffer = SerializationBuffer<CellType>::create(region);
+        if (numStored == ring.size()) {
+            grow();
+        }
+
+        BufferType& buffer = ring[(indexRead + numStored) % ring.size()];
+        // no-op for fixed size buffers, but serialized cells would
+        // otherwise be appended to the previous contents:
+        SerializationBuffer<CellType>::resize(&buffer, region.size());
 
         grid.saveRegion(&buffer, region);
+        Metrics::add(Metrics::PATCH_BUFFER_CELLS, region.size());
+        ++numStored;
         storedNanoSteps << (min)(requestedNanoSteps);
         erase_min(requestedNanoSteps);
     }
@@ -66,22 +88,54 @@ public:
         const bool remove=true)
     {
         checkNanoStepGet(nanoStep);
-        if (storedRegions.empty()) {
+        if (numStored == 0) {
             throw std::logic_error("no region available");
         }
 
-        destinationGrid->loadRegion(storedRegions.front(), region);
+        destinationGrid->loadRegion(ring[indexRead], region);
 
         if (remove) {
-            storedRegions.pop_front();
+            indexRead = (indexRead + 1) % ring.size();
+            --numStored;
             erase_min(storedNanoSteps);
         }
 
     }
 
+    /**
+     * Number of buffers which had to be allocated so far (including
+     * the ones preallocated by the constructor). Constant in steady
+     * state -- if it keeps rising the depth is too small.
+     */
+    inline std::size_t allocations() const
+    {
+        return numAllocations;
+    }
+
 private:
     Region<DIM> region;
-    std::deque<BufferType> storedRegions;
+    std::vector<BufferType> ring;
+    std::size_t indexRead;
+    std::size_t numStored;
+    std::size_t numAllocations;
+
+    inline void allocate()
+    {
+        ring.push_back(SerializationBuffer<CellType>::create(region));
+        ++numAllocations;
+    }
+
+    /**
+     * Makes room for one more buffer. Stored buffers are rotated to
+     * the front first so that the new one ends up behind the last
+     * stored fragment.
+     */
+    inline void grow()
+    {
+        std::rotate(ring.begin(), ring.begin() + indexRead, ring.end());
+        indexRead = 0;
+        allocate();
+    }
 };
 
 }
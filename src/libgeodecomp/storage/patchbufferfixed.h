@@ -1,6 +1,7 @@
 #ifndef LIBGEODECOMP_STORAGE_PATCHBUFFERFIXED_H
 #define LIBGEODECOMP_STORAGE_PATCHBUFFERFIXED_H
 
+#include <libgeodecomp/misc/metrics.h>
 #include <libgeodecomp/misc/stdcontaineroverloads.h>
 #include <libgeodecomp/storage/patchaccepter.h>
 #include <libgeodecomp/storage/patchprovider.h>
@@ -54,7 +55,11 @@ public:
             throw std::logic_error("PatchBufferFixed capacity exceeded.");
         }
 
+        // no-op for fixed size buffers, but serialized cells would
+        // otherwise be appended to the previous contents:
+        SerializationBuffer<CellType>::resize(&buffer[indexWrite], region.size());
         grid.saveRegion(&buffer[indexWrite], region);
+        Metrics::add(Metrics::PATCH_BUFFER_CELLS, region.size());
         storedNanoSteps << (min)(requestedNanoSteps);
         erase_min(requestedNanoSteps);
         inc(&indexWrite);
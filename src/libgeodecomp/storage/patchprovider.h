@@ -38,6 +38,24 @@ public:
         // empty as most implementations won't need it anyway.
     }
 
+    /**
+     * Gives implementations which rely on asynchronous transfers
+     * (e.g. PatchLink) a chance to drive them forward. Steppers call
+     * this repeatedly while they're busy updating the inner set.
+     */
+    virtual void progress()
+    {}
+
+    /**
+     * Announces the grid which the next get() will write to.
+     * Implementations which receive asynchronously (e.g. PatchLink)
+     * may then store incoming patches in that grid right away.
+     * Steppers may only call this once they won't access the
+     * provider's region in that grid until said get().
+     */
+    virtual void prepare(GRID_TYPE * /* destinationGrid */)
+    {}
+
     virtual void get(
         GRID_TYPE *destinationGrid,
         const Region<DIM>& patchableRegion,
@@ -0,0 +1,429 @@
+#ifndef LIBGEODECOMP_STORAGE_REGIONGRID_H
+#define LIBGEODECOMP_STORAGE_REGIONGRID_H
+
+#include <libgeodecomp/geometry/coordbox.h>
+#include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/geometry/topologies.h>
+#include <libgeodecomp/storage/coordmap.h>
+#include <libgeodecomp/storage/gridbase.h>
+
+#include <algorithm>
+#include <sstream>
+
+namespace LibGeoDecomp {
+
+/**
+ * A grid which stores only the cells of a given Region instead of
+ * its whole bounding box. Domain decompositions with irregular
+ * subdomains (e.g. Hilbert curve or H-indexing) may yield bounding
+ * boxes several times larger than the actual subdomain, this grid
+ * won't waste memory on those.
+ *
+ * Cells are stored streak by streak. A per-plane offset table (a
+ * plane being a row in 2D or a (y, z) pair in 3D) points to the
+ * first streak of each plane, so looking up a coordinate is reduced
+ * to a short scan over the streaks of one row. As streaks are stored
+ * contiguously, the streak-based UpdateFunctor works unmodified,
+ * provided that the neighbors of all updated cells are contained in
+ * the Region. This holds for the Steppers as they update only cells
+ * whose neighbors lie in their own region plus ghost zone halo.
+ *
+ * Accessing coordinates outside of the Region yields the edge cell.
+ * Writes to such coordinates are discarded, which allows
+ * Initializers to simply iterate over the grid's bounding box.
+ *
+ * If the TOPOLOGY has periodic boundary conditions, coordinates will
+ * be normalized according to the topological dimensions (if given).
+ * Thus ghost zones which span the edges of the simulation space can
+ * be accessed with unwrapped coordinates.
+ */
+template<typename CELL_TYPE, typename TOPOLOGY=Topologies::Cube<2>::Topology>
+class RegionGrid : public GridBase<CELL_TYPE, TOPOLOGY::DIM>
+{
+public:
+    friend class RegionGridTest;
+
+    const static int DIM = TOPOLOGY::DIM;
+
+    typedef CELL_TYPE Cell;
+    typedef TOPOLOGY Topology;
+    typedef CoordMap<CELL_TYPE, RegionGrid> CoordMapType;
+
+    using GridBase<CELL_TYPE, TOPOLOGY::DIM>::loadRegion;
+    using GridBase<CELL_TYPE, TOPOLOGY::DIM>::saveRegion;
+    using GridBase<CELL_TYPE, TOPOLOGY::DIM>::topoDimensions;
+
+    explicit RegionGrid(
+        const Region<DIM>& region = Region<DIM>(),
+        const CELL_TYPE& defaultCell = CELL_TYPE(),
+        const CELL_TYPE& edgeCell = CELL_TYPE(),
+        const Coord<DIM>& topologicalDimensions = Coord<DIM>()) :
+        GridBase<CELL_TYPE, TOPOLOGY::DIM>(topologicalDimensions),
+        region(region),
+        edgeCell(edgeCell)
+    {
+        init(defaultCell);
+    }
+
+    explicit RegionGrid(
+        const CoordBox<DIM>& box,
+        const CELL_TYPE& defaultCell = CELL_TYPE(),
+        const CELL_TYPE& edgeCell = CELL_TYPE(),
+        const Coord<DIM>& topologicalDimensions = Coord<DIM>()) :
+        GridBase<CELL_TYPE, TOPOLOGY::DIM>(topologicalDimensions),
+        edgeCell(edgeCell)
+    {
+        region << box;
+        init(defaultCell);
+    }
+
+    inline const CELL_TYPE& getEdgeCell() const
+    {
+        return edgeCell;
+    }
+
+    inline CELL_TYPE& getEdgeCell()
+    {
+        return edgeCell;
+    }
+
+    virtual void resize(const CoordBox<DIM>& box)
+    {
+        region.clear();
+        region << box;
+        init(CELL_TYPE());
+    }
+
+    inline CELL_TYPE& operator[](const Coord<DIM>& coord)
+    {
+        CELL_TYPE *cell = const_cast<CELL_TYPE*>(locate(coord));
+        return cell ? *cell : edgeCell;
+    }
+
+    inline const CELL_TYPE& operator[](const Coord<DIM>& coord) const
+    {
+        const CELL_TYPE *cell = locate(coord);
+        return cell ? *cell : edgeCell;
+    }
+
+    virtual void set(const Coord<DIM>& coord, const CELL_TYPE& cell)
+    {
+        CELL_TYPE *target = const_cast<CELL_TYPE*>(locate(coord));
+        if (target) {
+            *target = cell;
+        }
+    }
+
+    virtual void set(const Streak<DIM>& streak, const CELL_TYPE *cells)
+    {
+        Coord<DIM> cursor = streak.origin;
+
+        while (cursor.x() < streak.endX) {
+            int length = 1;
+            CELL_TYPE *target = const_cast<CELL_TYPE*>(locate(cursor, &length));
+            length = (std::min)(length, streak.endX - cursor.x());
+
+            if (target) {
+                std::copy(cells, cells + length, target);
+            }
+
+            cells += length;
+            cursor.x() += length;
+        }
+    }
+
+    virtual CELL_TYPE get(const Coord<DIM>& coord) const
+    {
+        return (*this)[coord];
+    }
+
+    virtual void get(const Streak<DIM>& streak, CELL_TYPE *cells) const
+    {
+        Coord<DIM> cursor = streak.origin;
+
+        while (cursor.x() < streak.endX) {
+            int length = 1;
+            const CELL_TYPE *source = locate(cursor, &length);
+            length = (std::min)(length, streak.endX - cursor.x());
+
+            if (source) {
+                std::copy(source, source + length, cells);
+            } else {
+                std::fill(cells, cells + length, edgeCell);
+            }
+
+            cells += length;
+            cursor.x() += length;
+        }
+    }
+
+    virtual const CELL_TYPE *streakAddress(const Streak<DIM>& streak) const
+    {
+        int length = 0;
+        const CELL_TYPE *cell = locate(streak.origin, &length);
+        if (length < streak.length()) {
+            return 0;
+        }
+
+        return cell;
+    }
+
+    virtual void setEdge(const CELL_TYPE& cell)
+    {
+        edgeCell = cell;
+    }
+
+    virtual const CELL_TYPE& getEdge() const
+    {
+        return edgeCell;
+    }
+
+    virtual CoordBox<DIM> boundingBox() const
+    {
+        return box;
+    }
+
+    virtual const Region<DIM>& boundingRegion()
+    {
+        return region;
+    }
+
+    /**
+     * Number of cells actually stored.
+     */
+    inline std::size_t size() const
+    {
+        return cells.size();
+    }
+
+    void saveRegion(
+        std::vector<CELL_TYPE> *buffer,
+        const Region<DIM>& region,
+        const Coord<DIM>& offset = Coord<DIM>()) const
+    {
+        CELL_TYPE *target = buffer->data();
+
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(offset);
+             i != region.endStreak(offset);
+             ++i) {
+            get(*i, target);
+            target += i->length();
+        }
+    }
+
+    void loadRegion(
+        const std::vector<CELL_TYPE>& buffer,
+        const Region<DIM>& region,
+        const Coord<DIM>& offset = Coord<DIM>())
+    {
+        const CELL_TYPE *source = buffer.data();
+
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(offset);
+             i != region.endStreak(offset);
+             ++i) {
+            set(*i, source);
+            source += i->length();
+        }
+    }
+
+    inline CoordMapType getNeighborhood(const Coord<DIM>& center) const
+    {
+        return CoordMapType(center, this);
+    }
+
+    inline std::string toString() const
+    {
+        std::ostringstream message;
+        message << "RegionGrid<" << DIM << ">(\n"
+                << "  boundingBox: " << box << "\n"
+                << "  size: " << cells.size() << "\n"
+                << "  edgeCell:\n"
+                << edgeCell << "\n";
+
+        for (typename Region<DIM>::Iterator i = region.begin(); i != region.end(); ++i) {
+            message << "  Coord" << *i << ":\n" << (*this)[*i] << "\n";
+        }
+
+        message << ")";
+        return message.str();
+    }
+
+protected:
+    void saveMemberImplementation(
+        char *target,
+        MemoryLocation::Location targetLocation,
+        const Selector<CELL_TYPE>& selector,
+        const typename Region<DIM>::StreakIterator& begin,
+        const typename Region<DIM>::StreakIterator& end) const
+    {
+        for (typename Region<DIM>::StreakIterator i = begin; i != end; ++i) {
+            Coord<DIM> cursor = i->origin;
+
+            while (cursor.x() < i->endX) {
+                int length = 1;
+                const CELL_TYPE *source = locate(cursor, &length);
+                length = (std::min)(length, i->endX - cursor.x());
+
+                if (source) {
+                    selector.copyMemberOut(source, MemoryLocation::HOST, target, targetLocation, length);
+                } else {
+                    length = 1;
+                    selector.copyMemberOut(&edgeCell, MemoryLocation::HOST, target, targetLocation, length);
+                }
+
+                target += selector.sizeOfExternal() * length;
+                cursor.x() += length;
+            }
+        }
+    }
+
+    void loadMemberImplementation(
+        const char *source,
+        MemoryLocation::Location sourceLocation,
+        const Selector<CELL_TYPE>& selector,
+        const typename Region<DIM>::StreakIterator& begin,
+        const typename Region<DIM>::StreakIterator& end)
+    {
+        for (typename Region<DIM>::StreakIterator i = begin; i != end; ++i) {
+            Coord<DIM> cursor = i->origin;
+
+            while (cursor.x() < i->endX) {
+                int length = 1;
+                CELL_TYPE *target = const_cast<CELL_TYPE*>(locate(cursor, &length));
+                length = (std::min)(length, i->endX - cursor.x());
+
+                if (target) {
+                    selector.copyMemberIn(source, sourceLocation, target, MemoryLocation::HOST, length);
+                } else {
+                    length = 1;
+                }
+
+                source += selector.sizeOfExternal() * length;
+                cursor.x() += length;
+            }
+        }
+    }
+
+private:
+    /**
+     * Describes a stored streak: its extent along the X axis and the
+     * index of its first cell in the cell vector.
+     */
+    class StreakEntry
+    {
+    public:
+        inline StreakEntry(int begin = 0, int end = 0, int offset = 0) :
+            begin(begin),
+            end(end),
+            offset(offset)
+        {}
+
+        int begin;
+        int end;
+        int offset;
+    };
+
+    Region<DIM> region;
+    CoordBox<DIM> box;
+    std::vector<int> planeOffsets;
+    std::vector<StreakEntry> streaks;
+    std::vector<CELL_TYPE> cells;
+    CELL_TYPE edgeCell;
+    bool normalizeCoords;
+
+    void init(const CELL_TYPE& defaultCell)
+    {
+        box = region.boundingBox();
+
+        normalizeCoords = (topoDimensions.prod() > 0);
+        bool wrapsAnyAxis = false;
+        for (int d = 0; d < DIM; ++d) {
+            wrapsAnyAxis |= Topology::wrapsAxis(d);
+        }
+        normalizeCoords &= wrapsAnyAxis;
+
+        int numPlanes = 1;
+        for (int d = 1; d < DIM; ++d) {
+            numPlanes *= box.dimensions[d];
+        }
+
+        planeOffsets.assign(numPlanes + 1, 0);
+        streaks.clear();
+        streaks.reserve(region.numStreaks());
+
+        int offset = 0;
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            ++planeOffsets[planeIndex(i->origin - box.origin) + 1];
+            streaks.push_back(StreakEntry(i->origin.x(), i->endX, offset));
+            offset += i->length();
+        }
+
+        for (int i = 0; i < numPlanes; ++i) {
+            planeOffsets[i + 1] += planeOffsets[i];
+        }
+
+        cells.assign(offset, defaultCell);
+    }
+
+    inline int planeIndex(const Coord<DIM>& relativeCoord) const
+    {
+        int index = 0;
+        for (int d = DIM - 1; d > 0; --d) {
+            index = index * box.dimensions[d] + relativeCoord[d];
+        }
+
+        return index;
+    }
+
+    /**
+     * Returns a pointer to the cell at coord, or 0 if coord isn't
+     * part of the Region. If a pointer is returned, length will be
+     * set to the number of cells which are stored contiguously,
+     * starting at coord.
+     */
+    inline const CELL_TYPE *locate(const Coord<DIM>& coord, int *length = 0) const
+    {
+        Coord<DIM> normalizedCoord = coord;
+        if (normalizeCoords) {
+            normalizedCoord = Topology::normalize(coord, topoDimensions);
+        }
+
+        Coord<DIM> relativeCoord = normalizedCoord - box.origin;
+        for (int d = 1; d < DIM; ++d) {
+            if ((relativeCoord[d] < 0) || (relativeCoord[d] >= box.dimensions[d])) {
+                return 0;
+            }
+        }
+
+        int x = normalizedCoord.x();
+        int plane = planeIndex(relativeCoord);
+        for (int i = planeOffsets[plane]; i < planeOffsets[plane + 1]; ++i) {
+            const StreakEntry& entry = streaks[i];
+            if (x < entry.begin) {
+                return 0;
+            }
+
+            if (x < entry.end) {
+                if (length) {
+                    *length = entry.end - x;
+                }
+                return &cells[entry.offset + x - entry.begin];
+            }
+        }
+
+        return 0;
+    }
+};
+
+}
+
+template<typename _CharT, typename _Traits, typename _CellT, typename _Topology>
+std::basic_ostream<_CharT, _Traits>&
+operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+           const LibGeoDecomp::RegionGrid<_CellT, _Topology>& grid)
+{
+    __os << grid.toString();
+    return __os;
+}
+
+#endif
@@ -40,127 +40,6 @@ public:
     int rowIndex;
 };
 
-/**
- * Helper class to initialize the sell container from an adjacency matrix.
- * This is a class and not a method, because there are two different implementations,
- * one for SIGMA = 1 and one for SIGMA > 1.
- */
-template<typename VALUETYPE, int C, int SIGMA>
-class InitFromMatrix
-{
-public:
-    using SellContainer = SellCSigmaSparseMatrixContainer<VALUETYPE, C, SIGMA>;
-    using Matrix = std::vector<std::pair<Coord<2>, VALUETYPE> >;
-
-    void operator()(SellContainer *container, const Matrix& matrix) const
-    {
-        std::vector<int> rowLengthCopy;
-
-        // calculate size for arrays
-        const int matrixRows = container->dimension;
-        const int numberOfChunks = (matrixRows - 1) / C + 1;
-        const int numberOfSigmas = (matrixRows - 1) / SIGMA + 1;
-        const int rowsPadded = numberOfChunks * C;
-        int numberOfValues = 0;
-
-        // save references to sell data structures
-        auto& chunkOffset     = container->chunkOffset;
-        auto& chunkLength     = container->chunkLength;
-        auto& rowLength       = container->rowLength;
-        auto& realRowToSorted = container->realRowToSorted;
-        auto& chunkRowToReal  = container->chunkRowToReal;
-        auto& values          = container->values;
-        auto& column          = container->column;
-
-        // allocate memory
-        chunkOffset.resize(numberOfChunks + 1);
-        chunkLength.resize(numberOfChunks);
-        rowLength.resize(rowsPadded);
-        rowLengthCopy.resize(rowsPadded);
-        realRowToSorted.reserve(rowsPadded);
-        chunkRowToReal.resize(rowsPadded);
-
-        // get row lengths
-        std::fill(begin(rowLength), end(rowLength), 0);
-        for (const auto& pair: matrix) {
-            ++rowLength[pair.first.x()];
-        }
-
-        // map sorting scope
-        for (int nSigma = 0; nSigma < numberOfSigmas; ++nSigma) {
-            const int numberOfRows = (std::min)(SIGMA, rowsPadded - nSigma * SIGMA);
-            std::vector<SortItem> lengths(numberOfRows);
-            for (int i = 0; i < numberOfRows; ++i) {
-                const int row = nSigma * SIGMA + i;
-                lengths[i] = SortItem(rowLength[row], row);
-            }
-            std::stable_sort(begin(lengths), end(lengths),
-                             [] (const SortItem& a, const SortItem& b) -> bool
-                             { return a.rowLength > b.rowLength; });
-            for (int i = 0; i < numberOfRows; ++i) {
-                int newID = nSigma * SIGMA + i;
-                chunkRowToReal[newID] = lengths[i].rowIndex;
-                realRowToSorted.push_back(std::make_pair(lengths[i].rowIndex, newID));
-                rowLengthCopy[newID] = lengths[i].rowLength;
-            }
-        }
-
-        std::stable_sort(realRowToSorted.begin(), realRowToSorted.end(),
-                         [] (const std::pair<int, int>& a, const std::pair<int, int>& b) -> bool
-                         { return a.first < b.first; });
-
-        // save chunk lengths and offsets
-        chunkOffset[0] = 0;
-        for (int nChunk = 0; nChunk < numberOfChunks; ++nChunk) {
-            std::vector<int> lengths(C);
-            for (auto i = 0u; i < lengths.size(); ++i) {
-                lengths[i] = rowLength[chunkRowToReal[nChunk * C + i]];
-            }
-            chunkLength[nChunk] = *std::max_element(begin(lengths), end(lengths));
-            if (nChunk > 0) {
-                chunkOffset[nChunk] = chunkOffset[nChunk - 1] + chunkLength[nChunk - 1] * C;
-            }
-            numberOfValues += chunkLength[nChunk] * C;
-        }
-        chunkOffset[numberOfChunks] =
-            chunkOffset[numberOfChunks - 1] +
-            chunkLength[numberOfChunks - 1] * C;
-
-        // save values
-        rowLength = std::move(rowLengthCopy);
-        values.resize(numberOfValues);
-        column.resize(numberOfValues);
-        std::fill(begin(values), end(values), 0);
-        std::fill(begin(column), end(column), 0);
-        int currentRow = 0;
-        int index = 0;
-
-        for (const auto& pair: matrix) {
-            if (pair.first.x() != currentRow) {
-                currentRow = pair.first.x();
-                index = 0;
-            }
-            std::vector<std::pair<int, int> >::iterator iter = std::lower_bound(
-                realRowToSorted.begin(), realRowToSorted.end(), pair.first.x(),
-                [](const std::pair<int, int>& a, const int id) {
-                    return a.first < id;
-                });
-
-            if (iter == realRowToSorted.end()) {
-                throw std::logic_error("ID not found");
-            }
-
-            const int chunk = iter->second / C;
-            const int row   = iter->second % C;
-            const int start = chunkOffset[chunk];
-            const int idx   = start + index * C + row;
-            values[idx]     = pair.second;
-            column[idx]     = pair.first.y();
-            ++index;
-        }
-    }
-};
-
 }
 
 /**
@@ -177,9 +56,119 @@ public:
     using AlignedValueVector = std::vector<VALUETYPE, LibFlatArray::aligned_allocator<VALUETYPE, 64> >;
     using AlignedIntVector   = std::vector<int, LibFlatArray::aligned_allocator<int, 64> >;
 
-    friend SellHelpers::InitFromMatrix<VALUETYPE, C, SIGMA>;
     friend class ReorderingUnstructuredGridTest;
 
+    /**
+     * Sets up the SELL-C-SIGMA layout of a container in two phases:
+     * the constructor takes the length of each row, sorts the rows
+     * within each SIGMA-window by length and allocates the chunks.
+     * Afterwards the rows' entries can be written via setRow(),
+     * which locates a row in constant time and may be called
+     * concurrently for different rows. Every row with a non-zero
+     * length has to be set exactly once.
+     *
+     * This allows to stream rows into the container (e.g. from a
+     * generator or a file reader), without first materializing the
+     * complete matrix as a SparseMatrix.
+     */
+    class Builder
+    {
+    public:
+        Builder(SellCSigmaSparseMatrixContainer *container, const std::vector<int>& rowLengths) :
+            container(container)
+        {
+            if (rowLengths.size() != container->dimension) {
+                throw std::invalid_argument("number of row lengths doesn't match matrix dimension");
+            }
+
+            const int matrixRows = container->dimension;
+            const int numberOfChunks = (matrixRows - 1) / C + 1;
+            const int rowsPadded = numberOfChunks * C;
+            const int numberOfSigmas = (rowsPadded - 1) / SIGMA + 1;
+
+            auto& chunkOffset     = container->chunkOffset;
+            auto& chunkLength     = container->chunkLength;
+            auto& rowLength       = container->rowLength;
+            auto& realRowToSorted = container->realRowToSorted;
+            auto& chunkRowToReal  = container->chunkRowToReal;
+
+            chunkOffset.assign(numberOfChunks + 1, 0);
+            chunkLength.assign(numberOfChunks, 0);
+            rowLength.assign(rowsPadded, 0);
+            realRowToSorted.resize(rowsPadded);
+            chunkRowToReal.resize(rowsPadded);
+
+            // sort rows by length within each SIGMA-window. As each
+            // window holds a contiguous range of rows, the mapping
+            // of real rows to sorted rows doesn't need to be sorted
+            // afterwards and can be indexed directly:
+#pragma omp parallel
+            {
+                std::vector<SellHelpers::SortItem> lengths;
+
+#pragma omp for schedule(dynamic, 64)
+                for (int nSigma = 0; nSigma < numberOfSigmas; ++nSigma) {
+                    const int numberOfRows = (std::min)(SIGMA, rowsPadded - nSigma * SIGMA);
+                    lengths.resize(numberOfRows);
+                    for (int i = 0; i < numberOfRows; ++i) {
+                        const int row = nSigma * SIGMA + i;
+                        lengths[i] = SellHelpers::SortItem(row < matrixRows ? rowLengths[row] : 0, row);
+                    }
+
+                    if (SIGMA > 1) {
+                        std::stable_sort(
+                            lengths.begin(),
+                            lengths.end(),
+                            [] (const SellHelpers::SortItem& a, const SellHelpers::SortItem& b) -> bool
+                            { return a.rowLength > b.rowLength; });
+                    }
+
+                    for (int i = 0; i < numberOfRows; ++i) {
+                        const int newID = nSigma * SIGMA + i;
+                        chunkRowToReal[newID] = lengths[i].rowIndex;
+                        realRowToSorted[lengths[i].rowIndex] = std::make_pair(lengths[i].rowIndex, newID);
+                        rowLength[newID] = lengths[i].rowLength;
+                    }
+                }
+            }
+
+#pragma omp parallel for schedule(static)
+            for (int nChunk = 0; nChunk < numberOfChunks; ++nChunk) {
+                chunkLength[nChunk] = *std::max_element(
+                    rowLength.begin() + nChunk * C,
+                    rowLength.begin() + (nChunk + 1) * C);
+            }
+
+            for (int nChunk = 0; nChunk < numberOfChunks; ++nChunk) {
+                chunkOffset[nChunk + 1] = chunkOffset[nChunk] + chunkLength[nChunk] * C;
+            }
+
+            const int numberOfValues = chunkOffset[numberOfChunks];
+            container->values.assign(numberOfValues, VALUETYPE(0));
+            container->column.assign(numberOfValues, 0);
+        }
+
+        /**
+         * Copies the entries of the given row, columns and values
+         * need to hold as many elements as were specified as this
+         * row's length.
+         */
+        inline void setRow(const int row, const int *columns, const VALUETYPE *values)
+        {
+            const int sortedRow = container->realRowToSorted[row].second;
+            const int length = container->rowLength[sortedRow];
+            int index = container->chunkOffset[sortedRow / C] + sortedRow % C;
+
+            for (int i = 0; i < length; ++i, index += C) {
+                container->values[index] = values[i];
+                container->column[index] = columns[i];
+            }
+        }
+
+    private:
+        SellCSigmaSparseMatrixContainer *container;
+    };
+
     explicit
     SellCSigmaSparseMatrixContainer(const int N = 0) :
         values(),
@@ -220,11 +209,74 @@ public:
      */
     void initFromMatrix(const SparseMatrix& matrix)
     {
-        SparseMatrix sortedMatrix = matrix;
-        std::sort(sortedMatrix.begin(), sortedMatrix.end(), [](const std::pair<Coord<2>, VALUETYPE>& a, const std::pair<Coord<2>, VALUETYPE>& b){
-                return a.first < b.first;
-            });
-        SellHelpers::InitFromMatrix<VALUETYPE, C, SIGMA>()(this, sortedMatrix);
+        // bucket entries by row (i.e. convert to CSR), which is
+        // linear in the number of entries and needs less memory
+        // than sorting a copy of the matrix:
+        std::vector<long> rowOffsets(dimension + 1, 0);
+        for (const auto& entry: matrix) {
+            if ((entry.first.x() < 0) || (std::size_t(entry.first.x()) >= dimension)) {
+                throw std::invalid_argument("row index out of bounds");
+            }
+            ++rowOffsets[entry.first.x() + 1];
+        }
+        for (std::size_t row = 0; row < dimension; ++row) {
+            rowOffsets[row + 1] += rowOffsets[row];
+        }
+
+        std::vector<std::pair<int, VALUETYPE> > entries(matrix.size());
+        std::vector<long> cursors(rowOffsets.begin(), rowOffsets.end() - 1);
+        for (const auto& entry: matrix) {
+            entries[cursors[entry.first.x()]++] = std::make_pair(entry.first.y(), entry.second);
+        }
+
+        std::vector<int> columns(matrix.size());
+        std::vector<VALUETYPE> values(matrix.size());
+
+#pragma omp parallel for schedule(dynamic, 1024)
+        for (long row = 0; row < long(dimension); ++row) {
+            std::sort(
+                entries.begin() + rowOffsets[row],
+                entries.begin() + rowOffsets[row + 1],
+                [](const std::pair<int, VALUETYPE>& a, const std::pair<int, VALUETYPE>& b) {
+                    return a.first < b.first;
+                });
+
+            for (long i = rowOffsets[row]; i < rowOffsets[row + 1]; ++i) {
+                columns[i] = entries[i].first;
+                values[i]  = entries[i].second;
+            }
+        }
+
+        initFromCSR(rowOffsets.data(), columns.data(), values.data());
+    }
+
+    /**
+     * Initializes the container from a matrix in compressed sparse
+     * row (CSR) format: the entries of row i are stored at indices
+     * rowOffsets[i] to rowOffsets[i + 1] - 1 in columns and values,
+     * hence rowOffsets needs to hold dim() + 1 elements. Chunks are
+     * filled in parallel.
+     */
+    template<typename OFFSET>
+    void initFromCSR(const OFFSET *rowOffsets, const int *columns, const VALUETYPE *values)
+    {
+        std::vector<int> rowLengths(dimension);
+        for (std::size_t row = 0; row < dimension; ++row) {
+            rowLengths[row] = rowOffsets[row + 1] - rowOffsets[row];
+        }
+
+        Builder builder(this, rowLengths);
+        const int numberOfChunks = chunkLength.size();
+
+#pragma omp parallel for schedule(dynamic, 64)
+        for (int chunk = 0; chunk < numberOfChunks; ++chunk) {
+            for (int i = 0; i < C; ++i) {
+                const int row = chunkRowToReal[chunk * C + i];
+                if (std::size_t(row) < dimension) {
+                    builder.setRow(row, columns + rowOffsets[row], values + rowOffsets[row]);
+                }
+            }
+        }
     }
 
     inline bool operator==(const SellCSigmaSparseMatrixContainer& other) const
@@ -238,7 +290,7 @@ public:
     template<int O_C, int O_SIGMA>
     inline bool operator==(const SellCSigmaSparseMatrixContainer<VALUETYPE, O_C, O_SIGMA>& other) const
     {
-        if (dimension != other.dimension) {
+        if (dimension != other.dim()) {
             return false;
         }
 
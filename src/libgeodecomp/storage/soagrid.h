@@ -265,6 +265,103 @@ private:
     long memberOffset;
 };
 
+/**
+ * Appends the chunks of memory which hold one member (and those of
+ * all following members) of a SoA grid's streaks. Elements of array
+ * members are stored in separate arrays, so each one is treated like
+ * a member of its own.
+ */
+template<typename CELL, long MEMBER, bool DONE = (MEMBER == long(LibFlatArray::number_of_members<CELL>::VALUE))>
+class ListMemberChunks
+{
+public:
+    typedef LibFlatArray::detail::flat_array::offset<CELL, MEMBER + 1> Member;
+
+    static void apply(
+        const std::vector<long>& indices,
+        const std::vector<int>& streakLengths,
+        long gridVolume,
+        std::vector<std::ptrdiff_t> *offsets,
+        std::vector<int> *lengths)
+    {
+        long memberOffset = LibFlatArray::detail::flat_array::offset<CELL, MEMBER>::OFFSET;
+
+        for (std::size_t element = 0; element < Member::ARITY; ++element) {
+            long arrayOffset = gridVolume * (memberOffset + element * Member::ELEMENT_SIZE);
+
+            for (std::size_t i = 0; i < indices.size(); ++i) {
+                *offsets << std::ptrdiff_t(arrayOffset + indices[i] * Member::ELEMENT_SIZE);
+                *lengths << int(streakLengths[i] * Member::ELEMENT_SIZE);
+            }
+        }
+
+        ListMemberChunks<CELL, MEMBER + 1>::apply(indices, streakLengths, gridVolume, offsets, lengths);
+    }
+};
+
+/**
+ * see above
+ */
+template<typename CELL, long MEMBER>
+class ListMemberChunks<CELL, MEMBER, true>
+{
+public:
+    static void apply(
+        const std::vector<long>& /* indices */,
+        const std::vector<int>& /* streakLengths */,
+        long /* gridVolume */,
+        std::vector<std::ptrdiff_t> * /* offsets */,
+        std::vector<int> * /* lengths */)
+    {}
+};
+
+/**
+ * Lists the chunks of memory in which a SoA grid stores a Region's
+ * cells. The order matches the one in which saveRegion() serializes
+ * them: member by member and, per member, streak by streak. Offsets
+ * are given in bytes, relative to the grid's data().
+ */
+template<typename CELL, int DIM>
+class ListChunks
+{
+public:
+    ListChunks(
+        const Region<DIM>& region,
+        const Coord<DIM>& origin,
+        const Coord<3>& edgeRadii,
+        std::vector<std::ptrdiff_t> *offsets,
+        std::vector<int> *lengths) :
+        region(region),
+        origin(origin),
+        edgeRadii(edgeRadii),
+        offsets(offsets),
+        lengths(lengths)
+    {}
+
+    template<long DIM_X, long DIM_Y, long DIM_Z, long INDEX>
+    void operator()(LibFlatArray::soa_accessor<CELL, DIM_X, DIM_Y, DIM_Z, INDEX> /* accessor */) const
+    {
+        std::vector<long> indices;
+        std::vector<int> streakLengths;
+        indices.reserve(region.numStreaks());
+        streakLengths.reserve(region.numStreaks());
+
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            indices << long(GenIndex<DIM_X, DIM_Y, DIM_Z>()(i->origin - origin, edgeRadii));
+            streakLengths << i->length();
+        }
+
+        ListMemberChunks<CELL, 0>::apply(indices, streakLengths, DIM_X * DIM_Y * DIM_Z, offsets, lengths);
+    }
+
+private:
+    const Region<DIM>& region;
+    const Coord<DIM>& origin;
+    const Coord<3>& edgeRadii;
+    std::vector<std::ptrdiff_t> *offsets;
+    std::vector<int> *lengths;
+};
+
 /**
  * This class duplicates some functionality from RegionStreakIterator,
  * but is still necessary as we always need 3D coordinates (because of
@@ -575,6 +672,26 @@ public:
             size);
     }
 
+    /**
+     * Lists the chunks of memory which hold the Region's cells, in
+     * the order in which saveRegion() would serialize them (see
+     * SoAGridHelpers::ListChunks). This allows callers (e.g.
+     * PatchLink) to transfer the cells straight from/to the grid.
+     */
+    void regionChunks(
+        const Region<DIM>& region,
+        std::vector<std::ptrdiff_t> *offsets,
+        std::vector<int> *lengths) const
+    {
+        delegate.callback(
+            SoAGridHelpers::ListChunks<CELL, DIM>(
+                region,
+                box.origin,
+                edgeRadii,
+                offsets,
+                lengths));
+    }
+
     static Coord<3> calcEdgeRadii()
     {
         return Coord<3>(
@@ -0,0 +1,10 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}memberfiltertest.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+  ${RELATIVE_PATH}selectortest.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}memberfiltertest.h
+  ${RELATIVE_PATH}selectortest.h
+)
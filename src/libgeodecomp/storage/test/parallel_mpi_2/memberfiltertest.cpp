@@ -0,0 +1,49 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_MemberFilterTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/parallel_mpi_2/memberfiltertest.h"
+
+static MemberFilterTest suite_MemberFilterTest;
+
+static CxxTest::List Tests_MemberFilterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MemberFilterTest( "/root/repo/src/libgeodecomp/storage/test/parallel_mpi_2/memberfiltertest.h", 13, "MemberFilterTest", suite_MemberFilterTest, Tests_MemberFilterTest );
+
+static class TestDescription_suite_MemberFilterTest_testBasics : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemberFilterTest_testBasics() : CxxTest::RealTestDescription( Tests_MemberFilterTest, suiteDescription_MemberFilterTest, 26, "testBasics" ) {}
+ void runTest() { suite_MemberFilterTest.testBasics(); }
+} testDescription_suite_MemberFilterTest_testBasics;
+
+static class TestDescription_suite_MemberFilterTest_testHostAoS : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemberFilterTest_testHostAoS() : CxxTest::RealTestDescription( Tests_MemberFilterTest, suiteDescription_MemberFilterTest, 40, "testHostAoS" ) {}
+ void runTest() { suite_MemberFilterTest.testHostAoS(); }
+} testDescription_suite_MemberFilterTest_testHostAoS;
+
+static class TestDescription_suite_MemberFilterTest_testHostSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemberFilterTest_testHostSoA() : CxxTest::RealTestDescription( Tests_MemberFilterTest, suiteDescription_MemberFilterTest, 54, "testHostSoA" ) {}
+ void runTest() { suite_MemberFilterTest.testHostSoA(); }
+} testDescription_suite_MemberFilterTest_testHostSoA;
+
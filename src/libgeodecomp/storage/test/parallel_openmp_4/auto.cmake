@@ -0,0 +1,8 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+  ${RELATIVE_PATH}unstructuredupdatefunctortest.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}unstructuredupdatefunctortest.h
+)
@@ -0,0 +1,176 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_UnstructuredUpdateFunctorTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/parallel_openmp_4/unstructuredupdatefunctortest.h"
+
+static UnstructuredUpdateFunctorTest suite_UnstructuredUpdateFunctorTest;
+
+static CxxTest::List Tests_UnstructuredUpdateFunctorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_UnstructuredUpdateFunctorTest( "/root/repo/src/libgeodecomp/storage/test/parallel_openmp_4/unstructuredupdatefunctortest.h", 164, "UnstructuredUpdateFunctorTest", suite_UnstructuredUpdateFunctorTest, Tests_UnstructuredUpdateFunctorTest );
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicSansUpdateLineXConcurrencyFalseFalse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicSansUpdateLineXConcurrencyFalseFalse() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 167, "testBasicSansUpdateLineXConcurrencyFalseFalse" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicSansUpdateLineXConcurrencyFalseFalse(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicSansUpdateLineXConcurrencyFalseFalse;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicSansUpdateLineXConcurrencyFalseTrue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicSansUpdateLineXConcurrencyFalseTrue() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 216, "testBasicSansUpdateLineXConcurrencyFalseTrue" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicSansUpdateLineXConcurrencyFalseTrue(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicSansUpdateLineXConcurrencyFalseTrue;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicSansUpdateLineXConcurrencyTrueFalse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicSansUpdateLineXConcurrencyTrueFalse() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 265, "testBasicSansUpdateLineXConcurrencyTrueFalse" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicSansUpdateLineXConcurrencyTrueFalse(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicSansUpdateLineXConcurrencyTrueFalse;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicSansUpdateLineXConcurrencyTrueTrue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicSansUpdateLineXConcurrencyTrueTrue() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 314, "testBasicSansUpdateLineXConcurrencyTrueTrue" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicSansUpdateLineXConcurrencyTrueTrue(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicSansUpdateLineXConcurrencyTrueTrue;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithUpdateLineXConcurrencyFalseFalse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithUpdateLineXConcurrencyFalseFalse() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 363, "testBasicWithUpdateLineXConcurrencyFalseFalse" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicWithUpdateLineXConcurrencyFalseFalse(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithUpdateLineXConcurrencyFalseFalse;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithUpdateLineXConcurrencyFalseTrue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithUpdateLineXConcurrencyFalseTrue() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 412, "testBasicWithUpdateLineXConcurrencyFalseTrue" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicWithUpdateLineXConcurrencyFalseTrue(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithUpdateLineXConcurrencyFalseTrue;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithUpdateLineXConcurrencyTrueFalse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithUpdateLineXConcurrencyTrueFalse() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 461, "testBasicWithUpdateLineXConcurrencyTrueFalse" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicWithUpdateLineXConcurrencyTrueFalse(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithUpdateLineXConcurrencyTrueFalse;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithUpdateLineXConcurrencyTrueTrue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithUpdateLineXConcurrencyTrueTrue() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 510, "testBasicWithUpdateLineXConcurrencyTrueTrue" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicWithUpdateLineXConcurrencyTrueTrue(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithUpdateLineXConcurrencyTrueTrue;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaButSansUpdateLineXConcurrencyFalseFalse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaButSansUpdateLineXConcurrencyFalseFalse() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 559, "testBasicWithSigmaButSansUpdateLineXConcurrencyFalseFalse" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicWithSigmaButSansUpdateLineXConcurrencyFalseFalse(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaButSansUpdateLineXConcurrencyFalseFalse;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaButSansUpdateLineXConcurrencyFalseTrue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaButSansUpdateLineXConcurrencyFalseTrue() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 616, "testBasicWithSigmaButSansUpdateLineXConcurrencyFalseTrue" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicWithSigmaButSansUpdateLineXConcurrencyFalseTrue(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaButSansUpdateLineXConcurrencyFalseTrue;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaButSansUpdateLineXConcurrencyTrueFalse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaButSansUpdateLineXConcurrencyTrueFalse() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 673, "testBasicWithSigmaButSansUpdateLineXConcurrencyTrueFalse" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicWithSigmaButSansUpdateLineXConcurrencyTrueFalse(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaButSansUpdateLineXConcurrencyTrueFalse;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaButSansUpdateLineXConcurrencyTrueTrue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaButSansUpdateLineXConcurrencyTrueTrue() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 730, "testBasicWithSigmaButSansUpdateLineXConcurrencyTrueTrue" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicWithSigmaButSansUpdateLineXConcurrencyTrueTrue(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaButSansUpdateLineXConcurrencyTrueTrue;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaAndWithUpdateLineXConcurrencyFalseFalse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaAndWithUpdateLineXConcurrencyFalseFalse() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 787, "testBasicWithSigmaAndWithUpdateLineXConcurrencyFalseFalse" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicWithSigmaAndWithUpdateLineXConcurrencyFalseFalse(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaAndWithUpdateLineXConcurrencyFalseFalse;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaAndWithUpdateLineXConcurrencyFalseTrue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaAndWithUpdateLineXConcurrencyFalseTrue() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 845, "testBasicWithSigmaAndWithUpdateLineXConcurrencyFalseTrue" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicWithSigmaAndWithUpdateLineXConcurrencyFalseTrue(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaAndWithUpdateLineXConcurrencyFalseTrue;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaAndWithUpdateLineXConcurrencyTrueFalse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaAndWithUpdateLineXConcurrencyTrueFalse() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 903, "testBasicWithSigmaAndWithUpdateLineXConcurrencyTrueFalse" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicWithSigmaAndWithUpdateLineXConcurrencyTrueFalse(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaAndWithUpdateLineXConcurrencyTrueFalse;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaAndWithUpdateLineXConcurrencyTrueTrue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaAndWithUpdateLineXConcurrencyTrueTrue() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 961, "testBasicWithSigmaAndWithUpdateLineXConcurrencyTrueTrue" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicWithSigmaAndWithUpdateLineXConcurrencyTrueTrue(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaAndWithUpdateLineXConcurrencyTrueTrue;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAConcurrencyFalseFalse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAConcurrencyFalseFalse() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 1019, "testSoAConcurrencyFalseFalse" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testSoAConcurrencyFalseFalse(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testSoAConcurrencyFalseFalse;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAConcurrencyFalseTrue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAConcurrencyFalseTrue() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 1085, "testSoAConcurrencyFalseTrue" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testSoAConcurrencyFalseTrue(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testSoAConcurrencyFalseTrue;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAConcurrencyTrueFalse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAConcurrencyTrueFalse() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 1151, "testSoAConcurrencyTrueFalse" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testSoAConcurrencyTrueFalse(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testSoAConcurrencyTrueFalse;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAConcurrencyTrueTrue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAConcurrencyTrueTrue() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 1217, "testSoAConcurrencyTrueTrue" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testSoAConcurrencyTrueTrue(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testSoAConcurrencyTrueTrue;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMAConcurrencyFalseFalse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMAConcurrencyFalseFalse() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 1283, "testSoAWithSIGMAConcurrencyFalseFalse" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testSoAWithSIGMAConcurrencyFalseFalse(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMAConcurrencyFalseFalse;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMAConcurrencyFalseTrue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMAConcurrencyFalseTrue() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 1349, "testSoAWithSIGMAConcurrencyFalseTrue" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testSoAWithSIGMAConcurrencyFalseTrue(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMAConcurrencyFalseTrue;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMAConcurrencyTrueFalse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMAConcurrencyTrueFalse() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 1415, "testSoAWithSIGMAConcurrencyTrueFalse" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testSoAWithSIGMAConcurrencyTrueFalse(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMAConcurrencyTrueFalse;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMAConcurrencyTrueTrue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMAConcurrencyTrueTrue() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 1481, "testSoAWithSIGMAConcurrencyTrueTrue" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testSoAWithSIGMAConcurrencyTrueTrue(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMAConcurrencyTrueTrue;
+
@@ -0,0 +1,56 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CollectionInterfaceTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/collectioninterfacetest.h"
+
+static CollectionInterfaceTest suite_CollectionInterfaceTest;
+
+static CxxTest::List Tests_CollectionInterfaceTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CollectionInterfaceTest( "/root/repo/src/libgeodecomp/storage/test/unit/collectioninterfacetest.h", 79, "CollectionInterfaceTest", suite_CollectionInterfaceTest, Tests_CollectionInterfaceTest );
+
+static class TestDescription_suite_CollectionInterfaceTest_testPassThrough1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CollectionInterfaceTest_testPassThrough1() : CxxTest::RealTestDescription( Tests_CollectionInterfaceTest, suiteDescription_CollectionInterfaceTest, 83, "testPassThrough1" ) {}
+ void runTest() { suite_CollectionInterfaceTest.testPassThrough1(); }
+} testDescription_suite_CollectionInterfaceTest_testPassThrough1;
+
+static class TestDescription_suite_CollectionInterfaceTest_testPassThrough2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CollectionInterfaceTest_testPassThrough2() : CxxTest::RealTestDescription( Tests_CollectionInterfaceTest, suiteDescription_CollectionInterfaceTest, 93, "testPassThrough2" ) {}
+ void runTest() { suite_CollectionInterfaceTest.testPassThrough2(); }
+} testDescription_suite_CollectionInterfaceTest_testPassThrough2;
+
+static class TestDescription_suite_CollectionInterfaceTest_testDelegate1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CollectionInterfaceTest_testDelegate1() : CxxTest::RealTestDescription( Tests_CollectionInterfaceTest, suiteDescription_CollectionInterfaceTest, 114, "testDelegate1" ) {}
+ void runTest() { suite_CollectionInterfaceTest.testDelegate1(); }
+} testDescription_suite_CollectionInterfaceTest_testDelegate1;
+
+static class TestDescription_suite_CollectionInterfaceTest_testDelegate2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CollectionInterfaceTest_testDelegate2() : CxxTest::RealTestDescription( Tests_CollectionInterfaceTest, suiteDescription_CollectionInterfaceTest, 138, "testDelegate2" ) {}
+ void runTest() { suite_CollectionInterfaceTest.testDelegate2(); }
+} testDescription_suite_CollectionInterfaceTest_testDelegate2;
+
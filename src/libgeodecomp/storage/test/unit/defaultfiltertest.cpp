@@ -0,0 +1,44 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_DefaultFilterTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/defaultfiltertest.h"
+
+static DefaultFilterTest suite_DefaultFilterTest;
+
+static CxxTest::List Tests_DefaultFilterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_DefaultFilterTest( "/root/repo/src/libgeodecomp/storage/test/unit/defaultfiltertest.h", 11, "DefaultFilterTest", suite_DefaultFilterTest, Tests_DefaultFilterTest );
+
+static class TestDescription_suite_DefaultFilterTest_testHostAoS : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DefaultFilterTest_testHostAoS() : CxxTest::RealTestDescription( Tests_DefaultFilterTest, suiteDescription_DefaultFilterTest, 14, "testHostAoS" ) {}
+ void runTest() { suite_DefaultFilterTest.testHostAoS(); }
+} testDescription_suite_DefaultFilterTest_testHostAoS;
+
+static class TestDescription_suite_DefaultFilterTest_testHostSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DefaultFilterTest_testHostSoA() : CxxTest::RealTestDescription( Tests_DefaultFilterTest, suiteDescription_DefaultFilterTest, 55, "testHostSoA" ) {}
+ void runTest() { suite_DefaultFilterTest.testHostSoA(); }
+} testDescription_suite_DefaultFilterTest_testHostSoA;
+
@@ -0,0 +1,110 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_DisplacedGridTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/displacedgridtest.h"
+
+static DisplacedGridTest suite_DisplacedGridTest;
+
+static CxxTest::List Tests_DisplacedGridTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_DisplacedGridTest( "/root/repo/src/libgeodecomp/storage/test/unit/displacedgridtest.h", 70, "DisplacedGridTest", suite_DisplacedGridTest, Tests_DisplacedGridTest );
+
+static class TestDescription_suite_DisplacedGridTest_testBoundingBox : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testBoundingBox() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 74, "testBoundingBox" ) {}
+ void runTest() { suite_DisplacedGridTest.testBoundingBox(); }
+} testDescription_suite_DisplacedGridTest_testBoundingBox;
+
+static class TestDescription_suite_DisplacedGridTest_testRegionConstructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testRegionConstructor() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 84, "testRegionConstructor" ) {}
+ void runTest() { suite_DisplacedGridTest.testRegionConstructor(); }
+} testDescription_suite_DisplacedGridTest_testRegionConstructor;
+
+static class TestDescription_suite_DisplacedGridTest_testRemapRegion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testRemapRegion() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 96, "testRemapRegion" ) {}
+ void runTest() { suite_DisplacedGridTest.testRemapRegion(); }
+} testDescription_suite_DisplacedGridTest_testRemapRegion;
+
+static class TestDescription_suite_DisplacedGridTest_testBoundingRegion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testBoundingRegion() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 106, "testBoundingRegion" ) {}
+ void runTest() { suite_DisplacedGridTest.testBoundingRegion(); }
+} testDescription_suite_DisplacedGridTest_testBoundingRegion;
+
+static class TestDescription_suite_DisplacedGridTest_testSetOrigin : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testSetOrigin() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 120, "testSetOrigin" ) {}
+ void runTest() { suite_DisplacedGridTest.testSetOrigin(); }
+} testDescription_suite_DisplacedGridTest_testSetOrigin;
+
+static class TestDescription_suite_DisplacedGridTest_testResize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testResize() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 138, "testResize" ) {}
+ void runTest() { suite_DisplacedGridTest.testResize(); }
+} testDescription_suite_DisplacedGridTest_testResize;
+
+static class TestDescription_suite_DisplacedGridTest_testGetSetManyCells : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testGetSetManyCells() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 158, "testGetSetManyCells" ) {}
+ void runTest() { suite_DisplacedGridTest.testGetSetManyCells(); }
+} testDescription_suite_DisplacedGridTest_testGetSetManyCells;
+
+static class TestDescription_suite_DisplacedGridTest_testTopologicalNormalizationWithTorus : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testTopologicalNormalizationWithTorus() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 191, "testTopologicalNormalizationWithTorus" ) {}
+ void runTest() { suite_DisplacedGridTest.testTopologicalNormalizationWithTorus(); }
+} testDescription_suite_DisplacedGridTest_testTopologicalNormalizationWithTorus;
+
+static class TestDescription_suite_DisplacedGridTest_testStreakAddress : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testStreakAddress() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 265, "testStreakAddress" ) {}
+ void runTest() { suite_DisplacedGridTest.testStreakAddress(); }
+} testDescription_suite_DisplacedGridTest_testStreakAddress;
+
+static class TestDescription_suite_DisplacedGridTest_testLoadSaveMember : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testLoadSaveMember() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 289, "testLoadSaveMember" ) {}
+ void runTest() { suite_DisplacedGridTest.testLoadSaveMember(); }
+} testDescription_suite_DisplacedGridTest_testLoadSaveMember;
+
+static class TestDescription_suite_DisplacedGridTest_testLoadSaveRegion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testLoadSaveRegion() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 345, "testLoadSaveRegion" ) {}
+ void runTest() { suite_DisplacedGridTest.testLoadSaveRegion(); }
+} testDescription_suite_DisplacedGridTest_testLoadSaveRegion;
+
+static class TestDescription_suite_DisplacedGridTest_testLoadSaveRegionWithOffset : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testLoadSaveRegionWithOffset() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 397, "testLoadSaveRegionWithOffset" ) {}
+ void runTest() { suite_DisplacedGridTest.testLoadSaveRegionWithOffset(); }
+} testDescription_suite_DisplacedGridTest_testLoadSaveRegionWithOffset;
+
+static class TestDescription_suite_DisplacedGridTest_testLoadSaveRegionWithBoostSerialization : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_DisplacedGridTest_testLoadSaveRegionWithBoostSerialization() : CxxTest::RealTestDescription( Tests_DisplacedGridTest, suiteDescription_DisplacedGridTest, 461, "testLoadSaveRegionWithBoostSerialization" ) {}
+ void runTest() { suite_DisplacedGridTest.testLoadSaveRegionWithBoostSerialization(); }
+} testDescription_suite_DisplacedGridTest_testLoadSaveRegionWithBoostSerialization;
+
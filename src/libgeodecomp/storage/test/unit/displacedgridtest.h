@@ -262,6 +262,30 @@ public:
         TS_ASSERT_EQUALS(actual, expected);
     }
 
+    void testStreakAddress()
+    {
+        DisplacedGrid<int> grid(CoordBox<2>(Coord<2>(-3, -2), Coord<2>(8, 6)));
+        const DisplacedGrid<int>& constGrid = grid;
+
+        TS_ASSERT_EQUALS(&grid[Coord<2>(-3, -2)], constGrid.streakAddress(Streak<2>(Coord<2>(-3, -2), 5)));
+        TS_ASSERT_EQUALS(&grid[Coord<2>( 1,  3)], constGrid.streakAddress(Streak<2>(Coord<2>( 1,  3), 5)));
+        TS_ASSERT_EQUALS((const int*)0,          constGrid.streakAddress(Streak<2>(Coord<2>( 1,  3), 6)));
+        TS_ASSERT_EQUALS((const int*)0,          constGrid.streakAddress(Streak<2>(Coord<2>(-4,  0), 0)));
+        TS_ASSERT_EQUALS((const int*)0,          constGrid.streakAddress(Streak<2>(Coord<2>( 0,  4), 2)));
+
+        // same layout as in testTopologicalNormalizationWithTorus():
+        DisplacedGrid<int, Topologies::Torus<2>::Topology, true> torusGrid(
+            CoordBox<2>(Coord<2>(-3, -2), Coord<2>(8, 6)),
+            -2,
+            -2,
+            Coord<2>(15, 10));
+
+        TS_ASSERT_EQUALS(&torusGrid[Coord<2>(12, 9)], torusGrid.streakAddress(Streak<2>(Coord<2>(12, 9), 15)));
+        TS_ASSERT_EQUALS(&torusGrid[Coord<2>(12, 0)], torusGrid.streakAddress(Streak<2>(Coord<2>(12, 0), 20)));
+        TS_ASSERT_EQUALS((const int*)0,               torusGrid.streakAddress(Streak<2>(Coord<2>(12, 0), 21)));
+        TS_ASSERT_EQUALS((const int*)0,               torusGrid.streakAddress(Streak<2>(Coord<2>(10, 0), 15)));
+    }
+
     void testLoadSaveMember()
     {
         // basic setup:
@@ -0,0 +1,75 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_FixedArrayTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/fixedarraytest.h"
+
+static FixedArrayTest suite_FixedArrayTest;
+
+static CxxTest::List Tests_FixedArrayTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_FixedArrayTest( "/root/repo/src/libgeodecomp/storage/test/unit/fixedarraytest.h", 8, "FixedArrayTest", suite_FixedArrayTest, Tests_FixedArrayTest );
+
+static class TestDescription_suite_FixedArrayTest_testInsertDelete : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedArrayTest_testInsertDelete() : CxxTest::RealTestDescription( Tests_FixedArrayTest, suiteDescription_FixedArrayTest, 12, "testInsertDelete" ) {}
+ void runTest() { suite_FixedArrayTest.testInsertDelete(); }
+} testDescription_suite_FixedArrayTest_testInsertDelete;
+
+static class TestDescription_suite_FixedArrayTest_testRemove : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedArrayTest_testRemove() : CxxTest::RealTestDescription( Tests_FixedArrayTest, suiteDescription_FixedArrayTest, 52, "testRemove" ) {}
+ void runTest() { suite_FixedArrayTest.testRemove(); }
+} testDescription_suite_FixedArrayTest_testRemove;
+
+static class TestDescription_suite_FixedArrayTest_testEraseRemoveOnEnd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedArrayTest_testEraseRemoveOnEnd() : CxxTest::RealTestDescription( Tests_FixedArrayTest, suiteDescription_FixedArrayTest, 96, "testEraseRemoveOnEnd" ) {}
+ void runTest() { suite_FixedArrayTest.testEraseRemoveOnEnd(); }
+} testDescription_suite_FixedArrayTest_testEraseRemoveOnEnd;
+
+static class TestDescription_suite_FixedArrayTest_testConstructors : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedArrayTest_testConstructors() : CxxTest::RealTestDescription( Tests_FixedArrayTest, suiteDescription_FixedArrayTest, 105, "testConstructors" ) {}
+ void runTest() { suite_FixedArrayTest.testConstructors(); }
+} testDescription_suite_FixedArrayTest_testConstructors;
+
+static class TestDescription_suite_FixedArrayTest_testAddition : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedArrayTest_testAddition() : CxxTest::RealTestDescription( Tests_FixedArrayTest, suiteDescription_FixedArrayTest, 139, "testAddition" ) {}
+ void runTest() { suite_FixedArrayTest.testAddition(); }
+} testDescription_suite_FixedArrayTest_testAddition;
+
+static class TestDescription_suite_FixedArrayTest_testComparison : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedArrayTest_testComparison() : CxxTest::RealTestDescription( Tests_FixedArrayTest, suiteDescription_FixedArrayTest, 157, "testComparison" ) {}
+ void runTest() { suite_FixedArrayTest.testComparison(); }
+} testDescription_suite_FixedArrayTest_testComparison;
+
+static class TestDescription_suite_FixedArrayTest_testToString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedArrayTest_testToString() : CxxTest::RealTestDescription( Tests_FixedArrayTest, suiteDescription_FixedArrayTest, 178, "testToString" ) {}
+ void runTest() { suite_FixedArrayTest.testToString(); }
+} testDescription_suite_FixedArrayTest_testToString;
+
@@ -0,0 +1,55 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_FixedNeighborhoodUpdateFunctorTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/fixedneighborhoodupdatefunctortest.h"
+
+static FixedNeighborhoodUpdateFunctorTest suite_FixedNeighborhoodUpdateFunctorTest;
+
+static CxxTest::List Tests_FixedNeighborhoodUpdateFunctorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_FixedNeighborhoodUpdateFunctorTest( "/root/repo/src/libgeodecomp/storage/test/unit/fixedneighborhoodupdatefunctortest.h", 105, "FixedNeighborhoodUpdateFunctorTest", suite_FixedNeighborhoodUpdateFunctorTest, Tests_FixedNeighborhoodUpdateFunctorTest );
+
+static class TestDescription_suite_FixedNeighborhoodUpdateFunctorTest_testTorus : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedNeighborhoodUpdateFunctorTest_testTorus() : CxxTest::RealTestDescription( Tests_FixedNeighborhoodUpdateFunctorTest, suiteDescription_FixedNeighborhoodUpdateFunctorTest, 109, "testTorus" ) {}
+ void runTest() { suite_FixedNeighborhoodUpdateFunctorTest.testTorus(); }
+} testDescription_suite_FixedNeighborhoodUpdateFunctorTest_testTorus;
+
+static class TestDescription_suite_FixedNeighborhoodUpdateFunctorTest_testDegeneratedTorus : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedNeighborhoodUpdateFunctorTest_testDegeneratedTorus() : CxxTest::RealTestDescription( Tests_FixedNeighborhoodUpdateFunctorTest, suiteDescription_FixedNeighborhoodUpdateFunctorTest, 168, "testDegeneratedTorus" ) {}
+ void runTest() { suite_FixedNeighborhoodUpdateFunctorTest.testDegeneratedTorus(); }
+} testDescription_suite_FixedNeighborhoodUpdateFunctorTest_testDegeneratedTorus;
+
+static class TestDescription_suite_FixedNeighborhoodUpdateFunctorTest_testTorusWithOffset : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedNeighborhoodUpdateFunctorTest_testTorusWithOffset() : CxxTest::RealTestDescription( Tests_FixedNeighborhoodUpdateFunctorTest, suiteDescription_FixedNeighborhoodUpdateFunctorTest, 220, "testTorusWithOffset" ) {}
+ void runTest() { suite_FixedNeighborhoodUpdateFunctorTest.testTorusWithOffset(); }
+} testDescription_suite_FixedNeighborhoodUpdateFunctorTest_testTorusWithOffset;
+
+static class TestDescription_suite_FixedNeighborhoodUpdateFunctorTest_testCube : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedNeighborhoodUpdateFunctorTest_testCube() : CxxTest::RealTestDescription( Tests_FixedNeighborhoodUpdateFunctorTest, suiteDescription_FixedNeighborhoodUpdateFunctorTest, 304, "testCube" ) {}
+ void runTest() { suite_FixedNeighborhoodUpdateFunctorTest.testCube(); }
+} testDescription_suite_FixedNeighborhoodUpdateFunctorTest_testCube;
+
@@ -0,0 +1,81 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ImageTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/imagetest.h"
+
+static ImageTest suite_ImageTest;
+
+static CxxTest::List Tests_ImageTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ImageTest( "/root/repo/src/libgeodecomp/storage/test/unit/imagetest.h", 8, "ImageTest", suite_ImageTest, Tests_ImageTest );
+
+static class TestDescription_suite_ImageTest_testWidthAndHeight : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ImageTest_testWidthAndHeight() : CxxTest::RealTestDescription( Tests_ImageTest, suiteDescription_ImageTest, 11, "testWidthAndHeight" ) {}
+ void runTest() { suite_ImageTest.testWidthAndHeight(); }
+} testDescription_suite_ImageTest_testWidthAndHeight;
+
+static class TestDescription_suite_ImageTest_testSlice : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ImageTest_testSlice() : CxxTest::RealTestDescription( Tests_ImageTest, suiteDescription_ImageTest, 19, "testSlice" ) {}
+ void runTest() { suite_ImageTest.testSlice(); }
+} testDescription_suite_ImageTest_testSlice;
+
+static class TestDescription_suite_ImageTest_testPaste : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ImageTest_testPaste() : CxxTest::RealTestDescription( Tests_ImageTest, suiteDescription_ImageTest, 42, "testPaste" ) {}
+ void runTest() { suite_ImageTest.testPaste(); }
+} testDescription_suite_ImageTest_testPaste;
+
+static class TestDescription_suite_ImageTest_testPasteOffScreenLeftUpper : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ImageTest_testPasteOffScreenLeftUpper() : CxxTest::RealTestDescription( Tests_ImageTest, suiteDescription_ImageTest, 53, "testPasteOffScreenLeftUpper" ) {}
+ void runTest() { suite_ImageTest.testPasteOffScreenLeftUpper(); }
+} testDescription_suite_ImageTest_testPasteOffScreenLeftUpper;
+
+static class TestDescription_suite_ImageTest_testPasteOffScreenRightLower : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ImageTest_testPasteOffScreenRightLower() : CxxTest::RealTestDescription( Tests_ImageTest, suiteDescription_ImageTest, 62, "testPasteOffScreenRightLower" ) {}
+ void runTest() { suite_ImageTest.testPasteOffScreenRightLower(); }
+} testDescription_suite_ImageTest_testPasteOffScreenRightLower;
+
+static class TestDescription_suite_ImageTest_testIllegalSliceUpperLeft : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ImageTest_testIllegalSliceUpperLeft() : CxxTest::RealTestDescription( Tests_ImageTest, suiteDescription_ImageTest, 71, "testIllegalSliceUpperLeft" ) {}
+ void runTest() { suite_ImageTest.testIllegalSliceUpperLeft(); }
+} testDescription_suite_ImageTest_testIllegalSliceUpperLeft;
+
+static class TestDescription_suite_ImageTest_testIllegalSliceLowerRight : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ImageTest_testIllegalSliceLowerRight() : CxxTest::RealTestDescription( Tests_ImageTest, suiteDescription_ImageTest, 77, "testIllegalSliceLowerRight" ) {}
+ void runTest() { suite_ImageTest.testIllegalSliceLowerRight(); }
+} testDescription_suite_ImageTest_testIllegalSliceLowerRight;
+
+static class TestDescription_suite_ImageTest_testFillBox : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ImageTest_testFillBox() : CxxTest::RealTestDescription( Tests_ImageTest, suiteDescription_ImageTest, 83, "testFillBox" ) {}
+ void runTest() { suite_ImageTest.testFillBox(); }
+} testDescription_suite_ImageTest_testFillBox;
+
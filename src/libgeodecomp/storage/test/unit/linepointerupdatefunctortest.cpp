@@ -0,0 +1,55 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_LinePointerUpdateFunctorTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/linepointerupdatefunctortest.h"
+
+static LinePointerUpdateFunctorTest suite_LinePointerUpdateFunctorTest;
+
+static CxxTest::List Tests_LinePointerUpdateFunctorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_LinePointerUpdateFunctorTest( "/root/repo/src/libgeodecomp/storage/test/unit/linepointerupdatefunctortest.h", 10, "LinePointerUpdateFunctorTest", suite_LinePointerUpdateFunctorTest, Tests_LinePointerUpdateFunctorTest );
+
+static class TestDescription_suite_LinePointerUpdateFunctorTest_testMoore2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_LinePointerUpdateFunctorTest_testMoore2D() : CxxTest::RealTestDescription( Tests_LinePointerUpdateFunctorTest, suiteDescription_LinePointerUpdateFunctorTest, 42, "testMoore2D" ) {}
+ void runTest() { suite_LinePointerUpdateFunctorTest.testMoore2D(); }
+} testDescription_suite_LinePointerUpdateFunctorTest_testMoore2D;
+
+static class TestDescription_suite_LinePointerUpdateFunctorTest_testMoore3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_LinePointerUpdateFunctorTest_testMoore3D() : CxxTest::RealTestDescription( Tests_LinePointerUpdateFunctorTest, suiteDescription_LinePointerUpdateFunctorTest, 48, "testMoore3D" ) {}
+ void runTest() { suite_LinePointerUpdateFunctorTest.testMoore3D(); }
+} testDescription_suite_LinePointerUpdateFunctorTest_testMoore3D;
+
+static class TestDescription_suite_LinePointerUpdateFunctorTest_testVonNeumann2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_LinePointerUpdateFunctorTest_testVonNeumann2D() : CxxTest::RealTestDescription( Tests_LinePointerUpdateFunctorTest, suiteDescription_LinePointerUpdateFunctorTest, 54, "testVonNeumann2D" ) {}
+ void runTest() { suite_LinePointerUpdateFunctorTest.testVonNeumann2D(); }
+} testDescription_suite_LinePointerUpdateFunctorTest_testVonNeumann2D;
+
+static class TestDescription_suite_LinePointerUpdateFunctorTest_testVonNeumann3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_LinePointerUpdateFunctorTest_testVonNeumann3D() : CxxTest::RealTestDescription( Tests_LinePointerUpdateFunctorTest, suiteDescription_LinePointerUpdateFunctorTest, 60, "testVonNeumann3D" ) {}
+ void runTest() { suite_LinePointerUpdateFunctorTest.testVonNeumann3D(); }
+} testDescription_suite_LinePointerUpdateFunctorTest_testVonNeumann3D;
+
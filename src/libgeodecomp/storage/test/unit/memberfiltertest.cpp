@@ -0,0 +1,56 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_MemberFilterTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/memberfiltertest.h"
+
+static MemberFilterTest suite_MemberFilterTest;
+
+static CxxTest::List Tests_MemberFilterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MemberFilterTest( "/root/repo/src/libgeodecomp/storage/test/unit/memberfiltertest.h", 64, "MemberFilterTest", suite_MemberFilterTest, Tests_MemberFilterTest );
+
+static class TestDescription_suite_MemberFilterTest_testBasics : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemberFilterTest_testBasics() : CxxTest::RealTestDescription( Tests_MemberFilterTest, suiteDescription_MemberFilterTest, 67, "testBasics" ) {}
+ void runTest() { suite_MemberFilterTest.testBasics(); }
+} testDescription_suite_MemberFilterTest_testBasics;
+
+static class TestDescription_suite_MemberFilterTest_testHostAoS : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemberFilterTest_testHostAoS() : CxxTest::RealTestDescription( Tests_MemberFilterTest, suiteDescription_MemberFilterTest, 85, "testHostAoS" ) {}
+ void runTest() { suite_MemberFilterTest.testHostAoS(); }
+} testDescription_suite_MemberFilterTest_testHostAoS;
+
+static class TestDescription_suite_MemberFilterTest_testNesting : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemberFilterTest_testNesting() : CxxTest::RealTestDescription( Tests_MemberFilterTest, suiteDescription_MemberFilterTest, 132, "testNesting" ) {}
+ void runTest() { suite_MemberFilterTest.testNesting(); }
+} testDescription_suite_MemberFilterTest_testNesting;
+
+static class TestDescription_suite_MemberFilterTest_testHostSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MemberFilterTest_testHostSoA() : CxxTest::RealTestDescription( Tests_MemberFilterTest, suiteDescription_MemberFilterTest, 181, "testHostSoA" ) {}
+ void runTest() { suite_MemberFilterTest.testHostSoA(); }
+} testDescription_suite_MemberFilterTest_testHostSoA;
+
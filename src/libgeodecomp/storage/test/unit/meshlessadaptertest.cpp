@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_MeshlessAdapterTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/meshlessadaptertest.h"
+
+static MeshlessAdapterTest suite_MeshlessAdapterTest;
+
+static CxxTest::List Tests_MeshlessAdapterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MeshlessAdapterTest( "/root/repo/src/libgeodecomp/storage/test/unit/meshlessadaptertest.h", 9, "MeshlessAdapterTest", suite_MeshlessAdapterTest, Tests_MeshlessAdapterTest );
+
+static class TestDescription_suite_MeshlessAdapterTest_test1d : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MeshlessAdapterTest_test1d() : CxxTest::RealTestDescription( Tests_MeshlessAdapterTest, suiteDescription_MeshlessAdapterTest, 13, "test1d" ) {}
+ void runTest() { suite_MeshlessAdapterTest.test1d(); }
+} testDescription_suite_MeshlessAdapterTest_test1d;
+
+static class TestDescription_suite_MeshlessAdapterTest_test1dCube : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MeshlessAdapterTest_test1dCube() : CxxTest::RealTestDescription( Tests_MeshlessAdapterTest, suiteDescription_MeshlessAdapterTest, 80, "test1dCube" ) {}
+ void runTest() { suite_MeshlessAdapterTest.test1dCube(); }
+} testDescription_suite_MeshlessAdapterTest_test1dCube;
+
+static class TestDescription_suite_MeshlessAdapterTest_testBoxSizeDetermination : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MeshlessAdapterTest_testBoxSizeDetermination() : CxxTest::RealTestDescription( Tests_MeshlessAdapterTest, suiteDescription_MeshlessAdapterTest, 114, "testBoxSizeDetermination" ) {}
+ void runTest() { suite_MeshlessAdapterTest.testBoxSizeDetermination(); }
+} testDescription_suite_MeshlessAdapterTest_testBoxSizeDetermination;
+
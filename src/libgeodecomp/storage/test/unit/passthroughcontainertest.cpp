@@ -0,0 +1,37 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_PassThroughContainerTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/passthroughcontainertest.h"
+
+static PassThroughContainerTest suite_PassThroughContainerTest;
+
+static CxxTest::List Tests_PassThroughContainerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PassThroughContainerTest( "/root/repo/src/libgeodecomp/storage/test/unit/passthroughcontainertest.h", 74, "PassThroughContainerTest", suite_PassThroughContainerTest, Tests_PassThroughContainerTest );
+
+static class TestDescription_suite_PassThroughContainerTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PassThroughContainerTest_testBasic() : CxxTest::RealTestDescription( Tests_PassThroughContainerTest, suiteDescription_PassThroughContainerTest, 77, "testBasic" ) {}
+ void runTest() { suite_PassThroughContainerTest.testBasic(); }
+} testDescription_suite_PassThroughContainerTest_testBasic;
+
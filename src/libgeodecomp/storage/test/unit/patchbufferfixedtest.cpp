@@ -0,0 +1,39 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_PatchBufferFixedTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/patchbufferfixedtest.h"
+
+static PatchBufferFixedTest suite_PatchBufferFixedTest;
+
+static CxxTest::List Tests_PatchBufferFixedTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PatchBufferFixedTest( "/root/repo/src/libgeodecomp/storage/test/unit/patchbufferfixedtest.h", 11, "PatchBufferFixedTest", suite_PatchBufferFixedTest, Tests_PatchBufferFixedTest );
+
+static class TestDescription_suite_PatchBufferFixedTest_testCopyInCopyOut : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PatchBufferFixedTest_testCopyInCopyOut() : CxxTest::RealTestDescription( Tests_PatchBufferFixedTest, suiteDescription_PatchBufferFixedTest, 58, "testCopyInCopyOut" ) {}
+ void runTest() { suite_PatchBufferFixedTest.testCopyInCopyOut(); }
+} testDescription_suite_PatchBufferFixedTest_testCopyInCopyOut;
+
@@ -0,0 +1,44 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_PatchBufferTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/patchbuffertest.h"
+
+static PatchBufferTest suite_PatchBufferTest;
+
+static CxxTest::List Tests_PatchBufferTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PatchBufferTest( "/root/repo/src/libgeodecomp/storage/test/unit/patchbuffertest.h", 11, "PatchBufferTest", suite_PatchBufferTest, Tests_PatchBufferTest );
+
+static class TestDescription_suite_PatchBufferTest_testCopyInCopyOut : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PatchBufferTest_testCopyInCopyOut() : CxxTest::RealTestDescription( Tests_PatchBufferTest, suiteDescription_PatchBufferTest, 55, "testCopyInCopyOut" ) {}
+ void runTest() { suite_PatchBufferTest.testCopyInCopyOut(); }
+} testDescription_suite_PatchBufferTest_testCopyInCopyOut;
+
+static class TestDescription_suite_PatchBufferTest_testRecycling : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PatchBufferTest_testRecycling() : CxxTest::RealTestDescription( Tests_PatchBufferTest, suiteDescription_PatchBufferTest, 108, "testRecycling" ) {}
+ void runTest() { suite_PatchBufferTest.testRecycling(); }
+} testDescription_suite_PatchBufferTest_testRecycling;
+
@@ -105,6 +105,37 @@ public:
         TS_ASSERT_EQUALS(testGrid2, compGrid);
     }
 
+    void testRecycling()
+    {
+        PatchBufferType patchBuffer(region1, 2);
+        TS_ASSERT_EQUALS(std::size_t(2), patchBuffer.allocations());
+
+        for (int i = 0; i < 9; ++i) {
+            patchBuffer.pushRequest(i);
+            patchBuffer.put(baseGrid, validRegion, dimensions.dimensions, i, 0);
+            compGrid = zeroGrid;
+            patchBuffer.get(&compGrid, validRegion, dimensions.dimensions, i, 0);
+            TS_ASSERT_EQUALS(testGrid1, compGrid);
+        }
+        TS_ASSERT_EQUALS(std::size_t(2), patchBuffer.allocations());
+
+        // exceeding the depth makes the ring grow while retaining
+        // the order of the stored fragments:
+        for (int i = 9; i < 14; ++i) {
+            patchBuffer.pushRequest(i);
+            baseGrid[Coord<2>(2, 2)] = i;
+            patchBuffer.put(baseGrid, validRegion, dimensions.dimensions, i, 0);
+        }
+        TS_ASSERT_EQUALS(std::size_t(5), patchBuffer.allocations());
+
+        for (int i = 9; i < 14; ++i) {
+            compGrid = zeroGrid;
+            patchBuffer.get(&compGrid, validRegion, dimensions.dimensions, i, 0);
+            TS_ASSERT_EQUALS(i, compGrid[Coord<2>(2, 2)]);
+        }
+        TS_ASSERT_EQUALS(PatchAccepter<GridType>::infinity(), patchBuffer.nextAvailableNanoStep());
+    }
+
 private:
     CoordBox<2> dimensions;
     GridType baseGrid;
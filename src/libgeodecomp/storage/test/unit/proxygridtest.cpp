@@ -0,0 +1,56 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ProxyGridTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/proxygridtest.h"
+
+static ProxyGridTest suite_ProxyGridTest;
+
+static CxxTest::List Tests_ProxyGridTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ProxyGridTest( "/root/repo/src/libgeodecomp/storage/test/unit/proxygridtest.h", 44, "ProxyGridTest", suite_ProxyGridTest, Tests_ProxyGridTest );
+
+static class TestDescription_suite_ProxyGridTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ProxyGridTest_testBasic() : CxxTest::RealTestDescription( Tests_ProxyGridTest, suiteDescription_ProxyGridTest, 47, "testBasic" ) {}
+ void runTest() { suite_ProxyGridTest.testBasic(); }
+} testDescription_suite_ProxyGridTest_testBasic;
+
+static class TestDescription_suite_ProxyGridTest_testSelector : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ProxyGridTest_testSelector() : CxxTest::RealTestDescription( Tests_ProxyGridTest, suiteDescription_ProxyGridTest, 104, "testSelector" ) {}
+ void runTest() { suite_ProxyGridTest.testSelector(); }
+} testDescription_suite_ProxyGridTest_testSelector;
+
+static class TestDescription_suite_ProxyGridTest_testLoadSaveRegion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ProxyGridTest_testLoadSaveRegion() : CxxTest::RealTestDescription( Tests_ProxyGridTest, suiteDescription_ProxyGridTest, 163, "testLoadSaveRegion" ) {}
+ void runTest() { suite_ProxyGridTest.testLoadSaveRegion(); }
+} testDescription_suite_ProxyGridTest_testLoadSaveRegion;
+
+static class TestDescription_suite_ProxyGridTest_testLoadSaveRegionWithBoostSerialization : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ProxyGridTest_testLoadSaveRegionWithBoostSerialization() : CxxTest::RealTestDescription( Tests_ProxyGridTest, suiteDescription_ProxyGridTest, 215, "testLoadSaveRegionWithBoostSerialization" ) {}
+ void runTest() { suite_ProxyGridTest.testLoadSaveRegionWithBoostSerialization(); }
+} testDescription_suite_ProxyGridTest_testLoadSaveRegionWithBoostSerialization;
+
@@ -0,0 +1,68 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_RegionGridTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/regiongridtest.h"
+
+static RegionGridTest suite_RegionGridTest;
+
+static CxxTest::List Tests_RegionGridTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RegionGridTest( "/root/repo/src/libgeodecomp/storage/test/unit/regiongridtest.h", 10, "RegionGridTest", suite_RegionGridTest, Tests_RegionGridTest );
+
+static class TestDescription_suite_RegionGridTest_testStoresOnlyRegion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionGridTest_testStoresOnlyRegion() : CxxTest::RealTestDescription( Tests_RegionGridTest, suiteDescription_RegionGridTest, 29, "testStoresOnlyRegion" ) {}
+ void runTest() { suite_RegionGridTest.testStoresOnlyRegion(); }
+} testDescription_suite_RegionGridTest_testStoresOnlyRegion;
+
+static class TestDescription_suite_RegionGridTest_testRandomAccess : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionGridTest_testRandomAccess() : CxxTest::RealTestDescription( Tests_RegionGridTest, suiteDescription_RegionGridTest, 41, "testRandomAccess" ) {}
+ void runTest() { suite_RegionGridTest.testRandomAccess(); }
+} testDescription_suite_RegionGridTest_testRandomAccess;
+
+static class TestDescription_suite_RegionGridTest_testStreakAccess : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionGridTest_testStreakAccess() : CxxTest::RealTestDescription( Tests_RegionGridTest, suiteDescription_RegionGridTest, 65, "testStreakAccess" ) {}
+ void runTest() { suite_RegionGridTest.testStreakAccess(); }
+} testDescription_suite_RegionGridTest_testStreakAccess;
+
+static class TestDescription_suite_RegionGridTest_testSaveLoadRegion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionGridTest_testSaveLoadRegion() : CxxTest::RealTestDescription( Tests_RegionGridTest, suiteDescription_RegionGridTest, 88, "testSaveLoadRegion" ) {}
+ void runTest() { suite_RegionGridTest.testSaveLoadRegion(); }
+} testDescription_suite_RegionGridTest_testSaveLoadRegion;
+
+static class TestDescription_suite_RegionGridTest_testPeriodicBoundaries : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionGridTest_testPeriodicBoundaries() : CxxTest::RealTestDescription( Tests_RegionGridTest, suiteDescription_RegionGridTest, 109, "testPeriodicBoundaries" ) {}
+ void runTest() { suite_RegionGridTest.testPeriodicBoundaries(); }
+} testDescription_suite_RegionGridTest_testPeriodicBoundaries;
+
+static class TestDescription_suite_RegionGridTest_testGridTypeSelector : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionGridTest_testGridTypeSelector() : CxxTest::RealTestDescription( Tests_RegionGridTest, suiteDescription_RegionGridTest, 127, "testGridTypeSelector" ) {}
+ void runTest() { suite_RegionGridTest.testGridTypeSelector(); }
+} testDescription_suite_RegionGridTest_testGridTypeSelector;
+
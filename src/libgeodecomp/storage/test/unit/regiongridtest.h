@@ -0,0 +1,150 @@
+#include <cxxtest/TestSuite.h>
+#include <libgeodecomp/misc/testcell.h>
+#include <libgeodecomp/storage/gridtypeselector.h>
+#include <libgeodecomp/storage/regiongrid.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class RegionGridTest : public CxxTest::TestSuite
+{
+public:
+    typedef RegionGrid<int> GridType;
+
+    void setUp()
+    {
+        // an L-shaped region which fills less than half of its
+        // bounding box:
+        region.clear();
+        region << Streak<2>(Coord<2>(10, 20), 40);
+        region << Streak<2>(Coord<2>(10, 21), 40);
+        for (int y = 22; y < 60; ++y) {
+            region << Streak<2>(Coord<2>(10, y), 14);
+        }
+        // a second streak within one row:
+        region << Streak<2>(Coord<2>(30, 59), 35);
+    }
+
+    void testStoresOnlyRegion()
+    {
+        GridType grid(region, 1, -1);
+
+        TS_ASSERT_EQUALS(region.size(), grid.size());
+        TS_ASSERT_EQUALS(CoordBox<2>(Coord<2>(10, 20), Coord<2>(30, 40)), grid.boundingBox());
+        TS_ASSERT_EQUALS(region, grid.boundingRegion());
+        TS_ASSERT_EQUALS(std::size_t(2 * 30 + 38 * 4 + 5), grid.size());
+        TS_ASSERT_EQUALS(std::size_t(41), grid.planeOffsets.size());
+        TS_ASSERT_EQUALS(region.numStreaks(), grid.streaks.size());
+    }
+
+    void testRandomAccess()
+    {
+        GridType grid(region, 1, -1);
+        for (Region<2>::Iterator i = region.begin(); i != region.end(); ++i) {
+            TS_ASSERT_EQUALS(1, grid[*i]);
+            grid[*i] = i->x() * 100 + i->y();
+        }
+
+        CoordBox<2> box = grid.boundingBox();
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            int expected = region.count(*i) ? (i->x() * 100 + i->y()) : -1;
+            TS_ASSERT_EQUALS(expected, grid.get(*i));
+        }
+
+        // writes to coordinates outside of the region are discarded:
+        grid.set(Coord<2>(30, 30), 4711);
+        TS_ASSERT_EQUALS(-1, grid.get(Coord<2>(30, 30)));
+        grid.set(Coord<2>(12, 25), 4711);
+        TS_ASSERT_EQUALS(4711, grid.get(Coord<2>(12, 25)));
+
+        TS_ASSERT_EQUALS(-1, grid[Coord<2>(-1, -1)]);
+        TS_ASSERT_EQUALS(-1, grid[Coord<2>(1000, 59)]);
+    }
+
+    void testStreakAccess()
+    {
+        GridType grid(region, 0, -1);
+        Streak<2> streak(Coord<2>(12, 59), 33);
+
+        std::vector<int> cells(streak.length());
+        for (int i = 0; i < streak.length(); ++i) {
+            cells[i] = i + 1;
+        }
+        grid.set(streak, &cells[0]);
+
+        std::vector<int> buffer(streak.length());
+        grid.get(streak, &buffer[0]);
+        for (int x = streak.origin.x(); x < streak.endX; ++x) {
+            int expected = ((x < 14) || (x >= 30)) ? (x - 11) : -1;
+            TS_ASSERT_EQUALS(expected, buffer[x - 12]);
+        }
+
+        TS_ASSERT_EQUALS(&grid[Coord<2>(31, 59)], grid.streakAddress(Streak<2>(Coord<2>(31, 59), 35)));
+        TS_ASSERT_EQUALS(static_cast<const int*>(0), grid.streakAddress(Streak<2>(Coord<2>(12, 59), 35)));
+        TS_ASSERT_EQUALS(static_cast<const int*>(0), grid.streakAddress(Streak<2>(Coord<2>(31, 59), 36)));
+    }
+
+    void testSaveLoadRegion()
+    {
+        GridType source(region, 0, -1);
+        GridType target(region, 0, -1);
+        for (Region<2>::Iterator i = region.begin(); i != region.end(); ++i) {
+            source[*i] = i->x() * 100 + i->y();
+        }
+
+        Region<2> transferRegion;
+        transferRegion << Streak<2>(Coord<2>(15, 21), 45);
+        transferRegion << Streak<2>(Coord<2>(11, 40), 13);
+        std::vector<int> buffer(transferRegion.size());
+        source.saveRegion(&buffer, transferRegion);
+        target.loadRegion(buffer, transferRegion);
+
+        for (Region<2>::Iterator i = region.begin(); i != region.end(); ++i) {
+            int expected = transferRegion.count(*i) ? (i->x() * 100 + i->y()) : 0;
+            TS_ASSERT_EQUALS(expected, target[*i]);
+        }
+    }
+
+    void testPeriodicBoundaries()
+    {
+        Coord<2> dim(20, 10);
+        Region<2> torusRegion;
+        torusRegion << Streak<2>(Coord<2>( 0, 0),  3);
+        torusRegion << Streak<2>(Coord<2>(17, 0), 20);
+        torusRegion << Streak<2>(Coord<2>( 0, 9),  3);
+
+        RegionGrid<int, Topologies::Torus<2>::Topology> grid(torusRegion, 0, -1, dim);
+        grid[Coord<2>(19, 0)] = 1;
+        grid[Coord<2>( 1, 9)] = 2;
+
+        TS_ASSERT_EQUALS(1, grid[Coord<2>(-1,  0)]);
+        TS_ASSERT_EQUALS(2, grid[Coord<2>( 1, -1)]);
+        TS_ASSERT_EQUALS(2, grid[Coord<2>(21, -1)]);
+        TS_ASSERT_EQUALS(-1, grid[Coord<2>(5, 0)]);
+    }
+
+    void testGridTypeSelector()
+    {
+        typedef TestCell<2, Stencils::Moore<2, 1>, Topologies::Cube<2>::Topology, APITraits::HasRegionGrid> CellType;
+        typedef GridTypeSelector<CellType, Topologies::Cube<2>::Topology, true, APITraits::FalseType>::Value SelectedGridType;
+        typedef RegionGrid<CellType, Topologies::Cube<2>::Topology> ExpectedGridType;
+
+        SelectedGridType *grid = static_cast<ExpectedGridType*>(0);
+        TS_ASSERT_EQUALS(static_cast<SelectedGridType*>(0), grid);
+
+        // RegionGrid can't wrap without topological dimensions:
+        typedef GridTypeSelector<CellType, Topologies::Cube<2>::Topology, false, APITraits::FalseType>::Value IncorrectGridType;
+        IncorrectGridType *incorrectGrid = static_cast<DisplacedGrid<CellType, Topologies::Cube<2>::Topology, false>*>(0);
+        TS_ASSERT_EQUALS(static_cast<IncorrectGridType*>(0), incorrectGrid);
+
+        typedef GridTypeSelector<TestCell<2>, Topologies::Cube<2>::Topology, true, APITraits::FalseType>::Value DefaultGridType;
+        DefaultGridType *defaultGrid = static_cast<DisplacedGrid<TestCell<2>, Topologies::Cube<2>::Topology, true>*>(0);
+        TS_ASSERT_EQUALS(static_cast<DefaultGridType*>(0), defaultGrid);
+    }
+
+private:
+    Region<2> region;
+};
+
+}
@@ -0,0 +1,117 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ReorderingUnstructuredGridTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/reorderingunstructuredgridtest.h"
+
+static ReorderingUnstructuredGridTest suite_ReorderingUnstructuredGridTest;
+
+static CxxTest::List Tests_ReorderingUnstructuredGridTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ReorderingUnstructuredGridTest( "/root/repo/src/libgeodecomp/storage/test/unit/reorderingunstructuredgridtest.h", 66, "ReorderingUnstructuredGridTest", suite_ReorderingUnstructuredGridTest, Tests_ReorderingUnstructuredGridTest );
+
+static class TestDescription_suite_ReorderingUnstructuredGridTest_testResize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ReorderingUnstructuredGridTest_testResize() : CxxTest::RealTestDescription( Tests_ReorderingUnstructuredGridTest, suiteDescription_ReorderingUnstructuredGridTest, 71, "testResize" ) {}
+ void runTest() { suite_ReorderingUnstructuredGridTest.testResize(); }
+} testDescription_suite_ReorderingUnstructuredGridTest_testResize;
+
+static class TestDescription_suite_ReorderingUnstructuredGridTest_testGetSetAoS : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ReorderingUnstructuredGridTest_testGetSetAoS() : CxxTest::RealTestDescription( Tests_ReorderingUnstructuredGridTest, suiteDescription_ReorderingUnstructuredGridTest, 97, "testGetSetAoS" ) {}
+ void runTest() { suite_ReorderingUnstructuredGridTest.testGetSetAoS(); }
+} testDescription_suite_ReorderingUnstructuredGridTest_testGetSetAoS;
+
+static class TestDescription_suite_ReorderingUnstructuredGridTest_testGetSetSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ReorderingUnstructuredGridTest_testGetSetSoA() : CxxTest::RealTestDescription( Tests_ReorderingUnstructuredGridTest, suiteDescription_ReorderingUnstructuredGridTest, 127, "testGetSetSoA" ) {}
+ void runTest() { suite_ReorderingUnstructuredGridTest.testGetSetSoA(); }
+} testDescription_suite_ReorderingUnstructuredGridTest_testGetSetSoA;
+
+static class TestDescription_suite_ReorderingUnstructuredGridTest_testGetSetStreaksAoS : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ReorderingUnstructuredGridTest_testGetSetStreaksAoS() : CxxTest::RealTestDescription( Tests_ReorderingUnstructuredGridTest, suiteDescription_ReorderingUnstructuredGridTest, 155, "testGetSetStreaksAoS" ) {}
+ void runTest() { suite_ReorderingUnstructuredGridTest.testGetSetStreaksAoS(); }
+} testDescription_suite_ReorderingUnstructuredGridTest_testGetSetStreaksAoS;
+
+static class TestDescription_suite_ReorderingUnstructuredGridTest_testGetSetStreaksSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ReorderingUnstructuredGridTest_testGetSetStreaksSoA() : CxxTest::RealTestDescription( Tests_ReorderingUnstructuredGridTest, suiteDescription_ReorderingUnstructuredGridTest, 191, "testGetSetStreaksSoA" ) {}
+ void runTest() { suite_ReorderingUnstructuredGridTest.testGetSetStreaksSoA(); }
+} testDescription_suite_ReorderingUnstructuredGridTest_testGetSetStreaksSoA;
+
+static class TestDescription_suite_ReorderingUnstructuredGridTest_testEdgeCellHandlingAoS : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ReorderingUnstructuredGridTest_testEdgeCellHandlingAoS() : CxxTest::RealTestDescription( Tests_ReorderingUnstructuredGridTest, suiteDescription_ReorderingUnstructuredGridTest, 227, "testEdgeCellHandlingAoS" ) {}
+ void runTest() { suite_ReorderingUnstructuredGridTest.testEdgeCellHandlingAoS(); }
+} testDescription_suite_ReorderingUnstructuredGridTest_testEdgeCellHandlingAoS;
+
+static class TestDescription_suite_ReorderingUnstructuredGridTest_testEdgeCellHandlingSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ReorderingUnstructuredGridTest_testEdgeCellHandlingSoA() : CxxTest::RealTestDescription( Tests_ReorderingUnstructuredGridTest, suiteDescription_ReorderingUnstructuredGridTest, 249, "testEdgeCellHandlingSoA" ) {}
+ void runTest() { suite_ReorderingUnstructuredGridTest.testEdgeCellHandlingSoA(); }
+} testDescription_suite_ReorderingUnstructuredGridTest_testEdgeCellHandlingSoA;
+
+static class TestDescription_suite_ReorderingUnstructuredGridTest_testLoadSaveRegionAoS : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ReorderingUnstructuredGridTest_testLoadSaveRegionAoS() : CxxTest::RealTestDescription( Tests_ReorderingUnstructuredGridTest, suiteDescription_ReorderingUnstructuredGridTest, 270, "testLoadSaveRegionAoS" ) {}
+ void runTest() { suite_ReorderingUnstructuredGridTest.testLoadSaveRegionAoS(); }
+} testDescription_suite_ReorderingUnstructuredGridTest_testLoadSaveRegionAoS;
+
+static class TestDescription_suite_ReorderingUnstructuredGridTest_testLoadSaveRegionSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ReorderingUnstructuredGridTest_testLoadSaveRegionSoA() : CxxTest::RealTestDescription( Tests_ReorderingUnstructuredGridTest, suiteDescription_ReorderingUnstructuredGridTest, 325, "testLoadSaveRegionSoA" ) {}
+ void runTest() { suite_ReorderingUnstructuredGridTest.testLoadSaveRegionSoA(); }
+} testDescription_suite_ReorderingUnstructuredGridTest_testLoadSaveRegionSoA;
+
+static class TestDescription_suite_ReorderingUnstructuredGridTest_testLoadSaveMemberAoS : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ReorderingUnstructuredGridTest_testLoadSaveMemberAoS() : CxxTest::RealTestDescription( Tests_ReorderingUnstructuredGridTest, suiteDescription_ReorderingUnstructuredGridTest, 380, "testLoadSaveMemberAoS" ) {}
+ void runTest() { suite_ReorderingUnstructuredGridTest.testLoadSaveMemberAoS(); }
+} testDescription_suite_ReorderingUnstructuredGridTest_testLoadSaveMemberAoS;
+
+static class TestDescription_suite_ReorderingUnstructuredGridTest_testLoadSaveMemberSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ReorderingUnstructuredGridTest_testLoadSaveMemberSoA() : CxxTest::RealTestDescription( Tests_ReorderingUnstructuredGridTest, suiteDescription_ReorderingUnstructuredGridTest, 433, "testLoadSaveMemberSoA" ) {}
+ void runTest() { suite_ReorderingUnstructuredGridTest.testLoadSaveMemberSoA(); }
+} testDescription_suite_ReorderingUnstructuredGridTest_testLoadSaveMemberSoA;
+
+static class TestDescription_suite_ReorderingUnstructuredGridTest_testSetWeightsAoS : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ReorderingUnstructuredGridTest_testSetWeightsAoS() : CxxTest::RealTestDescription( Tests_ReorderingUnstructuredGridTest, suiteDescription_ReorderingUnstructuredGridTest, 486, "testSetWeightsAoS" ) {}
+ void runTest() { suite_ReorderingUnstructuredGridTest.testSetWeightsAoS(); }
+} testDescription_suite_ReorderingUnstructuredGridTest_testSetWeightsAoS;
+
+static class TestDescription_suite_ReorderingUnstructuredGridTest_testSetWeightsSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ReorderingUnstructuredGridTest_testSetWeightsSoA() : CxxTest::RealTestDescription( Tests_ReorderingUnstructuredGridTest, suiteDescription_ReorderingUnstructuredGridTest, 666, "testSetWeightsSoA" ) {}
+ void runTest() { suite_ReorderingUnstructuredGridTest.testSetWeightsSoA(); }
+} testDescription_suite_ReorderingUnstructuredGridTest_testSetWeightsSoA;
+
+static class TestDescription_suite_ReorderingUnstructuredGridTest_testLoadSaveRegionWithBoostSerialization : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ReorderingUnstructuredGridTest_testLoadSaveRegionWithBoostSerialization() : CxxTest::RealTestDescription( Tests_ReorderingUnstructuredGridTest, suiteDescription_ReorderingUnstructuredGridTest, 846, "testLoadSaveRegionWithBoostSerialization" ) {}
+ void runTest() { suite_ReorderingUnstructuredGridTest.testLoadSaveRegionWithBoostSerialization(); }
+} testDescription_suite_ReorderingUnstructuredGridTest_testLoadSaveRegionWithBoostSerialization;
+
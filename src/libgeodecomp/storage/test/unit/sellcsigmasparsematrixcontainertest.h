@@ -881,6 +881,96 @@ public:
         TS_ASSERT(col[11] == 0);
         TS_ASSERT(col[12] == 2);
         TS_ASSERT(col[13] == 0);
+#endif
+    }
+
+    void testInitFromCSR()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        const int dim = 37;
+        std::vector<int> rowOffsets(1, 0);
+        std::vector<int> columns;
+        std::vector<double> values;
+        DMatrix matrix;
+
+        for (int row = 0; row < dim; ++row) {
+            int length = (row * 7) % 5;
+            for (int i = 0; i < length; ++i) {
+                columns << i * 9 + row % 3;
+                values << row + i * 0.5;
+                matrix << std::make_pair(Coord<2>(row, columns.back()), values.back());
+            }
+            rowOffsets << int(columns.size());
+        }
+        // initFromMatrix() must not depend on the order of entries:
+        std::reverse(matrix.begin(), matrix.end());
+
+        SellCSigmaSparseMatrixContainer<double, 1, 1> reference(dim);
+        reference.initFromMatrix(matrix);
+        SellCSigmaSparseMatrixContainer<double, 4, 8> fromMatrix(dim);
+        fromMatrix.initFromMatrix(matrix);
+        SellCSigmaSparseMatrixContainer<double, 4, 8> fromCSR(dim);
+        fromCSR.initFromCSR(rowOffsets.data(), columns.data(), values.data());
+
+        TS_ASSERT(fromMatrix == fromCSR);
+        TS_ASSERT_EQUALS(fromMatrix.rowLengthVec(),       fromCSR.rowLengthVec());
+        TS_ASSERT_EQUALS(fromMatrix.chunkOffsetVec(),     fromCSR.chunkOffsetVec());
+        TS_ASSERT_EQUALS(fromMatrix.realRowToSortedVec(), fromCSR.realRowToSortedVec());
+        TS_ASSERT_EQUALS(fromMatrix.chunkRowToRealVec(),  fromCSR.chunkRowToRealVec());
+
+        for (int row = 0; row < dim; ++row) {
+            int sortedRow = fromCSR.realRowToSortedVec()[row].second;
+            TS_ASSERT_EQUALS(row, fromCSR.realRowToSortedVec()[row].first);
+            TS_ASSERT_EQUALS(row, fromCSR.chunkRowToRealVec()[sortedRow]);
+            TS_ASSERT_EQUALS(rowOffsets[row + 1] - rowOffsets[row], fromCSR.rowLengthVec()[sortedRow]);
+            // getRow() expects indices of sorted rows:
+            TS_ASSERT_EQUALS(reference.getRow(row), fromCSR.getRow(sortedRow));
+        }
+#endif
+    }
+
+    void testBuilder()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        typedef SellCSigmaSparseMatrixContainer<int, 2, 4> Container;
+        const int dim = 10;
+        std::vector<int> rowLengths;
+        IMatrix matrix;
+
+        for (int row = 0; row < dim; ++row) {
+            rowLengths << (row % 4);
+            for (int i = 0; i < rowLengths.back(); ++i) {
+                matrix << std::make_pair(Coord<2>(row, row + i), 100 * row + i);
+            }
+        }
+
+        Container expected(dim);
+        expected.initFromMatrix(matrix);
+
+        // rows may be streamed in in arbitrary order:
+        Container actual(dim);
+        Container::Builder builder(&actual, rowLengths);
+        for (int row = dim - 1; row >= 0; --row) {
+            std::vector<int> columns;
+            std::vector<int> values;
+            for (int i = 0; i < rowLengths[row]; ++i) {
+                columns << row + i;
+                values << 100 * row + i;
+            }
+            builder.setRow(row, columns.data(), values.data());
+        }
+
+        TS_ASSERT(expected == actual);
+        TS_ASSERT_EQUALS(expected.chunkOffsetVec(), actual.chunkOffsetVec());
+        for (int row = 0; row < dim; ++row) {
+            TS_ASSERT_EQUALS(expected.getRow(row), actual.getRow(row));
+        }
+
+        TS_ASSERT_THROWS(Container::Builder(&actual, std::vector<int>(dim + 1)), std::invalid_argument&);
+
+        IMatrix invalid;
+        invalid << std::make_pair(Coord<2>(dim, 0), 1);
+        TS_ASSERT_THROWS(actual.initFromMatrix(invalid), std::invalid_argument&);
 #endif
     }
 };
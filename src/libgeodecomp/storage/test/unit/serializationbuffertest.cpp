@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_SerializationBufferTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/serializationbuffertest.h"
+
+static SerializationBufferTest suite_SerializationBufferTest;
+
+static CxxTest::List Tests_SerializationBufferTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SerializationBufferTest( "/root/repo/src/libgeodecomp/storage/test/unit/serializationbuffertest.h", 11, "SerializationBufferTest", suite_SerializationBufferTest, Tests_SerializationBufferTest );
+
+static class TestDescription_suite_SerializationBufferTest_testTestCell2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SerializationBufferTest_testTestCell2D() : CxxTest::RealTestDescription( Tests_SerializationBufferTest, suiteDescription_SerializationBufferTest, 14, "testTestCell2D" ) {}
+ void runTest() { suite_SerializationBufferTest.testTestCell2D(); }
+} testDescription_suite_SerializationBufferTest_testTestCell2D;
+
+static class TestDescription_suite_SerializationBufferTest_testTestCell3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SerializationBufferTest_testTestCell3D() : CxxTest::RealTestDescription( Tests_SerializationBufferTest, suiteDescription_SerializationBufferTest, 35, "testTestCell3D" ) {}
+ void runTest() { suite_SerializationBufferTest.testTestCell3D(); }
+} testDescription_suite_SerializationBufferTest_testTestCell3D;
+
+static class TestDescription_suite_SerializationBufferTest_testTestCellSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SerializationBufferTest_testTestCellSoA() : CxxTest::RealTestDescription( Tests_SerializationBufferTest, suiteDescription_SerializationBufferTest, 57, "testTestCellSoA" ) {}
+ void runTest() { suite_SerializationBufferTest.testTestCellSoA(); }
+} testDescription_suite_SerializationBufferTest_testTestCellSoA;
+
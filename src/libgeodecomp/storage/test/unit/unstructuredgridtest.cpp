@@ -0,0 +1,98 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_UnstructuredGridTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/unstructuredgridtest.h"
+
+static UnstructuredGridTest suite_UnstructuredGridTest;
+
+static CxxTest::List Tests_UnstructuredGridTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_UnstructuredGridTest( "/root/repo/src/libgeodecomp/storage/test/unit/unstructuredgridtest.h", 62, "UnstructuredGridTest", suite_UnstructuredGridTest, Tests_UnstructuredGridTest );
+
+static class TestDescription_suite_UnstructuredGridTest_testDefaultConstructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridTest_testDefaultConstructor() : CxxTest::RealTestDescription( Tests_UnstructuredGridTest, suiteDescription_UnstructuredGridTest, 87, "testDefaultConstructor" ) {}
+ void runTest() { suite_UnstructuredGridTest.testDefaultConstructor(); }
+} testDescription_suite_UnstructuredGridTest_testDefaultConstructor;
+
+static class TestDescription_suite_UnstructuredGridTest_testConstructorDefaultInit : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridTest_testConstructorDefaultInit() : CxxTest::RealTestDescription( Tests_UnstructuredGridTest, suiteDescription_UnstructuredGridTest, 95, "testConstructorDefaultInit" ) {}
+ void runTest() { suite_UnstructuredGridTest.testConstructorDefaultInit(); }
+} testDescription_suite_UnstructuredGridTest_testConstructorDefaultInit;
+
+static class TestDescription_suite_UnstructuredGridTest_testOperatorEqual1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridTest_testOperatorEqual1() : CxxTest::RealTestDescription( Tests_UnstructuredGridTest, suiteDescription_UnstructuredGridTest, 105, "testOperatorEqual1" ) {}
+ void runTest() { suite_UnstructuredGridTest.testOperatorEqual1(); }
+} testDescription_suite_UnstructuredGridTest_testOperatorEqual1;
+
+static class TestDescription_suite_UnstructuredGridTest_testAssimentOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridTest_testAssimentOperator() : CxxTest::RealTestDescription( Tests_UnstructuredGridTest, suiteDescription_UnstructuredGridTest, 123, "testAssimentOperator" ) {}
+ void runTest() { suite_UnstructuredGridTest.testAssimentOperator(); }
+} testDescription_suite_UnstructuredGridTest_testAssimentOperator;
+
+static class TestDescription_suite_UnstructuredGridTest_testSetterGetter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridTest_testSetterGetter() : CxxTest::RealTestDescription( Tests_UnstructuredGridTest, suiteDescription_UnstructuredGridTest, 142, "testSetterGetter" ) {}
+ void runTest() { suite_UnstructuredGridTest.testSetterGetter(); }
+} testDescription_suite_UnstructuredGridTest_testSetterGetter;
+
+static class TestDescription_suite_UnstructuredGridTest_testEdgeCell : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridTest_testEdgeCell() : CxxTest::RealTestDescription( Tests_UnstructuredGridTest, suiteDescription_UnstructuredGridTest, 163, "testEdgeCell" ) {}
+ void runTest() { suite_UnstructuredGridTest.testEdgeCell(); }
+} testDescription_suite_UnstructuredGridTest_testEdgeCell;
+
+static class TestDescription_suite_UnstructuredGridTest_testWeightsMatrix : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridTest_testWeightsMatrix() : CxxTest::RealTestDescription( Tests_UnstructuredGridTest, suiteDescription_UnstructuredGridTest, 180, "testWeightsMatrix" ) {}
+ void runTest() { suite_UnstructuredGridTest.testWeightsMatrix(); }
+} testDescription_suite_UnstructuredGridTest_testWeightsMatrix;
+
+static class TestDescription_suite_UnstructuredGridTest_testLoadSaveRegion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridTest_testLoadSaveRegion() : CxxTest::RealTestDescription( Tests_UnstructuredGridTest, suiteDescription_UnstructuredGridTest, 223, "testLoadSaveRegion" ) {}
+ void runTest() { suite_UnstructuredGridTest.testLoadSaveRegion(); }
+} testDescription_suite_UnstructuredGridTest_testLoadSaveRegion;
+
+static class TestDescription_suite_UnstructuredGridTest_testLoadSaveRegionWithOffset : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridTest_testLoadSaveRegionWithOffset() : CxxTest::RealTestDescription( Tests_UnstructuredGridTest, suiteDescription_UnstructuredGridTest, 273, "testLoadSaveRegionWithOffset" ) {}
+ void runTest() { suite_UnstructuredGridTest.testLoadSaveRegionWithOffset(); }
+} testDescription_suite_UnstructuredGridTest_testLoadSaveRegionWithOffset;
+
+static class TestDescription_suite_UnstructuredGridTest_testResize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridTest_testResize() : CxxTest::RealTestDescription( Tests_UnstructuredGridTest, suiteDescription_UnstructuredGridTest, 337, "testResize" ) {}
+ void runTest() { suite_UnstructuredGridTest.testResize(); }
+} testDescription_suite_UnstructuredGridTest_testResize;
+
+static class TestDescription_suite_UnstructuredGridTest_testResizeFromZero : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridTest_testResizeFromZero() : CxxTest::RealTestDescription( Tests_UnstructuredGridTest, suiteDescription_UnstructuredGridTest, 370, "testResizeFromZero" ) {}
+ void runTest() { suite_UnstructuredGridTest.testResizeFromZero(); }
+} testDescription_suite_UnstructuredGridTest_testResizeFromZero;
+
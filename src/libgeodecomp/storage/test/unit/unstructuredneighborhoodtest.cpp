@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_UnstructuredNeighborhoodTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/unstructuredneighborhoodtest.h"
+
+static UnstructuredNeighborhoodTest suite_UnstructuredNeighborhoodTest;
+
+static CxxTest::List Tests_UnstructuredNeighborhoodTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_UnstructuredNeighborhoodTest( "/root/repo/src/libgeodecomp/storage/test/unit/unstructuredneighborhoodtest.h", 31, "UnstructuredNeighborhoodTest", suite_UnstructuredNeighborhoodTest, Tests_UnstructuredNeighborhoodTest );
+
+static class TestDescription_suite_UnstructuredNeighborhoodTest_testSquareBracketsOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredNeighborhoodTest_testSquareBracketsOperator() : CxxTest::RealTestDescription( Tests_UnstructuredNeighborhoodTest, suiteDescription_UnstructuredNeighborhoodTest, 34, "testSquareBracketsOperator" ) {}
+ void runTest() { suite_UnstructuredNeighborhoodTest.testSquareBracketsOperator(); }
+} testDescription_suite_UnstructuredNeighborhoodTest_testSquareBracketsOperator;
+
+static class TestDescription_suite_UnstructuredNeighborhoodTest_testNeighborhoodSimple : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredNeighborhoodTest_testNeighborhoodSimple() : CxxTest::RealTestDescription( Tests_UnstructuredNeighborhoodTest, suiteDescription_UnstructuredNeighborhoodTest, 58, "testNeighborhoodSimple" ) {}
+ void runTest() { suite_UnstructuredNeighborhoodTest.testNeighborhoodSimple(); }
+} testDescription_suite_UnstructuredNeighborhoodTest_testNeighborhoodSimple;
+
+static class TestDescription_suite_UnstructuredNeighborhoodTest_testNeighborhood : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredNeighborhoodTest_testNeighborhood() : CxxTest::RealTestDescription( Tests_UnstructuredNeighborhoodTest, suiteDescription_UnstructuredNeighborhoodTest, 118, "testNeighborhood" ) {}
+ void runTest() { suite_UnstructuredNeighborhoodTest.testNeighborhood(); }
+} testDescription_suite_UnstructuredNeighborhoodTest_testNeighborhood;
+
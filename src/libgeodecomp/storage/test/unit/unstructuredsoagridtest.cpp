@@ -0,0 +1,74 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_UnstructuredSoAGridTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/unstructuredsoagridtest.h"
+
+static UnstructuredSoAGridTest suite_UnstructuredSoAGridTest;
+
+static CxxTest::List Tests_UnstructuredSoAGridTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_UnstructuredSoAGridTest( "/root/repo/src/libgeodecomp/storage/test/unit/unstructuredsoagridtest.h", 80, "UnstructuredSoAGridTest", suite_UnstructuredSoAGridTest, Tests_UnstructuredSoAGridTest );
+
+static class TestDescription_suite_UnstructuredSoAGridTest_testConstructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredSoAGridTest_testConstructor() : CxxTest::RealTestDescription( Tests_UnstructuredSoAGridTest, suiteDescription_UnstructuredSoAGridTest, 83, "testConstructor" ) {}
+ void runTest() { suite_UnstructuredSoAGridTest.testConstructor(); }
+} testDescription_suite_UnstructuredSoAGridTest_testConstructor;
+
+static class TestDescription_suite_UnstructuredSoAGridTest_testGetAndSet : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredSoAGridTest_testGetAndSet() : CxxTest::RealTestDescription( Tests_UnstructuredSoAGridTest, suiteDescription_UnstructuredSoAGridTest, 100, "testGetAndSet" ) {}
+ void runTest() { suite_UnstructuredSoAGridTest.testGetAndSet(); }
+} testDescription_suite_UnstructuredSoAGridTest_testGetAndSet;
+
+static class TestDescription_suite_UnstructuredSoAGridTest_testResize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredSoAGridTest_testResize() : CxxTest::RealTestDescription( Tests_UnstructuredSoAGridTest, suiteDescription_UnstructuredSoAGridTest, 114, "testResize" ) {}
+ void runTest() { suite_UnstructuredSoAGridTest.testResize(); }
+} testDescription_suite_UnstructuredSoAGridTest_testResize;
+
+static class TestDescription_suite_UnstructuredSoAGridTest_testLoadSaveRegionWithOffset : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredSoAGridTest_testLoadSaveRegionWithOffset() : CxxTest::RealTestDescription( Tests_UnstructuredSoAGridTest, suiteDescription_UnstructuredSoAGridTest, 147, "testLoadSaveRegionWithOffset" ) {}
+ void runTest() { suite_UnstructuredSoAGridTest.testLoadSaveRegionWithOffset(); }
+} testDescription_suite_UnstructuredSoAGridTest_testLoadSaveRegionWithOffset;
+
+static class TestDescription_suite_UnstructuredSoAGridTest_testLoadSaveRegion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredSoAGridTest_testLoadSaveRegion() : CxxTest::RealTestDescription( Tests_UnstructuredSoAGridTest, suiteDescription_UnstructuredSoAGridTest, 204, "testLoadSaveRegion" ) {}
+ void runTest() { suite_UnstructuredSoAGridTest.testLoadSaveRegion(); }
+} testDescription_suite_UnstructuredSoAGridTest_testLoadSaveRegion;
+
+static class TestDescription_suite_UnstructuredSoAGridTest_testSaveAndLoadMemberBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredSoAGridTest_testSaveAndLoadMemberBasic() : CxxTest::RealTestDescription( Tests_UnstructuredSoAGridTest, suiteDescription_UnstructuredSoAGridTest, 247, "testSaveAndLoadMemberBasic" ) {}
+ void runTest() { suite_UnstructuredSoAGridTest.testSaveAndLoadMemberBasic(); }
+} testDescription_suite_UnstructuredSoAGridTest_testSaveAndLoadMemberBasic;
+
+static class TestDescription_suite_UnstructuredSoAGridTest_testSaveAndLoadMember : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredSoAGridTest_testSaveAndLoadMember() : CxxTest::RealTestDescription( Tests_UnstructuredSoAGridTest, suiteDescription_UnstructuredSoAGridTest, 288, "testSaveAndLoadMember" ) {}
+ void runTest() { suite_UnstructuredSoAGridTest.testSaveAndLoadMember(); }
+} testDescription_suite_UnstructuredSoAGridTest_testSaveAndLoadMember;
+
@@ -154,8 +154,83 @@ public:
     double sum;
 };
 
+/**
+ * Same as SimpleUnstructuredSoATestCell, but lets the neighborhood
+ * gather the neighbors' values instead of doing so manually.
+ */
+template<int SIGMA>
+class GatheringUnstructuredSoATestCell
+{
+public:
+    typedef short_vec<double, 4> ShortVec;
+
+    class API :
+        public APITraits::HasUpdateLineX,
+        public APITraits::HasSoA,
+        public APITraits::HasUnstructuredTopology,
+        public APITraits::HasPredefinedMPIDataType<double>,
+        public APITraits::HasSellType<double>,
+        public APITraits::HasSellMatrices<1>,
+        public APITraits::HasSellC<4>,
+        public APITraits::HasSellSigma<SIGMA>,
+        public LibFlatArray::api_traits::has_default_1d_sizes
+    {};
+
+    inline
+    explicit GatheringUnstructuredSoATestCell(double v = 0) :
+        value(v),
+        sum(0)
+    {}
+
+    template<typename HOOD_NEW, typename HOOD_OLD>
+    static void updateLineX(HOOD_NEW& hoodNew, int indexEnd, HOOD_OLD& hoodOld, unsigned /* nanoStep */)
+    {
+        unstructuredLoopPeeler<ShortVec>(
+            &hoodNew.index(),
+            indexEnd,
+            hoodOld,
+            [&hoodNew](auto REAL, auto *counter, const auto& end, auto& hoodOld) {
+                typedef decltype(REAL) ShortVec;
+                for (; hoodNew.index() < end; hoodNew += ShortVec::ARITY) {
+                    ShortVec tmp;
+                    tmp.load_aligned(&hoodNew->sum());
+
+                    for (const auto& j: hoodOld.weights().gather(&hoodOld->value())) {
+                        tmp += j.values() * j.weights();
+                    }
+
+                    &hoodNew->sum() << tmp;
+                    ++hoodOld;
+                }
+            });
+    }
+
+    template<typename NEIGHBORHOOD>
+    void update(NEIGHBORHOOD& neighborhood, unsigned /* nanoStep */)
+    {
+        sum = 0.;
+        for (const auto& j: neighborhood.weights(0)) {
+            sum += neighborhood[j.first()].value * j.second();
+        }
+    }
+
+    inline bool operator==(const GatheringUnstructuredSoATestCell& cell) const
+    {
+        return cell.sum == sum;
+    }
+
+    inline bool operator!=(const GatheringUnstructuredSoATestCell& cell) const
+    {
+        return !(*this == cell);
+    }
+
+    double value;
+    double sum;
+};
+
 LIBFLATARRAY_REGISTER_SOA(SimpleUnstructuredSoATestCell<1 >, ((double)(sum))((double)(value)))
 LIBFLATARRAY_REGISTER_SOA(SimpleUnstructuredSoATestCell<60>, ((double)(sum))((double)(value)))
+LIBFLATARRAY_REGISTER_SOA(GatheringUnstructuredSoATestCell<1>, ((double)(sum))((double)(value)))
 #endif
 
 namespace LibGeoDecomp {
@@ -443,6 +518,72 @@ public:
 #endif
     }
 
+    void testSoAWithGather()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        const int DIM = 150;
+        CoordBox<1> dim(Coord<1>(0), Coord<1>(DIM));
+        Region<1> boundingRegion;
+        boundingRegion << dim;
+
+        GatheringUnstructuredSoATestCell<1> defaultCell(200);
+        GatheringUnstructuredSoATestCell<1> edgeCell(-1);
+
+        typedef ReorderingUnstructuredGrid<UnstructuredSoAGrid<GatheringUnstructuredSoATestCell<1>, 1, double, 4, 1> > GridType;
+        GridType gridOld(boundingRegion, defaultCell, edgeCell);
+        GridType gridNew(boundingRegion, defaultCell, edgeCell);
+
+        for (int i = 0; i < DIM; ++i) {
+            gridOld.set(Coord<1>(i), GatheringUnstructuredSoATestCell<1>(2000 + i));
+        }
+
+        // weights matrix looks like this:
+        // 0
+        // 1
+        // 2 12
+        // 3 13 23
+        // ...
+        GridType::SparseMatrix matrix;
+        for (int row = 0; row < DIM; ++row) {
+            for (int col = 0; col < row; ++col) {
+                matrix << std::make_pair(Coord<2>(row, col), row + col * 10);
+            }
+        }
+        gridOld.setWeights(0, matrix);
+        gridNew.setWeights(0, matrix);
+
+        Region<1> region;
+        // loop peeling in first and last chunk
+        region << Streak<1>(Coord<1>(10),   30);
+        // loop peeling in first chunk
+        region << Streak<1>(Coord<1>(37),   60);
+        // "normal" streak
+        region << Streak<1>(Coord<1>(64),   80);
+        // loop peeling in last chunk
+        region << Streak<1>(Coord<1>(100), 149);
+        region = gridOld.remapRegion(region);
+
+        UnstructuredUpdateFunctor<GatheringUnstructuredSoATestCell<1> > functor;
+        UpdateFunctorHelpers::ConcurrencyNoP concurrencySpec;
+        APITraits::SelectThreadedUpdate<GatheringUnstructuredSoATestCell<1> >::Value modelThreadingSpec;
+
+        functor(region, gridOld, &gridNew, 0, concurrencySpec, modelThreadingSpec);
+
+        for (Coord<1> coord(0); coord < Coord<1>(150); ++coord.x()) {
+            if (region.count(coord)) {
+                double sum = 0;
+                for (int i = 0; i < coord.x(); ++i) {
+                    double weight = coord.x() + i * 10;
+                    sum += weight * (2000 + i);
+                }
+                TS_ASSERT_EQUALS(sum, gridNew.get(coord).sum);
+            } else {
+                TS_ASSERT_EQUALS(0.0, gridNew.get(coord).sum);
+            }
+        }
+#endif
+    }
+
     void testSoAWithSIGMA()
     {
 #ifdef LIBGEODECOMP_WITH_CPP14
@@ -12,6 +12,22 @@ using namespace LibGeoDecomp;
 
 std::stringstream myLog;
 
+class ProgressCounter
+{
+public:
+    explicit ProgressCounter(int *counter) :
+        counter(counter)
+    {}
+
+    void operator()() const
+    {
+        ++*counter;
+    }
+
+private:
+    int *counter;
+};
+
 class BasicCell
 {
 public:
@@ -256,6 +272,48 @@ public:
         }
     }
 
+    void testProgressHook()
+    {
+        typedef TestCell<2> TestCellType;
+        typedef Grid<TestCellType, Topologies::Cube<2>::Topology> GridType;
+
+        Coord<2> dim(17, 9);
+        TestInitializer<TestCellType> init(dim);
+        GridType gridOld(dim);
+        init.grid(&gridOld);
+        GridType gridNew = gridOld;
+
+        Region<2> region;
+        region << CoordBox<2>(Coord<2>(1, 2), Coord<2>(15, 6));
+
+        int counter = 0;
+        typedef UpdateFunctorHelpers::ConcurrencyWithProgress<
+            UpdateFunctorHelpers::ConcurrencyNoP, ProgressCounter> ConcurrencySpec;
+        UpdateFunctor<TestCellType, ConcurrencySpec>()(
+            region, Coord<2>(), Coord<2>(), gridOld, &gridNew, 0,
+            ConcurrencySpec(UpdateFunctorHelpers::ConcurrencyNoP(), ProgressCounter(&counter)));
+
+        // once per plane (i.e. row):
+        TS_ASSERT_EQUALS(6, counter);
+        TS_ASSERT(gridNew[Coord<2>(5, 4)].valid());
+        TS_ASSERT_EQUALS(gridOld[Coord<2>(5, 4)].cycleCounter + 1, gridNew[Coord<2>(5, 4)].cycleCounter);
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+        counter = 0;
+        typedef UpdateFunctorHelpers::ConcurrencyWithProgress<
+            UpdateFunctorHelpers::ConcurrencyEnableOpenMP, ProgressCounter> ThreadedConcurrencySpec;
+        UpdateFunctor<TestCellType, ThreadedConcurrencySpec>()(
+            region, Coord<2>(), Coord<2>(), gridOld, &gridNew, 0,
+            ThreadedConcurrencySpec(
+                UpdateFunctorHelpers::ConcurrencyEnableOpenMP(false, false),
+                ProgressCounter(&counter)));
+
+        // only the master thread drives progress, and it gets at least one plane:
+        TS_ASSERT_LESS_THAN(0, counter);
+        TS_ASSERT_LESS_THAN_EQUALS(counter, 6);
+#endif
+    }
+
 private:
     template<typename CELL>
     void checkSelector(const std::string& line, int repeats)
@@ -0,0 +1,55 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_VanillaUpdateFunctorTest_init = false;
+#include "/root/repo/src/libgeodecomp/storage/test/unit/vanillaupdatefunctortest.h"
+
+static VanillaUpdateFunctorTest suite_VanillaUpdateFunctorTest;
+
+static CxxTest::List Tests_VanillaUpdateFunctorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_VanillaUpdateFunctorTest( "/root/repo/src/libgeodecomp/storage/test/unit/vanillaupdatefunctortest.h", 9, "VanillaUpdateFunctorTest", suite_VanillaUpdateFunctorTest, Tests_VanillaUpdateFunctorTest );
+
+static class TestDescription_suite_VanillaUpdateFunctorTest_testMoore2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_VanillaUpdateFunctorTest_testMoore2D() : CxxTest::RealTestDescription( Tests_VanillaUpdateFunctorTest, suiteDescription_VanillaUpdateFunctorTest, 37, "testMoore2D" ) {}
+ void runTest() { suite_VanillaUpdateFunctorTest.testMoore2D(); }
+} testDescription_suite_VanillaUpdateFunctorTest_testMoore2D;
+
+static class TestDescription_suite_VanillaUpdateFunctorTest_testMoore3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_VanillaUpdateFunctorTest_testMoore3D() : CxxTest::RealTestDescription( Tests_VanillaUpdateFunctorTest, suiteDescription_VanillaUpdateFunctorTest, 43, "testMoore3D" ) {}
+ void runTest() { suite_VanillaUpdateFunctorTest.testMoore3D(); }
+} testDescription_suite_VanillaUpdateFunctorTest_testMoore3D;
+
+static class TestDescription_suite_VanillaUpdateFunctorTest_testVonNeumann2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_VanillaUpdateFunctorTest_testVonNeumann2D() : CxxTest::RealTestDescription( Tests_VanillaUpdateFunctorTest, suiteDescription_VanillaUpdateFunctorTest, 49, "testVonNeumann2D" ) {}
+ void runTest() { suite_VanillaUpdateFunctorTest.testVonNeumann2D(); }
+} testDescription_suite_VanillaUpdateFunctorTest_testVonNeumann2D;
+
+static class TestDescription_suite_VanillaUpdateFunctorTest_testVonNeumann3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_VanillaUpdateFunctorTest_testVonNeumann3D() : CxxTest::RealTestDescription( Tests_VanillaUpdateFunctorTest, suiteDescription_VanillaUpdateFunctorTest, 55, "testVonNeumann3D" ) {}
+ void runTest() { suite_VanillaUpdateFunctorTest.testVonNeumann3D(); }
+} testDescription_suite_VanillaUpdateFunctorTest_testVonNeumann3D;
+
@@ -53,6 +53,13 @@ public:
         return *this;
     }
 
+    template<typename CARGO>
+    inline
+    typename HOOD::template ScalarGatherRange<CARGO> gather(const CARGO *source) const
+    {
+        return hood.gatherScalar(source);
+    }
+
 private:
     HOOD& hood;
 };
@@ -5,6 +5,7 @@
 #ifdef LIBGEODECOMP_WITH_CPP14
 
 #include <libflatarray/flat_array.hpp>
+#include <libflatarray/short_vec.hpp>
 #include <libflatarray/soa_accessor.hpp>
 
 #include <libgeodecomp/geometry/coord.h>
@@ -15,6 +16,111 @@
 
 namespace LibGeoDecomp {
 
+namespace UnstructuredSoANeighborhoodHelpers {
+
+/**
+ * Iterates through the columns of a chunk (or of a single row
+ * within a chunk for ARITY == 1) and yields ARITY neighbor values
+ * at a time, gathered from source via the column indices of the
+ * SELL-C-SIGMA matrix, along with the corresponding edge weights.
+ * STRIDE is the chunk size C.
+ */
+template<typename VALUE_TYPE, typename CARGO, int ARITY, int STRIDE>
+class GatherIterator
+{
+public:
+    typedef LibFlatArray::short_vec<VALUE_TYPE, ARITY> WeightsVec;
+    typedef LibFlatArray::short_vec<CARGO, ARITY> ValuesVec;
+
+    inline
+    GatherIterator(const int *columns, const VALUE_TYPE *weights, const CARGO *source) :
+        columns(columns),
+        weightsPtr(weights),
+        source(source)
+    {}
+
+    inline
+    void operator++()
+    {
+        columns += STRIDE;
+        weightsPtr += STRIDE;
+    }
+
+    inline
+    bool operator==(const GatherIterator& other) const
+    {
+        return columns == other.columns;
+    }
+
+    inline
+    bool operator!=(const GatherIterator& other) const
+    {
+        return !(*this == other);
+    }
+
+    inline
+    const GatherIterator& operator*() const
+    {
+        return *this;
+    }
+
+    inline
+    WeightsVec weights() const
+    {
+        WeightsVec ret;
+        ret.load_aligned(weightsPtr);
+        return ret;
+    }
+
+    inline
+    ValuesVec values() const
+    {
+        ValuesVec ret;
+        ret.gather(source, columns);
+        return ret;
+    }
+
+private:
+    const int *columns;
+    const VALUE_TYPE *weightsPtr;
+    const CARGO *source;
+};
+
+/**
+ * Range adapter for GatherIterator, so it can be used in range-based
+ * for loops.
+ */
+template<typename VALUE_TYPE, typename CARGO, int ARITY, int STRIDE>
+class GatherRange
+{
+public:
+    typedef GatherIterator<VALUE_TYPE, CARGO, ARITY, STRIDE> Iterator;
+
+    inline
+    GatherRange(const Iterator& beginIter, const Iterator& endIter) :
+        beginIter(beginIter),
+        endIter(endIter)
+    {}
+
+    inline
+    const Iterator& begin() const
+    {
+        return beginIter;
+    }
+
+    inline
+    const Iterator& end() const
+    {
+        return endIter;
+    }
+
+private:
+    Iterator beginIter;
+    Iterator endIter;
+};
+
+}
+
 /**
  * Neighborhood providing pointers for vectorization of UnstructuredSoAGrid.
  * weights(id) returns a pair of two pointers. One points to the array where
@@ -44,6 +150,10 @@ public:
     static const int ARITY = C;
 
     using IteratorPair = std::pair<const int*, const VALUE_TYPE*>;
+    template<typename CARGO>
+    using GatherRange = UnstructuredSoANeighborhoodHelpers::GatherRange<VALUE_TYPE, CARGO, C, C>;
+    template<typename CARGO>
+    using ScalarGatherRange = UnstructuredSoANeighborhoodHelpers::GatherRange<VALUE_TYPE, CARGO, 1, C>;
     using SoAAccessor = LibFlatArray::soa_accessor<CELL, DIM_X, DIM_Y, DIM_Z, INDEX>;
     using ConstSoAAccessor = LibFlatArray::const_soa_accessor<CELL, DIM_X, DIM_Y, DIM_Z, INDEX>;
 
@@ -223,6 +333,40 @@ public:
         return ScalarIterator(matrix, matrix.chunkOffsetVec()[currentChunk + 1], intraChunkOffset);
     }
 
+    /**
+     * Returns a range over the columns of the current chunk, each
+     * yielding C neighbor values gathered from source (usually a
+     * member of the old grid, e.g. &hoodOld->value()) and the C
+     * corresponding weights as short_vecs:
+     *
+     *   for (const auto& j: hoodOld.weights(0).gather(&hoodOld->value())) {
+     *       sum += j.values() * j.weights();
+     *   }
+     *
+     * This saves the user from loading weights and indices manually
+     * and lets the short_vec backend use hardware gathers (AVX2,
+     * AVX-512) on the SELL column array.
+     */
+    template<typename CARGO>
+    inline
+    GatherRange<CARGO> gather(const CARGO *source) const
+    {
+        const auto& matrix = grid.getWeights(currentMatrixID);
+        return gatherRange<GatherRange<CARGO> >(matrix, source, 0);
+    }
+
+    /**
+     * Scalar counterpart of gather(), used by the loop peeler for
+     * cells which are not aligned on chunk boundaries.
+     */
+    template<typename CARGO>
+    inline
+    ScalarGatherRange<CARGO> gatherScalar(const CARGO *source) const
+    {
+        const auto& matrix = grid.getWeights(currentMatrixID);
+        return gatherRange<ScalarGatherRange<CARGO> >(matrix, source, intraChunkOffset);
+    }
+
     /**
      * Advance hood by one cell within a chunk. Useful for scalar
      * iteration (see ScalarIterator).
@@ -250,6 +394,22 @@ public:
     }
 
 private:
+    template<typename RANGE, typename MATRIX, typename CARGO>
+    inline
+    RANGE gatherRange(const MATRIX& matrix, const CARGO *source, int scalarOffset) const
+    {
+        typedef typename RANGE::Iterator GatherIterator;
+
+        const int *columns = matrix.columnVec().data() + scalarOffset;
+        const VALUE_TYPE *values = matrix.valuesVec().data() + scalarOffset;
+        const int begin = matrix.chunkOffsetVec()[currentChunk];
+        const int end = matrix.chunkOffsetVec()[currentChunk + 1];
+
+        return RANGE(
+            GatherIterator(columns + begin, values + begin, source),
+            GatherIterator(columns + end,   values + end,   source));
+    }
+
     /**
      * Reference to old grid. Storing just a reference to the weights
      * vector isn't sufficient as a user may with to access multiple
@@ -10,6 +10,7 @@
 #include <libgeodecomp/communication/mpilayer.h>
 #include <libgeodecomp/geometry/region.h>
 #include <libgeodecomp/misc/apitraits.h>
+#include <libgeodecomp/misc/metrics.h>
 #include <libgeodecomp/storage/fixedneighborhoodupdatefunctor.h>
 #include <libgeodecomp/storage/linepointerassembly.h>
 #include <libgeodecomp/storage/linepointerupdatefunctor.h>
@@ -312,6 +313,9 @@ public:
     {
         return false;
     }
+
+    void progress() const
+    {}
 };
 
 /**
@@ -348,6 +352,9 @@ public:
         return enableFineGrainedParallelism;
     }
 
+    void progress() const
+    {}
+
 private:
     bool updatingGhost;
     bool enableFineGrainedParallelism;
@@ -384,10 +391,41 @@ public:
         return enableFineGrainedParallelism;
     }
 
+    void progress() const
+    {}
+
 private:
     bool enableFineGrainedParallelism;
 };
 
+/**
+ * Decorates another CONCURRENCY_FUNCTOR with a sideband action: the
+ * UpdateFunctor will call progress() after each plane of the Region
+ * (on OpenMP's master thread only), which is then forwarded to the
+ * PROGRESS_FUNCTOR. Steppers use this to drive asynchronous MPI
+ * communication while they're updating the inner set.
+ */
+template<typename CONCURRENCY_FUNCTOR, typename PROGRESS_FUNCTOR>
+class ConcurrencyWithProgress : public CONCURRENCY_FUNCTOR
+{
+public:
+    inline
+    ConcurrencyWithProgress(
+        const CONCURRENCY_FUNCTOR& delegate,
+        const PROGRESS_FUNCTOR& progressFunctor) :
+        CONCURRENCY_FUNCTOR(delegate),
+        progressFunctor(progressFunctor)
+    {}
+
+    void progress() const
+    {
+        progressFunctor();
+    }
+
+private:
+    PROGRESS_FUNCTOR progressFunctor;
+};
+
 }
 
 /**
@@ -417,6 +455,8 @@ public:
         unsigned nanoStep,
         const CONCURRENCY_FUNCTOR& concurrencySpec = UpdateFunctorHelpers::ConcurrencyNoP())
     {
+        Metrics::add(Metrics::CELLS_UPDATED, region.size());
+
         UpdateFunctorHelpers::Selector<CELL>()(
             region, sourceOffset, targetOffset, gridOld, gridNew, nanoStep, concurrencySpec,
             typename APITraits::SelectFixedCoordsOnlyUpdate<CELL>::Value(),
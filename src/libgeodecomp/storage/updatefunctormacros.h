@@ -1,8 +1,19 @@
 #ifndef LIBGEODECOMP_STORAGE_UPDATEFUNCTORMACROS_H
 #define LIBGEODECOMP_STORAGE_UPDATEFUNCTORMACROS_H
 
+#include <libgeodecomp/config.h>
 #include <libgeodecomp/storage/updatefunctormacrosmsvc.h>
 
+#ifdef LIBGEODECOMP_WITH_THREADS
+#include <omp.h>
+#endif
+
+// The CONCURRENCY_FUNCTOR's progress() is called after each plane
+// (or streak, for fine grained parallelism) so the caller may drive
+// sideband actions (e.g. MPI progress) during long updates. Only
+// OpenMP's master thread does so as those actions are rarely thread
+// safe.
+
 #ifndef _MSC_BUILD
 
 #ifdef LIBGEODECOMP_WITH_THREADS
@@ -20,6 +31,9 @@
                      ++i) {                                             \
                     LGD_UPDATE_FUNCTOR_BODY;                            \
                 }                                                       \
+                if (omp_get_thread_num() == 0) {                        \
+                    concurrencySpec.progress();                         \
+                }                                                       \
             }                                                           \
     /**/
 #define LGD_UPDATE_FUNCTOR_THREADING_SELECTOR_2                         \
@@ -35,6 +49,9 @@
                          ++i) {                                         \
                         LGD_UPDATE_FUNCTOR_BODY;                        \
                     }                                                   \
+                    if (omp_get_thread_num() == 0) {                    \
+                        concurrencySpec.progress();                     \
+                    }                                                   \
                 }                                                       \
     /**/
 #define LGD_UPDATE_FUNCTOR_THREADING_SELECTOR_3                         \
@@ -60,6 +77,9 @@
                     for (std::size_t j = 0; j < streaks.size(); ++j) {  \
                         Streak<DIM> *i = &streaks[j];                   \
                         LGD_UPDATE_FUNCTOR_BODY;                        \
+                        if (omp_get_thread_num() == 0) {                \
+                            concurrencySpec.progress();                 \
+                        }                                               \
                     }                                                   \
             }                                                           \
     /**/
@@ -146,10 +166,16 @@
 #endif
 
 #define LGD_UPDATE_FUNCTOR_THREADING_SELECTOR_8                         \
-    for (typename Region<DIM>::StreakIterator i = region.beginStreak(); \
-         i != region.endStreak();                                       \
-         ++i) {                                                         \
-        LGD_UPDATE_FUNCTOR_BODY;                                        \
+    for (std::size_t c = 0; c < region.numPlanes(); ++c) {              \
+        typename Region<DIM>::StreakIterator e =                        \
+            region.planeStreakIterator(c + 1);                          \
+        typedef typename Region<DIM>::StreakIterator Iter;              \
+        for (Iter i = region.planeStreakIterator(c + 0);                \
+             i != e;                                                    \
+             ++i) {                                                     \
+            LGD_UPDATE_FUNCTOR_BODY;                                    \
+        }                                                               \
+        concurrencySpec.progress();                                     \
     }                                                                   \
     /**/
 
@@ -22,6 +22,9 @@
                      ++i) {                                             \
                     LGD_UPDATE_FUNCTOR_BODY;                            \
                 }                                                       \
+                if (omp_get_thread_num() == 0) {                        \
+                    concurrencySpec.progress();                         \
+                }                                                       \
             }                                                           \
     /**/
 #define LGD_UPDATE_FUNCTOR_THREADING_SELECTOR_2                         \
@@ -37,6 +40,9 @@
                          ++i) {                                         \
                         LGD_UPDATE_FUNCTOR_BODY;                        \
                     }                                                   \
+                    if (omp_get_thread_num() == 0) {                    \
+                        concurrencySpec.progress();                     \
+                    }                                                   \
                 }                                                       \
     /**/
 #define LGD_UPDATE_FUNCTOR_THREADING_SELECTOR_3                         \
@@ -62,6 +68,9 @@
                 for (int j = 0; j < int(streaks.size()); ++j) {         \
                     Streak<DIM> *i = &streaks[std::size_t(j)];          \
                     LGD_UPDATE_FUNCTOR_BODY;                            \
+                    if (omp_get_thread_num() == 0) {                    \
+                        concurrencySpec.progress();                     \
+                    }                                                   \
                 }                                                       \
             }                                                           \
     /**/
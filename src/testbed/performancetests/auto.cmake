@@ -0,0 +1,8 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}cudatests.cu
+  ${RELATIVE_PATH}main.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}cell.h
+  ${RELATIVE_PATH}cpubenchmark.h
+)
@@ -7,10 +7,12 @@
 #include <libgeodecomp/geometry/floatcoord.h>
 #include <libgeodecomp/geometry/region.h>
 #include <libgeodecomp/geometry/stencils.h>
+#include <libgeodecomp/geometry/voronoimesher.h>
 #include <libgeodecomp/geometry/partitions/hindexingpartition.h>
 #include <libgeodecomp/geometry/partitions/hilbertpartition.h>
 #include <libgeodecomp/geometry/partitions/stripingpartition.h>
 #include <libgeodecomp/geometry/partitions/zcurvepartition.h>
+#include <libgeodecomp/storage/containercell.h>
 #include <libgeodecomp/storage/grid.h>
 #include <libgeodecomp/storage/linepointerassembly.h>
 #include <libgeodecomp/storage/linepointerupdatefunctor.h>
@@ -45,6 +47,37 @@
 using namespace LibGeoDecomp;
 using namespace LibFlatArray;
 
+/**
+ * Restricts OpenMP to a single thread while in scope, which forces
+ * Region's set operations onto their sequential code path. Useful
+ * for measuring the speedup of the planewise parallel merges.
+ */
+class SequentialScope
+{
+public:
+    explicit SequentialScope(bool enabled)
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        oldNumThreads = omp_get_max_threads();
+        if (enabled) {
+            omp_set_num_threads(1);
+        }
+#endif
+    }
+
+    ~SequentialScope()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        omp_set_num_threads(oldNumThreads);
+#endif
+    }
+
+private:
+#ifdef LIBGEODECOMP_WITH_THREADS
+    int oldNumThreads;
+#endif
+};
+
 class RegionCount : public CPUBenchmark
 {
 public:
@@ -135,6 +168,10 @@ public:
 class RegionIntersect : public CPUBenchmark
 {
 public:
+    explicit RegionIntersect(bool sequential = false) :
+        sequential(sequential)
+    {}
+
     std::string family()
     {
         return "RegionIntersect";
@@ -142,7 +179,7 @@ public:
 
     std::string species()
     {
-        return "gold";
+        return sequential ? "vanilla" : "gold";
     }
 
     double performance(std::vector<int> rawDim)
@@ -150,8 +187,6 @@ public:
         Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
         double seconds = 0;
         {
-            ScopedTimer t(&seconds);
-
             Region<3> r1;
             Region<3> r2;
 
@@ -167,6 +202,8 @@ public:
                 }
             }
 
+            SequentialScope scope(sequential);
+            ScopedTimer t(&seconds);
             Region<3> r3 = r1 & r2;
         }
 
@@ -177,11 +214,18 @@ public:
     {
         return "s";
     }
+
+private:
+    bool sequential;
 };
 
 class RegionSubtract : public CPUBenchmark
 {
 public:
+    explicit RegionSubtract(bool sequential = false) :
+        sequential(sequential)
+    {}
+
     std::string family()
     {
         return "RegionSubtract";
@@ -189,7 +233,7 @@ public:
 
     std::string species()
     {
-        return "gold";
+        return sequential ? "vanilla" : "gold";
     }
 
     double performance(std::vector<int> rawDim)
@@ -197,8 +241,6 @@ public:
         Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
         double seconds = 0;
         {
-            ScopedTimer t(&seconds);
-
             Region<3> r1;
             Region<3> r2;
 
@@ -214,6 +256,8 @@ public:
                 }
             }
 
+            SequentialScope scope(sequential);
+            ScopedTimer t(&seconds);
             Region<3> r3 = r1 - r2;
         }
 
@@ -224,11 +268,18 @@ public:
     {
         return "s";
     }
+
+private:
+    bool sequential;
 };
 
 class RegionUnion : public CPUBenchmark
 {
 public:
+    explicit RegionUnion(bool sequential = false) :
+        sequential(sequential)
+    {}
+
     std::string family()
     {
         return "RegionUnion";
@@ -236,7 +287,7 @@ public:
 
     std::string species()
     {
-        return "gold";
+        return sequential ? "vanilla" : "gold";
     }
 
     double performance(std::vector<int> rawDim)
@@ -244,8 +295,6 @@ public:
         Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
         double seconds = 0;
         {
-            ScopedTimer t(&seconds);
-
             Region<3> r1;
             Region<3> r2;
 
@@ -261,6 +310,8 @@ public:
                 }
             }
 
+            SequentialScope scope(sequential);
+            ScopedTimer t(&seconds);
             Region<3> r3 = r1 + r2;
         }
 
@@ -271,6 +322,9 @@ public:
     {
         return "s";
     }
+
+private:
+    bool sequential;
 };
 
 class RegionAppend : public CPUBenchmark
@@ -334,8 +388,9 @@ public:
 class RegionExpand : public CPUBenchmark
 {
 public:
-    explicit RegionExpand(int expansionWidth) :
-        expansionWidth(expansionWidth)
+    explicit RegionExpand(int expansionWidth, bool sequential = false) :
+        expansionWidth(expansionWidth),
+        sequential(sequential)
     {}
 
     std::string family()
@@ -347,7 +402,7 @@ public:
 
     std::string species()
     {
-        return "gold";
+        return sequential ? "vanilla" : "gold";
     }
 
     double performance(std::vector<int> rawDim)
@@ -355,8 +410,6 @@ public:
         Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
         double seconds = 0;
         {
-            ScopedTimer t(&seconds);
-
             Region<3> r1;
             for (int z = 0; z < dim.z(); ++z) {
                 for (int y = 0; y < dim.y(); ++y) {
@@ -364,6 +417,8 @@ public:
                 }
             }
 
+            SequentialScope scope(sequential);
+            ScopedTimer t(&seconds);
             Region<3> r2 = r1.expand(expansionWidth);
         }
 
@@ -377,6 +432,7 @@ public:
 
 private:
     int expansionWidth;
+    bool sequential;
 };
 
 class RegionExpandWithAdjacency : public CPUBenchmark
@@ -617,6 +673,107 @@ private:
     }
 };
 
+class VoronoiMesherFillGeometryData : public CPUBenchmark
+{
+public:
+    class MeshCell
+    {
+    public:
+        explicit MeshCell(const FloatCoord<2>& center = FloatCoord<2>(), int id = 0) :
+            center(center),
+            id(id),
+            area(0)
+        {}
+
+        void setArea(const double newArea)
+        {
+            area = newArea;
+        }
+
+        void setShape(const std::vector<FloatCoord<2> >& newShape)
+        {
+            shape = newShape;
+        }
+
+        void pushNeighbor(const int neighborID, const double /* length */, const FloatCoord<2>& /* dir */)
+        {
+            neighborIDs << neighborID;
+        }
+
+        std::size_t numberOfNeighbors() const
+        {
+            return neighborIDs.size();
+        }
+
+        FloatCoord<2> center;
+        int id;
+        double area;
+        std::vector<FloatCoord<2> > shape;
+        std::vector<int> neighborIDs;
+    };
+
+    typedef ContainerCell<MeshCell, 30> MeshContainer;
+
+    class Mesher : public VoronoiMesher<MeshContainer>
+    {
+    public:
+        Mesher(const Coord<2>& gridDim, const FloatCoord<2>& quadrantSize) :
+            VoronoiMesher<MeshContainer>(gridDim, quadrantSize, 1.0),
+            counter(1)
+        {}
+
+        virtual void addCell(MeshContainer *container, const FloatCoord<2>& center)
+        {
+            container->insert(counter, MeshCell(center, counter));
+            ++counter;
+        }
+
+    private:
+        int counter;
+    };
+
+    std::string family()
+    {
+        return "VoronoiMesher";
+    }
+
+    std::string species()
+    {
+        return "gold";
+    }
+
+    double performance(std::vector<int> rawDim)
+    {
+        Coord<2> dim(rawDim[0], rawDim[1]);
+        FloatCoord<2> quadrantSize(100, 100);
+        Grid<MeshContainer> grid(dim);
+        Mesher mesher(dim, quadrantSize);
+
+        for (CoordBox<2>::Iterator i = grid.boundingBox().begin(); i != grid.boundingBox().end(); ++i) {
+            mesher.addRandomCells(&grid, *i, 20);
+        }
+
+        double seconds = 0;
+        {
+            ScopedTimer t(&seconds);
+
+            mesher.fillGeometryData(&grid);
+        }
+
+        if (grid.get(Coord<2>(1, 1)).begin()->area == 4711) {
+            std::cout << "this statement just serves to prevent the compiler from"
+                      << "optimizing away the loops above\n";
+        }
+
+        return seconds;
+    }
+
+    std::string unit()
+    {
+        return "s";
+    }
+};
+
 
 class CoordEnumerationVanilla : public CPUBenchmark
 {
@@ -2986,29 +3143,44 @@ int main(int argc, char **argv)
     eval(RegionInsert(), toVector(Coord<3>( 512,  512,  512)));
     eval(RegionInsert(), toVector(Coord<3>(2048, 2048, 2048)));
 
-    eval(RegionIntersect(), toVector(Coord<3>( 128,  128,  128)));
-    eval(RegionIntersect(), toVector(Coord<3>( 512,  512,  512)));
-    eval(RegionIntersect(), toVector(Coord<3>(2048, 2048, 2048)));
-
-    eval(RegionSubtract(), toVector(Coord<3>( 128,  128,  128)));
-    eval(RegionSubtract(), toVector(Coord<3>( 512,  512,  512)));
-    eval(RegionSubtract(), toVector(Coord<3>(2048, 2048, 2048)));
-
-    eval(RegionUnion(), toVector(Coord<3>( 128,  128,  128)));
-    eval(RegionUnion(), toVector(Coord<3>( 512,  512,  512)));
-    eval(RegionUnion(), toVector(Coord<3>(2048, 2048, 2048)));
+    eval(RegionIntersect(true), toVector(Coord<3>( 128,  128,  128)));
+    eval(RegionIntersect(true), toVector(Coord<3>( 512,  512,  512)));
+    eval(RegionIntersect(true), toVector(Coord<3>(2048, 2048, 2048)));
+    eval(RegionIntersect(),     toVector(Coord<3>( 128,  128,  128)));
+    eval(RegionIntersect(),     toVector(Coord<3>( 512,  512,  512)));
+    eval(RegionIntersect(),     toVector(Coord<3>(2048, 2048, 2048)));
+
+    eval(RegionSubtract(true), toVector(Coord<3>( 128,  128,  128)));
+    eval(RegionSubtract(true), toVector(Coord<3>( 512,  512,  512)));
+    eval(RegionSubtract(true), toVector(Coord<3>(2048, 2048, 2048)));
+    eval(RegionSubtract(),     toVector(Coord<3>( 128,  128,  128)));
+    eval(RegionSubtract(),     toVector(Coord<3>( 512,  512,  512)));
+    eval(RegionSubtract(),     toVector(Coord<3>(2048, 2048, 2048)));
+
+    eval(RegionUnion(true), toVector(Coord<3>( 128,  128,  128)));
+    eval(RegionUnion(true), toVector(Coord<3>( 512,  512,  512)));
+    eval(RegionUnion(true), toVector(Coord<3>(2048, 2048, 2048)));
+    eval(RegionUnion(),     toVector(Coord<3>( 128,  128,  128)));
+    eval(RegionUnion(),     toVector(Coord<3>( 512,  512,  512)));
+    eval(RegionUnion(),     toVector(Coord<3>(2048, 2048, 2048)));
 
     eval(RegionAppend(), toVector(Coord<3>( 128,  128,  128)));
     eval(RegionAppend(), toVector(Coord<3>( 512,  512,  512)));
     eval(RegionAppend(), toVector(Coord<3>(2048, 2048, 2048)));
 
-    eval(RegionExpand(1), toVector(Coord<3>( 128,  128,  128)));
-    eval(RegionExpand(1), toVector(Coord<3>( 512,  512,  512)));
-    eval(RegionExpand(1), toVector(Coord<3>(2048, 2048, 2048)));
+    eval(RegionExpand(1, true), toVector(Coord<3>( 128,  128,  128)));
+    eval(RegionExpand(1, true), toVector(Coord<3>( 512,  512,  512)));
+    eval(RegionExpand(1, true), toVector(Coord<3>(2048, 2048, 2048)));
+    eval(RegionExpand(1),       toVector(Coord<3>( 128,  128,  128)));
+    eval(RegionExpand(1),       toVector(Coord<3>( 512,  512,  512)));
+    eval(RegionExpand(1),       toVector(Coord<3>(2048, 2048, 2048)));
 
-    eval(RegionExpand(5), toVector(Coord<3>( 128,  128,  128)));
-    eval(RegionExpand(5), toVector(Coord<3>( 512,  512,  512)));
-    eval(RegionExpand(5), toVector(Coord<3>(2048, 2048, 2048)));
+    eval(RegionExpand(5, true), toVector(Coord<3>( 128,  128,  128)));
+    eval(RegionExpand(5, true), toVector(Coord<3>( 512,  512,  512)));
+    eval(RegionExpand(5, true), toVector(Coord<3>(2048, 2048, 2048)));
+    eval(RegionExpand(5),       toVector(Coord<3>( 128,  128,  128)));
+    eval(RegionExpand(5),       toVector(Coord<3>( 512,  512,  512)));
+    eval(RegionExpand(5),       toVector(Coord<3>(2048, 2048, 2048)));
 
     {
         std::vector<int> params(4);
@@ -3037,6 +3209,9 @@ int main(int argc, char **argv)
         eval(RegionExpandWithAdjacency(cells), params);
     }
 
+    eval(VoronoiMesherFillGeometryData(), toVector(Coord<3>( 32,  32, 1)));
+    eval(VoronoiMesherFillGeometryData(), toVector(Coord<3>(128, 128, 1)));
+
     eval(CoordEnumerationVanilla(), toVector(Coord<3>( 128,  128,  128)));
     eval(CoordEnumerationVanilla(), toVector(Coord<3>( 512,  512,  512)));
     eval(CoordEnumerationVanilla(), toVector(Coord<3>(2048, 2048, 2048)));
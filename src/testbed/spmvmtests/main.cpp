@@ -34,6 +34,8 @@
 #include <immintrin.h>
 #endif
 
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
 #include <stdio.h>
@@ -116,17 +118,15 @@ public:
     template<typename HOOD_NEW, typename HOOD_OLD>
     static void updateLineX(HOOD_NEW& hoodNew, int indexEnd, HOOD_OLD& hoodOld, unsigned /* nanoStep */)
     {
-        ShortVec tmp, weights, values;
+        ShortVec tmp;
         // no loop peeler required here because we know it's only
         // going to be one Streak anyway and that will be aligned on
         // chunk boundaries.
         for (; hoodNew.index() < indexEnd; hoodNew += C, ++hoodOld) {
             tmp.load_aligned(&hoodNew->sum());
 
-            for (const auto& j: hoodOld.weights(0)) {
-                weights.load_aligned(j.second());
-                values.gather(&hoodOld->value(), j.first());
-                tmp += values * weights;
+            for (const auto& j: hoodOld.weights(0).gather(&hoodOld->value())) {
+                tmp = fma(j.values(), j.weights(), tmp);
             }
 
             tmp.store_aligned(&hoodNew->sum());
@@ -194,21 +194,23 @@ private:
 
         values.resize(nonZero);
         column.resize(nonZero);
-        rowLen.resize(dimension + 1);
+        rowLen.assign(dimension + 1, 0);
 
-        int currentRow = 0;
-        int cnt = 0;
-        rowLen[0] = 0;
+        // Matrix Market files are usually stored column by column,
+        // hence we need to bucket the entries by row:
         for (const auto& pair : matrix) {
-            if (currentRow != pair.first.x()) {
-                currentRow = pair.first.x();
-                rowLen[currentRow] = cnt;
-            }
-            values[cnt] = pair.second;
-            column[cnt] = pair.first.y();
-            ++cnt;
+            ++rowLen[pair.first.x() + 1];
+        }
+        for (int i = 0; i < dimension; ++i) {
+            rowLen[i + 1] += rowLen[i];
+        }
+
+        std::vector<int> cursor(rowLen.begin(), rowLen.end() - 1);
+        for (const auto& pair : matrix) {
+            int index = cursor[pair.first.x()]++;
+            values[index] = pair.second;
+            column[index] = pair.first.y();
         }
-        rowLen[dimension] = cnt;
     }
 
 public:
@@ -849,6 +851,225 @@ public:
 };
 #endif
 
+#ifdef __AVX__
+/**
+ * Reference kernel for the gathered neighbor iteration of
+ * UnstructuredSoANeighborhood (see SPMVMSoACell). Unlike the other
+ * SELL benchmarks this one initializes the right hand side with
+ * varying values and checks the result against the CRS baseline.
+ */
+template<typename CELL, std::string& FILENAME, int NZ, int SIGMA>
+class SparseMatrixVectorMultiplicationMMGather : public CPUBenchmark
+{
+private:
+    typedef UnstructuredSoAGrid<CELL, 1, double, C, SIGMA> Grid;
+    typedef SellCSigmaSparseMatrixContainer<double, C, SIGMA> Matrix;
+
+    void updateFunctor(const Region<1>& region, const Grid& gridOld,
+                       Grid *gridNew, unsigned nanoStep)
+    {
+        typedef LibGeoDecomp::UpdateFunctorHelpers::ConcurrencyEnableOpenMP ConcurrencySpec;
+        typedef typename APITraits::SelectThreadedUpdate<CELL>::Value ModelThreadingSpec;
+        gridOld.callback(
+            gridNew,
+            UnstructuredUpdateFunctorHelpers::UnstructuredGridSoAUpdateHelper<CELL, Grid, ConcurrencySpec, ModelThreadingSpec>(
+                gridOld, gridNew, region, nanoStep, ConcurrencySpec(true, true), ModelThreadingSpec()));
+    }
+
+public:
+    std::string family()
+    {
+        std::stringstream ss;
+        ss << "GATHER: C:" << C << " SIGMA:" << SIGMA;
+        return ss.str();
+    }
+
+    std::string species()
+    {
+        return FILENAME;
+    }
+
+    double performance(std::vector<int> rawDim)
+    {
+        Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
+
+        // 1. create grids
+        const Coord<1> size(dim.x());
+        Grid gridOld(size);
+        Grid gridNew(size);
+
+        // 2. init grid old
+        const int maxT = 1;
+        SparseMatrixInitializerMM<CELL, Grid> init(FILENAME, dim, maxT);
+        init.grid(&gridOld);
+
+        std::vector<double> rhs(dim.x());
+        for (int i = 0; i < dim.x(); ++i) {
+            rhs[i] = 1.0 + i % 7;
+            gridOld.set(Coord<1>(i), CELL(rhs[i]));
+        }
+
+        // 3. call updateFunctor()
+        double seconds = 0;
+        Region<1> region;
+        region << Streak<1>(Coord<1>(0), size.x());
+        {
+            ScopedTimer t(&seconds);
+            updateFunctor(region, gridOld, &gridNew, 0);
+        }
+
+        // 4. compare with CRS, rows in the SELL grid are permuted
+        // within each SIGMA-window:
+        CRSInitializer<double> crsInit(dim.x());
+        crsInit.init(FILENAME);
+        const double *values = crsInit.valuesVec().data();
+        const int *col = crsInit.columnVec().data();
+        const int *row = crsInit.rowLenVec().data();
+        const Matrix& matrix = gridOld.getWeights(0);
+
+        for (int i = 0; i < dim.x(); ++i) {
+            double expected = 0;
+            for (int j = row[i]; j < row[i + 1]; ++j) {
+                expected += values[j] * rhs[col[j]];
+            }
+
+            double actual = gridNew.get(Coord<1>(matrix.realRowToSortedVec()[i].second)).sum;
+            if (std::abs(actual - expected) > 1e-10 * (std::abs(expected) + 1)) {
+                LOG(FATAL, "SparseMatrixVectorMultiplicationMMGather: row " << i << " yields " << actual
+                    << ", but CRS yields " << expected);
+                throw std::logic_error("result doesn't match CRS baseline");
+            }
+        }
+
+        const double numOps = 2. * static_cast<double>(NZ);
+        const double gflops = 1.0e-9 * numOps / seconds;
+        return gflops;
+    }
+
+    std::string unit()
+    {
+        return "GFLOP/s";
+    }
+};
+#endif
+
+/**
+ * Measures the time needed to set up a SELL-C-SIGMA matrix, either
+ * from coordinate format (COO, as used by
+ * GridBase::setWeights()) or directly from compressed row storage.
+ * Parsing the file is not included in the timings.
+ */
+template<std::string& FILENAME, int SIGMA, bool FROM_CSR>
+class SellCSigmaSetupMM : public CPUBenchmark
+{
+private:
+    typedef std::vector<std::pair<Coord<2>, double> > SparseMatrix;
+
+    void readMatrix(int dimension, SparseMatrix *matrix)
+    {
+        MM_typecode matcode;
+        int M, N, nz;
+        FILE *f = fopen(FILENAME.c_str(), "r");
+        if (!f) {
+            LOG(FATAL, "SellCSigmaSetupMM failed to open file " << FILENAME);
+            throw std::logic_error("fopen() failed");
+        }
+
+        if (mm_read_banner(f, &matcode) != 0) {
+            throw std::logic_error("Could not process Matrix Market banner");
+        }
+
+        if (mm_read_mtx_crd_size(f, &M, &N, &nz) != 0) {
+            throw std::logic_error("Could not dimensions of matrix");
+        }
+
+        if (dimension != M || dimension != N) {
+            throw std::logic_error("Size mismatch");
+        }
+
+        matrix->reserve(nz);
+        for (int i = 0; i < nz; ++i) {
+            int m, n;
+            double tmp;
+            if (fscanf(f, "%d %d %lg\n", &m, &n, &tmp) != 3) {
+                throw std::logic_error("Failed to parse mtx format");
+            }
+            *matrix << std::make_pair(Coord<2>(m - 1, n - 1), tmp);
+        }
+
+        fclose(f);
+    }
+
+public:
+    std::string family()
+    {
+        std::stringstream ss;
+        ss << "SELLSetup: C:" << C << " SIGMA:" << SIGMA;
+        return ss.str();
+    }
+
+    std::string species()
+    {
+        return FILENAME + (FROM_CSR ? " CSR" : " COO");
+    }
+
+    double performance(std::vector<int> rawDim)
+    {
+        const int dimension = rawDim[0];
+        SparseMatrix matrix;
+        readMatrix(dimension, &matrix);
+
+        SellCSigmaSparseMatrixContainer<double, C, SIGMA> container(dimension);
+        double seconds = 0;
+
+        if (FROM_CSR) {
+            std::sort(
+                matrix.begin(),
+                matrix.end(),
+                [](const std::pair<Coord<2>, double>& a, const std::pair<Coord<2>, double>& b) {
+                    return a.first < b.first;
+                });
+
+            std::vector<long> rowOffsets(dimension + 1, 0);
+            std::vector<int> columns(matrix.size());
+            std::vector<double> values(matrix.size());
+            for (std::size_t i = 0; i < matrix.size(); ++i) {
+                ++rowOffsets[matrix[i].first.x() + 1];
+                columns[i] = matrix[i].first.y();
+                values[i]  = matrix[i].second;
+            }
+            for (int i = 0; i < dimension; ++i) {
+                rowOffsets[i + 1] += rowOffsets[i];
+            }
+
+            ScopedTimer t(&seconds);
+            container.initFromCSR(&rowOffsets[0], &columns[0], &values[0]);
+        } else {
+            ScopedTimer t(&seconds);
+            container.initFromMatrix(matrix);
+        }
+
+        if (container.valuesVec().size() < matrix.size()) {
+            throw std::logic_error("SELL-C-SIGMA container lost entries");
+        }
+
+        return seconds;
+    }
+
+    std::string unit()
+    {
+        return "s";
+    }
+};
+
+#define SELL_SETUP_TESTS(MATRIX)                                        \
+    do {                                                                \
+        eval(SellCSigmaSetupMM<MATRIX, 1,   false>(), toVector(Coord<3>(DIM, 1, 1))); \
+        eval(SellCSigmaSetupMM<MATRIX, 1,   true >(), toVector(Coord<3>(DIM, 1, 1))); \
+        eval(SellCSigmaSetupMM<MATRIX, 128, false>(), toVector(Coord<3>(DIM, 1, 1))); \
+        eval(SellCSigmaSetupMM<MATRIX, 128, true >(), toVector(Coord<3>(DIM, 1, 1))); \
+    } while (0)
+
 std::string RM07 = "RM07R.mtx";
 std::string KKT  = "kkt_power.mtx";
 std::string HAM  = "Hamrle3.mtx";
@@ -890,6 +1111,7 @@ int main(int argc, char **argv)
         // SPMVM_TESTS(SparseMatrixVectorMultiplicationMM, RM07);
 
 #ifdef __AVX__
+        SELL_SETUP_TESTS(RM07);
         // SPMVM_TESTS(SparseMatrixVectorMultiplicationMMNative, RM07);
         eval(SparseMatrixVectorMultiplicationMMCRS<SPMVMSoACell<1>, RM07, NZ, 1>(), toVector(Coord<3>(DIM, 1, 1)));
 #endif
@@ -908,8 +1130,11 @@ int main(int argc, char **argv)
         SPMVM_TESTS(SparseMatrixVectorMultiplicationMM, KKT);
 
 #ifdef __AVX__
+        SELL_SETUP_TESTS(KKT);
         SPMVM_TESTS(SparseMatrixVectorMultiplicationMMNative, KKT);
         eval(SparseMatrixVectorMultiplicationMMCRS<SPMVMSoACell<1>, KKT, NZ, 1>(), toVector(Coord<3>(DIM, 1, 1)));
+        eval(SparseMatrixVectorMultiplicationMMGather<SPMVMSoACell<1>,   KKT, NZ, 1>(),   toVector(Coord<3>(DIM, 1, 1)));
+        eval(SparseMatrixVectorMultiplicationMMGather<SPMVMSoACell<128>, KKT, NZ, 128>(), toVector(Coord<3>(DIM, 1, 1)));
 #endif
 
 #ifdef __MIC__
@@ -926,8 +1151,11 @@ int main(int argc, char **argv)
         SPMVM_TESTS(SparseMatrixVectorMultiplicationMM, HAM);
 
 #ifdef __AVX__
+        SELL_SETUP_TESTS(HAM);
         SPMVM_TESTS(SparseMatrixVectorMultiplicationMMNative, HAM);
         eval(SparseMatrixVectorMultiplicationMMCRS<SPMVMSoACell<1>, HAM, NZ, 1>(), toVector(Coord<3>(DIM, 1, 1)));
+        eval(SparseMatrixVectorMultiplicationMMGather<SPMVMSoACell<1>,   HAM, NZ, 1>(),   toVector(Coord<3>(DIM, 1, 1)));
+        eval(SparseMatrixVectorMultiplicationMMGather<SPMVMSoACell<128>, HAM, NZ, 128>(), toVector(Coord<3>(DIM, 1, 1)));
 #endif
 
 #ifdef __MIC__
@@ -944,8 +1172,11 @@ int main(int argc, char **argv)
         SPMVM_TESTS(SparseMatrixVectorMultiplicationMM, ML);
 
 #ifdef __AVX__
+        SELL_SETUP_TESTS(ML);
         SPMVM_TESTS(SparseMatrixVectorMultiplicationMMNative, ML);
         eval(SparseMatrixVectorMultiplicationMMCRS<SPMVMSoACell<1>, ML, NZ, 1>(), toVector(Coord<3>(DIM, 1, 1)));
+        eval(SparseMatrixVectorMultiplicationMMGather<SPMVMSoACell<1>,   ML, NZ, 1>(),   toVector(Coord<3>(DIM, 1, 1)));
+        eval(SparseMatrixVectorMultiplicationMMGather<SPMVMSoACell<128>, ML, NZ, 128>(), toVector(Coord<3>(DIM, 1, 1)));
 #endif
 
 #ifdef __MIC__